@@ -1202,6 +1202,25 @@ void MindRTBackend::RunGraph(const ActorInfo &actor_info, const VectorRef &args,
   MS_LOG(INFO) << "Status record: end run actor: " << actor_info;
 }
 
+void MindRTBackend::PrefetchInputs(const ActorInfo &actor_info, const VectorRef &args) {
+  if (real_execution_mode_ == kPynativeMode) {
+    return;
+  }
+  const auto &graph_iter = actor_to_graph_compiler_info_.find(actor_info);
+  if (graph_iter == actor_to_graph_compiler_info_.end()) {
+    MS_LOG(EXCEPTION) << "Can't find the graph compiler info.";
+  }
+  MS_EXCEPTION_IF_NULL(graph_iter->second);
+  const auto &graph_compiler_info = *(graph_iter->second);
+  if (graph_compiler_info.strategy_ != runtime::GraphExecutionStrategy::kPipeline) {
+    return;
+  }
+  const auto &actor_set = runtime::GraphScheduler::GetInstance().Fetch(actor_info);
+  MS_EXCEPTION_IF_NULL(actor_set);
+  auto input_tensors = GetRunGraphInputs(graph_compiler_info, args);
+  runtime::GraphScheduler::GetInstance().PrefetchInputs(actor_set, input_tensors);
+}
+
 BaseRef MindRTBackend::ConstructOutputByAbstract(const abstract::AbstractBasePtr &abstract,
                                                  const std::vector<tensor::TensorPtr> &output_tensors,
                                                  size_t *output_position) {
@@ -113,6 +113,8 @@ class BACKEND_EXPORT MindRTBackend : public Backend {
 
   // Run Graph in the graph mode.
   void RunGraph(const ActorInfo &actor_info, const VectorRef &args, VectorRef *outputs);
+  // Stage the inputs of the next step while the current step is running in the graph mode.
+  void PrefetchInputs(const ActorInfo &actor_info, const VectorRef &args);
   // Run single op in the PyNative mode.
   void RunOp(OpRunInfo *op_run_info, VectorRef *outputs);
 #ifdef ENABLE_DEBUGGER
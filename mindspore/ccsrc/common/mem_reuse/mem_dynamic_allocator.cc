@@ -16,6 +16,7 @@
 
 #include "common/mem_reuse/mem_dynamic_allocator.h"
 #include <string>
+#include <atomic>
 #include "include/common/utils/convert_utils.h"
 #include "utils/log_adapter.h"
 #include "utils/ms_context.h"
@@ -31,6 +32,26 @@ const size_t kMinimumAllocMem = 10 << 20;
 
 thread_local AllocatorDebugInfo DynamicMemAllocatorDebugInfo::debug_info_;
 
+namespace {
+// The thread memory caches of one thread by pool id, which are marked as exited for the trim when the thread exits.
+struct ThreadMemCacheHolder {
+  ~ThreadMemCacheHolder() {
+    for (auto &item : thread_caches_) {
+      auto &thread_cache = item.second;
+      if (thread_cache == nullptr) {
+        continue;
+      }
+      std::lock_guard<std::mutex> cache_locker(thread_cache->mutex_);
+      thread_cache->exited_ = true;
+      if (thread_cache->pool_exited_num_ != nullptr) {
+        (void)thread_cache->pool_exited_num_->fetch_add(1);
+      }
+    }
+  }
+  std::unordered_map<size_t, ThreadMemCachePtr> thread_caches_;
+};
+}  // namespace
+
 static const std::map<DynamicMemBufStatus, std::string> kBufStatusString = {
   {DynamicMemBufStatus::kMemBufIdle, "idle"},
   {DynamicMemBufStatus::kMemBufUsed, "used"},
@@ -43,42 +64,87 @@ static const std::map<AllocatorType, std::string> kAllocatorTypeString = {
   {AllocatorType::kOther, "other"},
 };
 
+DynamicMemPoolBestFit::DynamicMemPoolBestFit()
+    : persistent_mem_(std::make_shared<MemStatusManager>()), common_mem_(std::make_shared<MemStatusManager>()) {
+  static std::atomic<size_t> pool_id_counter{0};
+  pool_id_ = pool_id_counter.fetch_add(1);
+  thread_cache_enable_ = (common::GetEnv(kEnableMemThreadCacheEnv) == "1");
+}
+
 DynamicMemPoolBestFit::~DynamicMemPoolBestFit() {
+  ClearThreadCaches();
   persistent_mem_->clear();
   common_mem_->clear();
 }
 
 DeviceMemPtr DynamicMemPoolBestFit::AllocTensorMem(size_t size, bool from_persistent_mem) {
   size_t align_size = AlignMemorySize(size);
-  std::lock_guard<std::mutex> locker(mutex_);
+  // The small common memory is served by the thread memory cache first, which doesn't need the pool lock.
+  bool use_thread_cache = thread_cache_enable_ && (!from_persistent_mem) && (align_size <= kThreadCacheMaxMemSize);
+  if (use_thread_cache) {
+    auto device_addr = AllocFromThreadCache(align_size);
+    if (device_addr != nullptr) {
+      RecordMemSize(device_addr, align_size);
+      (void)thread_cache_hit_count_.fetch_add(1);
+      return device_addr;
+    }
+  }
+
+  DeviceMemPtr device_addr = nullptr;
+  {
+    std::lock_guard<std::mutex> locker(mutex_);
+    device_addr = AllocTensorMemInner(align_size, from_persistent_mem);
+    MS_LOG(DEBUG) << "Alloc memory details, name:" << DynamicMemAllocatorDebugInfo::GetDebugInfo().name_
+                  << ", address:" << device_addr << ", size:" << size
+                  << "B, total allocated mem:" << TotalMemStatistics() << "B, peak used mem:" << UsedMemPeakStatistics()
+                  << "B, in used mem:" << TotalUsedMemStatistics()
+                  << "B, total idle mem:" << (TotalMemStatistics() - TotalUsedMemStatistics()) << "B.";
+  }
+  if (use_thread_cache && (device_addr != nullptr)) {
+    RecordMemSize(device_addr, align_size);
+  }
+  return device_addr;
+}
+
+DeviceMemPtr DynamicMemPoolBestFit::AllocTensorMemInner(size_t align_size, bool from_persistent_mem) {
+  if (exited_thread_cache_num_->load() > 0) {
+    (void)TrimThreadCaches(false);
+  }
   // Find the idle memory buf by tensor size, if not find, then add new memory block and memory buf.
   DeviceMemPtr device_addr = FindIdleMemBuf(align_size, from_persistent_mem);
+  // The memory cached by the threads idle since the last trim is returned to the pool before the pool grows.
+  if ((!device_addr) && (TrimThreadCaches(true) > 0)) {
+    device_addr = FindIdleMemBuf(align_size, from_persistent_mem);
+  }
   if (!device_addr) {
     device_addr = AddMemBlockAndMemBuf(align_size, from_persistent_mem);
   }
 
+  // The memory held by the thread memory caches is returned to the pool and try again.
+  if ((!device_addr) && (FlushThreadCaches() > 0)) {
+    device_addr = FindIdleMemBuf(align_size, from_persistent_mem);
+    if (!device_addr) {
+      device_addr = AddMemBlockAndMemBuf(align_size, from_persistent_mem);
+    }
+  }
+
   // Alloc memory failed and dump the info.
   if (!device_addr) {
     DumpDynamicMemPoolDebugInfo();
     DumpDynamicMemPoolStateInfo();
   }
-
-  MS_LOG(DEBUG) << "Alloc memory details, name:" << DynamicMemAllocatorDebugInfo::GetDebugInfo().name_
-                << ", address:" << device_addr << ", size:" << size << "B, total allocated mem:" << TotalMemStatistics()
-                << "B, peak used mem:" << UsedMemPeakStatistics() << "B, in used mem:" << TotalUsedMemStatistics()
-                << "B, total idle mem:" << (TotalMemStatistics() - TotalUsedMemStatistics()) << "B.";
   return device_addr;
 }
 
 std::vector<DeviceMemPtr> DynamicMemPoolBestFit::AllocContinuousTensorMem(const std::vector<size_t> &size_list) {
   std::vector<DeviceMemPtr> device_addr_list;
   size_t total_size = std::accumulate(size_list.begin(), size_list.end(), 0);
-  // Pre-alloc the one whole piece memory.
-  auto device_addr = AllocTensorMem(total_size, false);
+  // Pre-alloc the one whole piece memory, which is split later and can't be served by the thread memory cache.
+  std::lock_guard<std::mutex> locker(mutex_);
+  auto device_addr = AllocTensorMemInner(AlignMemorySize(total_size), false);
   if (!device_addr) {
     return device_addr_list;
   }
-  std::lock_guard<std::mutex> locker(mutex_);
   // Remove the pre-alloc memory.
   auto mem_block = FindMemBlock(device_addr, common_mem_);
   if (mem_block == nullptr) {
@@ -314,7 +380,16 @@ DynamicMemBlockPtr DynamicMemPoolBestFit::FindMemBlock(const DeviceMemPtr &devic
 
 void DynamicMemPoolBestFit::FreeTensorMem(const DeviceMemPtr &device_addr) {
   MS_EXCEPTION_IF_NULL(device_addr);
+  // The memory allocated through the thread memory cache is cached in the current thread first.
+  if (thread_cache_enable_ && FreeToThreadCache(device_addr)) {
+    return;
+  }
   std::lock_guard<std::mutex> locker(mutex_);
+  FreeTensorMemInner(device_addr);
+}
+
+void DynamicMemPoolBestFit::FreeTensorMemInner(const DeviceMemPtr &device_addr) {
+  MS_EXCEPTION_IF_NULL(device_addr);
   auto fn = [this](const MemStatusManagerPtr &mem_mng, const DeviceMemPtr &device_addr) -> DynamicMemBlockPtr {
     auto mem_block = FindMemBlock(device_addr, mem_mng);
     if (mem_block != nullptr) {
@@ -416,8 +491,144 @@ void DynamicMemPoolBestFit::EraseIdleMemBuf(size_t size, const DeviceMemPtr &dev
   MS_LOG(ERROR) << "Can't find the size[" << size << "] and device address[" << device_addr << "] in the idle mem_buf.";
 }
 
+ThreadMemCache *DynamicMemPoolBestFit::GetThreadCache() {
+  // One thread may use the different pools, and the pool id is unique even if the pool is destroyed.
+  thread_local ThreadMemCacheHolder holder;
+  auto &thread_cache = holder.thread_caches_[pool_id_];
+  if (thread_cache == nullptr) {
+    thread_cache = std::make_shared<ThreadMemCache>();
+    thread_cache->pool_exited_num_ = exited_thread_cache_num_;
+    std::lock_guard<std::mutex> locker(mutex_);
+    thread_caches_.push_back(thread_cache);
+  }
+  return thread_cache.get();
+}
+
+DeviceMemPtr DynamicMemPoolBestFit::AllocFromThreadCache(size_t align_size) {
+  auto thread_cache = GetThreadCache();
+  MS_EXCEPTION_IF_NULL(thread_cache);
+  std::lock_guard<std::mutex> cache_locker(thread_cache->mutex_);
+  thread_cache->active_ = true;
+  const auto &iter = thread_cache->idle_mem_bufs_.find(align_size);
+  if ((iter == thread_cache->idle_mem_bufs_.end()) || iter->second.empty()) {
+    return nullptr;
+  }
+  auto device_addr = iter->second.back();
+  iter->second.pop_back();
+  thread_cache->total_size_ -= align_size;
+  return device_addr;
+}
+
+bool DynamicMemPoolBestFit::FreeToThreadCache(const DeviceMemPtr &device_addr) {
+  size_t align_size = 0;
+  {
+    auto &shard = mem_size_shards_[(reinterpret_cast<uintptr_t>(device_addr) / DYNAMIC_MEM_ALIGN_SIZE) %
+                                   kMemSizeShardNum];
+    std::lock_guard<std::mutex> shard_locker(shard.mutex_);
+    const auto &iter = shard.mem_sizes_.find(device_addr);
+    if (iter == shard.mem_sizes_.end()) {
+      return false;
+    }
+    align_size = iter->second;
+    (void)shard.mem_sizes_.erase(iter);
+  }
+
+  auto thread_cache = GetThreadCache();
+  MS_EXCEPTION_IF_NULL(thread_cache);
+  {
+    std::lock_guard<std::mutex> cache_locker(thread_cache->mutex_);
+    thread_cache->active_ = true;
+    auto &idle_mem_bufs = thread_cache->idle_mem_bufs_[align_size];
+    if ((idle_mem_bufs.size() < kThreadCacheMaxBufNum) &&
+        (thread_cache->total_size_ + align_size <= kThreadCacheMaxTotalSize)) {
+      idle_mem_bufs.push_back(device_addr);
+      thread_cache->total_size_ += align_size;
+      return true;
+    }
+  }
+
+  // The thread memory cache is full and the memory is returned to the pool.
+  std::lock_guard<std::mutex> locker(mutex_);
+  FreeTensorMemInner(device_addr);
+  return true;
+}
+
+void DynamicMemPoolBestFit::RecordMemSize(const DeviceMemPtr &device_addr, size_t align_size) {
+  auto &shard =
+    mem_size_shards_[(reinterpret_cast<uintptr_t>(device_addr) / DYNAMIC_MEM_ALIGN_SIZE) % kMemSizeShardNum];
+  std::lock_guard<std::mutex> shard_locker(shard.mutex_);
+  shard.mem_sizes_[device_addr] = align_size;
+}
+
+size_t DynamicMemPoolBestFit::FlushThreadCache(ThreadMemCache *thread_cache) {
+  MS_EXCEPTION_IF_NULL(thread_cache);
+  size_t flush_num = 0;
+  for (auto &idle_mem_bufs : thread_cache->idle_mem_bufs_) {
+    for (auto &device_addr : idle_mem_bufs.second) {
+      FreeTensorMemInner(device_addr);
+      ++flush_num;
+    }
+    idle_mem_bufs.second.clear();
+  }
+  thread_cache->total_size_ = 0;
+  (void)thread_cache_flush_count_.fetch_add(flush_num);
+  return flush_num;
+}
+
+size_t DynamicMemPoolBestFit::FlushThreadCaches() {
+  size_t flush_num = 0;
+  for (auto &thread_cache : thread_caches_) {
+    MS_EXCEPTION_IF_NULL(thread_cache);
+    std::lock_guard<std::mutex> cache_locker(thread_cache->mutex_);
+    flush_num += FlushThreadCache(thread_cache.get());
+  }
+  if (flush_num > 0) {
+    MS_LOG(INFO) << "Return " << flush_num << " memory bufs of the thread memory caches to the pool.";
+  }
+  return flush_num;
+}
+
+size_t DynamicMemPoolBestFit::TrimThreadCaches(bool trim_idle) {
+  if ((exited_thread_cache_num_->exchange(0) == 0) && (!trim_idle)) {
+    return 0;
+  }
+  size_t trim_num = 0;
+  for (auto iter = thread_caches_.begin(); iter != thread_caches_.end();) {
+    MS_EXCEPTION_IF_NULL(*iter);
+    bool exited = false;
+    {
+      std::lock_guard<std::mutex> cache_locker((*iter)->mutex_);
+      exited = (*iter)->exited_;
+      if (exited || (trim_idle && !(*iter)->active_)) {
+        trim_num += FlushThreadCache(iter->get());
+      }
+      (*iter)->active_ = false;
+    }
+    // Nobody else holds the cache of an exited thread, so it is released here.
+    iter = exited ? thread_caches_.erase(iter) : iter + 1;
+  }
+  if (trim_num > 0) {
+    MS_LOG(INFO) << "Return " << trim_num << " memory bufs of the exited or idle thread memory caches to the pool.";
+  }
+  return trim_num;
+}
+
+void DynamicMemPoolBestFit::ClearThreadCaches() {
+  for (auto &thread_cache : thread_caches_) {
+    MS_EXCEPTION_IF_NULL(thread_cache);
+    std::lock_guard<std::mutex> cache_locker(thread_cache->mutex_);
+    thread_cache->idle_mem_bufs_.clear();
+    thread_cache->total_size_ = 0;
+  }
+  for (auto &shard : mem_size_shards_) {
+    std::lock_guard<std::mutex> shard_locker(shard.mutex_);
+    shard.mem_sizes_.clear();
+  }
+}
+
 void DynamicMemPoolBestFit::ReleaseDeviceRes() {
   std::lock_guard<std::mutex> locker(mutex_);
+  ClearThreadCaches();
   DumpDynamicMemPoolStateInfo();
 
   auto fn = [this](const MemStatusManagerPtr &mem_mng) {
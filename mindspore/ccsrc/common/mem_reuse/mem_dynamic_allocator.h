@@ -19,12 +19,15 @@
 
 #include <memory>
 #include <map>
+#include <unordered_map>
+#include <array>
 #include <vector>
 #include <algorithm>
 #include <utility>
 #include <thread>
 #include <mutex>
 #include <string>
+#include <atomic>
 #include "utils/ms_utils.h"
 
 namespace mindspore {
@@ -44,6 +47,16 @@ static const size_t DYNAMIC_MEM_ALIGN_SIZE = 512;
 // The minimum unit size (1G) of memory block used for dynamic extend.
 static const size_t DYNAMIC_MEM_ALLOC_UNIT_SIZE = 1024 << 20;
 
+// The memory larger than the max size isn't cached in the thread memory cache.
+static const size_t kThreadCacheMaxMemSize = 1 << 20;
+// The max memory buf number of one size and the max total memory size cached by one thread.
+static const size_t kThreadCacheMaxBufNum = 32;
+static const size_t kThreadCacheMaxTotalSize = 32 << 20;
+// The shard number of the memory size map of the memory allocated through the thread memory cache.
+static const size_t kMemSizeShardNum = 16;
+// The environment variable to enable the thread memory cache.
+constexpr char kEnableMemThreadCacheEnv[] = "MS_DEV_ENABLE_MEM_THREAD_CACHE";
+
 // The Comparator of device address from small to large.
 struct DeviceAddrCmp {
   bool operator()(const DeviceMemPtr &addr1, const DeviceMemPtr &addr2) const { return addr1 < addr2; }
@@ -144,11 +157,32 @@ struct MemStatusManager {
 };
 using MemStatusManagerPtr = std::shared_ptr<MemStatusManager>;
 
+// The thread memory cache keeps the memory bufs freed by one thread by the aligned size, and the next allocation of the
+// same size in the thread is served without the pool lock. The cached memory buf is still used in the pool, and it is
+// returned to the pool when the pool memory is not enough.
+struct ThreadMemCache {
+  // Locked by the owner thread only, except the flush and the trim of pool.
+  std::mutex mutex_;
+  std::unordered_map<size_t, std::vector<DeviceMemPtr>> idle_mem_bufs_;
+  size_t total_size_{0};
+  // Whether the owner thread used the cache since the last trim of pool.
+  bool active_{false};
+  // The owner thread has exited, and the exited cache number of pool is increased for the trim.
+  bool exited_{false};
+  std::shared_ptr<std::atomic<size_t>> pool_exited_num_{nullptr};
+};
+using ThreadMemCachePtr = std::shared_ptr<ThreadMemCache>;
+
+// The aligned size of memory allocated through the thread memory cache, which is used to cache the memory when free.
+struct MemSizeShard {
+  std::mutex mutex_;
+  std::unordered_map<DeviceMemPtr, size_t> mem_sizes_;
+};
+
 // The main class of dynamic memory pool.
 class DynamicMemPoolBestFit {
  public:
-  DynamicMemPoolBestFit()
-      : persistent_mem_(std::make_shared<MemStatusManager>()), common_mem_(std::make_shared<MemStatusManager>()) {}
+  DynamicMemPoolBestFit();
   virtual ~DynamicMemPoolBestFit();
 
   // The main program entry of memory alloc.
@@ -161,6 +195,15 @@ class DynamicMemPoolBestFit {
   // Release the real device memory.
   void ReleaseDeviceRes();
 
+  // The thread memory cache is disabled by default, and it can be enabled by the environment variable. The cached
+  // memory bufs are returned to the pool before the memory alloc fails.
+  bool thread_cache_enable() const { return thread_cache_enable_; }
+  void set_thread_cache_enable(bool thread_cache_enable) { thread_cache_enable_ = thread_cache_enable; }
+  // The allocations served by the thread memory caches, and the cached memory bufs returned to the pool by the flush
+  // and the trim.
+  size_t ThreadCacheHitCount() const { return thread_cache_hit_count_.load(); }
+  size_t ThreadCacheFlushCount() const { return thread_cache_flush_count_.load(); }
+
   // Get the minimum memory unit size using for dynamic extend.
   size_t MemAllocUnitSize(bool from_persistent_mem = false) const;
   // Set the minimum memory unit size using for dynamic extend.
@@ -198,6 +241,25 @@ class DynamicMemPoolBestFit {
   virtual size_t CalMemBlockAllocSize(size_t size, bool from_persistent_mem);
 
  private:
+  // The memory alloc and free of the pool, which must be called in the lock.
+  DeviceMemPtr AllocTensorMemInner(size_t align_size, bool from_persistent_mem);
+  void FreeTensorMemInner(const DeviceMemPtr &device_addr);
+
+  // The memory alloc and free through the thread memory cache, which must be called out of the lock.
+  DeviceMemPtr AllocFromThreadCache(size_t align_size);
+  bool FreeToThreadCache(const DeviceMemPtr &device_addr);
+  ThreadMemCache *GetThreadCache();
+  void RecordMemSize(const DeviceMemPtr &device_addr, size_t align_size);
+  // Return the cached memory bufs of all threads to the pool, which must be called in the lock.
+  size_t FlushThreadCaches();
+  // Return the cached memory bufs of the exited threads to the pool and drop their caches, and also the cached memory
+  // bufs of the threads idle since the last trim if trim_idle, which must be called in the lock.
+  size_t TrimThreadCaches(bool trim_idle);
+  // Return the cached memory bufs of one thread, which must be called in the lock of pool and thread memory cache.
+  size_t FlushThreadCache(ThreadMemCache *thread_cache);
+  // Drop the cached memory bufs and the memory sizes when the device memory is released.
+  void ClearThreadCaches();
+
   // Find the idle memory buf by aligned size when memory alloc.
   DeviceMemPtr FindIdleMemBuf(size_t size, bool from_persistent_mem);
   // Add the memory block and memory buf when memory alloc not find the idle memory buf.
@@ -223,6 +285,16 @@ class DynamicMemPoolBestFit {
   // In the graph mode, the unit size set in the context will be modified through the FetchMemUnitSize function, so it
   // needs to be changed back after that
   size_t config_unit_size_{DYNAMIC_MEM_ALLOC_UNIT_SIZE};
+
+  bool thread_cache_enable_{false};
+  // The unique id of pool, which is the key of the thread memory caches in one thread.
+  size_t pool_id_{0};
+  std::vector<ThreadMemCachePtr> thread_caches_;
+  // Shared with the thread memory caches, which may outlive the pool in the exiting threads.
+  std::shared_ptr<std::atomic<size_t>> exited_thread_cache_num_{std::make_shared<std::atomic<size_t>>(0)};
+  std::atomic<size_t> thread_cache_hit_count_{0};
+  std::atomic<size_t> thread_cache_flush_count_{0};
+  std::array<MemSizeShard, kMemSizeShardNum> mem_size_shards_;
 };
 }  // namespace device
 }  // namespace mindspore
@@ -25,6 +25,7 @@
 #include <utility>
 
 #include "distributed/persistent/storage/local_file.h"
+#include "distributed/persistent/storage/incremental_file.h"
 #include "utils/log_adapter.h"
 
 namespace mindspore {
@@ -38,16 +39,20 @@ class Data {
   explicit Data(const std::shared_ptr<std::vector<T>> &data, const std::shared_ptr<std::vector<int>> &shape = nullptr)
       : data_(data), shape_(shape) {}
 
+  // The memory of Data is managed outside, such as the memory mapped from the file.
+  Data(T *external_data, size_t size, const std::shared_ptr<std::vector<int>> &shape = nullptr)
+      : data_(nullptr), shape_(shape), external_data_(external_data), external_size_(size) {}
+
   virtual ~Data() = default;
 
   // Get the memory data of Data
-  T *data() const { return data_->data(); }
+  T *data() const { return data_ != nullptr ? data_->data() : external_data_; }
 
-  // Get the mutable memory data of Data
+  // Get the mutable memory data of Data, which is nullptr for the external memory.
   std::shared_ptr<std::vector<T>> MutableData() const { return data_; }
 
   // Get the element number of Data
-  size_t size() const { return data_->size(); }
+  size_t size() const { return data_ != nullptr ? data_->size() : external_size_; }
 
   // Get the dimension information of Data.
   std::shared_ptr<std::vector<int>> shape() const { return shape_; }
@@ -58,6 +63,10 @@ class Data {
 
   // Container used to record the dimension information of Data which persists a tensor.
   std::shared_ptr<std::vector<int>> shape_;
+
+  // The external memory used when the container is not set.
+  T *external_data_{nullptr};
+  size_t external_size_{0};
 };
 
 // Implementation of the class Data to complete the function of persistence and disaster tolerance.
@@ -74,6 +83,7 @@ class PersistentData : public Data<T> {
   // Custom storage config, you can choose different configurations according to different storage forms,
   // such as using file storage by configuring the file storage path,
   // and config can be like this: std::map<std::string, std::string> config = {{kFileStoragePath, "real_path_of_dir"}};
+  // The incremental file storage is used if the config kIncrementalPersist is "true".
   void Initialize(const std::map<std::string, std::string> &storage_config);
 
   // In disaster recovery mode, memory of tensor need to be saved into disk file periodically.
@@ -93,6 +103,11 @@ class PersistentData : public Data<T> {
 
 template <typename T>
 void PersistentData<T>::Initialize(const std::map<std::string, std::string> &storage_config) {
+  auto incremental_iter = storage_config.find(storage::kIncrementalPersist);
+  if (incremental_iter != storage_config.end() && incremental_iter->second == "true") {
+    storage_ = std::make_shared<storage::IncrementalFile>(storage_config);
+    return;
+  }
   storage_ = std::make_shared<storage::LocalFile>(storage_config);
 }
 
@@ -36,6 +36,13 @@ constexpr size_t JSON_SUFFIX_LENS = 5;
 // Storage config related.
 constexpr char kFileStoragePath[] = "file_storage_path";
 constexpr char kMaxBlockLength[] = "max_block_length";
+constexpr char kIncrementalPersist[] = "incremental_persist";
+constexpr char kMaxDeltaLength[] = "max_delta_length";
+
+// Incremental file related.
+constexpr char kIncrementalBaseFile[] = "incremental_base";
+constexpr char kIncrementalDeltaFilePrefix[] = "incremental_delta_";
+constexpr char kTempFileSuffix[] = ".tmp";
 }  // namespace storage
 }  // namespace distributed
 }  // namespace mindspore
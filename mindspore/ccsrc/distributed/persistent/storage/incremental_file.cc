@@ -0,0 +1,613 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "distributed/persistent/storage/incremental_file.h"
+
+#include <dirent.h>
+#include <fcntl.h>
+#include <securec.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <iomanip>
+#include <iterator>
+#include <sstream>
+#include <utility>
+
+#include "utils/system/crc32c.h"
+#include "utils/convert_utils_base.h"
+#include "utils/log_adapter.h"
+#include "distributed/persistent/storage/constants.h"
+#include "distributed/persistent/storage/file_io_utils.h"
+
+namespace mindspore {
+namespace distributed {
+namespace storage {
+namespace {
+constexpr uint64_t kBaseFileMagic = 0x4D53424153453031;
+constexpr uint64_t kDeltaRecordMagic = 0x4D5344454C544131;
+// The sequence in the delta log file name is padded with zero, so the file names are sorted by the sequence.
+constexpr int kSequenceWidth = 20;
+// The length of rows read and written at a time when compacting the base file.
+constexpr size_t kCompactChunkLength = 64 << 20;
+// The interval to append the records again after appending failed.
+constexpr int64_t kAppendRetryIntervalMs = 1000;
+
+// The base file is composed of the header and all rows of every input in turn.
+struct BaseFileHeader {
+  uint64_t magic;
+  // The delta log files up to this sequence are compacted into this base file.
+  uint64_t sequence;
+  uint64_t input_num;
+  uint64_t row_num;
+  uint64_t row_length;
+  uint32_t crc;
+  uint32_t reserved;
+};
+
+// The delta record is composed of the header, the row indices and the rows of all inputs of every row index in turn.
+struct DeltaRecordHeader {
+  uint64_t magic;
+  uint64_t row_count;
+  uint32_t crc;
+  uint32_t reserved;
+};
+
+uint32_t Crc32c(uint32_t init_crc, const char *data, size_t size) {
+  return system::Crc32c::MakeCrc32c(init_crc, data, size);
+}
+
+bool WriteAll(int fd, const char *data, size_t size) {
+  while (size > 0) {
+    ssize_t ret = write(fd, data, size);
+    if (ret <= 0) {
+      return false;
+    }
+    data += ret;
+    size -= static_cast<size_t>(ret);
+  }
+  return true;
+}
+
+bool ReadAll(int fd, char *data, size_t size) {
+  while (size > 0) {
+    ssize_t ret = read(fd, data, size);
+    if (ret <= 0) {
+      return false;
+    }
+    data += ret;
+    size -= static_cast<size_t>(ret);
+  }
+  return true;
+}
+
+void CopyRow(char *dst, const char *src, size_t length) {
+  auto ret = memcpy_s(dst, length, src, length);
+  if (ret != EOK) {
+    MS_LOG(EXCEPTION) << "Memcpy row failed, errno[" << ret << "]";
+  }
+}
+}  // namespace
+
+IncrementalFile::IncrementalFile(const std::map<std::string, std::string> &storage_config) {
+  auto file_path_iter = storage_config.find(kFileStoragePath);
+  if (file_path_iter == storage_config.end() || file_path_iter->second.empty()) {
+    MS_LOG(EXCEPTION) << "The file storage path of incremental file is not set.";
+  }
+  file_path_ = file_path_iter->second;
+
+  auto delta_length_iter = storage_config.find(kMaxDeltaLength);
+  if (delta_length_iter != storage_config.end() && !(delta_length_iter->second).empty()) {
+    max_delta_length_ = std::stoul(delta_length_iter->second);
+  } else {
+    max_delta_length_ = DEFAULT_MAX_DELTA_LENGTH;
+  }
+
+  LoadFiles();
+  append_thread_ = std::thread(&IncrementalFile::AppendLoop, this);
+  compact_thread_ = std::thread(&IncrementalFile::CompactLoop, this);
+}
+
+IncrementalFile::~IncrementalFile() {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    running_ = false;
+  }
+  append_cv_.notify_all();
+  compact_cv_.notify_all();
+  // The pending records are appended before the appending thread exits.
+  if (append_thread_.joinable()) {
+    append_thread_.join();
+  }
+  if (compact_thread_.joinable()) {
+    compact_thread_.join();
+  }
+  if (current_fd_ >= 0) {
+    (void)close(current_fd_);
+  }
+}
+
+std::string IncrementalFile::DeltaFileName(uint64_t sequence) const {
+  std::ostringstream file_name;
+  file_name << file_path_ << "/" << kIncrementalDeltaFilePrefix << std::setw(kSequenceWidth) << std::setfill('0')
+            << sequence;
+  return file_name.str();
+}
+
+void IncrementalFile::LoadFiles() {
+  std::string base_file_name = file_path_ + "/" + kIncrementalBaseFile;
+  if (FileIOUtils::IsFileOrDirExist(base_file_name)) {
+    BaseFileHeader header{};
+    int fd = open(base_file_name.c_str(), O_RDONLY);
+    bool ret = fd >= 0 && ReadAll(fd, reinterpret_cast<char *>(&header), sizeof(header));
+    if (fd >= 0) {
+      (void)close(fd);
+    }
+    if (!ret || header.magic != kBaseFileMagic) {
+      MS_LOG(EXCEPTION) << "The base file is broken, file name: " << base_file_name;
+    }
+    input_num_ = header.input_num;
+    row_num_ = header.row_num;
+    row_length_ = header.row_length;
+    base_sequence_ = header.sequence;
+    base_file_exists_ = true;
+  }
+
+  DIR *dir = opendir(file_path_.c_str());
+  if (dir == nullptr) {
+    MS_LOG(EXCEPTION) << "The file path [" << file_path_ << "] is not exist";
+  }
+  std::string prefix = kIncrementalDeltaFilePrefix;
+  std::string temp_suffix = kTempFileSuffix;
+  uint64_t last_sequence = base_sequence_;
+  struct dirent *entry;
+  while ((entry = readdir(dir)) != nullptr) {
+    std::string file_name = entry->d_name;
+    std::string real_file_name = file_path_ + "/" + file_name;
+    // The temporary base file is left by the compaction interrupted.
+    if (file_name.length() > temp_suffix.length() &&
+        file_name.compare(file_name.length() - temp_suffix.length(), temp_suffix.length(), temp_suffix) == 0) {
+      (void)std::remove(real_file_name.c_str());
+      continue;
+    }
+    if (file_name.length() <= prefix.length() || file_name.compare(0, prefix.length(), prefix) != 0) {
+      continue;
+    }
+    uint64_t sequence = std::stoull(file_name.substr(prefix.length()));
+    // The delta log file has been compacted, but it isn't removed before the process exits.
+    if (sequence <= base_sequence_) {
+      (void)std::remove(real_file_name.c_str());
+      continue;
+    }
+    last_sequence = std::max(last_sequence, sequence);
+    sealed_sequences_.push_back(sequence);
+  }
+  (void)closedir(dir);
+
+  // The records are appended to a new delta log file after restarting, since the tail of the last one may be broken.
+  std::sort(sealed_sequences_.begin(), sealed_sequences_.end());
+  current_sequence_ = last_sequence + 1;
+  if (!sealed_sequences_.empty() && !base_file_exists_) {
+    MS_LOG(EXCEPTION) << "The delta log files exist without base file in the file path: " << file_path_;
+  }
+}
+
+void IncrementalFile::Write(const InputData &input, const DirtyInfo &dirty_info) {
+  std::vector<InputData> inputs = {input};
+  Write(inputs, dirty_info);
+}
+
+void IncrementalFile::Write(const std::vector<InputData> &inputs, const DirtyInfo &dirty_info) {
+  if (inputs.empty()) {
+    MS_LOG(EXCEPTION) << "The inputs is empty";
+  }
+  if (!base_file_exists_) {
+    WriteBaseFile(inputs);
+    return;
+  }
+
+  if (inputs.size() != input_num_) {
+    MS_LOG(EXCEPTION) << "The input number " << inputs.size() << " is not equal to the base file: " << input_num_;
+  }
+  for (const auto &input : inputs) {
+    MS_EXCEPTION_IF_NULL(std::get<1>(input));
+    if (std::get<2>(input) != row_num_ * row_length_) {
+      MS_LOG(EXCEPTION) << "The input size " << std::get<2>(input)
+                        << " is not equal to the base file: " << row_num_ * row_length_;
+    }
+  }
+
+  std::vector<int> rows;
+  (void)std::copy_if(dirty_info.begin(), dirty_info.end(), std::back_inserter(rows),
+                     [this](int row) { return row >= 0 && static_cast<size_t>(row) < row_num_; });
+  std::sort(rows.begin(), rows.end());
+  rows.erase(std::unique(rows.begin(), rows.end()), rows.end());
+  if (rows.empty()) {
+    return;
+  }
+
+  // Only the dirty rows are copied here, and the record is written to disk by the appending thread.
+  size_t indices_length = rows.size() * sizeof(int);
+  size_t row_bytes = input_num_ * row_length_;
+  std::vector<char> record(sizeof(DeltaRecordHeader) + indices_length + rows.size() * row_bytes);
+  char *indices_data = record.data() + sizeof(DeltaRecordHeader);
+  CopyRow(indices_data, reinterpret_cast<const char *>(rows.data()), indices_length);
+  char *rows_data = indices_data + indices_length;
+  for (size_t i = 0; i < rows.size(); ++i) {
+    for (size_t input_index = 0; input_index < input_num_; ++input_index) {
+      const char *input_data = reinterpret_cast<const char *>(std::get<1>(inputs[input_index]));
+      CopyRow(rows_data + (i * input_num_ + input_index) * row_length_,
+              input_data + static_cast<size_t>(rows[i]) * row_length_, row_length_);
+    }
+  }
+  DeltaRecordHeader header{kDeltaRecordMagic, rows.size(), 0, 0};
+  header.crc = Crc32c(0, indices_data, record.size() - sizeof(DeltaRecordHeader));
+  CopyRow(record.data(), reinterpret_cast<const char *>(&header), sizeof(header));
+
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    pending_records_.push_back(std::move(record));
+  }
+  append_cv_.notify_one();
+}
+
+void IncrementalFile::WriteBaseFile(const std::vector<InputData> &inputs) {
+  const std::vector<int> &shape = std::get<0>(inputs.front());
+  if (shape.empty() || shape[0] <= 0) {
+    MS_LOG(EXCEPTION) << "The dimension of input shape contain zero.";
+  }
+  size_t row_num = static_cast<size_t>(shape[0]);
+  size_t input_size = std::get<2>(inputs.front());
+  if (input_size == 0 || input_size % row_num != 0) {
+    MS_LOG(EXCEPTION) << "The size of input tensor " << input_size << " can't be divided into " << row_num << " rows.";
+  }
+  for (const auto &input : inputs) {
+    MS_EXCEPTION_IF_NULL(std::get<1>(input));
+    if (std::get<2>(input) != input_size) {
+      MS_LOG(EXCEPTION) << "The inputs of incremental file should have the same size.";
+    }
+  }
+
+  BaseFileHeader header{kBaseFileMagic, 0, inputs.size(), row_num, input_size / row_num, 0, 0};
+  for (const auto &input : inputs) {
+    header.crc = Crc32c(header.crc, reinterpret_cast<const char *>(std::get<1>(input)), input_size);
+  }
+  header.sequence = current_sequence_ - 1;
+
+  std::lock_guard<std::mutex> file_lock(file_mutex_);
+  // Write to the temporary file and rename it, so the base file is never broken.
+  std::string base_file_name = file_path_ + "/" + kIncrementalBaseFile;
+  std::string temp_file_name = base_file_name + kTempFileSuffix;
+  int fd = open(temp_file_name.c_str(), O_WRONLY | O_CREAT | O_TRUNC, S_IRUSR | S_IWUSR);
+  if (fd < 0) {
+    MS_LOG(EXCEPTION) << "Open the base file failed, file name: " << temp_file_name;
+  }
+  bool ret = WriteAll(fd, reinterpret_cast<const char *>(&header), sizeof(header));
+  for (size_t i = 0; ret && i < inputs.size(); ++i) {
+    ret = WriteAll(fd, reinterpret_cast<const char *>(std::get<1>(inputs[i])), input_size);
+  }
+  ret = ret && fsync(fd) == 0;
+  (void)close(fd);
+  if (!ret || std::rename(temp_file_name.c_str(), base_file_name.c_str()) != 0) {
+    MS_LOG(EXCEPTION) << "Write the base file failed, file name: " << base_file_name;
+  }
+
+  input_num_ = header.input_num;
+  row_num_ = header.row_num;
+  row_length_ = header.row_length;
+  base_sequence_ = header.sequence;
+  base_file_exists_ = true;
+}
+
+void IncrementalFile::Read(const OutputData &output) {
+  std::vector<OutputData> outputs = {output};
+  Read(outputs);
+}
+
+void IncrementalFile::Read(const std::vector<OutputData> &outputs) {
+  uint64_t current_sequence = 0;
+  {
+    std::unique_lock<std::mutex> lock(mutex_);
+    flush_cv_.wait(lock, [this] { return pending_records_.empty() && !appending_; });
+    current_sequence = current_sequence_;
+  }
+
+  std::lock_guard<std::mutex> file_lock(file_mutex_);
+  if (!base_file_exists_) {
+    MS_LOG(EXCEPTION) << "The base file doesn't exist in the file path: " << file_path_;
+  }
+  ReadBaseFile(outputs);
+  for (uint64_t sequence = base_sequence_ + 1; sequence <= current_sequence; ++sequence) {
+    ReplayDeltaFile(sequence, [this, &outputs](int row, const char *row_data) {
+      for (size_t input_index = 0; input_index < input_num_; ++input_index) {
+        char *output_data = reinterpret_cast<char *>(outputs[input_index].first);
+        CopyRow(output_data + static_cast<size_t>(row) * row_length_, row_data + input_index * row_length_,
+                row_length_);
+      }
+    });
+  }
+}
+
+void IncrementalFile::ReadBaseFile(const std::vector<OutputData> &outputs) const {
+  if (outputs.size() != input_num_) {
+    MS_LOG(EXCEPTION) << "The output number " << outputs.size() << " is not equal to the base file: " << input_num_;
+  }
+  size_t input_size = row_num_ * row_length_;
+  for (const auto &output : outputs) {
+    MS_EXCEPTION_IF_NULL(output.first);
+    if (output.second != input_size) {
+      MS_LOG(EXCEPTION) << "The output size " << output.second << " is not equal to the base file: " << input_size;
+    }
+  }
+
+  std::string base_file_name = file_path_ + "/" + kIncrementalBaseFile;
+  int fd = open(base_file_name.c_str(), O_RDONLY);
+  if (fd < 0) {
+    MS_LOG(EXCEPTION) << "Open the base file failed, file name: " << base_file_name;
+  }
+  BaseFileHeader header{};
+  bool ret = ReadAll(fd, reinterpret_cast<char *>(&header), sizeof(header));
+  uint32_t crc = 0;
+  for (size_t i = 0; ret && i < outputs.size(); ++i) {
+    char *output_data = reinterpret_cast<char *>(outputs[i].first);
+    ret = ReadAll(fd, output_data, input_size);
+    crc = Crc32c(crc, output_data, input_size);
+  }
+  (void)close(fd);
+  if (!ret) {
+    MS_LOG(EXCEPTION) << "Read the base file failed, file name: " << base_file_name;
+  }
+  if (header.magic != kBaseFileMagic || header.crc != crc) {
+    MS_LOG(EXCEPTION) << "The base file has been modified, file name: " << base_file_name;
+  }
+}
+
+template <typename Func>
+void IncrementalFile::ReplayDeltaFile(uint64_t sequence, const Func &apply_row) const {
+  std::string file_name = DeltaFileName(sequence);
+  int fd = open(file_name.c_str(), O_RDONLY);
+  if (fd < 0) {
+    return;
+  }
+  size_t row_bytes = input_num_ * row_length_;
+  size_t offset = 0;
+  std::vector<char> payload;
+  DeltaRecordHeader header{};
+  while (ReadAll(fd, reinterpret_cast<char *>(&header), sizeof(header))) {
+    bool valid = header.magic == kDeltaRecordMagic && header.row_count > 0 && header.row_count <= row_num_;
+    if (valid) {
+      size_t indices_length = header.row_count * sizeof(int);
+      payload.resize(indices_length + header.row_count * row_bytes);
+      valid = ReadAll(fd, payload.data(), payload.size()) && Crc32c(0, payload.data(), payload.size()) == header.crc;
+    }
+    if (!valid) {
+      MS_LOG(WARNING) << "The delta record at offset " << offset << " of file " << file_name
+                      << " is broken, the following records are dropped.";
+      break;
+    }
+
+    const int *rows = reinterpret_cast<const int *>(payload.data());
+    const char *rows_data = payload.data() + header.row_count * sizeof(int);
+    for (size_t i = 0; i < header.row_count; ++i) {
+      if (rows[i] >= 0 && static_cast<size_t>(rows[i]) < row_num_) {
+        apply_row(rows[i], rows_data + i * row_bytes);
+      }
+    }
+    offset += sizeof(header) + payload.size();
+  }
+  (void)close(fd);
+}
+
+void IncrementalFile::AppendLoop() {
+  bool retry = false;
+  while (true) {
+    std::vector<std::vector<char>> records;
+    {
+      std::unique_lock<std::mutex> lock(mutex_);
+      if (retry) {
+        auto retry_interval = std::chrono::milliseconds(kAppendRetryIntervalMs);
+        (void)append_cv_.wait_for(lock, retry_interval, [this] { return !running_; });
+      } else {
+        append_cv_.wait(lock, [this] { return !running_ || !pending_records_.empty(); });
+      }
+      if (pending_records_.empty()) {
+        return;
+      }
+      records.swap(pending_records_);
+      appending_ = true;
+    }
+    retry = !AppendRecords(records);
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      if (retry && running_) {
+        // The rows of the records are not dirty for the caller any more, so the records are kept in front of the
+        // records written later and appended again.
+        (void)pending_records_.insert(pending_records_.begin(), std::make_move_iterator(records.begin()),
+                                      std::make_move_iterator(records.end()));
+      } else if (retry) {
+        MS_LOG(ERROR) << "The storage is destroyed, " << records.size() << " records failed to append are dropped.";
+      }
+      appending_ = false;
+    }
+    flush_cv_.notify_all();
+  }
+}
+
+bool IncrementalFile::AppendRecords(const std::vector<std::vector<char>> &records) {
+  std::string file_name = DeltaFileName(current_sequence_);
+  if (current_fd_ < 0) {
+    current_fd_ = open(file_name.c_str(), O_WRONLY | O_CREAT | O_APPEND, S_IRUSR | S_IWUSR);
+    if (current_fd_ < 0) {
+      MS_LOG(ERROR) << "Open the delta log file failed, file name: " << file_name << ", " << records.size()
+                    << " records will be appended again.";
+      return false;
+    }
+    current_length_ = 0;
+  }
+
+  size_t length = current_length_;
+  bool ret = true;
+  for (const auto &record : records) {
+    ret = WriteAll(current_fd_, record.data(), record.size());
+    if (!ret) {
+      break;
+    }
+    length += record.size();
+  }
+  ret = ret && fdatasync(current_fd_) == 0;
+  if (!ret) {
+    // Drop the record written partially, so the following records can be replayed.
+    MS_LOG(ERROR) << "Append to the delta log file failed, file name: " << file_name << ", " << records.size()
+                  << " records will be appended again.";
+    (void)ftruncate(current_fd_, static_cast<off_t>(current_length_));
+    return false;
+  }
+  current_length_ = length;
+  if (current_length_ < max_delta_length_) {
+    return true;
+  }
+
+  (void)close(current_fd_);
+  current_fd_ = -1;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    sealed_sequences_.push_back(current_sequence_);
+    ++current_sequence_;
+  }
+  compact_cv_.notify_one();
+  return true;
+}
+
+void IncrementalFile::CompactLoop() {
+  while (true) {
+    uint64_t last_sequence = 0;
+    {
+      std::unique_lock<std::mutex> lock(mutex_);
+      compact_cv_.wait(lock, [this] { return !running_ || !sealed_sequences_.empty(); });
+      if (!running_) {
+        return;
+      }
+      last_sequence = sealed_sequences_.back();
+      compacting_ = true;
+    }
+    if (!Compact(last_sequence)) {
+      MS_LOG(ERROR) << "Compact the delta log files up to " << DeltaFileName(last_sequence) << " failed.";
+    }
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      (void)sealed_sequences_.erase(
+        sealed_sequences_.begin(),
+        std::upper_bound(sealed_sequences_.begin(), sealed_sequences_.end(), last_sequence));
+      compacting_ = false;
+    }
+    flush_cv_.notify_all();
+  }
+}
+
+bool IncrementalFile::Compact(uint64_t last_sequence) {
+  std::lock_guard<std::mutex> file_lock(file_mutex_);
+  if (!base_file_exists_ || last_sequence <= base_sequence_) {
+    return true;
+  }
+
+  // Collect the latest rows in the delta log files, whose size is limited by the maximum length of delta log files.
+  size_t row_bytes = input_num_ * row_length_;
+  std::map<int, size_t> row_offsets;
+  std::vector<char> latest_rows;
+  for (uint64_t sequence = base_sequence_ + 1; sequence <= last_sequence; ++sequence) {
+    ReplayDeltaFile(sequence, [&row_offsets, &latest_rows, row_bytes](int row, const char *row_data) {
+      auto iter = row_offsets.find(row);
+      if (iter == row_offsets.end()) {
+        iter = row_offsets.emplace(row, latest_rows.size()).first;
+        latest_rows.resize(latest_rows.size() + row_bytes);
+      }
+      CopyRow(latest_rows.data() + iter->second, row_data, row_bytes);
+    });
+  }
+
+  std::string base_file_name = file_path_ + "/" + kIncrementalBaseFile;
+  std::string temp_file_name = base_file_name + kTempFileSuffix;
+  int base_fd = open(base_file_name.c_str(), O_RDONLY);
+  int temp_fd = open(temp_file_name.c_str(), O_WRONLY | O_CREAT | O_TRUNC, S_IRUSR | S_IWUSR);
+  BaseFileHeader header{};
+  bool ret = base_fd >= 0 && temp_fd >= 0 && ReadAll(base_fd, reinterpret_cast<char *>(&header), sizeof(header)) &&
+             WriteAll(temp_fd, reinterpret_cast<const char *>(&header), sizeof(header));
+
+  // Patch the rows of the base file chunk by chunk, and check the integrity of the old base file at the same time.
+  size_t chunk_rows = std::max(kCompactChunkLength / row_length_, static_cast<size_t>(1));
+  std::vector<char> chunk(std::min(chunk_rows, row_num_) * row_length_);
+  uint32_t old_crc = 0;
+  uint32_t new_crc = 0;
+  for (size_t input_index = 0; ret && input_index < input_num_; ++input_index) {
+    for (size_t begin = 0; ret && begin < row_num_; begin += chunk_rows) {
+      size_t end = std::min(begin + chunk_rows, row_num_);
+      size_t length = (end - begin) * row_length_;
+      ret = ReadAll(base_fd, chunk.data(), length);
+      if (!ret) {
+        break;
+      }
+      old_crc = Crc32c(old_crc, chunk.data(), length);
+      for (auto iter = row_offsets.lower_bound(SizeToInt(begin)); iter != row_offsets.end(); ++iter) {
+        size_t row = static_cast<size_t>(iter->first);
+        if (row >= end) {
+          break;
+        }
+        CopyRow(chunk.data() + (row - begin) * row_length_,
+                latest_rows.data() + iter->second + input_index * row_length_, row_length_);
+      }
+      new_crc = Crc32c(new_crc, chunk.data(), length);
+      ret = WriteAll(temp_fd, chunk.data(), length);
+    }
+  }
+  if (ret && old_crc != header.crc) {
+    MS_LOG(ERROR) << "The base file has been modified, file name: " << base_file_name;
+    ret = false;
+  }
+  if (ret) {
+    header.sequence = last_sequence;
+    header.crc = new_crc;
+    ret = pwrite(temp_fd, &header, sizeof(header), 0) == static_cast<ssize_t>(sizeof(header)) && fsync(temp_fd) == 0;
+  }
+  if (base_fd >= 0) {
+    (void)close(base_fd);
+  }
+  if (temp_fd >= 0) {
+    (void)close(temp_fd);
+  }
+  if (!ret || std::rename(temp_file_name.c_str(), base_file_name.c_str()) != 0) {
+    (void)std::remove(temp_file_name.c_str());
+    return false;
+  }
+
+  for (uint64_t sequence = base_sequence_ + 1; sequence <= last_sequence; ++sequence) {
+    (void)std::remove(DeltaFileName(sequence).c_str());
+  }
+  base_sequence_ = last_sequence;
+  MS_LOG(INFO) << "Compact " << row_offsets.size() << " rows into the base file, file name: " << base_file_name;
+  return true;
+}
+
+void IncrementalFile::Flush() {
+  std::unique_lock<std::mutex> lock(mutex_);
+  flush_cv_.wait(lock, [this] {
+    return pending_records_.empty() && !appending_ && sealed_sequences_.empty() && !compacting_;
+  });
+}
+}  // namespace storage
+}  // namespace distributed
+}  // namespace mindspore
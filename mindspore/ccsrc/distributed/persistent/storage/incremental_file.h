@@ -0,0 +1,129 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef MINDSPORE_CCSRC_DISTRIBUTED_PERSISTENT_STORAGE_INCREMENTAL_FILE_H_
+#define MINDSPORE_CCSRC_DISTRIBUTED_PERSISTENT_STORAGE_INCREMENTAL_FILE_H_
+
+#include <condition_variable>
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "distributed/persistent/storage/storage.h"
+
+namespace mindspore {
+namespace distributed {
+namespace storage {
+// The default maximum length of one delta log file, the full delta log files are compacted into the base file: 1GB.
+constexpr size_t DEFAULT_MAX_DELTA_LENGTH = 1UL << 30;
+
+// Incremental file type persistence storage implementation class.
+// The first write saves the entire data as the base file. The following writes only copy the dirty rows into one
+// record, and the record is appended to the delta log file by the background appending thread, so the caller is only
+// blocked by copying the dirty rows instead of rewriting and hashing the whole blocks. When a delta log file exceeds
+// the maximum length, it is sealed and compacted into a new base file by the compacting thread. The read loads the base
+// file and replays the records of the delta log files which are not compacted yet.
+class IncrementalFile : public StorageBase {
+ public:
+  explicit IncrementalFile(const std::map<std::string, std::string> &storage_config);
+  ~IncrementalFile() override;
+
+  // Write the entire data as the base file at the first time, and append the dirty rows to the delta log after that.
+  void Write(const InputData &input, const DirtyInfo &dirty_info) override;
+  // All the inputs have the same shape, and the rows of all inputs in dirty info are appended in one record.
+  void Write(const std::vector<InputData> &inputs, const DirtyInfo &dirty_info) override;
+
+  // Read the base file and replay the delta logs.
+  void Read(const OutputData &output) override;
+  void Read(const std::vector<OutputData> &outputs) override;
+
+  // Wait until all the records written before are appended and the sealed delta log files are compacted, the records
+  // failed to append are retried until appended.
+  void Flush();
+
+ private:
+  // Load the layout of the base file and the delta log files existing in the file path, which are written before the
+  // process restarts.
+  void LoadFiles();
+
+  // Write the entire inputs to the base file.
+  void WriteBaseFile(const std::vector<InputData> &inputs);
+
+  // Read the base file and check the integrity.
+  void ReadBaseFile(const std::vector<OutputData> &outputs) const;
+
+  // Replay the records of one delta log file by the function, stop at the first broken record which is the tail
+  // written partially when the process exits.
+  template <typename Func>
+  void ReplayDeltaFile(uint64_t sequence, const Func &apply_row) const;
+
+  // Compact the base file and the delta log files up to the sequence into a new base file, the files are kept and
+  // compacted next time if it fails.
+  bool Compact(uint64_t last_sequence);
+
+  // Append one batch of records to the current delta log file, and seal the file if it is full. Return false if the
+  // records are not appended, and they are appended again by the appending thread later.
+  bool AppendRecords(const std::vector<std::vector<char>> &records);
+
+  void AppendLoop();
+  void CompactLoop();
+
+  std::string DeltaFileName(uint64_t sequence) const;
+
+  // Folder path to save the base file and the delta log files.
+  std::string file_path_;
+
+  // Maximum size of each delta log file.
+  size_t max_delta_length_;
+
+  // The layout of data, each row of each input occupies row_length_ bytes.
+  size_t input_num_{0};
+  size_t row_num_{0};
+  size_t row_length_{0};
+  bool base_file_exists_{false};
+
+  // The delta log files whose sequences are not greater than the base sequence are compacted into the base file.
+  uint64_t base_sequence_{0};
+
+  // The current delta log file appended by the appending thread.
+  uint64_t current_sequence_{1};
+  int current_fd_{-1};
+  size_t current_length_{0};
+
+  std::mutex mutex_;
+  std::condition_variable append_cv_;
+  std::condition_variable compact_cv_;
+  std::condition_variable flush_cv_;
+  std::vector<std::vector<char>> pending_records_;
+  std::vector<uint64_t> sealed_sequences_;
+  bool appending_{false};
+  bool compacting_{false};
+  bool running_{true};
+
+  // Protects the base file and delta log files from being replaced by compaction during reading.
+  std::mutex file_mutex_;
+
+  std::thread append_thread_;
+  std::thread compact_thread_;
+};
+}  // namespace storage
+}  // namespace distributed
+}  // namespace mindspore
+
+#endif  // MINDSPORE_CCSRC_DISTRIBUTED_PERSISTENT_STORAGE_INCREMENTAL_FILE_H_
@@ -74,10 +74,23 @@ bool Executor::HandleModelUpdate(const std::string &param_name, const UploadData
     return true;
   }
 
-  std::mutex &mtx = parameter_mutex_[param_name];
-  std::unique_lock<std::mutex> lock(mtx);
   auto &param_aggr = param_aggrs_[param_name];
   MS_ERROR_IF_NULL_W_RET_VAL(param_aggr, false);
+  // The streaming aggregation kernels accumulate the uploaded data concurrently, so the uploads of the same parameter
+  // share the parameter lock and the uploaded data isn't copied into the kernel inputs. The shared lock still excludes
+  // the other handlers like HandlePushWeight, which overwrite or read the weight under the exclusive lock.
+  if (param_aggr->SupportStreaming()) {
+    std::shared_mutex &mtx = parameter_mutex_[param_name];
+    std::shared_lock<std::shared_mutex> lock(mtx);
+    if (!param_aggr->StreamAggregators(upload_data)) {
+      MS_LOG(ERROR) << "Streaming aggregators for parameter " << param_name << " failed.";
+      return false;
+    }
+    return true;
+  }
+
+  std::shared_mutex &mtx = parameter_mutex_[param_name];
+  std::unique_lock<std::shared_mutex> lock(mtx);
   if (!param_aggr->UpdateData(upload_data)) {
     MS_LOG(ERROR) << "Updating data for parameter " << param_name << " failed.";
     return false;
@@ -98,8 +111,8 @@ bool Executor::HandlePushWeight(const std::map<std::string, Address> &feature_ma
       continue;
     }
 
-    std::mutex &mtx = parameter_mutex_[param_name];
-    std::unique_lock<std::mutex> lock(mtx);
+    std::shared_mutex &mtx = parameter_mutex_[param_name];
+    std::unique_lock<std::shared_mutex> lock(mtx);
     auto &param_aggr = param_aggrs_[param_name];
     MS_ERROR_IF_NULL_W_RET_VAL(param_aggr, false);
     AddressPtr old_weight = param_aggr->GetWeight();
@@ -124,8 +137,8 @@ std::map<std::string, AddressPtr> Executor::HandlePullWeight(const std::vector<s
       return weights;
     }
 
-    std::mutex &mtx = parameter_mutex_[param_name];
-    std::unique_lock<std::mutex> lock(mtx);
+    std::shared_mutex &mtx = parameter_mutex_[param_name];
+    std::unique_lock<std::shared_mutex> lock(mtx);
     const auto &param_aggr = param_aggrs_[param_name];
     MS_ERROR_IF_NULL_W_RET_VAL(param_aggr, weights);
     AddressPtr addr = param_aggr->GetWeight();
@@ -146,8 +159,8 @@ bool Executor::RunAllWeightAggregation() {
       MS_LOG(ERROR) << "Weight " << name << " is invalid in server.";
       return false;
     }
-    std::mutex &mtx = parameter_mutex_[name];
-    std::unique_lock<std::mutex> lock(mtx);
+    std::shared_mutex &mtx = parameter_mutex_[name];
+    std::unique_lock<std::shared_mutex> lock(mtx);
     auto &param_aggr = param_aggrs_[name];
     MS_ERROR_IF_NULL_W_RET_VAL(param_aggr, false);
     if (!param_aggr->requires_aggr()) {
@@ -168,8 +181,8 @@ bool Executor::IsWeightAggrDone(const std::vector<std::string> &param_names) {
       return false;
     }
 
-    std::mutex &mtx = parameter_mutex_[name];
-    std::unique_lock<std::mutex> lock(mtx);
+    std::shared_mutex &mtx = parameter_mutex_[name];
+    std::unique_lock<std::shared_mutex> lock(mtx);
     auto &param_aggr = param_aggrs_[name];
     MS_ERROR_IF_NULL_W_RET_VAL(param_aggr, false);
     if (!param_aggr->requires_aggr()) {
@@ -185,8 +198,8 @@ bool Executor::IsWeightAggrDone(const std::vector<std::string> &param_names) {
 
 void Executor::ResetAggregationStatus() {
   for (const auto &param_name : param_names_) {
-    std::mutex &mtx = parameter_mutex_[param_name];
-    std::unique_lock<std::mutex> lock(mtx);
+    std::shared_mutex &mtx = parameter_mutex_[param_name];
+    std::unique_lock<std::shared_mutex> lock(mtx);
     auto &param_aggr = param_aggrs_[param_name];
     MS_ERROR_IF_NULL_WO_RET_VAL(param_aggr);
     param_aggr->ResetAggregationStatus();
@@ -197,8 +210,8 @@ void Executor::ResetAggregationStatus() {
 std::map<std::string, AddressPtr> Executor::GetModel() {
   std::map<std::string, AddressPtr> model = {};
   for (const auto &name : param_names_) {
-    std::mutex &mtx = parameter_mutex_[name];
-    std::unique_lock<std::mutex> lock(mtx);
+    std::shared_mutex &mtx = parameter_mutex_[name];
+    std::unique_lock<std::shared_mutex> lock(mtx);
     AddressPtr addr = param_aggrs_[name]->GetWeight();
     if (addr == nullptr) {
       MS_LOG(WARNING) << "Get weight of " << name << " failed.";
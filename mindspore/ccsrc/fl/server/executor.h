@@ -23,6 +23,7 @@
 #include <string>
 #include <vector>
 #include <mutex>
+#include <shared_mutex>
 #include <condition_variable>
 #ifdef ENABLE_ARMOUR
 #include "fl/armour/cipher/cipher_unmask.h"
@@ -115,8 +116,8 @@ class Executor {
   std::mutex model_mutex_;
 
   // Because ParameterAggregator is not threadsafe, we have to create mutex for each ParameterAggregator so we can
-  // acquire lock before calling its method.
-  std::map<std::string, std::mutex> parameter_mutex_;
+  // acquire lock before calling its method. Only the streaming accumulation of the uploads shares the lock.
+  std::map<std::string, std::shared_mutex> parameter_mutex_;
 
 #ifdef ENABLE_ARMOUR
   armour::CipherUnmask cipher_unmask_;
@@ -17,6 +17,7 @@
 #ifndef MINDSPORE_CCSRC_FL_SERVER_KERNEL_AGGREGATION_KERNEL_H_
 #define MINDSPORE_CCSRC_FL_SERVER_KERNEL_AGGREGATION_KERNEL_H_
 
+#include <map>
 #include <memory>
 #include <string>
 #include <vector>
@@ -67,6 +68,13 @@ class AggregationKernelMod : public DeprecatedNativeCpuKernelMod {
 
   virtual bool ReInitForUpdatingHyperParams(size_t) { return true; }
 
+  // Whether the kernel accumulates the uploaded data directly in a thread safe way, so the uploads are aggregated
+  // concurrently without copying them into the kernel inputs under the lock of the parameter.
+  virtual bool SupportStreaming() const { return false; }
+
+  // Accumulate the uploaded data, whose keys are the input names of the kernel, for the streaming kernel.
+  virtual bool Accumulate(const std::map<std::string, Address> &) { return false; }
+
   // Setter and getter of kernels parameters information.
   void set_params_info(const ParamsInfo &params_info) { params_info_ = params_info; }
   const std::vector<std::string> &input_names() const { return params_info_.inputs_names(); }
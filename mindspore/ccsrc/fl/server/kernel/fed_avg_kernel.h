@@ -17,8 +17,11 @@
 #ifndef MINDSPORE_CCSRC_FL_SERVER_KERNEL_FED_AVG_KERNEL_H_
 #define MINDSPORE_CCSRC_FL_SERVER_KERNEL_FED_AVG_KERNEL_H_
 
+#include <map>
 #include <memory>
+#include <shared_mutex>
 #include <string>
+#include <type_traits>
 #include <utility>
 #include <vector>
 #include <functional>
@@ -29,6 +32,7 @@
 #include "fl/server/local_meta_store.h"
 #include "fl/server/kernel/aggregation_kernel.h"
 #include "fl/server/kernel/aggregation_kernel_factory.h"
+#include "fl/server/kernel/streaming_aggregator.h"
 
 namespace mindspore {
 namespace fl {
@@ -88,7 +92,7 @@ class FedAvgKernel : public AggregationKernelMod {
   }
 
   bool AllReduce() override {
-    std::unique_lock<std::mutex> lock(weight_mutex_);
+    std::unique_lock<std::shared_mutex> lock(weight_mutex_);
     MS_ERROR_IF_NULL_W_RET_VAL(weight_addr_, false);
     MS_ERROR_IF_NULL_W_RET_VAL(data_size_addr_, false);
     MS_ERROR_IF_NULL_W_RET_VAL(weight_addr_->addr, false);
@@ -109,8 +113,12 @@ class FedAvgKernel : public AggregationKernelMod {
       return false;
     }
     LocalMetaStore::GetInstance().put_value(kCtxFedAvgTotalDataSize, data_size_addr[0]);
-    for (size_t i = 0; i < weight_size / sizeof(T); i++) {
-      weight_addr[i] /= data_size_addr[0];
+    if constexpr (std::is_same<T, float>::value) {
+      aggregator_.Divide(static_cast<float>(data_size_addr[0]));
+    } else {
+      for (size_t i = 0; i < weight_size / sizeof(T); i++) {
+        weight_addr[i] /= data_size_addr[0];
+      }
     }
     done_ = true;
     return true;
@@ -126,32 +134,33 @@ class FedAvgKernel : public AggregationKernelMod {
       MS_ERROR_IF_NULL_W_RET_VAL(inputs[i]->addr, false);
     }
 
-    std::unique_lock<std::mutex> lock(weight_mutex_);
-    if (done_) {
-      MS_LOG(INFO) << "AllReduce for " << name_ << " has finished";
-      return true;
-    }
     // The weight and new_weight values should be multiplied by clients already, so we don't need to do multiplication
     // again.
-    T *weight_addr = reinterpret_cast<T *>(inputs[0]->addr);
-    S *data_size_addr = reinterpret_cast<S *>(inputs[1]->addr);
-    T *new_weight_addr = reinterpret_cast<T *>(inputs[2]->addr);
-    S *new_data_size_addr = reinterpret_cast<S *>(inputs[3]->addr);
+    return AccumulateWeight(inputs[2]->addr, inputs[2]->size, reinterpret_cast<S *>(inputs[3]->addr)[0]);
+  }
 
-    MS_LOG(DEBUG) << "Iteration: " << LocalMetaStore::GetInstance().curr_iter_num() << " launching FedAvgKernel for "
-                  << name_ << " new data size is " << new_data_size_addr[0] << ", current total data size is "
-                  << data_size_addr[0];
-    for (size_t i = 0; i < inputs[2]->size / sizeof(T); i++) {
-      weight_addr[i] += new_weight_addr[i];
-    }
-    data_size_addr[0] += new_data_size_addr[0];
-    lock.unlock();
+  bool SupportStreaming() const override { return std::is_same<T, float>::value; }
 
-    accum_count_++;
-    return true;
+  bool Accumulate(const std::map<std::string, Address> &new_data) override {
+    auto new_weight_iter = new_data.find(kNewWeight);
+    auto new_data_size_iter = new_data.find(kNewDataSize);
+    if (new_weight_iter == new_data.end() || new_data_size_iter == new_data.end()) {
+      MS_LOG(ERROR) << "The uploaded data of " << name_ << " should contain new_weight and new_data_size.";
+      return false;
+    }
+    MS_ERROR_IF_NULL_W_RET_VAL(new_weight_iter->second.addr, false);
+    MS_ERROR_IF_NULL_W_RET_VAL(new_data_size_iter->second.addr, false);
+    if (new_data_size_iter->second.size != sizeof(S)) {
+      MS_LOG(ERROR) << "The size of new_data_size is " << new_data_size_iter->second.size << ", but expected "
+                    << sizeof(S);
+      return false;
+    }
+    return AccumulateWeight(new_weight_iter->second.addr, new_weight_iter->second.size,
+                            reinterpret_cast<const S *>(new_data_size_iter->second.addr)[0]);
   }
 
   void Reset() override {
+    std::unique_lock<std::shared_mutex> lock(weight_mutex_);
     accum_count_ = 0;
     done_ = false;
     ClearWeightAndDataSize();
@@ -165,6 +174,10 @@ class FedAvgKernel : public AggregationKernelMod {
     data_size_addr_ = inputs[1];
     new_weight_addr_ = inputs[2];
     new_data_size_addr_ = inputs[3];
+    MS_ERROR_IF_NULL_WO_RET_VAL(weight_addr_);
+    if constexpr (std::is_same<T, float>::value) {
+      aggregator_.Init(reinterpret_cast<T *>(weight_addr_->addr), weight_addr_->size / sizeof(T));
+    }
     return;
   }
   bool ReInitForUpdatingHyperParams(size_t aggr_threshold) override {
@@ -173,6 +186,42 @@ class FedAvgKernel : public AggregationKernelMod {
   }
 
  private:
+  // Accumulate one uploaded weight. The uploads are accumulated concurrently by the streaming aggregator chunk by
+  // chunk, and they are exclusive with all-reduce and reset.
+  bool AccumulateWeight(const void *new_weight, size_t new_weight_size, S new_data_size) {
+    std::shared_lock<std::shared_mutex> lock(weight_mutex_);
+    if (done_) {
+      MS_LOG(INFO) << "AllReduce for " << name_ << " has finished";
+      return true;
+    }
+    MS_ERROR_IF_NULL_W_RET_VAL(weight_addr_, false);
+    MS_ERROR_IF_NULL_W_RET_VAL(weight_addr_->addr, false);
+    MS_ERROR_IF_NULL_W_RET_VAL(data_size_addr_, false);
+    MS_ERROR_IF_NULL_W_RET_VAL(data_size_addr_->addr, false);
+    if constexpr (std::is_same<T, float>::value) {
+      if (!aggregator_.Accumulate(reinterpret_cast<const T *>(new_weight), new_weight_size / sizeof(T))) {
+        MS_LOG(ERROR) << "Accumulating the weight of " << name_ << " failed.";
+        return false;
+      }
+    } else {
+      std::unique_lock<std::mutex> weight_lock(data_size_mutex_);
+      T *weight_addr = reinterpret_cast<T *>(weight_addr_->addr);
+      const T *new_weight_addr = reinterpret_cast<const T *>(new_weight);
+      for (size_t i = 0; i < new_weight_size / sizeof(T); i++) {
+        weight_addr[i] += new_weight_addr[i];
+      }
+    }
+
+    std::unique_lock<std::mutex> data_size_lock(data_size_mutex_);
+    S *data_size_addr = reinterpret_cast<S *>(data_size_addr_->addr);
+    MS_LOG(DEBUG) << "Iteration: " << LocalMetaStore::GetInstance().curr_iter_num() << " launching FedAvgKernel for "
+                  << name_ << " new data size is " << new_data_size << ", current total data size is "
+                  << data_size_addr[0];
+    data_size_addr[0] += new_data_size;
+    accum_count_++;
+    return true;
+  }
+
   void GenerateReuseKernelNodeInfo() override {
     MS_LOG(INFO) << "FedAvg reuse 'weight' of the kernel node.";
     // Only the trainable parameter is reused for federated average.
@@ -207,8 +256,13 @@ class FedAvgKernel : public AggregationKernelMod {
   AddressPtr data_size_addr_;
   AddressPtr new_weight_addr_;
   AddressPtr new_data_size_addr_;
-  // The kernel could be called concurrently so we need lock to ensure threadsafe.
-  std::mutex weight_mutex_;
+  // The kernel could be called concurrently so we need lock to ensure threadsafe. The accumulation shares the lock,
+  // while the all-reduce and reset hold it exclusively.
+  std::shared_mutex weight_mutex_;
+  // Protects the data size and the accumulation count.
+  std::mutex data_size_mutex_;
+  // Accumulates the uploaded weights concurrently.
+  StreamingAggregator aggregator_;
 };
 }  // namespace kernel
 }  // namespace server
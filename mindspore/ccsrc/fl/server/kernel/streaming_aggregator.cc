@@ -0,0 +1,85 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "fl/server/kernel/streaming_aggregator.h"
+#include <algorithm>
+#include "plugin/device/cpu/kernel/cpu_kernel.h"
+#include "plugin/device/cpu/kernel/nnacl/fp32/add_fp32.h"
+
+namespace mindspore {
+namespace fl {
+namespace server {
+namespace kernel {
+void StreamingAggregator::Init(float *weight, size_t size) {
+  weight_ = weight;
+  size_ = size;
+  chunk_num_ = (size + kAggregationChunkSize - 1) / kAggregationChunkSize;
+  chunk_mutexes_ = std::make_unique<std::mutex[]>(chunk_num_);
+  next_start_chunk_ = 0;
+}
+
+void StreamingAggregator::AccumulateChunk(size_t chunk, const float *new_weight) {
+  size_t begin = chunk * kAggregationChunkSize;
+  size_t length = std::min(kAggregationChunkSize, size_ - begin);
+  std::lock_guard<std::mutex> lock(chunk_mutexes_[chunk]);
+  if (ElementAdd(weight_ + begin, new_weight + begin, weight_ + begin, SizeToInt(length)) != NNACL_OK) {
+    MS_LOG(EXCEPTION) << "Accumulate the chunk " << chunk << " of the weight failed.";
+  }
+}
+
+bool StreamingAggregator::Accumulate(const float *new_weight, size_t size) {
+  MS_ERROR_IF_NULL_W_RET_VAL(weight_, false);
+  MS_ERROR_IF_NULL_W_RET_VAL(new_weight, false);
+  if (size != size_) {
+    MS_LOG(ERROR) << "The uploaded weight size " << size << " is not equal to the aggregated weight size " << size_;
+    return false;
+  }
+  if (chunk_num_ == 0) {
+    return true;
+  }
+
+  // The concurrent uploads start from different chunks, so they seldom wait for the same chunk lock.
+  size_t start_chunk = next_start_chunk_.fetch_add(1) % chunk_num_;
+  auto task = [this, start_chunk, new_weight](size_t start, size_t end) {
+    for (size_t i = start; i < end; ++i) {
+      AccumulateChunk((start_chunk + i) % chunk_num_, new_weight);
+    }
+  };
+  if (chunk_num_ < kParallelAggregationChunkNum) {
+    task(0, chunk_num_);
+  } else {
+    mindspore::kernel::ParallelLaunch(task, chunk_num_, 1.0);
+  }
+  return true;
+}
+
+void StreamingAggregator::Divide(float divisor) {
+  MS_ERROR_IF_NULL_WO_RET_VAL(weight_);
+  auto task = [this, divisor](size_t start, size_t end) {
+    for (size_t i = start * kAggregationChunkSize; i < std::min(end * kAggregationChunkSize, size_); ++i) {
+      weight_[i] /= divisor;
+    }
+  };
+  if (chunk_num_ < kParallelAggregationChunkNum) {
+    task(0, chunk_num_);
+  } else {
+    mindspore::kernel::ParallelLaunch(task, chunk_num_, 1.0);
+  }
+}
+}  // namespace kernel
+}  // namespace server
+}  // namespace fl
+}  // namespace mindspore
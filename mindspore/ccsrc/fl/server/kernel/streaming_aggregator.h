@@ -0,0 +1,65 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef MINDSPORE_CCSRC_FL_SERVER_KERNEL_STREAMING_AGGREGATOR_H_
+#define MINDSPORE_CCSRC_FL_SERVER_KERNEL_STREAMING_AGGREGATOR_H_
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+
+namespace mindspore {
+namespace fl {
+namespace server {
+namespace kernel {
+// The element number of one chunk of the aggregated weight: 64KB.
+constexpr size_t kAggregationChunkSize = 16384;
+// The chunks of the weight having at least this number of chunks are accumulated by the thread pool in parallel.
+constexpr size_t kParallelAggregationChunkNum = 8;
+
+// StreamingAggregator accumulates the weights uploaded by clients into the aggregated weight as the uploads arrive.
+// The weight is split into chunks and every chunk has its own lock, so the concurrent uploads accumulate different
+// chunks at the same time instead of queuing on the lock of the whole weight: each upload visits the chunks from a
+// different start chunk. The chunks of a large weight are dispatched to the thread pool, and the elements of one chunk
+// are accumulated by the SIMD instructions.
+class StreamingAggregator {
+ public:
+  StreamingAggregator() = default;
+  ~StreamingAggregator() = default;
+
+  // Bind the aggregated weight with the element number.
+  void Init(float *weight, size_t size);
+
+  // Accumulate the uploaded weight into the aggregated weight, which could be called concurrently.
+  bool Accumulate(const float *new_weight, size_t size);
+
+  // Divide the aggregated weight by the divisor in parallel, which shouldn't be called with Accumulate concurrently.
+  void Divide(float divisor);
+
+ private:
+  void AccumulateChunk(size_t chunk, const float *new_weight);
+
+  float *weight_{nullptr};
+  size_t size_{0};
+  size_t chunk_num_{0};
+  std::unique_ptr<std::mutex[]> chunk_mutexes_;
+  std::atomic<size_t> next_start_chunk_{0};
+};
+}  // namespace kernel
+}  // namespace server
+}  // namespace fl
+}  // namespace mindspore
+#endif  // MINDSPORE_CCSRC_FL_SERVER_KERNEL_STREAMING_AGGREGATOR_H_
@@ -18,6 +18,7 @@
 #include <map>
 #include <string>
 #include <memory>
+#include <algorithm>
 #include "fl/server/executor.h"
 #include "pipeline/jit/parse/parse.h"
 #include "include/common/utils/python_adapter.h"
@@ -25,17 +26,29 @@
 namespace mindspore {
 namespace fl {
 namespace server {
+namespace {
+// The initial model is owned by both the model map and the initial model pointer.
+constexpr long kInitialModelOwnerCount = 2;
+}  // namespace
+
 void ModelStore::Initialize(uint32_t rank_id, uint32_t max_count) {
   if (!Executor::GetInstance().initialized()) {
     MS_LOG(EXCEPTION) << "Server's executor must be initialized before model storage.";
   }
+  Initialize(rank_id, max_count, Executor::GetInstance().GetModel());
+}
+
+void ModelStore::Initialize(uint32_t rank_id, uint32_t max_count,
+                            const std::map<std::string, AddressPtr> &initial_model) {
   rank_id_ = rank_id;
   max_model_count_ = max_count;
-  initial_model_ = AssignNewModelMemory();
+  iteration_to_model_.clear();
+  iteration_to_compress_model_.clear();
+  initial_model_ = AssignNewModelMemory(initial_model);
   iteration_to_model_[kInitIterationNum] = initial_model_;
-  std::map<std::string, AddressPtr> model = Executor::GetInstance().GetModel();
   for (const auto &item : mindspore::fl::compression::kCompressTypeMap) {
-    iteration_to_compress_model_[kInitIterationNum][item.first] = AssignNewCompressModelMemory(item.first, model);
+    iteration_to_compress_model_[kInitIterationNum][item.first] =
+      AssignNewCompressModelMemory(item.first, initial_model);
   }
   model_size_ = ComputeModelSize();
   MS_LOG(INFO) << "Model store checkpoint dir is: " << ps::PSContext::instance()->checkpoint_dir();
@@ -52,40 +65,58 @@ void ModelStore::StoreModelByIterNum(size_t iteration, const std::map<std::strin
     return;
   }
 
+  // A model read from the store, e.g. the last model stored again for an invalid iteration, is shared without copy.
+  std::shared_ptr<MemoryRegister> shared_register = nullptr;
+  for (const auto &stored : iteration_to_model_) {
+    if (IsStoredModel(stored.second, new_model)) {
+      shared_register = stored.second;
+      break;
+    }
+  }
+
+  // If iteration_to_model_ size is already max_model_count_, we need to replace earliest model with the newest model.
+  // The memory of the earliest model is reused only if no reader or other iteration holds it, otherwise they keep the
+  // old version and new memory is assigned for the newest model.
   std::shared_ptr<MemoryRegister> memory_register = nullptr;
-  if (iteration_to_model_.size() < max_model_count_) {
-    // If iteration_to_model_.size() is not max_model_count_, need to assign new memory for the model.
-    memory_register = AssignNewModelMemory();
-    MS_ERROR_IF_NULL_WO_RET_VAL(memory_register);
-    iteration_to_model_[iteration] = memory_register;
-  } else {
-    // If iteration_to_model_ size is already max_model_count_, we need to replace earliest model with the newest model.
+  if (iteration_to_model_.size() >= max_model_count_) {
     memory_register = iteration_to_model_.begin()->second;
-    MS_ERROR_IF_NULL_WO_RET_VAL(memory_register);
     (void)iteration_to_model_.erase(iteration_to_model_.begin());
+    long owner_count = (memory_register == initial_model_) ? kInitialModelOwnerCount : 1;
+    if (memory_register.use_count() > owner_count) {
+      MS_LOG(INFO) << "The earliest model is still in use, it is not reused for the model of iteration " << iteration;
+      memory_register = nullptr;
+    }
   }
 
-  // Copy new model data to the the stored model.
-  auto &stored_model = memory_register->addresses();
-  for (const auto &weight : new_model) {
-    const std::string &weight_name = weight.first;
-    if (stored_model.count(weight_name) == 0) {
-      MS_LOG(ERROR) << "The stored model has no weight " << weight_name;
-      continue;
-    }
+  if (shared_register != nullptr) {
+    memory_register = shared_register;
+  } else if (memory_register == nullptr) {
+    // The new memory is filled with the new model, so this is the only copy of it.
+    memory_register = AssignNewModelMemory(new_model);
+    MS_ERROR_IF_NULL_WO_RET_VAL(memory_register);
+  } else {
+    // Copy new model data to the the stored model.
+    auto &stored_model = memory_register->addresses();
+    for (const auto &weight : new_model) {
+      const std::string &weight_name = weight.first;
+      if (stored_model.count(weight_name) == 0) {
+        MS_LOG(ERROR) << "The stored model has no weight " << weight_name;
+        continue;
+      }
 
-    MS_ERROR_IF_NULL_WO_RET_VAL(stored_model[weight_name]);
-    MS_ERROR_IF_NULL_WO_RET_VAL(stored_model[weight_name]->addr);
-    MS_ERROR_IF_NULL_WO_RET_VAL(weight.second);
-    MS_ERROR_IF_NULL_WO_RET_VAL(weight.second->addr);
-    void *dst_addr = stored_model[weight_name]->addr;
-    size_t dst_size = stored_model[weight_name]->size;
-    void *src_addr = weight.second->addr;
-    size_t src_size = weight.second->size;
-    int ret = memcpy_s(dst_addr, dst_size, src_addr, src_size);
-    if (ret != 0) {
-      MS_LOG(ERROR) << "memcpy_s error, errorno(" << ret << ")";
-      return;
+      MS_ERROR_IF_NULL_WO_RET_VAL(stored_model[weight_name]);
+      MS_ERROR_IF_NULL_WO_RET_VAL(stored_model[weight_name]->addr);
+      MS_ERROR_IF_NULL_WO_RET_VAL(weight.second);
+      MS_ERROR_IF_NULL_WO_RET_VAL(weight.second->addr);
+      void *dst_addr = stored_model[weight_name]->addr;
+      size_t dst_size = stored_model[weight_name]->size;
+      void *src_addr = weight.second->addr;
+      size_t src_size = weight.second->size;
+      int ret = memcpy_s(dst_addr, dst_size, src_addr, src_size);
+      if (ret != 0) {
+        MS_LOG(ERROR) << "memcpy_s error, errorno(" << ret << ")";
+        return;
+      }
     }
   }
   iteration_to_model_[iteration] = memory_register;
@@ -101,7 +132,13 @@ std::map<std::string, AddressPtr> ModelStore::GetModelByIterNum(size_t iteration
     MS_LOG(WARNING) << "Model for iteration " << iteration << " is not stored. Return latest model";
     return model;
   }
-  model = iteration_to_model_[iteration]->addresses();
+  // The returned addresses share the ownership of the stored model, so the model isn't overwritten by the following
+  // iterations until the reader releases it.
+  const auto &memory_register = iteration_to_model_[iteration];
+  MS_ERROR_IF_NULL_W_RET_VAL(memory_register, model);
+  for (const auto &weight : memory_register->addresses()) {
+    model[weight.first] = AddressPtr(memory_register, weight.second.get());
+  }
   return model;
 }
 
@@ -113,13 +150,16 @@ std::map<std::string, AddressPtr> ModelStore::GetCompressModelByIterNum(size_t i
     MS_LOG(ERROR) << "Compress Model for iteration " << iteration << " is not stored.";
     return compressModel;
   }
-  std::map<schema::CompressType, std::shared_ptr<MemoryRegister>> compress_model_map =
-    iteration_to_compress_model_[iteration];
+  const auto &compress_model_map = iteration_to_compress_model_[iteration];
   if (compress_model_map.count(compressType) == 0) {
     MS_LOG(ERROR) << "Compress Model for compress type " << compressType << " is not stored.";
     return compressModel;
   }
-  compressModel = iteration_to_compress_model_[iteration][compressType]->addresses();
+  const auto &memory_register = compress_model_map.at(compressType);
+  MS_ERROR_IF_NULL_W_RET_VAL(memory_register, compressModel);
+  for (const auto &weight : memory_register->addresses()) {
+    compressModel[weight.first] = AddressPtr(memory_register, weight.second.get());
+  }
   return compressModel;
 }
 
@@ -131,20 +171,19 @@ void ModelStore::Reset() {
   OnIterationUpdate();
 }
 
-const std::map<size_t, std::shared_ptr<MemoryRegister>> &ModelStore::iteration_to_model() {
+std::map<size_t, std::shared_ptr<MemoryRegister>> ModelStore::iteration_to_model() {
   std::unique_lock<std::mutex> lock(model_mtx_);
   return iteration_to_model_;
 }
 
-const std::map<size_t, CompressTypeMap> &ModelStore::iteration_to_compress_model() {
+std::map<size_t, CompressTypeMap> ModelStore::iteration_to_compress_model() {
   std::unique_lock<std::mutex> lock(model_mtx_);
   return iteration_to_compress_model_;
 }
 
 size_t ModelStore::model_size() const { return model_size_; }
 
-std::shared_ptr<MemoryRegister> ModelStore::AssignNewModelMemory() const {
-  std::map<std::string, AddressPtr> model = Executor::GetInstance().GetModel();
+std::shared_ptr<MemoryRegister> ModelStore::AssignNewModelMemory(const std::map<std::string, AddressPtr> &model) const {
   if (model.empty()) {
     MS_LOG(WARNING) << "Model feature map is empty.";
     return std::make_shared<MemoryRegister>();
@@ -155,11 +194,11 @@ std::shared_ptr<MemoryRegister> ModelStore::AssignNewModelMemory() const {
   MS_ERROR_IF_NULL_W_RET_VAL(memory_register, nullptr);
   for (const auto &weight : model) {
     const std::string weight_name = weight.first;
+    MS_ERROR_IF_NULL_W_RET_VAL(weight.second, nullptr);
+    MS_ERROR_IF_NULL_W_RET_VAL(weight.second->addr, nullptr);
     size_t weight_size = weight.second->size;
     auto weight_data = std::make_unique<char[]>(weight_size);
     MS_ERROR_IF_NULL_W_RET_VAL(weight_data, nullptr);
-    MS_ERROR_IF_NULL_W_RET_VAL(weight.second, nullptr);
-    MS_ERROR_IF_NULL_W_RET_VAL(weight.second->addr, nullptr);
 
     auto src_data_size = weight_size;
     auto dst_data_size = weight_size;
@@ -173,6 +212,19 @@ std::shared_ptr<MemoryRegister> ModelStore::AssignNewModelMemory() const {
   return memory_register;
 }
 
+bool ModelStore::IsStoredModel(const std::shared_ptr<MemoryRegister> &stored_model,
+                               const std::map<std::string, AddressPtr> &model) {
+  if (stored_model == nullptr || model.empty() || stored_model->addresses().size() != model.size()) {
+    return false;
+  }
+  const auto &stored_addresses = stored_model->addresses();
+  return std::all_of(model.begin(), model.end(), [&stored_addresses](const auto &weight) {
+    auto iter = stored_addresses.find(weight.first);
+    return weight.second != nullptr && iter != stored_addresses.end() && iter->second != nullptr &&
+           iter->second->addr == weight.second->addr && iter->second->size == weight.second->size;
+  });
+}
+
 std::shared_ptr<MemoryRegister> ModelStore::AssignNewCompressModelMemory(
   schema::CompressType compressType, const std::map<std::string, AddressPtr> &model) const {
   if (model.empty()) {
@@ -237,12 +289,25 @@ void ModelStore::StoreCompressModelByIterNum(size_t iteration, const std::map<st
     return;
   }
 
+  // The compress models of a model read from the store are shared as well instead of being encoded again.
+  CompressTypeMap shared_compress_model;
+  for (const auto &stored : iteration_to_model_) {
+    auto compress_iter = iteration_to_compress_model_.find(stored.first);
+    if (compress_iter != iteration_to_compress_model_.end() && IsStoredModel(stored.second, new_model)) {
+      shared_compress_model = compress_iter->second;
+      break;
+    }
+  }
+
+  // Readers of the evicted compress models keep their versions alive through the returned addresses.
   iteration_to_compress_model_[iteration] = {};
   if (iteration_to_compress_model_.size() >= max_model_count_) {
-    auto compress_model_map = iteration_to_compress_model_.begin()->second;
-    compress_model_map.clear();
     (void)iteration_to_compress_model_.erase(iteration_to_compress_model_.begin());
   }
+  if (!shared_compress_model.empty()) {
+    iteration_to_compress_model_[iteration] = shared_compress_model;
+    return;
+  }
 
   for (const auto &item : mindspore::fl::compression::kCompressTypeMap) {
     auto memory_register = AssignNewCompressModelMemory(item.first, new_model);
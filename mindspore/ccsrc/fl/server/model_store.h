@@ -52,27 +52,31 @@ class ModelStore {
   // Initialize ModelStore with max count of models need to be stored.
   void Initialize(uint32_t rank_id, uint32_t max_count = 3);
 
+  // Initialize ModelStore with the given model as the model of iteration 0 instead of the model of Executor.
+  void Initialize(uint32_t rank_id, uint32_t max_count, const std::map<std::string, AddressPtr> &initial_model);
+
   // Store the model of the given iteration. The model is acquired from Executor. If the current model count is already
-  // max_model_count_, the earliest model will be replaced.
+  // max_model_count_, the earliest model will be replaced. A model returned by GetModelByIterNum is not copied again,
+  // the iteration shares the stored version instead.
   void StoreModelByIterNum(size_t iteration, const std::map<std::string, AddressPtr> &new_model);
 
-  // Get model of the given iteration.
+  // Get model of the given iteration. The returned addresses share the ownership of the stored version, which is never
+  // written again while they are alive.
   std::map<std::string, AddressPtr> GetModelByIterNum(size_t iteration);
 
   // Reset the stored models. Called when federated learning job finishes.
   void Reset();
 
   // Returns all models stored in ModelStore.
-  const std::map<size_t, std::shared_ptr<MemoryRegister>> &iteration_to_model();
+  std::map<size_t, std::shared_ptr<MemoryRegister>> iteration_to_model();
 
   // Returns the model size, which could be calculated at the initializing phase.
   size_t model_size() const;
 
-  // Get compress model of the given iteration.
+  // Get compress model of the given iteration. Like GetModelByIterNum, the addresses share the stored version.
   std::map<std::string, AddressPtr> GetCompressModelByIterNum(size_t iteration, schema::CompressType compressType);
 
-  const std::map<size_t, std::map<schema::CompressType, std::shared_ptr<MemoryRegister>>>
-    &iteration_to_compress_model();
+  std::map<size_t, CompressTypeMap> iteration_to_compress_model();
 
   void StoreCompressModelByIterNum(size_t iteration, const std::map<std::string, AddressPtr> &new_model);
 
@@ -95,8 +99,12 @@ class ModelStore {
   void SaveCheckpoint(size_t iteration, const std::map<std::string, AddressPtr> &model) const;
 
   // To store multiple models, new memory must assigned. The max memory size assigned for models is max_model_count_ *
-  // model_size_.
-  std::shared_ptr<MemoryRegister> AssignNewModelMemory() const;
+  // model_size_. The new memory is filled with the given model.
+  std::shared_ptr<MemoryRegister> AssignNewModelMemory(const std::map<std::string, AddressPtr> &model) const;
+
+  // Whether the model is made of the addresses of the stored model, which means it needn't be copied.
+  static bool IsStoredModel(const std::shared_ptr<MemoryRegister> &stored_model,
+                            const std::map<std::string, AddressPtr> &model);
 
   std::shared_ptr<MemoryRegister> AssignNewCompressModelMemory(schema::CompressType compressType,
                                                                const std::map<std::string, AddressPtr> &model) const;
@@ -109,6 +109,29 @@ bool ParameterAggregator::LaunchAggregators() {
   return true;
 }
 
+bool ParameterAggregator::SupportStreaming() const {
+  if (aggregation_kernel_parameters_.empty()) {
+    return false;
+  }
+  return std::all_of(aggregation_kernel_parameters_.begin(), aggregation_kernel_parameters_.end(),
+                     [](const auto &aggregator_with_params) {
+                       const auto &aggr_kernel = aggregator_with_params.first;
+                       return aggr_kernel != nullptr && aggr_kernel->SupportStreaming();
+                     });
+}
+
+bool ParameterAggregator::StreamAggregators(const std::map<std::string, Address> &new_data) {
+  for (auto &aggregator_with_params : aggregation_kernel_parameters_) {
+    std::shared_ptr<kernel::AggregationKernelMod> aggr_kernel = aggregator_with_params.first;
+    MS_ERROR_IF_NULL_W_RET_VAL(aggr_kernel, false);
+    if (!aggr_kernel->Accumulate(new_data)) {
+      MS_LOG(ERROR) << "Accumulating by aggregation kernel " << typeid(aggr_kernel.get()).name() << " failed.";
+      return false;
+    }
+  }
+  return true;
+}
+
 AddressPtr ParameterAggregator::GetWeight() {
   if (memory_register_ == nullptr) {
     MS_LOG(ERROR)
@@ -78,6 +78,13 @@ class ParameterAggregator {
   // Launch aggregators/optimizers of this ParameterAggregator in order.
   bool LaunchAggregators();
 
+  // Whether all the aggregation kernels accumulate the uploaded data directly. If so, the uploaded data is aggregated
+  // by StreamAggregators concurrently instead of UpdateData and LaunchAggregators under the lock of the parameter.
+  bool SupportStreaming() const;
+
+  // Accumulate the uploaded data by the aggregation kernels, which could be called concurrently.
+  bool StreamAggregators(const std::map<std::string, Address> &new_data);
+
   // Different from the method Pull, this method simply returns the weight of this ParameterAggregator without causing
   // any change of status.
   AddressPtr GetWeight();
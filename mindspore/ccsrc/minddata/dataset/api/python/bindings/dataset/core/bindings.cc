@@ -73,6 +73,20 @@ PYBIND_REGISTER(ConfigManager, 0, ([](const py::module *m) {
                     .def("get_enable_watchdog", &ConfigManager::enable_watchdog)
                     .def("set_multiprocessing_timeout_interval", &ConfigManager::set_multiprocessing_timeout_interval)
                     .def("get_multiprocessing_timeout_interval", &ConfigManager::multiprocessing_timeout_interval)
+                    .def("set_shuffle_memory_limit", &ConfigManager::set_shuffle_memory_limit)
+                    .def("get_shuffle_memory_limit", &ConfigManager::shuffle_memory_limit)
+                    .def("set_generator_zero_copy", &ConfigManager::set_generator_zero_copy)
+                    .def("get_generator_zero_copy", &ConfigManager::generator_zero_copy)
+                    .def("set_enable_generator_shm_ring", &ConfigManager::set_enable_generator_shm_ring)
+                    .def("get_enable_generator_shm_ring", &ConfigManager::enable_generator_shm_ring)
+                    .def("set_enable_tfrecord_crc_check", &ConfigManager::set_enable_tfrecord_crc_check)
+                    .def("get_enable_tfrecord_crc_check", &ConfigManager::enable_tfrecord_crc_check)
+                    .def("set_file_readahead_depth", &ConfigManager::set_file_readahead_depth)
+                    .def("get_file_readahead_depth", &ConfigManager::file_readahead_depth)
+                    .def("set_enable_tensor_memory_pool", &ConfigManager::set_enable_tensor_memory_pool)
+                    .def("get_enable_tensor_memory_pool", &ConfigManager::enable_tensor_memory_pool)
+                    .def("set_tensor_memory_pool_limit", &ConfigManager::set_tensor_memory_pool_limit)
+                    .def("get_tensor_memory_pool_limit", &ConfigManager::tensor_memory_pool_limit)
                     .def("set_dynamic_shape", &ConfigManager::set_dynamic_shape)
                     .def("get_dynamic_shape", &ConfigManager::dynamic_shape)
                     .def("load", [](ConfigManager &c, const std::string &s) { THROW_IF_ERROR(c.LoadFile(s)); });
@@ -16,6 +16,7 @@
 
 #include "minddata/dataset/api/python/pybind_register.h"
 #include "minddata/dataset/engine/datasetops/batch_op.h"
+#include "minddata/dataset/engine/datasetops/source/shared_row_ring.h"
 
 namespace mindspore {
 namespace dataset {
@@ -42,5 +43,40 @@ PYBIND_REGISTER(DatasetOp, 0, ([](const py::module *m) {
                   (void)py::class_<DatasetOp, std::shared_ptr<DatasetOp>>(*m, "DatasetOp");
                 }));
 
+PYBIND_REGISTER(SharedRowRing, 0, ([](const py::module *m) {
+                  (void)py::class_<SharedRowRing, std::shared_ptr<SharedRowRing>>(*m, "SharedRowRing")
+                    .def(py::init([](int32_t shm_id) {
+                      std::unique_ptr<SharedRowRing> ring;
+                      THROW_IF_ERROR(SharedRowRing::Attach(shm_id, &ring));
+                      return std::shared_ptr<SharedRowRing>(std::move(ring));
+                    }))
+                    .def("write",
+                         [](SharedRowRing &ring, int32_t ring_id, const py::tuple &row, int64_t timeout_ms) {
+                           // The tensors share the memory of the arrays, which are copied into the shared memory
+                           // only once.
+                           TensorRow tensor_row;
+                           for (const auto &item : row) {
+                             std::shared_ptr<Tensor> tensor;
+                             THROW_IF_ERROR(Tensor::CreateFromNpArrayNoCopy(item.cast<py::array>(), &tensor));
+                             tensor_row.push_back(tensor);
+                           }
+                           bool written = false;
+                           {
+                             py::gil_scoped_release gil_release;
+                             THROW_IF_ERROR(ring.Write(ring_id, tensor_row, timeout_ms, &written));
+                           }
+                           return written;
+                         })
+                    .def("write_error",
+                         [](SharedRowRing &ring, int32_t ring_id, const std::string &err_msg, int64_t timeout_ms) {
+                           bool written = false;
+                           {
+                             py::gil_scoped_release gil_release;
+                             THROW_IF_ERROR(ring.WriteError(ring_id, err_msg, timeout_ms, &written));
+                           }
+                           return written;
+                         });
+                }));
+
 }  // namespace dataset
 }  // namespace mindspore
@@ -332,17 +332,19 @@ PYBIND_REGISTER(GeneratorNode, 2, ([](const py::module *m) {
                     .def(
                       py::init([](const py::function &generator_function, const std::vector<std::string> &column_names,
                                   const std::vector<DataType> &column_types, int64_t dataset_len,
-                                  const py::handle &sampler, uint32_t num_parallel_workers) {
+                                  const py::handle &sampler, uint32_t num_parallel_workers, int64_t shm_row_size) {
                         auto gen =
                           std::make_shared<GeneratorNode>(generator_function, column_names, column_types, dataset_len,
-                                                          toSamplerObj(sampler), num_parallel_workers);
+                                                          toSamplerObj(sampler), num_parallel_workers, shm_row_size);
                         THROW_IF_ERROR(gen->ValidateParams());
                         return gen;
                       }))
                     .def(py::init([](const py::function &generator_function, const std::shared_ptr<SchemaObj> &schema,
-                                     int64_t dataset_len, const py::handle &sampler, uint32_t num_parallel_workers) {
+                                     int64_t dataset_len, const py::handle &sampler, uint32_t num_parallel_workers,
+                                     int64_t shm_row_size) {
                       auto gen = std::make_shared<GeneratorNode>(generator_function, schema, dataset_len,
-                                                                 toSamplerObj(sampler), num_parallel_workers);
+                                                                 toSamplerObj(sampler), num_parallel_workers,
+                                                                 shm_row_size);
                       THROW_IF_ERROR(gen->ValidateParams());
                       return gen;
                     }));
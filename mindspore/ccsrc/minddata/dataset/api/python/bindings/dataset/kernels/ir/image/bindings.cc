@@ -30,6 +30,7 @@
 #include "minddata/dataset/kernels/ir/vision/cutmix_batch_ir.h"
 #include "minddata/dataset/kernels/ir/vision/cutout_ir.h"
 #include "minddata/dataset/kernels/ir/vision/decode_ir.h"
+#include "minddata/dataset/kernels/ir/vision/decode_resize_ir.h"
 #include "minddata/dataset/kernels/ir/vision/equalize_ir.h"
 #include "minddata/dataset/kernels/ir/vision/gaussian_blur_ir.h"
 #include "minddata/dataset/kernels/ir/vision/horizontal_flip_ir.h"
@@ -194,6 +195,17 @@ PYBIND_REGISTER(DecodeOperation, 1, ([](const py::module *m) {
                     }));
                 }));
 
+PYBIND_REGISTER(
+  DecodeResizeOperation, 1, ([](const py::module *m) {
+    (void)py::class_<vision::DecodeResizeOperation, TensorOperation, std::shared_ptr<vision::DecodeResizeOperation>>(
+      *m, "DecodeResizeOperation")
+      .def(py::init([](const std::vector<int32_t> &size, InterpolationMode interpolation) {
+        auto decode_resize = std::make_shared<vision::DecodeResizeOperation>(size, interpolation);
+        THROW_IF_ERROR(decode_resize->ValidateParams());
+        return decode_resize;
+      }));
+  }));
+
 PYBIND_REGISTER(EqualizeOperation, 1, ([](const py::module *m) {
                   (void)
                     py::class_<vision::EqualizeOperation, TensorOperation, std::shared_ptr<vision::EqualizeOperation>>(
@@ -390,9 +402,10 @@ PYBIND_REGISTER(
     (void)py::class_<vision::RandomCropDecodeResizeOperation, TensorOperation,
                      std::shared_ptr<vision::RandomCropDecodeResizeOperation>>(*m, "RandomCropDecodeResizeOperation")
       .def(py::init([](const std::vector<int32_t> &size, const std::vector<float> &scale,
-                       const std::vector<float> &ratio, InterpolationMode interpolation, int32_t max_attempts) {
-        auto random_crop_decode_resize =
-          std::make_shared<vision::RandomCropDecodeResizeOperation>(size, scale, ratio, interpolation, max_attempts);
+                       const std::vector<float> &ratio, InterpolationMode interpolation, int32_t max_attempts,
+                       bool scaled_decode) {
+        auto random_crop_decode_resize = std::make_shared<vision::RandomCropDecodeResizeOperation>(
+          size, scale, ratio, interpolation, max_attempts, scaled_decode);
         THROW_IF_ERROR(random_crop_decode_resize->ValidateParams());
         return random_crop_decode_resize;
       }));
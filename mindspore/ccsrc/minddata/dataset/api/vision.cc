@@ -31,6 +31,7 @@
 #include "minddata/dataset/kernels/ir/vision/cutmix_batch_ir.h"
 #include "minddata/dataset/kernels/ir/vision/cutout_ir.h"
 #include "minddata/dataset/kernels/ir/vision/decode_ir.h"
+#include "minddata/dataset/kernels/ir/vision/decode_resize_ir.h"
 #include "minddata/dataset/kernels/ir/vision/equalize_ir.h"
 #include "minddata/dataset/kernels/ir/vision/gaussian_blur_ir.h"
 #include "minddata/dataset/kernels/ir/vision/horizontal_flip_ir.h"
@@ -276,6 +277,21 @@ CutOut::CutOut(int32_t length, int32_t num_patches) : data_(std::make_shared<Dat
 std::shared_ptr<TensorOperation> CutOut::Parse() {
   return std::make_shared<CutOutOperation>(data_->length_, data_->num_patches_, true);
 }
+
+// DecodeResize Transform Operation.
+struct DecodeResize::Data {
+  Data(const std::vector<int32_t> &size, InterpolationMode interpolation)
+      : size_(size), interpolation_(interpolation) {}
+  std::vector<int32_t> size_;
+  InterpolationMode interpolation_;
+};
+
+DecodeResize::DecodeResize(const std::vector<int32_t> &size, InterpolationMode interpolation)
+    : data_(std::make_shared<Data>(size, interpolation)) {}
+
+std::shared_ptr<TensorOperation> DecodeResize::Parse() {
+  return std::make_shared<DecodeResizeOperation>(data_->size_, data_->interpolation_);
+}
 #endif  // not ENABLE_ANDROID
 
 // Decode Transform Operation.
@@ -658,23 +674,30 @@ std::shared_ptr<TensorOperation> RandomCrop::Parse() {
 // RandomCropDecodeResize Transform Operation.
 struct RandomCropDecodeResize::Data {
   Data(const std::vector<int32_t> &size, const std::vector<float> &scale, const std::vector<float> &ratio,
-       InterpolationMode interpolation, int32_t max_attempts)
-      : size_(size), scale_(scale), ratio_(ratio), interpolation_(interpolation), max_attempts_(max_attempts) {}
+       InterpolationMode interpolation, int32_t max_attempts, bool scaled_decode)
+      : size_(size),
+        scale_(scale),
+        ratio_(ratio),
+        interpolation_(interpolation),
+        max_attempts_(max_attempts),
+        scaled_decode_(scaled_decode) {}
   std::vector<int32_t> size_;
   std::vector<float> scale_;
   std::vector<float> ratio_;
   InterpolationMode interpolation_;
   int32_t max_attempts_;
+  bool scaled_decode_;
 };
 
 RandomCropDecodeResize::RandomCropDecodeResize(const std::vector<int32_t> &size, const std::vector<float> &scale,
                                                const std::vector<float> &ratio, InterpolationMode interpolation,
-                                               int32_t max_attempts)
-    : data_(std::make_shared<Data>(size, scale, ratio, interpolation, max_attempts)) {}
+                                               int32_t max_attempts, bool scaled_decode)
+    : data_(std::make_shared<Data>(size, scale, ratio, interpolation, max_attempts, scaled_decode)) {}
 
 std::shared_ptr<TensorOperation> RandomCropDecodeResize::Parse() {
   return std::make_shared<RandomCropDecodeResizeOperation>(data_->size_, data_->scale_, data_->ratio_,
-                                                           data_->interpolation_, data_->max_attempts_);
+                                                           data_->interpolation_, data_->max_attempts_,
+                                                           data_->scaled_decode_);
 }
 
 // RandomCropWithBBox Transform Operation.
@@ -23,8 +23,10 @@
 #include <thread>
 #include <utility>
 
+#include "minddata/dataset/core/global_context.h"
 #include "minddata/dataset/util/log_adapter.h"
 #include "minddata/dataset/util/status.h"
+#include "minddata/dataset/util/size_class_pool.h"
 #include "minddata/dataset/util/system_pool.h"
 #include "utils/ms_utils.h"
 
@@ -164,6 +166,14 @@ void ConfigManager::set_num_connections(int32_t num_connections) { num_connectio
 
 void ConfigManager::set_cache_prefetch_size(int32_t cache_prefetch_size) { cache_prefetch_size_ = cache_prefetch_size; }
 
+void ConfigManager::set_tensor_memory_pool_limit(int64_t limit) {
+  tensor_memory_pool_limit_ = limit;
+  // Only the config of the global context owns the global tensor memory pool.
+  if (GlobalContext::config_manager().get() == this) {
+    GlobalContext::Instance()->size_class_pool()->SetLimit(limit);
+  }
+}
+
 Status ConfigManager::set_enable_autotune(bool enable, bool save_autoconfig, const std::string &json_filepath) {
   enable_autotune_ = enable;
   save_autoconfig_ = save_autoconfig;
@@ -275,6 +275,65 @@ class ConfigManager {
   // @param interval - multiprocessing timeout interval in seconds
   void set_multiprocessing_timeout_interval(uint32_t interval) { multiprocessing_timeout_interval_ = interval; }
 
+  // getter function
+  // @return - The memory limit in bytes of the shuffle buffer, 0 means the buffer is limited by the row count only
+  int64_t shuffle_memory_limit() const { return shuffle_memory_limit_; }
+
+  // setter function
+  // @param memory_limit - The memory limit in bytes of the shuffle buffer, the rows beyond it are spilled to disk
+  void set_shuffle_memory_limit(int64_t memory_limit) { shuffle_memory_limit_ = memory_limit; }
+
+  // getter function
+  // @return - Flag to indicate whether the arrays returned by the generator are shared by the tensors without copying
+  bool generator_zero_copy() const { return generator_zero_copy_; }
+
+  // setter function
+  // @param zero_copy - Flag to indicate whether the arrays returned by the generator are shared without copying
+  void set_generator_zero_copy(bool zero_copy) { generator_zero_copy_ = zero_copy; }
+
+  // getter function
+  // @return - Flag to indicate whether the worker processes of GeneratorDataset write the rows into shared memory rings
+  bool enable_generator_shm_ring() const { return enable_generator_shm_ring_; }
+
+  // setter function
+  // @param enable - Flag to indicate whether the worker processes of GeneratorDataset write the rows into shared memory
+  //     rings instead of returning them through the Python queues
+  void set_enable_generator_shm_ring(bool enable) { enable_generator_shm_ring_ = enable; }
+
+  // getter function
+  // @return - Flag to indicate whether TFRecordDataset verifies the crc of each record
+  bool enable_tfrecord_crc_check() const { return enable_tfrecord_crc_check_; }
+
+  // setter function
+  // @param enable - Flag to indicate whether TFRecordDataset verifies the crc of the length and the data of each record
+  void set_enable_tfrecord_crc_check(bool enable) { enable_tfrecord_crc_check_ = enable; }
+
+  // getter function
+  // @return - The max number of files each file based leaf op reads ahead, 0 means no readahead
+  int32_t file_readahead_depth() const { return file_readahead_depth_; }
+
+  // setter function
+  // @param depth - The max number of files each file based leaf op reads ahead in the shared I/O threads
+  void set_file_readahead_depth(int32_t depth) { file_readahead_depth_ = depth; }
+
+  // getter function
+  // @return - Flag to indicate whether the data of the tensors is allocated from the size class memory pool
+  bool enable_tensor_memory_pool() const { return enable_tensor_memory_pool_; }
+
+  // setter function
+  // @param enable - Flag to indicate whether the data of the tensors created afterwards is allocated from the size
+  //     class memory pool instead of the system allocator
+  void set_enable_tensor_memory_pool(bool enable) { enable_tensor_memory_pool_ = enable; }
+
+  // getter function
+  // @return - The max bytes allocated from the tensor memory pool at the same time, 0 means no limit
+  int64_t tensor_memory_pool_limit() const { return tensor_memory_pool_limit_; }
+
+  // setter function
+  // @param limit - The max bytes allocated from the tensor memory pool at the same time, 0 means no limit, which is
+  //     applied to the global tensor memory pool right away
+  void set_tensor_memory_pool_limit(int64_t limit);
+
   // setter function
   // @param is_dynamic - Indicate whether the dataset is dynamic-shape
   void set_dynamic_shape(bool is_dynamic) { dynamic_shape_ = is_dynamic; }
@@ -317,6 +376,13 @@ class ConfigManager {
   uint32_t multiprocessing_timeout_interval_;  // Multiprocessing timeout interval in seconds
   std::string autotune_json_filepath_;         // Filepath name of the final AutoTune Configuration JSON file
   bool dynamic_shape_{false};
+  int64_t shuffle_memory_limit_{0};  // Memory limit in bytes of the shuffle buffer, 0 means no limit
+  bool generator_zero_copy_{false};  // Share the arrays returned by the generator instead of copying them
+  bool enable_generator_shm_ring_{false};  // Transfer the rows of the generator workers through shared memory rings
+  bool enable_tfrecord_crc_check_{false};  // Verify the crc of each record read by TFRecordDataset
+  int32_t file_readahead_depth_{0};        // The max number of files each file based leaf op reads ahead
+  bool enable_tensor_memory_pool_{false};  // Allocate the data of the tensors from the size class memory pool
+  int64_t tensor_memory_pool_limit_{0};    // Memory limit in bytes of the tensor memory pool, 0 means no limit
 };
 }  // namespace dataset
 }  // namespace mindspore
@@ -28,6 +28,7 @@
 #include "minddata/dataset/engine/perf/profiling.h"
 #endif
 #include "minddata/dataset/util/allocator.h"
+#include "minddata/dataset/util/size_class_pool.h"
 #include "minddata/dataset/util/system_pool.h"
 
 namespace mindspore {
@@ -57,6 +58,7 @@ GlobalContext *GlobalContext::Instance() {
 Status GlobalContext::Init() {
   config_manager_ = std::make_shared<ConfigManager>();
   mem_pool_ = std::make_shared<SystemPool>();
+  size_class_pool_ = std::make_shared<SizeClassPool>();
   // For testing we can use Dummy pool instead
 
   // Create some tensor allocators for the different types and hook them into the pool.
@@ -72,6 +74,13 @@ Status GlobalContext::Init() {
   return Status::OK();
 }
 
+std::shared_ptr<MemoryPool> GlobalContext::tensor_mem_pool() const {
+  if (!config_manager_->enable_tensor_memory_pool()) {
+    return mem_pool_;
+  }
+  return size_class_pool_;
+}
+
 // A print method typically used for debugging
 void GlobalContext::Print(std::ostream &out) const {
   out << "GlobalContext contains the following default config: " << *config_manager_ << "\n";
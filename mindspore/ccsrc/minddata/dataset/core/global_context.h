@@ -33,6 +33,7 @@ namespace mindspore {
 namespace dataset {
 // forward declare
 class MemoryPool;
+class SizeClassPool;
 class Tensor;
 class CVTensor;
 class DeviceTensor;
@@ -86,6 +87,14 @@ class GlobalContext {
   // @return the mem pool
   std::shared_ptr<MemoryPool> mem_pool() const { return mem_pool_; }
 
+  // Getter method
+  // @return the mem pool for the data of the tensors, which is the size class pool if it is enabled by the config
+  std::shared_ptr<MemoryPool> tensor_mem_pool() const;
+
+  // Getter method
+  // @return the size class pool for the data of the tensors, shared by all the pipelines
+  std::shared_ptr<SizeClassPool> size_class_pool() const { return size_class_pool_; }
+
   // Getter method
   // @return the tensor allocator as raw pointer
   const TensorAlloc *tensor_allocator() const { return tensor_allocator_.get(); }
@@ -113,6 +122,7 @@ class GlobalContext {
   static std::once_flag init_instance_flag_;
   static std::unique_ptr<GlobalContext> global_context_;        // The instance of the singleton (global)
   std::shared_ptr<MemoryPool> mem_pool_;                        // A global memory pool
+  std::shared_ptr<SizeClassPool> size_class_pool_;              // A global size class pool for the tensor data
   std::shared_ptr<ConfigManager> config_manager_;               // The configs
   std::unique_ptr<TensorAlloc> tensor_allocator_;               // An allocator for Tensors
   std::unique_ptr<CVTensorAlloc> cv_tensor_allocator_;          // An allocator for CV Tensors
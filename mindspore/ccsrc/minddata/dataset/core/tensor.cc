@@ -63,9 +63,11 @@ namespace dataset {
     break;                                                                                      \
   }
 
+thread_local TensorPlacement *Tensor::thread_placement_ = nullptr;
+
 Tensor::Tensor(const TensorShape &shape, const DataType &type) : shape_(shape), type_(type), data_(nullptr) {
   // grab the mem pool from global context and create the allocator for char data area
-  std::shared_ptr<MemoryPool> global_pool = GlobalContext::Instance()->mem_pool();
+  std::shared_ptr<MemoryPool> global_pool = GlobalContext::Instance()->tensor_mem_pool();
   data_allocator_ = std::make_unique<Allocator<unsigned char>>(global_pool);
 }
 
@@ -74,7 +76,8 @@ Tensor::Tensor(Tensor &&other) noexcept
       type_(other.type()),
       data_(other.GetMutableBuffer()),
       data_end_(other.data_end_),
-      data_allocator_(std::move(other.data_allocator_)) {
+      data_allocator_(std::move(other.data_allocator_)),
+      external_data_(std::move(other.external_data_)) {
   other.Invalidate();
 }
 
@@ -85,6 +88,7 @@ Tensor &Tensor::operator=(Tensor &&other) noexcept {
     data_ = other.GetMutableBuffer();
     data_end_ = other.data_end_;
     data_allocator_ = std::move(other.data_allocator_);
+    external_data_ = std::move(other.external_data_);
     yuv_shape_ = other.yuv_shape_;
     other.Invalidate();
   }
@@ -95,6 +99,13 @@ Status Tensor::CreateEmpty(const TensorShape &shape, const DataType &type, Tenso
   CHECK_FAIL_RETURN_UNEXPECTED(shape.known(), "Invalid shape.");
   CHECK_FAIL_RETURN_UNEXPECTED(type != DataType::DE_UNKNOWN, "Invalid data type.");
   RETURN_UNEXPECTED_IF_NULL(out);
+  if (thread_placement_ != nullptr && type.IsNumeric()) {
+    std::shared_ptr<void> owner = nullptr;
+    uchar *placed_data = thread_placement_->Place(shape, type, &owner);
+    if (placed_data != nullptr) {
+      return CreateFromExternalMemory(shape, type, placed_data, std::move(owner), out);
+    }
+  }
   const TensorAlloc *alloc = GlobalContext::Instance()->tensor_allocator();
   *out = std::allocate_shared<Tensor>(*alloc, shape, type);
   CHECK_FAIL_RETURN_UNEXPECTED(out != nullptr, "Allocate memory failed.");
@@ -171,6 +182,24 @@ Status Tensor::CreateFromMemory(const TensorShape &shape, const DataType &type,
   return Status::OK();
 }
 
+Status Tensor::CreateFromExternalMemory(const TensorShape &shape, const DataType &type, uchar *src,
+                                        std::shared_ptr<void> owner, TensorPtr *out) {
+  RETURN_UNEXPECTED_IF_NULL(src);
+  RETURN_UNEXPECTED_IF_NULL(owner);
+  RETURN_UNEXPECTED_IF_NULL(out);
+  CHECK_FAIL_RETURN_UNEXPECTED(shape.known(), "Invalid shape.");
+  CHECK_FAIL_RETURN_UNEXPECTED(type.IsNumeric() && type != DataType::DE_UNKNOWN,
+                               "Only numeric tensor can share the external memory.");
+  const TensorAlloc *alloc = GlobalContext::Instance()->tensor_allocator();
+  *out = std::allocate_shared<Tensor>(*alloc, shape, type);
+  CHECK_FAIL_RETURN_UNEXPECTED(out != nullptr, "Allocate memory failed.");
+  int64_t byte_size = (*out)->SizeInBytes();
+  (*out)->data_ = src;
+  (*out)->data_end_ = src + byte_size;
+  (*out)->external_data_ = std::move(owner);
+  return Status::OK();
+}
+
 #ifdef ENABLE_PYTHON
 Status Tensor::CreateFromNpString(py::array arr, std::shared_ptr<Tensor> *out) {
   RETURN_UNEXPECTED_IF_NULL(out);
@@ -228,6 +257,29 @@ Status Tensor::CreateFromNpArray(const py::array &arr, std::shared_ptr<Tensor> *
   }
   return Status::OK();
 }
+
+Status Tensor::CreateFromNpArrayNoCopy(const py::array &arr, std::shared_ptr<Tensor> *out) {
+  RETURN_UNEXPECTED_IF_NULL(out);
+  DataType type = DataType::FromNpArray(arr);
+  auto *data = static_cast<unsigned char *>(const_cast<void *>(arr.data()));
+  // Only the numeric arrays which are contiguous, aligned and writeable share the memory, the others are copied. The
+  // read-only arrays are mostly views of the memory owned by others, like the bytes objects or the mapped files.
+  bool contiguous = (arr.flags() & py::array::c_style) != 0;
+  if (!type.IsNumeric() || type == DataType::DE_UNKNOWN || !contiguous || !arr.writeable() || arr.size() == 0 ||
+      data == nullptr || reinterpret_cast<uintptr_t>(data) % type.SizeInBytes() != 0) {
+    return CreateFromNpArray(arr, out);
+  }
+  std::vector<dsize_t> shape(arr.shape(), arr.shape() + arr.ndim());
+  // The tensor may be destroyed in any thread, so the GIL is acquired to release the array.
+  std::shared_ptr<void> owner(new py::array(arr), [](void *ptr) {
+    if (Py_IsInitialized() == 0) {
+      return;
+    }
+    py::gil_scoped_acquire gil_acquire;
+    delete static_cast<py::array *>(ptr);
+  });
+  return CreateFromExternalMemory(TensorShape(shape), type, data, std::move(owner), out);
+}
 #endif
 
 #ifndef ENABLE_ANDROID
@@ -369,7 +421,11 @@ Status Tensor::CopyStridedArray(unsigned char *dst, unsigned char *src, std::vec
 // Description: Destructor
 Tensor::~Tensor() {
   if (data_ != nullptr) {
-    if (data_allocator_ != nullptr) {
+    if (external_data_ != nullptr) {
+      // The external memory is released by its owner.
+      data_ = nullptr;
+      data_end_ = nullptr;
+    } else if (data_allocator_ != nullptr) {
       data_allocator_->deallocate(data_);
       data_ = nullptr;
       data_end_ = nullptr;
@@ -484,7 +540,12 @@ void Tensor::PrintData(std::ostream &out) const {
 Status Tensor::AllocateBuffer(const dsize_t &length) {
   RETURN_UNEXPECTED_IF_NULL(data_allocator_);
   if (data_ == nullptr) {
-    data_ = data_allocator_->allocate(length);
+    try {
+      data_ = data_allocator_->allocate(length);
+    } catch (const std::bad_alloc &e) {
+      RETURN_STATUS_OOM("Failed to allocate " + std::to_string(length) +
+                        " bytes of memory for tensor, the memory limit of the tensor memory pool may be reached.");
+    }
     CHECK_FAIL_RETURN_UNEXPECTED(data_ != nullptr, "Failed to allocate memory for tensor.");
     data_end_ = data_ + length;
   }
@@ -507,6 +568,7 @@ void Tensor::Invalidate() {
   data_ = nullptr;
   data_end_ = nullptr;
   data_allocator_ = nullptr;
+  external_data_ = nullptr;
 }
 
 template <typename T>
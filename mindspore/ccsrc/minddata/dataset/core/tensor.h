@@ -19,6 +19,7 @@
 #include <deque>
 #include <memory>
 #include <string>
+#include <string_view>
 #include <vector>
 #include "./securec.h"
 #include "minddata/dataset/util/log_adapter.h"
@@ -58,6 +59,20 @@ using TensorAllocPtr = std::shared_ptr<Allocator<Tensor>>;  // An allocator shar
 using offset_t = uint32_t;                                  // type of offset values to store strings locations
 using TensorPtr = std::shared_ptr<Tensor>;
 
+/// The memory that the numeric tensors created in a thread are placed in, which lets a producer write its output
+/// into the memory of its consumer directly.
+class TensorPlacement {
+ public:
+  virtual ~TensorPlacement() = default;
+
+  /// Get the memory for a tensor of the shape and type.
+  /// \param[in] shape shape of the tensor
+  /// \param[in] type type of the tensor
+  /// \param[out] owner the owner which keeps the memory alive
+  /// \return The memory of the tensor, or nullptr to allocate the tensor as usual
+  virtual uchar *Place(const TensorShape &shape, const DataType &type, std::shared_ptr<void> *owner) = 0;
+};
+
 class Tensor {
  public:
   Tensor() = delete;
@@ -80,6 +95,7 @@ class Tensor {
   Tensor &operator=(Tensor &&other) noexcept;
 
   /// Create a numeric tensor with type and shape. Items of the tensor would be uninitialized.
+  /// \note The tensor is placed in the memory of the placement guarded in the calling thread if it is given.
   /// \param[in] shape shape of the output tensor
   /// \param[in] type type of the output tensor
   /// \param[out] out Generated tensor
@@ -105,6 +121,32 @@ class Tensor {
   static Status CreateFromMemory(const TensorShape &shape, const DataType &type, const uchar *src,
                                  const dsize_t &length, TensorPtr *out);
 
+  /// Create a numeric tensor which shares the memory of an external buffer instead of copying it. The owner keeps
+  /// the buffer alive, and it is released when the tensor is destroyed.
+  /// \param[in] shape shape of the output tensor
+  /// \param[in] type type of the output tensor
+  /// \param[in] src pointer to the external buffer
+  /// \param[in] owner the owner of the external buffer
+  /// \param[out] out Generated tensor
+  /// \return Status code
+  static Status CreateFromExternalMemory(const TensorShape &shape, const DataType &type, uchar *src,
+                                         std::shared_ptr<void> owner, TensorPtr *out);
+
+  /// Place the numeric tensors created by CreateEmpty in the calling thread with the placement while the guard is
+  /// alive, the previous placement is restored when the guard is destroyed.
+  class PlacementGuard {
+   public:
+    explicit PlacementGuard(TensorPlacement *placement) : prev_placement_(thread_placement_) {
+      thread_placement_ = placement;
+    }
+    ~PlacementGuard() { thread_placement_ = prev_placement_; }
+    PlacementGuard(const PlacementGuard &) = delete;
+    PlacementGuard &operator=(const PlacementGuard &) = delete;
+
+   private:
+    TensorPlacement *prev_placement_;
+  };
+
   /// Create a copy of the input tensor
   /// \param[in] in original tensor to be copied
   /// \param[out] out output tensor to be generated
@@ -124,6 +166,14 @@ class Tensor {
   /// \param[out] out Created tensor
   /// \return Status Code
   static Status CreateFromNpArray(const py::array &arr, TensorPtr *out);
+
+  /// Create a Tensor which shares the memory of a given py::array without copying it. The array is referenced by the
+  /// tensor until the tensor is destroyed, so it should not be modified after the tensor is created. The arrays which
+  /// are not numeric, contiguous, aligned and writeable are copied as CreateFromNpArray does.
+  /// \param[in] arr py::array
+  /// \param[out] out Created tensor
+  /// \return Status Code
+  static Status CreateFromNpArrayNoCopy(const py::array &arr, TensorPtr *out);
 #endif
 
 #ifndef ENABLE_ANDROID
@@ -736,6 +786,8 @@ class Tensor {
   CharAllocPtr data_allocator_;
   /// pointer to the end of the physical data
   unsigned char *data_end_ = nullptr;
+  /// owner of the external memory shared by the tensor, data_ is not freed by the tensor if it is set
+  std::shared_ptr<void> external_data_;
 
   /// shape for interpretation of YUV image
   std::vector<uint32_t> yuv_shape_;
@@ -762,6 +814,9 @@ class Tensor {
   /// const of the size of the offset variable
   static constexpr uint8_t kOffsetSize = sizeof(offset_t);
 
+  /// the placement of the tensors created in the thread, nullptr if the tensors are allocated as usual
+  static thread_local TensorPlacement *thread_placement_;
+
 #ifdef ENABLE_PYTHON
   /// Helper function to create a tensor from Numpy array of strings
   /// \param[in] arr Numpy array
@@ -846,6 +901,61 @@ inline Status Tensor::CreateFromVector<std::string>(const std::vector<std::strin
   }
   return Status::OK();
 }
+
+/// Create a string Tensor from a vector of string views without constructing the strings, the memory layout is the
+/// same as the Tensor created from a vector of strings.
+/// \param[in] items elements of the tensor
+/// \param[in] shape shape of the output tensor
+/// \param[out] out output argument to hold the created Tensor
+/// \return Status Code
+template <>
+inline Status Tensor::CreateFromVector<std::string_view>(const std::vector<std::string_view> &items,
+                                                         const TensorShape &shape, TensorPtr *out) {
+  RETURN_UNEXPECTED_IF_NULL(out);
+  CHECK_FAIL_RETURN_UNEXPECTED(
+    static_cast<dsize_t>(items.size()) == shape.NumOfElements(),
+    "Number of elements in the vector does not match the number of elements of the shape required");
+  const TensorAlloc *alloc = GlobalContext::Instance()->tensor_allocator();
+  *out = std::allocate_shared<Tensor>(*alloc, TensorShape({static_cast<dsize_t>(items.size())}),
+                                      DataType(DataType::DE_STRING));
+  CHECK_FAIL_RETURN_UNEXPECTED(out != nullptr, "Allocate memory failed.");
+  if (items.empty()) {
+    if (shape.known()) {
+      return (*out)->Reshape(shape);
+    }
+  }
+  auto length_sum = [](size_t sum, const std::string_view &s) { return s.length() + sum; };
+  size_t total_length = std::accumulate(items.begin(), items.end(), static_cast<size_t>(0), length_sum);
+  size_t num_bytes = (kOffsetSize + 1) * (*out)->shape_.NumOfElements() + kOffsetSize + total_length;
+
+  RETURN_IF_NOT_OK((*out)->AllocateBuffer(num_bytes));
+  auto offset_arr = reinterpret_cast<offset_t *>((*out)->data_);
+  uchar *buf = (*out)->GetStringsBuffer();
+
+  offset_t offset = buf - (*out)->data_;  // the first string will start here
+  uint32_t i = 0;
+  for (const auto &str : items) {
+    offset_arr[i++] = offset;
+    num_bytes -= kOffsetSize;
+    if (!str.empty()) {
+      int ret_code = memcpy_s((*out)->data_ + offset, num_bytes, str.data(), str.length());
+      CHECK_FAIL_RETURN_UNEXPECTED(ret_code == 0, "Cannot copy string into Tensor");
+    }
+    (*out)->data_[offset + str.length()] = '\0';
+    offset = offset + str.length() + 1;
+    num_bytes -= str.length() + 1;
+  }
+  // store one more offset value so we can get the length of the last string
+  offset_arr[i] = offset;
+
+  (*out)->data_end_ = (*out)->data_ + offset_arr[i];
+
+  MS_ASSERT(num_bytes == 0);
+  if (shape.known()) {
+    RETURN_IF_NOT_OK((*out)->Reshape(shape));
+  }
+  return Status::OK();
+}
 /// Create a string scalar Tensor from the given value.
 /// \param[in] item value
 /// \param[out] out Created tensor
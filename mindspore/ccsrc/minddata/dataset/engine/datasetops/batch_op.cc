@@ -22,6 +22,7 @@
 #include "minddata/dataset/core/pybind_support.h"
 #endif
 
+#include "minddata/dataset/engine/datasetops/map_op/map_op.h"
 #include "minddata/dataset/kernels/data/data_utils.h"
 #include "minddata/dataset/util/status.h"
 
@@ -68,7 +69,8 @@ BatchOp::BatchOp(int32_t batch_size, bool drop, bool pad, int32_t op_queue_size,
       pad_info_(pad_map),
       batch_num_(0),
       batch_cnt_(0),
-      python_mp_(nullptr) {
+      python_mp_(nullptr),
+      batch_slots_(nullptr) {
   // Adjust connector queue size.  After batch each row is batch_size times larger
   worker_connector_size_ = std::max(1, worker_connector_size_ / start_batch_size_);
   if (num_workers == 1) {
@@ -121,6 +123,8 @@ Status BatchOp::operator()() {
       RETURN_IF_NOT_OK(worker_in_queues_[NextWorkerID()]->EmplaceBack(
         std::make_pair(std::move(table), CBatchInfo(epoch_num, batch_num++, cnt + 1 - epoch_num))));
       cnt++;
+    } else if (batch_slots_ != nullptr && table->empty() == false) {
+      batch_slots_->Discard(epoch_num, batch_num);
     }
     table = std::make_unique<TensorQTable>();  // this drops when drop == true
     // end of the current epoch, batch_num should start from 0 again
@@ -256,10 +260,78 @@ Status BatchOp::MakeBatchedRow(std::pair<std::unique_ptr<TensorQTable>, CBatchIn
   if (pad_) {
     RETURN_IF_NOT_OK(PadColumns(&table_pair.first, pad_info_, column_name_id_map_));
   }  // do padding if needed
+  if (batch_slots_ != nullptr) {
+    return BatchRowsFromSlots(&table_pair.first, table_pair.second, new_row);
+  }
   RETURN_IF_NOT_OK(BatchRows(&table_pair.first, new_row, table_pair.first->size()));
   return Status::OK();
 }
 
+Status BatchOp::BatchRowsFromSlots(std::unique_ptr<TensorQTable> *src, const CBatchInfo &info, TensorRow *dest) {
+  RETURN_UNEXPECTED_IF_NULL(src);
+  RETURN_UNEXPECTED_IF_NULL(*src);
+  RETURN_UNEXPECTED_IF_NULL(dest);
+  CHECK_FAIL_RETURN_UNEXPECTED(!(*src)->empty(), "[Internal ERROR] Source table of batch is empty.");
+  TensorRow slot_tensors;
+  batch_slots_->Take(info.epoch_num_, info.batch_num_, &slot_tensors);
+  size_t num_rows = (*src)->size();
+  size_t num_columns = (*src)->front().size();
+  bool all_columns = slot_tensors.size() == num_columns;
+
+  TensorRow handed_over(num_columns, nullptr);
+  auto rest_table = std::make_unique<TensorQTable>(num_rows, TensorRow());
+  for (size_t i = 0; i < num_columns; i++) {
+    const std::shared_ptr<Tensor> batch_tensor = i < slot_tensors.size() ? slot_tensors[i] : nullptr;
+    bool all_in_slots = batch_tensor != nullptr && std::all_of((*src)->begin(), (*src)->end(), [&](const auto &row) {
+                          return i < row.size() && row[i] == batch_tensor;
+                        });
+    // The remainder batch is the first rows of the batch tensor, which is handed over without copying either.
+    if (all_columns && all_in_slots) {
+      if (num_rows == static_cast<size_t>(batch_slots_->batch_size())) {
+        handed_over[i] = batch_tensor;
+      } else {
+        RETURN_IF_NOT_OK(BatchSlots::SliceRows(batch_tensor, static_cast<int64_t>(num_rows), &handed_over[i]));
+      }
+      continue;
+    }
+    // The rows written into a batch tensor which can't be handed over view their slots, and are copied once by
+    // BatchRows.
+    for (size_t j = 0; j < num_rows; j++) {
+      CHECK_FAIL_RETURN_UNEXPECTED(i < (*src)->at(j).size(), "[Internal ERROR] Rows of batch have different sizes.");
+      std::shared_ptr<Tensor> tensor = std::move((*src)->at(j)[i]);
+      if (batch_tensor != nullptr && tensor == batch_tensor) {
+        RETURN_IF_NOT_OK(BatchSlots::RestoreRow(batch_tensor, static_cast<int64_t>(j), &tensor));
+      }
+      rest_table->at(j).push_back(std::move(tensor));
+    }
+  }
+
+  TensorRow rest_row;
+  if (!rest_table->front().empty()) {
+    RETURN_IF_NOT_OK(BatchRows(&rest_table, &rest_row, num_rows));
+  }
+  size_t rest_index = 0;
+  for (size_t i = 0; i < num_columns; i++) {
+    dest->push_back(handed_over[i] != nullptr ? handed_over[i] : rest_row.at(rest_index++));
+  }
+  return Status::OK();
+}
+
+Status BatchOp::PrepareOperator() {
+  RETURN_IF_NOT_OK(DatasetOp::PrepareOperator());
+  if (child_.size() != 1 || pad_ || start_batch_size_ <= 1 || IsPython()) {
+    return Status::OK();
+  }
+  // The rows of the child MapOp arrive in order, so each map worker knows the batch and the slot of its row.
+  auto map_op = std::dynamic_pointer_cast<MapOp>(child_[0]);
+  if (map_op != nullptr) {
+    batch_slots_ = std::make_shared<BatchSlots>(start_batch_size_);
+    map_op->SetBatchSlots(batch_slots_);
+    MS_LOG(INFO) << "Batch op fuses with its child map op, the map workers write rows into the batch directly.";
+  }
+  return Status::OK();
+}
+
 Status BatchOp::EofReceived(int32_t) { return Status::OK(); }
 
 Status BatchOp::EoeReceived(int32_t) {
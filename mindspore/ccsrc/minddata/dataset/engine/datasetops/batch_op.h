@@ -30,6 +30,7 @@
 #include "minddata/dataset/core/config_manager.h"
 #include "minddata/dataset/core/tensor.h"
 #include "minddata/dataset/engine/dataset_iterator.h"
+#include "minddata/dataset/engine/datasetops/batch_slots.h"
 #include "minddata/dataset/engine/datasetops/parallel_op.h"
 #include "minddata/dataset/util/status.h"
 
@@ -193,6 +194,11 @@ class BatchOp : public ParallelOp<std::pair<std::unique_ptr<TensorQTable>, CBatc
   // @return Name of the current Op
   std::string Name() const override { return kBatchOp; }
 
+  // During tree prepare phase, fuse the execution with the child MapOp if the batch size is fixed and no padding or
+  // per_batch_map is needed, so the map workers write the rows into the preallocated batch tensors.
+  // @return Status The status code returned
+  Status PrepareOperator() override;
+
   // batch the rows in src table then put it to dest table
   // @param const std::unique_ptr<TensorQTable> *src - table that has the rows for batching
   // @param const std::unique_ptr<TensorQTable> *dest - dest_table to hold batched rows
@@ -237,6 +243,14 @@ class BatchOp : public ParallelOp<std::pair<std::unique_ptr<TensorQTable>, CBatc
   // @return Status The status code returned
   Status MakeBatchedRow(std::pair<std::unique_ptr<TensorQTable>, CBatchInfo> table_pair, TensorRow *new_row);
 
+  // Batch the rows whose tensors are written into the batch tensors by the map workers. The columns filled by all the
+  // rows of a full batch are handed over directly, and the other columns are batched by BatchRows.
+  // @param std::unique_ptr<TensorQTable> *src - table that has the rows for batching
+  // @param const CBatchInfo &info - the epoch and the index of the batch
+  // @param TensorRow *dest - the batched row
+  // @return Status The status code returned
+  Status BatchRowsFromSlots(std::unique_ptr<TensorQTable> *src, const CBatchInfo &info, TensorRow *dest);
+
 #ifdef ENABLE_PYTHON
   // Function that calls pyfunc to perform map on batch
   // @param (std::pair<std::unique_ptr<TensorQTable>, batch_stats> *table_pair - contains un-batched tensor
@@ -294,6 +308,7 @@ class BatchOp : public ParallelOp<std::pair<std::unique_ptr<TensorQTable>, CBatc
   py::function batch_map_func_;   // Function pointer of per batch map function
 #endif
   std::shared_ptr<PythonMultiprocessingRuntime> python_mp_;  // python multiprocessing instance
+  std::shared_ptr<BatchSlots> batch_slots_;                  // batch tensors shared with the child MapOp if fused
 
  protected:
   Status Launch() override;
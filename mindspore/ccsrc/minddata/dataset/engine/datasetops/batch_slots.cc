@@ -0,0 +1,231 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "minddata/dataset/engine/datasetops/batch_slots.h"
+
+#include <algorithm>
+#include <cstring>
+#include <vector>
+
+namespace mindspore {
+namespace dataset {
+uchar *SlotPlacement::Place(const TensorShape &shape, const DataType &type, std::shared_ptr<void> *owner) {
+  if (owner == nullptr) {
+    return nullptr;
+  }
+  for (auto &target : targets_) {
+    if (!target.placed && target.type == type && target.shape == shape) {
+      target.placed = true;
+      *owner = target.batch_tensor;
+      return target.addr;
+    }
+  }
+  return nullptr;
+}
+
+BatchSlots::BatchSlots(int32_t batch_size) : batch_size_(batch_size) {}
+
+void BatchSlots::Prepare(int64_t epoch_num, int64_t row_num, SlotPlacement *placement) {
+  if (placement == nullptr || batch_size_ <= 0) {
+    return;
+  }
+  placement->targets_.clear();
+  std::vector<SlotPlacement::Target> targets;
+  {
+    std::unique_lock<std::mutex> lock(mux_);
+    auto iter = batches_.find(std::make_pair(epoch_num, row_num / batch_size_));
+    if (iter == batches_.end()) {
+      return;
+    }
+    const SlotBatch &batch = iter->second;
+    dsize_t slot = row_num % batch_size_;
+    for (size_t i = 0; i < batch.tensors.size() && i < batch.buffers.size(); i++) {
+      const std::shared_ptr<Tensor> &batch_tensor = batch.tensors[i];
+      if (batch_tensor == nullptr || batch.buffers[i] == nullptr) {
+        continue;
+      }
+      std::vector<dsize_t> dims = batch_tensor->shape().AsVector();
+      TensorShape row_shape(std::vector<dsize_t>(dims.begin() + 1, dims.end()));
+      auto row_bytes = static_cast<size_t>(row_shape.NumOfElements()) * batch_tensor->type().SizeInBytes();
+      uchar *addr = batch.buffers[i] + static_cast<size_t>(slot) * row_bytes;
+      targets.push_back({row_shape, batch_tensor->type(), addr, batch_tensor, false});
+    }
+  }
+  for (const auto &target : targets) {
+    auto same_count = std::count_if(targets.begin(), targets.end(), [&target](const SlotPlacement::Target &other) {
+      return other.type == target.type && other.shape == target.shape;
+    });
+    if (same_count == 1) {
+      placement->targets_.push_back(target);
+    }
+  }
+}
+
+Status BatchSlots::Write(int64_t epoch_num, int64_t row_num, TensorRow *row) {
+  RETURN_UNEXPECTED_IF_NULL(row);
+  CHECK_FAIL_RETURN_UNEXPECTED(batch_size_ > 0, "[Internal ERROR] Batch size of batch slots should be positive.");
+  auto key = std::make_pair(epoch_num, row_num / batch_size_);
+  dsize_t slot = row_num % batch_size_;
+  size_t num_columns = row->size();
+  const SlotBatch *batch = nullptr;
+  {
+    std::unique_lock<std::mutex> lock(mux_);
+    SlotBatch &slot_batch = batches_[key];
+    // The first row written allocates the batch tensors by its shapes and types.
+    if (slot_batch.tensors.size() == 0) {
+      RETURN_IF_NOT_OK(AllocateBatch(*row, &slot_batch));
+    }
+    batch = &slot_batch;
+  }
+  if (batch->tensors.size() != num_columns) {
+    return Status::OK();
+  }
+
+  // The batch tensors aren't changed after the allocation and the batch isn't taken before all its rows are written,
+  // so the rows copy into their own slots without the lock.
+  std::vector<bool> fits(num_columns, false);
+  std::vector<uchar *> slot_addrs(num_columns, nullptr);
+  for (size_t i = 0; i < num_columns; i++) {
+    const std::shared_ptr<Tensor> &tensor = (*row)[i];
+    const std::shared_ptr<Tensor> &batch_tensor = batch->tensors[i];
+    if (batch_tensor == nullptr || tensor == nullptr || tensor->type() != batch_tensor->type() ||
+        !FitSlot(tensor->shape(), batch_tensor->shape())) {
+      continue;
+    }
+    fits[i] = true;
+    auto row_bytes = static_cast<size_t>(tensor->SizeInBytes());
+    if (row_bytes != 0) {
+      slot_addrs[i] = batch->buffers[i] + static_cast<size_t>(slot) * row_bytes;
+    }
+  }
+  // The tensor placed in the slot of another column is copied out before the slot is overwritten by that column.
+  for (size_t i = 0; i < num_columns; i++) {
+    const std::shared_ptr<Tensor> &tensor = (*row)[i];
+    if (tensor == nullptr || tensor->GetBuffer() == nullptr || tensor->GetBuffer() == slot_addrs[i]) {
+      continue;
+    }
+    if (std::find(slot_addrs.begin(), slot_addrs.end(), tensor->GetBuffer()) != slot_addrs.end()) {
+      std::shared_ptr<Tensor> own_tensor;
+      RETURN_IF_NOT_OK(Tensor::CreateFromTensor(tensor, &own_tensor));
+      (*row)[i] = std::move(own_tensor);
+    }
+  }
+
+  for (size_t i = 0; i < num_columns; i++) {
+    if (!fits[i]) {
+      continue;
+    }
+    const std::shared_ptr<Tensor> &tensor = (*row)[i];
+    auto row_bytes = static_cast<size_t>(tensor->SizeInBytes());
+    // The tensor created in its slot by the last TensorOp of the map worker needn't be copied.
+    if (row_bytes != 0 && tensor->GetBuffer() != slot_addrs[i]) {
+      if (row_bytes < SECUREC_MEM_MAX_LEN) {
+        int ret_code = memcpy_s(slot_addrs[i], row_bytes, tensor->GetBuffer(), row_bytes);
+        CHECK_FAIL_RETURN_UNEXPECTED(ret_code == 0, "[Internal ERROR] Failed to copy the row into the batch slot.");
+      } else {
+        (void)std::memcpy(slot_addrs[i], tensor->GetBuffer(), row_bytes);
+      }
+    }
+    (*row)[i] = batch->tensors[i];
+  }
+  return Status::OK();
+}
+
+Status BatchSlots::AllocateBatch(const TensorRow &row, SlotBatch *batch) {
+  size_t num_columns = row.size();
+  batch->tensors.resize(num_columns);
+  batch->buffers.resize(num_columns, nullptr);
+  for (size_t i = 0; i < num_columns; i++) {
+    const std::shared_ptr<Tensor> &tensor = row[i];
+    if (tensor == nullptr || !tensor->type().IsNumeric() || !tensor->shape().known()) {
+      continue;
+    }
+    TensorShape batch_shape = tensor->shape().PrependDim(static_cast<int64_t>(batch_size_));
+    RETURN_IF_NOT_OK(Tensor::CreateEmpty(batch_shape, tensor->type(), &batch->tensors[i]));
+    if (batch_shape.NumOfElements() != 0) {
+      TensorShape remaining = TensorShape::CreateUnknownRankShape();
+      RETURN_IF_NOT_OK(batch->tensors[i]->StartAddrOfIndex({0}, &batch->buffers[i], &remaining));
+    }
+  }
+  return Status::OK();
+}
+
+bool BatchSlots::FitSlot(const TensorShape &row_shape, const TensorShape &batch_shape) {
+  if (!row_shape.known() || row_shape.Rank() + 1 != batch_shape.Rank()) {
+    return false;
+  }
+  for (dsize_t i = 0; i < row_shape.Rank(); i++) {
+    if (row_shape[i] != batch_shape[i + 1]) {
+      return false;
+    }
+  }
+  return true;
+}
+
+void BatchSlots::Take(int64_t epoch_num, int64_t batch_num, TensorRow *columns) {
+  if (columns == nullptr) {
+    return;
+  }
+  std::unique_lock<std::mutex> lock(mux_);
+  auto iter = batches_.find(std::make_pair(epoch_num, batch_num));
+  if (iter == batches_.end()) {
+    columns->clear();
+    return;
+  }
+  *columns = std::move(iter->second.tensors);
+  (void)batches_.erase(iter);
+}
+
+void BatchSlots::Discard(int64_t epoch_num, int64_t batch_num) {
+  std::unique_lock<std::mutex> lock(mux_);
+  (void)batches_.erase(std::make_pair(epoch_num, batch_num));
+}
+
+Status BatchSlots::RestoreRow(const std::shared_ptr<Tensor> &batch_tensor, int64_t slot, std::shared_ptr<Tensor> *out) {
+  RETURN_UNEXPECTED_IF_NULL(batch_tensor);
+  RETURN_UNEXPECTED_IF_NULL(out);
+  std::vector<dsize_t> dims = batch_tensor->shape().AsVector();
+  CHECK_FAIL_RETURN_UNEXPECTED(!dims.empty() && slot >= 0 && slot < dims[0],
+                               "[Internal ERROR] The slot to restore is out of the batch.");
+  TensorShape row_shape(std::vector<dsize_t>(dims.begin() + 1, dims.end()));
+  if (row_shape.NumOfElements() == 0) {
+    return Tensor::CreateEmpty(row_shape, batch_tensor->type(), out);
+  }
+  uchar *start_addr = nullptr;
+  TensorShape remaining = TensorShape::CreateUnknownRankShape();
+  RETURN_IF_NOT_OK(batch_tensor->StartAddrOfIndex({slot}, &start_addr, &remaining));
+  // The row is copied by BatchOp when it is batched again, so it only views the slot.
+  return Tensor::CreateFromExternalMemory(row_shape, batch_tensor->type(), start_addr, batch_tensor, out);
+}
+
+Status BatchSlots::SliceRows(const std::shared_ptr<Tensor> &batch_tensor, int64_t num_rows,
+                             std::shared_ptr<Tensor> *out) {
+  RETURN_UNEXPECTED_IF_NULL(batch_tensor);
+  RETURN_UNEXPECTED_IF_NULL(out);
+  std::vector<dsize_t> dims = batch_tensor->shape().AsVector();
+  CHECK_FAIL_RETURN_UNEXPECTED(!dims.empty() && num_rows > 0 && num_rows <= dims[0],
+                               "[Internal ERROR] The rows to slice are out of the batch.");
+  dims[0] = num_rows;
+  TensorShape shape(dims);
+  if (shape.NumOfElements() == 0) {
+    return Tensor::CreateEmpty(shape, batch_tensor->type(), out);
+  }
+  uchar *start_addr = nullptr;
+  TensorShape remaining = TensorShape::CreateUnknownRankShape();
+  RETURN_IF_NOT_OK(batch_tensor->StartAddrOfIndex({0}, &start_addr, &remaining));
+  return Tensor::CreateFromExternalMemory(shape, batch_tensor->type(), start_addr, batch_tensor, out);
+}
+}  // namespace dataset
+}  // namespace mindspore
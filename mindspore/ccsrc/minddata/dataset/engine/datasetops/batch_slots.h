@@ -0,0 +1,141 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef MINDSPORE_CCSRC_MINDDATA_DATASET_ENGINE_DATASETOPS_BATCH_SLOTS_H_
+#define MINDSPORE_CCSRC_MINDDATA_DATASET_ENGINE_DATASETOPS_BATCH_SLOTS_H_
+
+#include <map>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+#include "minddata/dataset/core/tensor.h"
+#include "minddata/dataset/core/tensor_row.h"
+#include "minddata/dataset/util/status.h"
+
+namespace mindspore {
+namespace dataset {
+// SlotPlacement places the output tensors of the last TensorOp of a map worker in the slots of its row, so the op
+// writes the row into the batch tensors directly. Only the slots whose shape and type are unique in the row are
+// offered, then a tensor can't be placed in the slot of another column.
+class SlotPlacement : public TensorPlacement {
+ public:
+  SlotPlacement() = default;
+
+  ~SlotPlacement() override = default;
+
+  uchar *Place(const TensorShape &shape, const DataType &type, std::shared_ptr<void> *owner) override;
+
+ private:
+  friend class BatchSlots;
+
+  struct Target {
+    TensorShape shape;
+    DataType type;
+    uchar *addr;
+    std::shared_ptr<Tensor> batch_tensor;
+    bool placed;
+  };
+  std::vector<Target> targets_;
+};
+
+// BatchSlots holds the preallocated batch tensors for the fused execution of MapOp and its parent BatchOp.
+// The first row of a batch written by a map worker allocates one batch tensor for each numeric column. The later rows
+// of the batch are created by the last TensorOp of the map workers in their slots of the batch tensors, and the rows
+// which are not created in their slots are copied into the slots. The tensors of the row are replaced with the batch
+// tensors, and BatchOp takes the filled batch tensors and hands them downstream without allocating the batch.
+// The columns whose shape or type differ from the first row of the batch are not written into the slots, and they
+// are batched by BatchOp as before.
+class BatchSlots {
+ public:
+  // Constructor of BatchSlots
+  // @param int32_t batch_size - the fixed batch size of the BatchOp
+  explicit BatchSlots(int32_t batch_size);
+
+  // Destructor
+  ~BatchSlots() = default;
+
+  // Prepare the placement of the tensors of a row in its slots, nothing is placed if the batch isn't allocated yet.
+  // @param int64_t epoch_num - the epoch of the row, which starts from 0
+  // @param int64_t row_num - the index of the row in the epoch, which starts from 0
+  // @param SlotPlacement *placement - the placement to prepare
+  void Prepare(int64_t epoch_num, int64_t row_num, SlotPlacement *placement);
+
+  // Write the tensors of a row into its slot, the written tensors in the row are replaced by the batch tensors.
+  // It could be called by the map workers concurrently.
+  // @param int64_t epoch_num - the epoch of the row, which starts from 0
+  // @param int64_t row_num - the index of the row in the epoch, which starts from 0
+  // @param TensorRow *row - the row to write
+  // @return Status The status code returned
+  Status Write(int64_t epoch_num, int64_t row_num, TensorRow *row);
+
+  // Take the batch tensors of a batch, the batch tensor is nullptr for the column not written by any row.
+  // @param int64_t epoch_num - the epoch of the batch, which starts from 0
+  // @param int64_t batch_num - the index of the batch in the epoch, which starts from 0
+  // @param TensorRow *columns - the batch tensors of all the columns
+  void Take(int64_t epoch_num, int64_t batch_num, TensorRow *columns);
+
+  // Remove the batch tensors of a batch which is dropped.
+  // @param int64_t epoch_num - the epoch of the batch, which starts from 0
+  // @param int64_t batch_num - the index of the batch in the epoch, which starts from 0
+  void Discard(int64_t epoch_num, int64_t batch_num);
+
+  // Restore the tensor of a row from its slot when the batch tensor is not handed over as a whole. The restored tensor
+  // shares the memory of the batch tensor.
+  // @param const std::shared_ptr<Tensor> &batch_tensor - the batch tensor the row is written into
+  // @param int64_t slot - the index of the row in the batch
+  // @param std::shared_ptr<Tensor> *out - the restored tensor of the row
+  // @return Status The status code returned
+  static Status RestoreRow(const std::shared_ptr<Tensor> &batch_tensor, int64_t slot, std::shared_ptr<Tensor> *out);
+
+  // Get the batch of the first rows of a batch tensor, which shares the memory of the batch tensor. It hands over the
+  // remainder batch which has less rows than the batch size.
+  // @param const std::shared_ptr<Tensor> &batch_tensor - the batch tensor the rows are written into
+  // @param int64_t num_rows - the number of the rows
+  // @param std::shared_ptr<Tensor> *out - the batch of the rows
+  // @return Status The status code returned
+  static Status SliceRows(const std::shared_ptr<Tensor> &batch_tensor, int64_t num_rows, std::shared_ptr<Tensor> *out);
+
+  int32_t batch_size() const { return batch_size_; }
+
+ private:
+  // The batch tensors of a batch and the start addresses of their data.
+  struct SlotBatch {
+    TensorRow tensors;
+    std::vector<uchar *> buffers;
+  };
+
+  // Allocate the batch tensors by the shapes and types of the first row written into the batch.
+  // @param const TensorRow &row - the first row written into the batch
+  // @param SlotBatch *batch - the batch to allocate
+  // @return Status The status code returned
+  Status AllocateBatch(const TensorRow &row, SlotBatch *batch);
+
+  // Whether the tensor of a row fits the slot of the batch tensor, without creating the batched shape of the row.
+  // @param const TensorShape &row_shape - the shape of the tensor of the row
+  // @param const TensorShape &batch_shape - the shape of the batch tensor
+  // @return bool Whether the batch shape is the row shape with the batch dimension prepended
+  static bool FitSlot(const TensorShape &row_shape, const TensorShape &batch_shape);
+
+  const int32_t batch_size_;
+  std::mutex mux_;
+  // The batch tensors of the batches being filled, keyed by the epoch and the index of the batch.
+  std::map<std::pair<int64_t, int64_t>, SlotBatch> batches_;
+};
+}  // namespace dataset
+}  // namespace mindspore
+
+#endif  // MINDSPORE_CCSRC_MINDDATA_DATASET_ENGINE_DATASETOPS_BATCH_SLOTS_H_
@@ -350,6 +350,10 @@ class DatasetOp : public std::enable_shared_from_this<DatasetOp> {
 
   virtual std::vector<int32_t> GetMPWorkerPIDs() const;
 
+  // \brief Getter for the op specific metrics, which are saved by the profiler along with the common metrics
+  // \return The names and the values of the metrics
+  virtual std::unordered_map<std::string, int64_t> GetProfilingMetrics() const { return {}; }
+
  protected:
   // \brief Removes a parent operator from this operator
   // \notes External callers do not have access to this function
@@ -39,6 +39,8 @@ Status CpuMapJob::Run(std::vector<TensorRow> in, std::vector<TensorRow> *out) {
     TensorRow input_row = in[row];
     TensorRow result_row;
     for (size_t i = 0; i < ops_.size(); i++) {
+      // The last TensorOp creates the output tensors with the placement, e.g. in the slots of the batch.
+      Tensor::PlacementGuard placement_guard(i + 1 == ops_.size() ? output_placement_ : nullptr);
       // Call compute function for cpu
       Status rc = ops_[i]->Compute(input_row, &result_row);
       if (rc.IsError()) {
@@ -45,8 +45,12 @@ class MapJob {
   // A pure virtual run function to execute a particular map job
   virtual Status Run(std::vector<TensorRow> in, std::vector<TensorRow> *out) = 0;
 
+  // Set the placement of the output tensors of the last TensorOp, which is ignored by the jobs not run in the host.
+  void SetOutputPlacement(TensorPlacement *placement) { output_placement_ = placement; }
+
  protected:
   std::vector<std::shared_ptr<TensorOp>> ops_;
+  TensorPlacement *output_placement_{nullptr};
 };
 
 }  // namespace dataset
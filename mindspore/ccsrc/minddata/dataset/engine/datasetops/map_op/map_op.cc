@@ -38,7 +38,8 @@ MapOp::MapOp(const std::vector<std::string> &in_col_names, const std::vector<std
       tfuncs_(std::move(tensor_funcs)),
       in_columns_(in_col_names),
       out_columns_(out_col_names),
-      python_mp_(nullptr) {
+      python_mp_(nullptr),
+      batch_slots_(nullptr) {
   // Set connector size via config.
   // If caller didn't specify the out_col_names, assume they are same as the in_columns.
   if (out_columns_.empty() || out_columns_[0].empty()) {
@@ -70,13 +71,16 @@ void MapOp::Print(std::ostream &out, bool show_all) const {
 }
 
 // A helper function that fetch worker map job from local queues and extract the data and map job list
-Status MapOp::FetchNextWork(uint32_t worker_id, TensorRow *row, std::vector<std::shared_ptr<MapJob>> *job_list) {
+Status MapOp::FetchNextWork(uint32_t worker_id, TensorRow *row, std::vector<std::shared_ptr<MapJob>> *job_list,
+                            int64_t *epoch_num, int64_t *row_num) {
   std::unique_ptr<MapWorkerJob> worker_job;
   // Fetch the next worker job and TensorRow
   RETURN_IF_NOT_OK(worker_in_queues_[worker_id]->PopFront(&worker_job));
   // Extract the TensorRow and job list from the map worker job.
   *row = std::move(worker_job->tensor_row);
   *job_list = std::move(worker_job->jobs);
+  *epoch_num = worker_job->epoch_num;
+  *row_num = worker_job->row_num;
 
   return Status::OK();
 }
@@ -126,6 +130,8 @@ Status MapOp::operator()() {
   child_iterator_ = std::make_unique<ChildIterator>(this, 0, 0);
   TensorRow new_row;
   RETURN_IF_NOT_OK(child_iterator_->FetchNextTensorRow(&new_row));
+  // The position of the data rows, which locates the slots of the rows in the batches if fused with BatchOp.
+  int64_t epoch_num = 0, row_num = 0;
 
   while (!new_row.eof()) {
     if (op_current_repeats_ % GetOpNumRepeatsPerEpoch() == 0) {
@@ -140,6 +146,10 @@ Status MapOp::operator()() {
       RETURN_IF_NOT_OK(callback_manager_.StepBegin(CallbackParam(op_current_epochs_ + 1, ep_step, total_step)));
 
       std::unique_ptr<MapWorkerJob> worker_job = std::make_unique<MapWorkerJob>(std::move(new_row));
+      if (worker_job->tensor_row.Flags() == TensorRow::kFlagNone) {
+        worker_job->epoch_num = epoch_num;
+        worker_job->row_num = row_num++;
+      }
 
       // Populate map worker job for a worker to execute
       RETURN_IF_NOT_OK(GenerateWorkerJob(&worker_job));
@@ -153,6 +163,8 @@ Status MapOp::operator()() {
     // Propagate the eoe row to worker
     std::unique_ptr<MapWorkerJob> worker_job = std::make_unique<MapWorkerJob>(std::move(new_row));
     RETURN_IF_NOT_OK(worker_in_queues_[NextWorkerID()]->Add(std::move(worker_job)));
+    epoch_num++;
+    row_num = 0;
     UpdateRepeatAndEpochCounter();
     RETURN_IF_NOT_OK(child_iterator_->FetchNextTensorRow(&new_row));
   }
@@ -179,8 +191,9 @@ Status MapOp::WorkerEntry(int32_t worker_id) {
 
   TensorRow in_row;
   std::vector<std::shared_ptr<MapJob>> job_list;
+  int64_t epoch_num = 0, row_num = 0;
   // Fetch next data row and map job list
-  RETURN_IF_NOT_OK(FetchNextWork(worker_id, &in_row, &job_list));
+  RETURN_IF_NOT_OK(FetchNextWork(worker_id, &in_row, &job_list, &epoch_num, &row_num));
 
   // Now that init work is done, drop into the main fetching loop.
   // Map op does not use child iterator, and it needs to manually handle eoe and eof's itself
@@ -195,13 +208,23 @@ Status MapOp::WorkerEntry(int32_t worker_id) {
     } else {
       CHECK_FAIL_RETURN_UNEXPECTED(in_row.size() != 0, "[Internal ERROR] MapOp got an empty TensorRow.");
       TensorRow out_row;
+      // The last TensorOp writes the row into the batch directly if fused with BatchOp.
+      SlotPlacement placement;
+      if (batch_slots_ != nullptr && !job_list.empty()) {
+        batch_slots_->Prepare(epoch_num, row_num, &placement);
+        job_list.back()->SetOutputPlacement(&placement);
+      }
       // Perform the compute function of TensorOp(s) and store the result in new_tensor_table.
       RETURN_IF_NOT_OK(WorkerCompute(in_row, &out_row, job_list));
+      // Copy the final tensors which are not created in their slots into the batch if fused with BatchOp.
+      if (batch_slots_ != nullptr) {
+        RETURN_IF_NOT_OK(batch_slots_->Write(epoch_num, row_num, &out_row));
+      }
       // Push the row onto the connector for next operator to consume.
       RETURN_IF_NOT_OK(worker_out_queues_[worker_id]->EmplaceBack(std::move(out_row)));
     }
     // Fetch next data row and map job list
-    RETURN_IF_NOT_OK(FetchNextWork(worker_id, &in_row, &job_list));
+    RETURN_IF_NOT_OK(FetchNextWork(worker_id, &in_row, &job_list, &epoch_num, &row_num));
   }
   return Status::OK();
 }
@@ -26,6 +26,7 @@
 #include "minddata/dataset/api/python/python_mp.h"
 #include "minddata/dataset/callback/ds_callback.h"
 #include "minddata/dataset/engine/dataset_iterator.h"
+#include "minddata/dataset/engine/datasetops/batch_slots.h"
 #include "minddata/dataset/engine/datasetops/map_op/map_job.h"
 #include "minddata/dataset/engine/datasetops/parallel_op.h"
 #include "minddata/dataset/kernels/tensor_op.h"
@@ -43,6 +44,9 @@ struct MapWorkerJob {
   explicit MapWorkerJob(TensorRow tr) : tensor_row(std::move(tr)) {}
   std::vector<std::shared_ptr<MapJob>> jobs;
   TensorRow tensor_row;
+  // The epoch of the row and the index of the row in the epoch, both start from 0.
+  int64_t epoch_num = 0;
+  int64_t row_num = 0;
 };
 
 // MapOp class implements the Map operator. It will apply a list of operations to each record specified by column names.
@@ -136,12 +140,19 @@ class MapOp : public ParallelOp<std::unique_ptr<MapWorkerJob>, TensorRow> {
   /// \return vector of int
   std::vector<int32_t> GetMPWorkerPIDs() const override;
 
+  /// Set the batch tensors shared with the parent BatchOp, the workers write the final tensors of each row into the
+  /// slot of the row in the batch tensors.
+  /// \param batch_slots BatchSlots
+  void SetBatchSlots(std::shared_ptr<BatchSlots> batch_slots) { batch_slots_ = std::move(batch_slots); }
+
  private:
   // A helper function to create jobs for workers.
   Status GenerateWorkerJob(const std::unique_ptr<MapWorkerJob> *worker_job);
 
-  // A helper function that fetch worker map job from local queues and extract the data and map job list
-  Status FetchNextWork(uint32_t worker_id, TensorRow *row, std::vector<std::shared_ptr<MapJob>> *job_list);
+  // A helper function that fetch worker map job from local queues and extract the data, map job list and the position
+  // of the row in the epoch
+  Status FetchNextWork(uint32_t worker_id, TensorRow *row, std::vector<std::shared_ptr<MapJob>> *job_list,
+                       int64_t *epoch_num, int64_t *row_num);
 
   //  Tensorops to be read and applied by worker threads
   std::vector<std::shared_ptr<TensorOp>> tfuncs_;
@@ -162,6 +173,8 @@ class MapOp : public ParallelOp<std::unique_ptr<MapWorkerJob>, TensorRow> {
 
   std::shared_ptr<PythonMultiprocessingRuntime> python_mp_;  // python multiprocessing instance
 
+  std::shared_ptr<BatchSlots> batch_slots_;  // batch tensors shared with the parent BatchOp if fused
+
   // Private function for worker/thread to loop continuously. It comprises the main
   // logic of MapOp: getting the data from previous Op, validating user specified column names,
   // applying a list of TensorOps to each of the data, process the results and then
@@ -0,0 +1,222 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "minddata/dataset/engine/datasetops/row_spill_file.h"
+
+#if defined(_WIN32) || defined(_WIN64)
+#include <process.h>
+#else
+#include <unistd.h>
+#endif
+#include <algorithm>
+#include <atomic>
+#include <utility>
+#include <vector>
+
+#include "minddata/dataset/util/log_adapter.h"
+#include "minddata/dataset/util/path.h"
+
+namespace mindspore {
+namespace dataset {
+namespace {
+template <typename T>
+void AppendValue(const T &value, std::string *out) {
+  (void)out->append(reinterpret_cast<const char *>(&value), sizeof(T));
+}
+
+template <typename T>
+Status ReadValue(const std::string &in, size_t *pos, T *value) {
+  CHECK_FAIL_RETURN_UNEXPECTED(*pos + sizeof(T) <= in.size(), "[Internal ERROR] The spilled row is truncated.");
+  (void)std::copy(in.data() + *pos, in.data() + *pos + sizeof(T), reinterpret_cast<char *>(value));
+  *pos += sizeof(T);
+  return Status::OK();
+}
+}  // namespace
+
+RowSpillFile::RowSpillFile(std::string dir) : dir_(std::move(dir)), file_end_(0) {}
+
+RowSpillFile::~RowSpillFile() {
+  if (file_.is_open()) {
+    file_.close();
+  }
+  if (!file_path_.empty()) {
+    Status rc = Path(file_path_).Remove();
+    if (rc.IsError()) {
+      MS_LOG(WARNING) << "Failed to remove the spill file: " << file_path_ << ", " << rc.ToString();
+    }
+  }
+}
+
+bool RowSpillFile::Spillable(const TensorRow &row) {
+  return std::all_of(row.begin(), row.end(), [](const std::shared_ptr<Tensor> &tensor) {
+    return tensor != nullptr && tensor->shape().known();
+  });
+}
+
+Status RowSpillFile::Open() {
+  static std::atomic<int64_t> file_count(0);
+#if defined(_WIN32) || defined(_WIN64)
+  int64_t pid = _getpid();
+#else
+  int64_t pid = getpid();
+#endif
+  Path file_path = Path(dir_) / ("shuffle_spill_" + std::to_string(pid) + "_" + std::to_string(file_count++) + ".bin");
+  file_path_ = file_path.ToString();
+  file_.open(file_path_, std::ios::in | std::ios::out | std::ios::trunc | std::ios::binary);
+  if (!file_.is_open()) {
+    std::string err_msg =
+      "Failed to create the spill file: " + file_path_ + ", check the directory exists and is writable.";
+    file_path_.clear();
+    RETURN_STATUS_UNEXPECTED(err_msg);
+  }
+  return Status::OK();
+}
+
+Status RowSpillFile::Serialize(const TensorRow &row, std::string *out) {
+  RETURN_UNEXPECTED_IF_NULL(out);
+  out->clear();
+  AppendValue<int64_t>(row.getId(), out);
+  std::vector<std::string> paths = row.getPath();
+  AppendValue<uint32_t>(static_cast<uint32_t>(paths.size()), out);
+  for (const auto &path : paths) {
+    AppendValue<uint32_t>(static_cast<uint32_t>(path.size()), out);
+    (void)out->append(path);
+  }
+  AppendValue<uint32_t>(static_cast<uint32_t>(row.size()), out);
+  for (const auto &tensor : row) {
+    RETURN_UNEXPECTED_IF_NULL(tensor);
+    AppendValue<uint8_t>(static_cast<uint8_t>(tensor->type().value()), out);
+    std::vector<dsize_t> dims = tensor->shape().AsVector();
+    AppendValue<uint32_t>(static_cast<uint32_t>(dims.size()), out);
+    for (auto dim : dims) {
+      AppendValue<int64_t>(dim, out);
+    }
+    int64_t byte_size = tensor->SizeInBytes();
+    AppendValue<int64_t>(byte_size, out);
+    if (byte_size > 0) {
+      (void)out->append(reinterpret_cast<const char *>(tensor->GetBuffer()), static_cast<size_t>(byte_size));
+    }
+  }
+  return Status::OK();
+}
+
+Status RowSpillFile::Deserialize(const std::string &in, TensorRow *row) {
+  RETURN_UNEXPECTED_IF_NULL(row);
+  size_t pos = 0;
+  int64_t id = 0;
+  RETURN_IF_NOT_OK(ReadValue(in, &pos, &id));
+  uint32_t num_paths = 0;
+  RETURN_IF_NOT_OK(ReadValue(in, &pos, &num_paths));
+  std::vector<std::string> paths;
+  for (uint32_t i = 0; i < num_paths; i++) {
+    uint32_t path_size = 0;
+    RETURN_IF_NOT_OK(ReadValue(in, &pos, &path_size));
+    CHECK_FAIL_RETURN_UNEXPECTED(pos + path_size <= in.size(), "[Internal ERROR] The spilled row is truncated.");
+    (void)paths.emplace_back(in, pos, path_size);
+    pos += path_size;
+  }
+  uint32_t num_tensors = 0;
+  RETURN_IF_NOT_OK(ReadValue(in, &pos, &num_tensors));
+  TensorRow result(id, {});
+  for (uint32_t i = 0; i < num_tensors; i++) {
+    uint8_t type = 0;
+    RETURN_IF_NOT_OK(ReadValue(in, &pos, &type));
+    CHECK_FAIL_RETURN_UNEXPECTED(type < DataType::NUM_OF_TYPES, "[Internal ERROR] Invalid type of spilled tensor.");
+    uint32_t rank = 0;
+    RETURN_IF_NOT_OK(ReadValue(in, &pos, &rank));
+    std::vector<dsize_t> dims(rank);
+    for (uint32_t j = 0; j < rank; j++) {
+      RETURN_IF_NOT_OK(ReadValue(in, &pos, &dims[j]));
+    }
+    int64_t byte_size = 0;
+    RETURN_IF_NOT_OK(ReadValue(in, &pos, &byte_size));
+    CHECK_FAIL_RETURN_UNEXPECTED(byte_size >= 0 && pos + static_cast<size_t>(byte_size) <= in.size(),
+                                 "[Internal ERROR] The spilled row is truncated.");
+    std::shared_ptr<Tensor> tensor;
+    DataType data_type(static_cast<DataType::Type>(type));
+    if (byte_size == 0) {
+      RETURN_IF_NOT_OK(Tensor::CreateEmpty(TensorShape(dims), data_type, &tensor));
+    } else {
+      RETURN_IF_NOT_OK(Tensor::CreateFromMemory(TensorShape(dims), data_type,
+                                                reinterpret_cast<const uchar *>(in.data() + pos), byte_size, &tensor));
+    }
+    pos += static_cast<size_t>(byte_size);
+    result.push_back(std::move(tensor));
+  }
+  result.setPath(paths);
+  *row = std::move(result);
+  return Status::OK();
+}
+
+Status RowSpillFile::Write(const TensorRow &row, Extent *extent) {
+  RETURN_UNEXPECTED_IF_NULL(extent);
+  if (!file_.is_open()) {
+    RETURN_IF_NOT_OK(Open());
+  }
+  std::string buffer;
+  RETURN_IF_NOT_OK(Serialize(row, &buffer));
+  auto length = static_cast<int64_t>(buffer.size());
+  int64_t offset = file_end_;
+  // Best fit from the free extents, the unused tail of the extent is kept as a smaller free extent.
+  auto iter = free_extents_.lower_bound(length);
+  if (iter != free_extents_.end()) {
+    offset = iter->second;
+    int64_t remaining = iter->first - length;
+    (void)free_extents_.erase(iter);
+    if (remaining > 0) {
+      (void)free_extents_.emplace(remaining, offset + length);
+    }
+  } else {
+    file_end_ += length;
+  }
+  (void)file_.seekp(offset);
+  (void)file_.write(buffer.data(), length);
+  if (!file_.good()) {
+    file_.clear();
+    RETURN_STATUS_UNEXPECTED("Failed to write the spill file: " + file_path_ + ", check the free space of the disk.");
+  }
+  extent->offset = offset;
+  extent->length = length;
+  return Status::OK();
+}
+
+Status RowSpillFile::Read(Extent *extent, TensorRow *row) {
+  RETURN_UNEXPECTED_IF_NULL(extent);
+  RETURN_UNEXPECTED_IF_NULL(row);
+  CHECK_FAIL_RETURN_UNEXPECTED(file_.is_open() && extent->Valid() && extent->offset + extent->length <= file_end_,
+                               "[Internal ERROR] Invalid extent of the spilled row.");
+  std::string buffer(static_cast<size_t>(extent->length), '\0');
+  (void)file_.seekg(extent->offset);
+  (void)file_.read(&buffer[0], extent->length);
+  if (!file_.good()) {
+    file_.clear();
+    RETURN_STATUS_UNEXPECTED("Failed to read the spill file: " + file_path_);
+  }
+  // Free the extent, the extent at the end of the file shrinks the used space instead.
+  if (extent->offset + extent->length == file_end_) {
+    file_end_ = extent->offset;
+  } else {
+    (void)free_extents_.emplace(extent->length, extent->offset);
+  }
+  extent->length = -1;
+  return Deserialize(buffer, row);
+}
+
+void RowSpillFile::Reset() {
+  free_extents_.clear();
+  file_end_ = 0;
+}
+}  // namespace dataset
+}  // namespace mindspore
@@ -0,0 +1,93 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef MINDSPORE_CCSRC_MINDDATA_DATASET_ENGINE_DATASETOPS_ROW_SPILL_FILE_H_
+#define MINDSPORE_CCSRC_MINDDATA_DATASET_ENGINE_DATASETOPS_ROW_SPILL_FILE_H_
+
+#include <fstream>
+#include <map>
+#include <string>
+
+#include "minddata/dataset/core/tensor_row.h"
+#include "minddata/dataset/util/status.h"
+
+namespace mindspore {
+namespace dataset {
+// RowSpillFile keeps the rows which do not fit in memory in a local scratch file in a compact serialized form, which
+// is the row id, the paths, and the type, shape and raw bytes of each tensor.
+// The space of a row is freed once the row is read back and reused by the rows written later, so the size of the file
+// follows the peak size of the spilled rows rather than the total size. The file is removed when the object is
+// destroyed.
+class RowSpillFile {
+ public:
+  // The location of a spilled row in the file
+  struct Extent {
+    int64_t offset = 0;
+    int64_t length = -1;  // A negative length means no row is spilled
+
+    bool Valid() const { return length >= 0; }
+  };
+
+  // Constructor of RowSpillFile, the file is created on the first write.
+  // @param std::string dir - the directory to create the scratch file in
+  explicit RowSpillFile(std::string dir);
+
+  // Destructor, which removes the scratch file
+  ~RowSpillFile();
+
+  // Check whether a row can be spilled, the row can be spilled only if all its tensors have a known shape.
+  // @param const TensorRow &row - the row to check
+  // @return bool - true if the row can be spilled
+  static bool Spillable(const TensorRow &row);
+
+  // Serialize a row and write it into the file.
+  // @param const TensorRow &row - the row to write
+  // @param Extent *extent - the location of the written row in the file
+  // @return Status The status code returned
+  Status Write(const TensorRow &row, Extent *extent);
+
+  // Read a row back from the file and free its space.
+  // @param Extent *extent - the location of the row, which is invalidated after the row is read
+  // @param TensorRow *row - the row read from the file
+  // @return Status The status code returned
+  Status Read(Extent *extent, TensorRow *row);
+
+  // Drop all the rows in the file, the space of the file is reused from the beginning.
+  void Reset();
+
+  // @return int64_t - the size of the used space of the file in bytes
+  int64_t UsedSize() const { return file_end_; }
+
+ private:
+  // Serialize a row into a byte string.
+  static Status Serialize(const TensorRow &row, std::string *out);
+
+  // Restore a row from the byte string created by Serialize().
+  static Status Deserialize(const std::string &in, TensorRow *row);
+
+  // Create the scratch file with a name unique in the directory.
+  Status Open();
+
+  std::string dir_;
+  std::string file_path_;
+  std::fstream file_;
+  int64_t file_end_;  // The end of the used space of the file
+  // The free extents of the file, keyed by the length and then mapped to the offset
+  std::multimap<int64_t, int64_t> free_extents_;
+};
+}  // namespace dataset
+}  // namespace mindspore
+
+#endif  // MINDSPORE_CCSRC_MINDDATA_DATASET_ENGINE_DATASETOPS_ROW_SPILL_FILE_H_
@@ -16,6 +16,7 @@
 #if defined(_WIN32) || defined(_WIN64)
 #include <stdlib.h>
 #endif
+#include <algorithm>
 #include <chrono>
 #include <iomanip>
 #include <iostream>
@@ -25,6 +26,7 @@
 #include "minddata/dataset/core/config_manager.h"
 #include "minddata/dataset/engine/datasetops/shuffle_op.h"
 #include "minddata/dataset/engine/dataset_iterator.h"
+#include "utils/ms_utils.h"
 
 #include "minddata/dataset/util/log_adapter.h"
 #include "minddata/dataset/util/random.h"
@@ -36,8 +38,33 @@ constexpr int32_t ShuffleOp::kShuffleStateInit;
 constexpr int32_t ShuffleOp::kShuffleStateActive;
 constexpr int32_t ShuffleOp::kShuffleStateDrain;
 
+namespace {
+// The bytes of the tensors of a row
+int64_t RowBytes(const TensorRow &row) {
+  int64_t bytes = 0;
+  for (const auto &tensor : row) {
+    if (tensor != nullptr) {
+      bytes += tensor->SizeInBytes();
+    }
+  }
+  return bytes;
+}
+
+// The directory of the scratch file for the spilled rows
+std::string SpillDir() {
+#if defined(_WIN32) || defined(_WIN64)
+  std::string dir = common::GetEnv("TEMP");
+  return dir.empty() ? "." : dir;
+#else
+  std::string dir = common::GetEnv("TMPDIR");
+  return dir.empty() ? "/tmp" : dir;
+#endif
+}
+}  // namespace
+
 // Constructor of the ShuffleOp
-ShuffleOp::ShuffleOp(int32_t shuffle_size, uint32_t shuffle_seed, int32_t op_connector_size, bool reset_every_epoch)
+ShuffleOp::ShuffleOp(int32_t shuffle_size, uint32_t shuffle_seed, int32_t op_connector_size, bool reset_every_epoch,
+                     int64_t memory_limit)
     : PipelineOp(op_connector_size),
       shuffle_size_(shuffle_size),
       shuffle_seed_(shuffle_seed),
@@ -45,7 +72,13 @@ ShuffleOp::ShuffleOp(int32_t shuffle_size, uint32_t shuffle_seed, int32_t op_con
       rng_(shuffle_seed),
       shuffle_buffer_(std::make_unique<TensorTable>()),
       shuffle_last_row_idx_(0),
-      shuffle_buffer_state_(kShuffleStateInit) {}
+      shuffle_buffer_state_(kShuffleStateInit),
+      memory_limit_(memory_limit),
+      buffer_bytes_(0),
+      peak_buffer_bytes_(0),
+      spilled_rows_(0),
+      spilled_bytes_(0),
+      peak_spill_file_bytes_(0) {}
 
 // Private function to re-init the shuffle op for another epoch.  Shuffle op calls this by
 // itself rather than waiting for the reset driven from operators above it in the pipeline.
@@ -62,6 +95,11 @@ Status ShuffleOp::SelfReset() {
   shuffle_buffer_ = std::make_unique<TensorTable>();
   shuffle_last_row_idx_ = 0;
   shuffle_buffer_state_ = kShuffleStateInit;
+  buffer_bytes_ = 0;
+  spill_extents_.clear();
+  if (spill_file_ != nullptr) {
+    spill_file_->Reset();
+  }
   return Status::OK();
 }
 
@@ -71,13 +109,21 @@ void ShuffleOp::Print(std::ostream &out, bool show_all) const {
     // Call the super class for displaying any common 1-liner info
     PipelineOp::Print(out, show_all);
     // Then show any custom derived-internal 1-liner info for this op
-    out << " [shuffle size: " << shuffle_size_ << "]\n";
+    out << " [shuffle size: " << shuffle_size_ << "]";
+    if (memory_limit_ > 0) {
+      out << " [memory limit: " << memory_limit_ << "]";
+    }
+    out << "\n";
   } else {
     // Call the super class for displaying any common detailed info
     PipelineOp::Print(out, show_all);
     // Then show any custom derived-internal stuff
     out << "\nShuffle size: " << shuffle_size_ << "\nShuffle buffer state: " << shuffle_buffer_state_
-        << "\nShuffle seed: " << shuffle_seed_ << "\n\n";
+        << "\nShuffle seed: " << shuffle_seed_;
+    if (memory_limit_ > 0) {
+      out << "\nMemory limit: " << memory_limit_ << "\nSpilled rows: " << spilled_rows_;
+    }
+    out << "\n\n";
   }
 }
 
@@ -90,17 +136,71 @@ Status ShuffleOp::AddRowToShuffleBuffer(TensorRow new_shuffle_row) {
   // slot better be empty because it should already have been swapped out during the random row
   // selection that was done previously!)
   if (shuffle_last_row_idx_ < (shuffle_size_ - 1)) {
-    shuffle_buffer_->push_back(std::move(new_shuffle_row));
+    shuffle_buffer_->emplace_back();
+    if (memory_limit_ > 0) {
+      spill_extents_.emplace_back();
+    }
     shuffle_last_row_idx_ = (shuffle_buffer_->size()) - 1;
   } else {
-    if (!(*shuffle_buffer_)[shuffle_last_row_idx_].empty()) {
+    if (!(*shuffle_buffer_)[shuffle_last_row_idx_].empty() ||
+        (memory_limit_ > 0 && spill_extents_[shuffle_last_row_idx_].Valid())) {
       RETURN_STATUS_UNEXPECTED("[Internal ERROR] Last row of shuffle buffer should not be occupied!");
     }
-    (*shuffle_buffer_)[shuffle_last_row_idx_] = std::move(new_shuffle_row);
   }
+  return PutRow(shuffle_last_row_idx_, std::move(new_shuffle_row));
+}
+
+Status ShuffleOp::PutRow(int32_t slot, TensorRow row) {
+  if (memory_limit_ > 0) {
+    int64_t row_bytes = RowBytes(row);
+    if (buffer_bytes_ + row_bytes > memory_limit_ && RowSpillFile::Spillable(row)) {
+      if (spill_file_ == nullptr) {
+        spill_file_ = std::make_unique<RowSpillFile>(SpillDir());
+      }
+      RowSpillFile::Extent &extent = spill_extents_[slot];
+      RETURN_IF_NOT_OK(spill_file_->Write(row, &extent));
+      spilled_rows_++;
+      spilled_bytes_ += extent.length;
+      peak_spill_file_bytes_ = std::max(peak_spill_file_bytes_.load(), spill_file_->UsedSize());
+      return Status::OK();
+    }
+    buffer_bytes_ += row_bytes;
+    peak_buffer_bytes_ = std::max(peak_buffer_bytes_.load(), buffer_bytes_);
+  }
+  (*shuffle_buffer_)[slot] = std::move(row);
+  return Status::OK();
+}
+
+Status ShuffleOp::TakeRow(int32_t slot, TensorRow *row) {
+  if (memory_limit_ > 0) {
+    if (spill_extents_[slot].Valid()) {
+      return spill_file_->Read(&spill_extents_[slot], row);
+    }
+    buffer_bytes_ -= RowBytes((*shuffle_buffer_)[slot]);
+  }
+  *row = std::move((*shuffle_buffer_)[slot]);
   return Status::OK();
 }
 
+void ShuffleOp::MoveRow(int32_t from, int32_t to) {
+  (*shuffle_buffer_)[to] = std::move((*shuffle_buffer_)[from]);
+  if (memory_limit_ > 0) {
+    spill_extents_[to] = spill_extents_[from];
+    spill_extents_[from] = RowSpillFile::Extent();
+  }
+}
+
+std::unordered_map<std::string, int64_t> ShuffleOp::GetProfilingMetrics() const {
+  if (memory_limit_ <= 0) {
+    return {};
+  }
+  return {{"shuffle_memory_limit", memory_limit_},
+          {"shuffle_peak_buffer_bytes", peak_buffer_bytes_.load()},
+          {"shuffle_spilled_rows", spilled_rows_.load()},
+          {"shuffle_spilled_bytes", spilled_bytes_.load()},
+          {"shuffle_peak_spill_file_bytes", peak_spill_file_bytes_.load()}};
+}
+
 // Class functor operator () override.
 // All dataset ops operate by launching a thread (see ExecutionTree). This class functor will
 // provide the master loop that drives the logic for performing the work
@@ -142,7 +242,8 @@ Status ShuffleOp::operator()() {
       // tensor table. We remove the data from the shuffle buffer, leaving that slot
       // in the table as an empty vector
       int64_t random_slot = rng_() % (shuffle_last_row_idx_ + 1);
-      TensorRow random_row = std::move((*shuffle_buffer_)[random_slot]);
+      TensorRow random_row;
+      RETURN_IF_NOT_OK(TakeRow(static_cast<int32_t>(random_slot), &random_row));
       MS_LOG(DEBUG) << "Shuffle operator sending a row to output.";
       RETURN_IF_NOT_OK(out_connector_->Add(std::move(random_row)));
 
@@ -151,7 +252,7 @@ Status ShuffleOp::operator()() {
       // just vacated.  This makes the shuffle buffer contiguous, with an empty slot at the
       // tail of the shuffle buffer.
       if (random_slot != shuffle_last_row_idx_) {
-        (*shuffle_buffer_)[random_slot] = std::move((*shuffle_buffer_)[shuffle_last_row_idx_]);
+        MoveRow(shuffle_last_row_idx_, static_cast<int32_t>(random_slot));
       }
 
       // Step 4)
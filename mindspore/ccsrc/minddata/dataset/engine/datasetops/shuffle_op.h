@@ -16,6 +16,7 @@
 #ifndef MINDSPORE_CCSRC_MINDDATA_DATASET_ENGINE_DATASETOPS_SHUFFLE_OP_H_
 #define MINDSPORE_CCSRC_MINDDATA_DATASET_ENGINE_DATASETOPS_SHUFFLE_OP_H_
 
+#include <atomic>
 #include <map>
 #include <memory>
 #include <queue>
@@ -28,6 +29,7 @@
 #include "minddata/dataset/core/tensor_shape.h"
 #include "minddata/dataset/engine/dataset_iterator.h"
 #include "minddata/dataset/engine/datasetops/pipeline_op.h"
+#include "minddata/dataset/engine/datasetops/row_spill_file.h"
 #include "minddata/dataset/util/status.h"
 
 namespace mindspore {
@@ -51,7 +53,10 @@ class ShuffleOp : public PipelineOp {
   // @param shuffle_size - The size for the shuffle buffer
   // @param shuffle_seed - The seed to use for random number generation
   // @param op_connector_size - The output connector queue size
-  ShuffleOp(int32_t shuffle_size, uint32_t shuffle_seed, int32_t op_connector_size, bool reset_every_epoch);
+  // @param memory_limit - The limit of the bytes of the rows held in memory, the rows beyond it are spilled to a
+  //     local scratch file. 0 means all the rows of the shuffle buffer are held in memory
+  ShuffleOp(int32_t shuffle_size, uint32_t shuffle_seed, int32_t op_connector_size, bool reset_every_epoch,
+            int64_t memory_limit = 0);
 
   // Destructor
   ~ShuffleOp() = default;
@@ -87,11 +92,33 @@ class ShuffleOp : public PipelineOp {
   // @return Name of the current Op
   std::string Name() const override { return kShuffleOp; }
 
+  // Getter for the memory and spill statistics of the shuffle buffer
+  // @return The names and the values of the statistics
+  std::unordered_map<std::string, int64_t> GetProfilingMetrics() const override;
+
  private:
   // Private function to add a new row to the shuffle buffer.
   // @return Status The status code returned
   Status AddRowToShuffleBuffer(TensorRow new_shuffle_row);
 
+  // Private function to put a row into a slot of the shuffle buffer. The row is spilled to the scratch file if
+  // holding it in memory exceeds the memory limit.
+  // @param slot - The slot of the shuffle buffer
+  // @param row - The row to put
+  // @return Status The status code returned
+  Status PutRow(int32_t slot, TensorRow row);
+
+  // Private function to take the row out of a slot of the shuffle buffer, reading it back if it is spilled.
+  // @param slot - The slot of the shuffle buffer
+  // @param row - The row taken
+  // @return Status The status code returned
+  Status TakeRow(int32_t slot, TensorRow *row);
+
+  // Private function to move the row in a slot of the shuffle buffer to another empty slot.
+  // @param from - The slot to move the row from
+  // @param to - The slot to move the row to
+  void MoveRow(int32_t from, int32_t to);
+
   // Private function to populate the shuffle buffer initially by fetching from the child output
   // connector until the shuffle buffer is full (or there is no more data coming).
   // @return Status The status code returned
@@ -116,6 +143,18 @@ class ShuffleOp : public PipelineOp {
   int32_t shuffle_last_row_idx_;  // Internal tracking of the last slot of our shuffle buffer
   int32_t shuffle_buffer_state_;  // State tracking for the shuffle buffer phases of work
 
+  // When the memory limit is set, the shuffle buffer holds the rows in memory until the limit is reached, and the
+  // other rows are spilled to a scratch file, leaving empty rows in their slots.
+  int64_t memory_limit_;                             // The limit of the bytes of the rows held in memory
+  int64_t buffer_bytes_;                             // The bytes of the rows held in memory
+  std::vector<RowSpillFile::Extent> spill_extents_;  // The extents of the spilled rows of the slots
+  std::unique_ptr<RowSpillFile> spill_file_;
+  // Statistics of the shuffle buffer, which are read by the profiler
+  std::atomic<int64_t> peak_buffer_bytes_;
+  std::atomic<int64_t> spilled_rows_;
+  std::atomic<int64_t> spilled_bytes_;
+  std::atomic<int64_t> peak_spill_file_bytes_;
+
   std::unique_ptr<ChildIterator> child_iterator_;  // An iterator for fetching.
 };
 }  // namespace dataset
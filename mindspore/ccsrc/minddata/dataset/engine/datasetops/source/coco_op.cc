@@ -86,6 +86,21 @@ void CocoOp::Print(std::ostream &out, bool show_all) const {
   }
 }
 
+Status CocoOp::PrefetchRow(row_id_type row_id) {
+#ifdef ENABLE_PYTHON
+  if (NeedDecrypt(decrypt_)) {
+    return Status::OK();
+  }
+#endif
+  // The path is built the same way as LoadTensorRow(), then the bytes read ahead are found by it.
+  auto real_path = FileUtils::GetRealPath(image_folder_path_.c_str());
+  if (real_path.has_value()) {
+    Path image_folder(real_path.value());
+    PrefetchFile((image_folder / image_ids_[row_id]).ToString());
+  }
+  return Status::OK();
+}
+
 Status CocoOp::LoadTensorRow(row_id_type row_id, TensorRow *trow) {
   RETURN_UNEXPECTED_IF_NULL(trow);
   std::string image_id = image_ids_[row_id];
@@ -571,9 +586,9 @@ Status CocoOp::CategoriesColumnLoad(const nlohmann::json &categories_tree) {
 Status CocoOp::ReadImageToTensor(const std::string &path, const ColDescriptor &col,
                                  std::shared_ptr<Tensor> *tensor) const {
 #ifdef ENABLE_PYTHON
-  RETURN_IF_NOT_OK(MappableLeafOp::ImageDecrypt(path, tensor, decrypt_));
+  RETURN_IF_NOT_OK(ReadImage(path, tensor, decrypt_));
 #else
-  RETURN_IF_NOT_OK(Tensor::CreateFromFile(path, tensor));
+  RETURN_IF_NOT_OK(ReadFile(path, tensor));
 #endif
 
   if (decode_) {
@@ -204,6 +204,11 @@ class CocoOp : public MappableLeafOp {
   /// \return Status The status code returned.
   Status LoadTensorRow(row_id_type row_id, TensorRow *row) override;
 
+  /// \brief Start to read the image file of a row ahead.
+  /// \param[in] row_id Id for the tensor row to load later.
+  /// \return Status The status code returned.
+  Status PrefetchRow(row_id_type row_id) override;
+
   /// \brief Load a tensor row with vector which a vector to a tensor, for "Detection" task.
   /// \param[in] row_id Id for this tensor row.
   /// \param[in] image_id Image id.
@@ -16,9 +16,12 @@
 #include "minddata/dataset/engine/datasetops/source/csv_op.h"
 
 #include <algorithm>
+#include <cerrno>
+#include <cstdlib>
 #include <fstream>
+#include <future>
 #include <iomanip>
-#include <stdexcept>
+#include <tuple>
 
 #include "utils/file_utils.h"
 #include "minddata/dataset/core/config_manager.h"
@@ -28,6 +31,14 @@
 
 namespace mindspore {
 namespace dataset {
+namespace {
+// The error codes of the parser for the fields which fail to be converted to numbers.
+constexpr int kCsvTypeMismatch = -3;
+constexpr int kCsvOutOfRange = -4;
+constexpr int kDecimalBase = 10;
+// The max number of threads to count the rows of a file.
+constexpr int32_t kCsvMaxScanThreads = 8;
+}  // namespace
 
 CsvOp::CsvOp(const std::vector<std::string> &csv_files_list, char field_delim,
              const std::vector<std::shared_ptr<BaseRecord>> &column_default,
@@ -39,7 +50,13 @@ CsvOp::CsvOp(const std::vector<std::string> &csv_files_list, char field_delim,
       csv_files_list_(std::move(csv_files_list)),
       field_delim_(field_delim),
       column_default_list_(column_default),
-      column_name_list_(column_name) {}
+      column_name_list_(column_name),
+      num_parse_threads_(1),
+      chunk_size_(CSV_CHUNK_SIZE) {
+  if (num_workers_ > 0) {
+    num_parse_threads_ = std::max(1, num_workers / num_workers_);
+  }
+}
 
 Status CsvOp::Init() {
   RETURN_IF_NOT_OK(filename_index_->insert(csv_files_list_));
@@ -64,6 +81,8 @@ CsvOp::CsvParser::CsvParser(int32_t worker_id, JaggedConnector *connector, char
       total_rows_(0),
       start_offset_(0),
       end_offset_(std::numeric_limits<int64_t>::max()),
+      scanner_(field_delim),
+      rows_buffer_(nullptr),
       err_message_("unknown"),
       file_path_(std::move(file_path)) {}
 
@@ -98,6 +117,31 @@ int CsvOp::CsvParser::ProcessMessage(int c) {
   return ret;
 }
 
+int CsvOp::CsvParser::ProcessBlock(const char *begin, const char *end) {
+  const char *pos = begin;
+  while (pos < end) {
+    // An unquoted field goes on until a special character, and a quoted field goes on until a quote.
+    const char *next = pos;
+    if (cur_state_ == State::UNQUOTE) {
+      next = scanner_.FindSpecialChar(pos, end);
+    } else if (cur_state_ == State::QUOTE) {
+      next = CsvScanner::FindQuote(pos, end);
+    }
+    if (next != pos) {
+      PutChars(pos, static_cast<size_t>(next - pos));
+      pos = next;
+      continue;
+    }
+    // Pass the character as unsigned the same as std::ifstream::get(), so it never equals to the end of file.
+    int ret = ProcessMessage(static_cast<unsigned char>(*pos));
+    if (ret != 0) {
+      return ret;
+    }
+    ++pos;
+  }
+  return 0;
+}
+
 int CsvOp::CsvParser::PutChar(int c) {
   if (pos_ >= str_buf_.size()) {
     str_buf_.resize(str_buf_.size() * 2);
@@ -107,8 +151,56 @@ int CsvOp::CsvParser::PutChar(int c) {
   return 0;
 }
 
+void CsvOp::CsvParser::PutChars(const char *chars, size_t len) {
+  size_t size = str_buf_.size();
+  while (pos_ + len >= size) {
+    size *= 2;
+  }
+  if (size != str_buf_.size()) {
+    str_buf_.resize(size);
+  }
+  (void)std::copy(chars, chars + len, str_buf_.begin() + pos_);
+  pos_ += len;
+}
+
+int CsvOp::CsvParser::ParseInt(int32_t *value) {
+  if (pos_ >= str_buf_.size()) {
+    str_buf_.resize(str_buf_.size() * 2);
+  }
+  str_buf_[pos_] = '\0';
+  char *end = nullptr;
+  errno = 0;
+  int64_t result = std::strtoll(str_buf_.data(), &end, kDecimalBase);
+  if (end == str_buf_.data()) {
+    return kCsvTypeMismatch;
+  }
+  if (errno == ERANGE || result < std::numeric_limits<int32_t>::min() ||
+      result > std::numeric_limits<int32_t>::max()) {
+    return kCsvOutOfRange;
+  }
+  *value = static_cast<int32_t>(result);
+  return 0;
+}
+
+int CsvOp::CsvParser::ParseFloat(float *value) {
+  if (pos_ >= str_buf_.size()) {
+    str_buf_.resize(str_buf_.size() * 2);
+  }
+  str_buf_[pos_] = '\0';
+  char *end = nullptr;
+  errno = 0;
+  float result = std::strtof(str_buf_.data(), &end);
+  if (end == str_buf_.data()) {
+    return kCsvTypeMismatch;
+  }
+  if (errno == ERANGE) {
+    return kCsvOutOfRange;
+  }
+  *value = result;
+  return 0;
+}
+
 int CsvOp::CsvParser::PutRecord(int c) {
-  std::string s = std::string(str_buf_.begin(), str_buf_.begin() + pos_);
   std::shared_ptr<Tensor> t;
   if (cur_col_ >= column_default_.size()) {
     std::stringstream ss;
@@ -120,22 +212,34 @@ int CsvOp::CsvParser::PutRecord(int c) {
   }
   Status rc;
   switch (column_default_[cur_col_]->type) {
-    case CsvOp::INT:
-      rc = Tensor::CreateScalar(std::stoi(s), &t);
+    case CsvOp::INT: {
+      int32_t value = 0;
+      int ret = ParseInt(&value);
+      if (ret != 0) {
+        return ret;
+      }
+      rc = Tensor::CreateScalar(value, &t);
       if (rc.IsError()) {
         err_message_ = rc.ToString();
         return -1;
       }
       break;
-    case CsvOp::FLOAT:
-      rc = Tensor::CreateScalar(std::stof(s), &t);
+    }
+    case CsvOp::FLOAT: {
+      float value = 0;
+      int ret = ParseFloat(&value);
+      if (ret != 0) {
+        return ret;
+      }
+      rc = Tensor::CreateScalar(value, &t);
       if (rc.IsError()) {
         err_message_ = rc.ToString();
         return -1;
       }
       break;
+    }
     default:
-      rc = Tensor::CreateScalar(s, &t);
+      rc = Tensor::CreateScalar(std::string(str_buf_.data(), pos_), &t);
       if (rc.IsError()) {
         err_message_ = rc.ToString();
         return -1;
@@ -185,6 +289,10 @@ int CsvOp::CsvParser::PutRow(int c) {
   total_rows_++;
   cur_col_ = 0;
 
+  if (rows_buffer_ != nullptr) {
+    rows_buffer_->push_back(std::move(cur_row_));
+    return 0;
+  }
   Status s = rows_connector_->Add(worker_id_, std::move(cur_row_));
   if (s.IsError()) {
     err_message_ = s.ToString();
@@ -196,11 +304,6 @@ int CsvOp::CsvParser::PutRow(int c) {
   return 0;
 }
 
-int CsvOp::CsvParser::AddRow(int c) {
-  total_rows_++;
-  return 0;
-}
-
 int CsvOp::CsvParser::EndFile(int c) {
   if (cur_col_ > 0) {
     int ret = PutRow(c);
@@ -222,93 +325,12 @@ int CsvOp::CsvParser::CatchException(int c) {
   return -1;
 }
 
-int CsvOp::CsvParser::CountRows(int c) {
-  Message m;
-  if (c == '"') {
-    m = Message::MS_QUOTE;
-  } else if (c == '\r' || c == '\n' || c == std::char_traits<char>::eof()) {
-    m = Message::MS_END_OF_LINE;
-  } else {
-    m = Message::MS_NORMAL;
-  }
-  StateDiagram::iterator it = sdl.find({cur_state_, m});
-  if (it == sdl.end()) {
-    return -1;
-  }
-  cur_state_ = it->second.first;
-  return it->second.second(*this, c);
-}
-
 Status CsvOp::CsvParser::InitCsvParser() {
   str_buf_.resize(CSV_BUFFER_SIZE);
-  InitSDL();
   InitSD();
   return Status::OK();
 }
 
-void CsvOp::CsvParser::InitSDL() {
-  // State diagram for counting rows
-  sdl = {// START_OF_FILE
-         // |---------------------------------------|
-         // |    abc    |    "      |      \n       |
-         // |---------------------------------------|
-         // | UNQUOTE   |   QUOTE   | START_OF_FILE |
-         // |---------------------------------------|
-         // |  NullFunc |  NullFunc |    NullFunc   |
-         // |---------------------------------------|
-         {{State::START_OF_FILE, Message::MS_NORMAL}, {State::UNQUOTE, &CsvParser::NullFunc}},
-         {{State::START_OF_FILE, Message::MS_QUOTE}, {State::QUOTE, &CsvParser::NullFunc}},
-         {{State::START_OF_FILE, Message::MS_END_OF_LINE}, {State::START_OF_FILE, &CsvParser::NullFunc}},
-
-         // UNQUOTE
-         // |-------------------------------------|
-         // |    abc    |    "      |    \n       |
-         // |-------------------------------------|
-         // | UNQUOTE   | QUOTE     | END_OF_LINE |
-         // |-------------------------------------|
-         // |  NullFunc | NullFunc  |  AddRow     |
-         // |-------------------------------------|
-         {{State::UNQUOTE, Message::MS_NORMAL}, {State::UNQUOTE, &CsvParser::NullFunc}},
-         {{State::UNQUOTE, Message::MS_QUOTE}, {State::QUOTE, &CsvParser::NullFunc}},
-         {{State::UNQUOTE, Message::MS_END_OF_LINE}, {State::END_OF_LINE, &CsvParser::AddRow}},
-
-         // QUOTE
-         // |--------------------------------------|
-         // |    abc    |      "       |    \n     |
-         // |--------------------------------------|
-         // | QUOTE     | SECOND_QUOTE |   QUOTE   |
-         // |--------------------------------------|
-         // |  NullFunc |  NullFunc    | NullFunc  |
-         // |--------------------------------------|
-         {{State::QUOTE, Message::MS_NORMAL}, {State::QUOTE, &CsvParser::NullFunc}},
-         {{State::QUOTE, Message::MS_QUOTE}, {State::SECOND_QUOTE, &CsvParser::NullFunc}},
-         {{State::QUOTE, Message::MS_END_OF_LINE}, {State::QUOTE, &CsvParser::NullFunc}},
-
-         // SECOND_QUOTE
-         // |-------------------------------------|
-         // |    abc    |     "     |     \n      |
-         // |-------------------------------------|
-         // | UNQUOTE   | QUOTE     | END_OF_LINE |
-         // |-------------------------------------|
-         // |  NullFunc | NullFunc  | AddRow      |
-         // |-------------------------------------|
-         {{State::SECOND_QUOTE, Message::MS_NORMAL}, {State::UNQUOTE, &CsvParser::NullFunc}},
-         {{State::SECOND_QUOTE, Message::MS_QUOTE}, {State::QUOTE, &CsvParser::NullFunc}},
-         {{State::SECOND_QUOTE, Message::MS_END_OF_LINE}, {State::END_OF_LINE, &CsvParser::AddRow}},
-
-         // END_OF_LINE
-         // |-------------------------------------|
-         // |    abc    |     "     |     \n      |
-         // |-------------------------------------|
-         // | UNQUOTE   | QUOTE     | END_OF_LINE |
-         // |-------------------------------------|
-         // | NullFunc  |  NullFunc | NullFunc    |
-         // |-------------------------------------|
-         {{State::END_OF_LINE, Message::MS_NORMAL}, {State::UNQUOTE, &CsvParser::NullFunc}},
-         {{State::END_OF_LINE, Message::MS_QUOTE}, {State::QUOTE, &CsvParser::NullFunc}},
-         {{State::END_OF_LINE, Message::MS_END_OF_LINE}, {State::END_OF_LINE, &CsvParser::NullFunc}}};
-}
-
 void CsvOp::CsvParser::InitSD() {
   // State diagram for CSV parser
   sd = {// START_OF_FILE
@@ -463,50 +485,121 @@ void CsvOp::CsvParser::InitSD() {
         {{State::END_OF_LINE, Message::MS_END_OF_FILE}, {State::END_OF_FILE, &CsvParser::EndFile}}};
 }
 
-Status CsvOp::LoadFile(const std::string &file, int64_t start_offset, int64_t end_offset, int32_t worker_id) {
+Status CsvOp::ParseRange(const std::string &file, const std::string &realpath, int64_t begin, int64_t end,
+                         int64_t start_row, int64_t start_offset, int64_t end_offset, int32_t worker_id,
+                         std::vector<TensorRow> *rows) {
   CsvParser csv_parser(worker_id, jagged_rows_connector_.get(), field_delim_, column_default_list_, file);
   RETURN_IF_NOT_OK(csv_parser.InitCsvParser());
   csv_parser.SetStartOffset(start_offset);
   csv_parser.SetEndOffset(end_offset);
+  csv_parser.Reset();
+  csv_parser.SetStartRow(start_row);
+  csv_parser.SetRowsBuffer(rows);
+
+  std::ifstream ifs;
+  ifs.open(realpath, std::ifstream::in | std::ifstream::binary);
+  if (!ifs.is_open()) {
+    RETURN_STATUS_UNEXPECTED("Invalid file, failed to open " + file + ", the file is damaged or permission denied.");
+  }
+  auto check_error = [&file, &csv_parser](int err) -> Status {
+    if (err == 0) {
+      return Status::OK();
+    }
+    // if error code is -2, the returned error is interrupted
+    if (err == -2) {
+      return Status(kMDInterrupted);
+    }
+    std::string err_row = std::to_string(csv_parser.GetTotalRows() + 1);
+    if (err == kCsvTypeMismatch) {
+      RETURN_STATUS_UNEXPECTED("Invalid csv, csv file: " + file + " parse failed at line " + err_row +
+                               ", type does not match.");
+    }
+    if (err == kCsvOutOfRange) {
+      RETURN_STATUS_UNEXPECTED("Invalid csv, " + file + " parse failed at line " + err_row + " : value out of range.");
+    }
+    RETURN_STATUS_UNEXPECTED("Invalid file, failed to parse csv file: " + file + " at line " + err_row +
+                             ". Error message: " + csv_parser.GetErrorMessage());
+  };
+
+  (void)ifs.seekg(begin);
+  std::vector<char> buffer(CSV_READ_SIZE);
+  int64_t pos = begin;
+  // Stop reading once all the rows to load are parsed.
+  while (pos < end && csv_parser.GetTotalRows() < end_offset) {
+    (void)ifs.read(buffer.data(), std::min(CSV_READ_SIZE, end - pos));
+    int64_t size = ifs.gcount();
+    if (size <= 0) {
+      break;
+    }
+    pos += size;
+    RETURN_IF_NOT_OK(check_error(csv_parser.ProcessBlock(buffer.data(), buffer.data() + size)));
+  }
+  if (pos >= end || csv_parser.GetTotalRows() < end_offset) {
+    RETURN_IF_NOT_OK(check_error(csv_parser.ProcessMessage(std::char_traits<char>::eof())));
+  }
+  return Status::OK();
+}
 
+Status CsvOp::LoadFile(const std::string &file, int64_t start_offset, int64_t end_offset, int32_t worker_id) {
   auto realpath = FileUtils::GetRealPath(file.c_str());
   if (!realpath.has_value()) {
     MS_LOG(ERROR) << "Invalid file path, " << file << " does not exist.";
     RETURN_STATUS_UNEXPECTED("Invalid file path, " + file + " does not exist.");
   }
 
-  std::ifstream ifs;
-  ifs.open(realpath.value(), std::ifstream::in);
-  if (!ifs.is_open()) {
-    RETURN_STATUS_UNEXPECTED("Invalid file, failed to open " + file + ", the file is damaged or permission denied.");
-  }
-  if (column_name_list_.empty()) {
-    std::string tmp;
-    getline(ifs, tmp);
+  int64_t file_size = 0;
+  int64_t data_start = 0;
+  RETURN_IF_NOT_OK(GetDataRange(realpath.value(), &file_size, &data_start));
+  std::vector<std::pair<int64_t, int64_t>> row_starts = {{0, data_start}};
+  int64_t total_rows = std::numeric_limits<int64_t>::max();
+  auto starts_iter = row_starts_.find(file);
+  auto rows_iter = filename_numrows_.find(file);
+  if (starts_iter != row_starts_.end() && !starts_iter->second.empty() && rows_iter != filename_numrows_.end()) {
+    row_starts = starts_iter->second;
+    total_rows = rows_iter->second;
+  }
+
+  // Each segment between two row starts covers the rows from the first one to the second one, find the segments
+  // which cover the rows to load. The tuple holds the offset, the end offset and the number of rows before it.
+  std::vector<std::tuple<int64_t, int64_t, int64_t>> segments;
+  for (size_t i = 0; i < row_starts.size(); ++i) {
+    bool last = i + 1 == row_starts.size();
+    int64_t first_row = row_starts[i].first;
+    int64_t next_row = last ? total_rows : row_starts[i + 1].first;
+    if (first_row < end_offset && next_row > start_offset) {
+      (void)segments.emplace_back(row_starts[i].second, last ? file_size : row_starts[i + 1].second, first_row);
+    }
   }
-  csv_parser.Reset();
-  try {
-    while (ifs.good()) {
-      // when ifstream reaches the end of file, the function get() return std::char_traits<char>::eof()
-      // which is a 32-bit -1, it's not equal to the 8-bit -1 on Euler OS. So instead of char, we use
-      // int to receive its return value.
-      int chr = ifs.get();
-      int err = csv_parser.ProcessMessage(chr);
-      if (err != 0) {
-        // if error code is -2, the returned error is interrupted
-        if (err == -2) return Status(kMDInterrupted);
-        RETURN_STATUS_UNEXPECTED("Invalid file, failed to parse csv file: " + file + " at line " +
-                                 std::to_string(csv_parser.GetTotalRows() + 1) +
-                                 ". Error message: " + csv_parser.GetErrorMessage());
-      }
+  if (segments.empty()) {
+    return Status::OK();
+  }
+  if (segments.size() == 1 || num_parse_threads_ <= 1) {
+    return ParseRange(file, realpath.value(), std::get<0>(segments.front()), std::get<1>(segments.back()),
+                      std::get<2>(segments.front()), start_offset, end_offset, worker_id, nullptr);
+  }
+
+  // Parse the segments in parallel, and add the rows to the connector in order of the segments.
+  std::vector<std::vector<TensorRow>> segment_rows(segments.size());
+  std::vector<std::future<Status>> tasks;
+  auto launch = [&](size_t i) {
+    tasks.emplace_back(std::async(std::launch::async, &CsvOp::ParseRange, this, std::cref(file),
+                                  std::cref(realpath.value()), std::get<0>(segments[i]), std::get<1>(segments[i]),
+                                  std::get<2>(segments[i]), start_offset, end_offset, worker_id, &segment_rows[i]));
+  };
+  tasks.reserve(segments.size());
+  size_t num_launched = std::min(segments.size(), static_cast<size_t>(num_parse_threads_));
+  for (size_t i = 0; i < num_launched; ++i) {
+    launch(i);
+  }
+  for (size_t i = 0; i < segments.size(); ++i) {
+    RETURN_IF_NOT_OK(tasks[i].get());
+    if (num_launched < segments.size()) {
+      launch(num_launched++);
     }
-  } catch (std::invalid_argument &ia) {
-    std::string err_row = std::to_string(csv_parser.GetTotalRows() + 1);
-    RETURN_STATUS_UNEXPECTED("Invalid csv, csv file: " + file + " parse failed at line " + err_row +
-                             ", type does not match.");
-  } catch (std::out_of_range &oor) {
-    std::string err_row = std::to_string(csv_parser.GetTotalRows() + 1);
-    RETURN_STATUS_UNEXPECTED("Invalid csv, " + file + " parse failed at line " + err_row + " : value out of range.");
+    for (auto &row : segment_rows[i]) {
+      RETURN_IF_NOT_OK(jagged_rows_connector_->Add(worker_id, std::move(row)));
+    }
+    segment_rows[i].clear();
   }
   return Status::OK();
 }
@@ -603,39 +696,100 @@ Status CsvOp::CalculateNumRowsPerShard() {
   return Status::OK();
 }
 
-int64_t CsvOp::CountTotalRows(const std::string &file) {
-  CsvParser csv_parser(0, jagged_rows_connector_.get(), field_delim_, column_default_list_, file);
-  Status rc = csv_parser.InitCsvParser();
-  if (rc.IsError()) {
-    MS_LOG(ERROR) << "[Internal ERROR], failed to initialize " + DatasetName(true) + " Parser. Error description:"
-                  << rc;
-    return 0;
+Status CsvOp::GetDataRange(const std::string &realpath, int64_t *file_size, int64_t *data_start) {
+  RETURN_UNEXPECTED_IF_NULL(file_size);
+  RETURN_UNEXPECTED_IF_NULL(data_start);
+  std::ifstream ifs;
+  ifs.open(realpath, std::ifstream::in | std::ifstream::binary);
+  if (!ifs.is_open()) {
+    RETURN_STATUS_UNEXPECTED("Invalid file, failed to open " + realpath +
+                             ", the file is damaged or permission denied.");
   }
+  (void)ifs.seekg(0, std::ios::end);
+  *file_size = static_cast<int64_t>(ifs.tellg());
+  (void)ifs.seekg(0, std::ios::beg);
+  *data_start = 0;
+  if (column_name_list_.empty()) {
+    // Skip the header line and its line break.
+    std::string tmp;
+    getline(ifs, tmp);
+    *data_start = std::min(static_cast<int64_t>(tmp.size()) + 1, *file_size);
+  }
+  return Status::OK();
+}
+
+Status CsvOp::ScanChunks(const std::string &realpath, const std::vector<int64_t> &chunk_offsets, int64_t file_size,
+                         size_t begin, size_t end, std::vector<CsvChunkRows> *chunks) {
+  RETURN_UNEXPECTED_IF_NULL(chunks);
+  std::ifstream ifs;
+  ifs.open(realpath, std::ifstream::in | std::ifstream::binary);
+  if (!ifs.is_open()) {
+    RETURN_STATUS_UNEXPECTED("Invalid file, failed to open " + realpath +
+                             ", the file is damaged or permission denied.");
+  }
+  std::vector<char> buffer;
+  for (size_t i = begin; i < end; ++i) {
+    int64_t chunk_begin = chunk_offsets[i];
+    int64_t chunk_end = i + 1 < chunk_offsets.size() ? chunk_offsets[i + 1] : file_size;
+    // Read the character before the chunk as well to know whether a row is unfinished at the start of the chunk.
+    int64_t read_begin = i == 0 ? chunk_begin : chunk_begin - 1;
+    buffer.resize(static_cast<size_t>(chunk_end - read_begin));
+    (void)ifs.seekg(read_begin);
+    (void)ifs.read(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+    CHECK_FAIL_RETURN_UNEXPECTED(ifs.gcount() == static_cast<std::streamsize>(buffer.size()),
+                                 "Invalid file, failed to read " + realpath + ", the file is damaged.");
+    bool row_pending = i > 0 && buffer[0] != '\r' && buffer[0] != '\n';
+    (*chunks)[i] = CsvScanner::ScanRows(buffer.data() + (chunk_begin - read_begin), buffer.data() + buffer.size(),
+                                        row_pending);
+  }
+  return Status::OK();
+}
 
+int64_t CsvOp::CountTotalRows(const std::string &file) {
   auto realpath = FileUtils::GetRealPath(file.c_str());
   if (!realpath.has_value()) {
     MS_LOG(ERROR) << "Invalid file path, csv file: " << file << " does not exist.";
     return 0;
   }
 
-  std::ifstream ifs;
-  ifs.open(realpath.value(), std::ifstream::in);
-  if (!ifs.is_open()) {
+  int64_t file_size = 0;
+  int64_t data_start = 0;
+  Status rc = GetDataRange(realpath.value(), &file_size, &data_start);
+  if (rc.IsError()) {
+    MS_LOG(ERROR) << rc;
     return 0;
   }
-  if (column_name_list_.empty()) {
-    std::string tmp;
-    getline(ifs, tmp);
+  std::vector<int64_t> chunk_offsets;
+  int64_t chunk_size = std::max(chunk_size_, static_cast<int64_t>(1));
+  for (int64_t offset = data_start; offset < file_size; offset += chunk_size) {
+    chunk_offsets.push_back(offset);
   }
-  csv_parser.Reset();
-  while (ifs.good()) {
-    int chr = ifs.get();
-    if (csv_parser.CountRows(chr) != 0) {
-      break;
+  std::vector<CsvChunkRows> chunks(chunk_offsets.size());
+  int32_t threads = std::min(GlobalContext::config_manager()->num_cpu_threads(), kCsvMaxScanThreads);
+  threads = std::max(1, std::min(threads, static_cast<int32_t>(chunks.size())));
+  if (threads == 1) {
+    rc = ScanChunks(realpath.value(), chunk_offsets, file_size, 0, chunks.size(), &chunks);
+  } else {
+    // Scan the chunks in parallel, the quote state at the start of each chunk is resolved after all are scanned.
+    std::vector<std::future<Status>> tasks;
+    size_t chunks_per_thread = (chunks.size() + threads - 1) / threads;
+    for (size_t begin = 0; begin < chunks.size(); begin += chunks_per_thread) {
+      size_t end = std::min(begin + chunks_per_thread, chunks.size());
+      tasks.emplace_back(std::async(std::launch::async, &CsvOp::ScanChunks, std::cref(realpath.value()),
+                                    std::cref(chunk_offsets), file_size, begin, end, &chunks));
+    }
+    for (auto &task : tasks) {
+      Status task_rc = task.get();
+      if (rc.IsOk()) {
+        rc = task_rc;
+      }
     }
   }
-
-  return csv_parser.GetTotalRows();
+  if (rc.IsError()) {
+    MS_LOG(ERROR) << rc;
+    return 0;
+  }
+  return CsvScanner::ResolveRows(chunks, chunk_offsets, &row_starts_[file]);
 }
 
 Status CsvOp::CountAllFileRows(const std::vector<std::string> &files, bool csv_header, int64_t *count) {
@@ -25,6 +25,7 @@
 
 #include "minddata/dataset/util/auto_index.h"
 #include "minddata/dataset/engine/datasetops/parallel_op.h"
+#include "minddata/dataset/engine/datasetops/source/csv_scanner.h"
 #include "minddata/dataset/engine/datasetops/source/io_block.h"
 #include "minddata/dataset/engine/datasetops/source/nonmappable_leaf_op.h"
 #include "minddata/dataset/engine/jagged_connector.h"
@@ -33,6 +34,10 @@ namespace mindspore {
 namespace dataset {
 
 const size_t CSV_BUFFER_SIZE = 4096;
+// The size of the chunks a csv file is split into to count and parse its rows in parallel.
+const int64_t CSV_CHUNK_SIZE = 4 * 1024 * 1024;
+// The size of the blocks read from a csv file at a time.
+const int64_t CSV_READ_SIZE = 1024 * 1024;
 using StringIndex = AutoIndexObj<std::string>;
 class JaggedConnector;
 
@@ -58,9 +63,12 @@ class CsvOp : public NonMappableLeafOp {
   };
 
   /// CsvParser is a class that parsing CSV file.
-  /// We design a state machine to implement CSV syntactic analysis. It contains two state diagram,'sd' and 'sdl'.
-  /// The 'sd' is used for parsing CSV syntactic, it's complete and complicate.
-  /// The 'sdl' is used for counting the record rows, it's concise and it runs fast.
+  /// We design a state machine to implement CSV syntactic analysis, the state diagram 'sd' is complete and complicate.
+  /// The runs of ordinary characters in a field are found by CsvScanner and copied at once without going through
+  /// the state diagram. The record rows are counted by CsvScanner, which needs no state diagram.
+  /// Each field is converted straight into a scalar tensor of its row. The fields are not parsed into preallocated
+  /// column tensors, because the rows are emitted one at a time through the jagged connector, and a following BatchOp
+  /// copies them into its batch tensors.
   struct CsvParser {
    public:
     CsvParser() = delete;
@@ -76,9 +84,19 @@ class CsvOp : public NonMappableLeafOp {
 
     void SetEndOffset(int64_t end_offset) { end_offset_ = end_offset; }
 
+    /// Set the number of rows before the position the parser starts from, which is the start of a row.
+    void SetStartRow(int64_t start_row) { total_rows_ = start_row; }
+
+    /// Collect the parsed rows into a vector instead of adding them to the connector.
+    void SetRowsBuffer(std::vector<TensorRow> *rows_buffer) { rows_buffer_ = rows_buffer; }
+
     int ProcessMessage(int c);
 
-    int CountRows(int c);
+    /// Parse a block of the file, the runs of ordinary characters in a field are copied at once.
+    /// @param begin - the start of the block.
+    /// @param end - the end of the block.
+    /// @return int - 0 for success, otherwise the error code.
+    int ProcessBlock(const char *begin, const char *end);
 
     Status InitCsvParser();
 
@@ -116,18 +134,22 @@ class CsvOp : public NonMappableLeafOp {
 
     int PutChar(int c);
 
+    void PutChars(const char *chars, size_t len);
+
+    // Convert the field in the buffer to a number in place, the same as std::stoi and std::stof but without building a
+    // std::string for the field.
+    int ParseInt(int32_t *value);
+
+    int ParseFloat(float *value);
+
     int PutRecord(int c);
 
     int PutRow(int c);
 
     int EndFile(int c);
 
-    int AddRow(int c);
-
     int CatchException(int c);
 
-    void InitSDL();
-
     void InitSD();
 
     int32_t worker_id_;
@@ -141,7 +163,8 @@ class CsvOp : public NonMappableLeafOp {
     int64_t start_offset_;
     int64_t end_offset_;
     StateDiagram sd;
-    StateDiagram sdl;
+    CsvScanner scanner_;
+    std::vector<TensorRow> *rows_buffer_;
     std::vector<char> str_buf_;
     TensorRow cur_row_;
     std::string err_message_;
@@ -179,6 +202,11 @@ class CsvOp : public NonMappableLeafOp {
   /// @return Vector of the input file names
   std::vector<std::string> FileNames() { return csv_files_list_; }
 
+  /// Set the size of the chunks a csv file is split into to count and parse its rows in parallel, CSV_CHUNK_SIZE by
+  /// default. It takes effect on the files counted afterwards.
+  /// @param chunk_size - the size of the chunks, which should be positive.
+  void SetChunkSize(int64_t chunk_size) { chunk_size_ = chunk_size; }
+
   /// Op name getter
   /// @return Name of the current Op
   std::string Name() const override { return "CSVOp"; }
@@ -212,11 +240,45 @@ class CsvOp : public NonMappableLeafOp {
   // @return Status - the error code returned.
   Status CalculateNumRowsPerShard() override;
 
-  /// Count number of rows in each file.
+  /// Count number of rows in each file. A large file is scanned in chunks in parallel, and the starts of the rows
+  /// found at the chunk boundaries are kept for LoadFile to parse the file in parallel.
   /// @param filename - csv file name.
   /// @return int64_t - the total number of rows in file.
   int64_t CountTotalRows(const std::string &file);
 
+  // Get the size of a csv file and the offset where its data starts after the header line.
+  // @param realpath - the real path of the file.
+  // @param file_size - the size of the file.
+  // @param data_start - the offset of the data.
+  // @return Status - the error code returned.
+  Status GetDataRange(const std::string &realpath, int64_t *file_size, int64_t *data_start);
+
+  // Scan a range of the chunks of a csv file for the ends of the rows.
+  // @param realpath - the real path of the file.
+  // @param chunk_offsets - the offsets of all the chunks in the file.
+  // @param file_size - the size of the file.
+  // @param begin - the index of the first chunk to scan.
+  // @param end - the index after the last chunk to scan.
+  // @param chunks - the scan results of all the chunks.
+  // @return Status - the error code returned.
+  static Status ScanChunks(const std::string &realpath, const std::vector<int64_t> &chunk_offsets, int64_t file_size,
+                           size_t begin, size_t end, std::vector<CsvChunkRows> *chunks);
+
+  // Parse a byte range of a csv file which starts at the start of a row.
+  // @param file - the file to read.
+  // @param realpath - the real path of the file.
+  // @param begin - the offset of the range.
+  // @param end - the offset after the range.
+  // @param start_row - the number of rows before the range.
+  // @param start_offset - the index of the first row to load.
+  // @param end_offset - the index after the last row to load.
+  // @param worker_id - the id of the worker that is executing this function.
+  // @param rows - the parsed rows are collected into it, or added to the connector if it is nullptr.
+  // @return Status - the error code returned.
+  Status ParseRange(const std::string &file, const std::string &realpath, int64_t begin, int64_t end,
+                    int64_t start_row, int64_t start_offset, int64_t end_offset, int32_t worker_id,
+                    std::vector<TensorRow> *rows);
+
   // Private function for computing the assignment of the column name map.
   // @return - Status
   Status ComputeColMap() override;
@@ -240,6 +302,13 @@ class CsvOp : public NonMappableLeafOp {
   std::vector<std::shared_ptr<CsvOp::BaseRecord>> column_default_list_;
   std::vector<std::string> column_name_list_;
   bool check_flag_ = false;
+  // The number of threads each worker parses a file with, it is more than one when there are fewer files than the
+  // requested workers.
+  int32_t num_parse_threads_;
+  // The size of the chunks a csv file is split into by CountTotalRows.
+  int64_t chunk_size_;
+  // The pairs of the number of rows before and the offset of the row starts in each file, found by CountTotalRows.
+  std::map<std::string, std::vector<std::pair<int64_t, int64_t>>> row_starts_;
 };
 }  // namespace dataset
 }  // namespace mindspore
@@ -0,0 +1,168 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "minddata/dataset/engine/datasetops/source/csv_scanner.h"
+
+#include <cstring>
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#elif defined(ENABLE_NEON)
+#include <arm_neon.h>
+#endif
+
+namespace mindspore {
+namespace dataset {
+namespace {
+// Find the first character equal to any of a, b, c and d in [begin, end).
+const char *FindAnyOf(const char *begin, const char *end, char a, char b, char c, char d) {
+  const char *pos = begin;
+#if defined(__AVX2__)
+  constexpr int64_t kBlockSize = 32;
+  const __m256i va = _mm256_set1_epi8(a);
+  const __m256i vb = _mm256_set1_epi8(b);
+  const __m256i vc = _mm256_set1_epi8(c);
+  const __m256i vd = _mm256_set1_epi8(d);
+  for (; end - pos >= kBlockSize; pos += kBlockSize) {
+    __m256i block = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(pos));
+    __m256i ab = _mm256_or_si256(_mm256_cmpeq_epi8(block, va), _mm256_cmpeq_epi8(block, vb));
+    __m256i cd = _mm256_or_si256(_mm256_cmpeq_epi8(block, vc), _mm256_cmpeq_epi8(block, vd));
+    auto mask = static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_or_si256(ab, cd)));
+    if (mask != 0) {
+      return pos + __builtin_ctz(mask);
+    }
+  }
+#elif defined(__SSE2__)
+  constexpr int64_t kBlockSize = 16;
+  const __m128i va = _mm_set1_epi8(a);
+  const __m128i vb = _mm_set1_epi8(b);
+  const __m128i vc = _mm_set1_epi8(c);
+  const __m128i vd = _mm_set1_epi8(d);
+  for (; end - pos >= kBlockSize; pos += kBlockSize) {
+    __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i *>(pos));
+    __m128i ab = _mm_or_si128(_mm_cmpeq_epi8(block, va), _mm_cmpeq_epi8(block, vb));
+    __m128i cd = _mm_or_si128(_mm_cmpeq_epi8(block, vc), _mm_cmpeq_epi8(block, vd));
+    auto mask = static_cast<uint32_t>(_mm_movemask_epi8(_mm_or_si128(ab, cd)));
+    if (mask != 0) {
+      return pos + __builtin_ctz(mask);
+    }
+  }
+#elif defined(ENABLE_NEON)
+  constexpr int64_t kBlockSize = 16;
+  constexpr int kBitsPerNibble = 4;
+  const uint8x16_t va = vdupq_n_u8(static_cast<uint8_t>(a));
+  const uint8x16_t vb = vdupq_n_u8(static_cast<uint8_t>(b));
+  const uint8x16_t vc = vdupq_n_u8(static_cast<uint8_t>(c));
+  const uint8x16_t vd = vdupq_n_u8(static_cast<uint8_t>(d));
+  for (; end - pos >= kBlockSize; pos += kBlockSize) {
+    uint8x16_t block = vld1q_u8(reinterpret_cast<const uint8_t *>(pos));
+    uint8x16_t ab = vorrq_u8(vceqq_u8(block, va), vceqq_u8(block, vb));
+    uint8x16_t cd = vorrq_u8(vceqq_u8(block, vc), vceqq_u8(block, vd));
+    // Narrow every byte of the comparison result to a nibble to get a 64-bit mask.
+    uint8x8_t narrowed = vshrn_n_u16(vreinterpretq_u16_u8(vorrq_u8(ab, cd)), kBitsPerNibble);
+    uint64_t mask = vget_lane_u64(vreinterpret_u64_u8(narrowed), 0);
+    if (mask != 0) {
+      return pos + (__builtin_ctzll(mask) / kBitsPerNibble);
+    }
+  }
+#endif
+  for (; pos < end; ++pos) {
+    if (*pos == a || *pos == b || *pos == c || *pos == d) {
+      return pos;
+    }
+  }
+  return end;
+}
+
+bool IsLineBreak(char c) { return c == '\r' || c == '\n'; }
+}  // namespace
+
+const char *CsvScanner::FindSpecialChar(const char *begin, const char *end) const {
+  return FindAnyOf(begin, end, field_delim_, '"', '\r', '\n');
+}
+
+const char *CsvScanner::FindQuote(const char *begin, const char *end) {
+  if (begin >= end) {
+    return end;
+  }
+  // memchr of the C library is already vectorized.
+  const void *found = memchr(begin, '"', static_cast<size_t>(end - begin));
+  return found == nullptr ? end : static_cast<const char *>(found);
+}
+
+CsvChunkRows CsvScanner::ScanRows(const char *begin, const char *end, bool row_pending) {
+  CsvChunkRows result;
+  result.row_pending[0] = row_pending;
+  // The chunk is outside a quoted field now for the case with the same index as the quote parity.
+  int parity = 0;
+  const char *pos = begin;
+  while (pos < end) {
+    const char *next = FindAnyOf(pos, end, '"', '"', '\r', '\n');
+    if (next != pos) {
+      result.row_pending[0] = true;
+      result.row_pending[1] = true;
+      if (next == end) {
+        break;
+      }
+    }
+    if (*next == '"') {
+      parity ^= 1;
+      result.row_pending[0] = true;
+      result.row_pending[1] = true;
+    } else if (result.row_pending[parity]) {
+      // A line break inside a quoted field belongs to the field, so only the case outside ends its row here.
+      result.rows[parity]++;
+      if (result.first_row_end[parity] < 0) {
+        result.first_row_end[parity] = next + 1 - begin;
+      }
+      result.row_pending[parity] = false;
+    }
+    pos = next + 1;
+  }
+  result.odd_quotes = parity == 1;
+  return result;
+}
+
+int64_t CsvScanner::ResolveRows(const std::vector<CsvChunkRows> &chunks, const std::vector<int64_t> &chunk_offsets,
+                                std::vector<std::pair<int64_t, int64_t>> *row_starts) {
+  if (row_starts != nullptr) {
+    row_starts->clear();
+    if (!chunk_offsets.empty()) {
+      row_starts->emplace_back(0, chunk_offsets[0]);
+    }
+  }
+  int64_t rows = 0;
+  int quoted = 0;
+  bool row_pending = false;
+  for (size_t i = 0; i < chunks.size(); ++i) {
+    const CsvChunkRows &chunk = chunks[i];
+    if (row_starts != nullptr && i > 0 && i < chunk_offsets.size() && chunk.first_row_end[quoted] >= 0) {
+      row_starts->emplace_back(rows + 1, chunk_offsets[i] + chunk.first_row_end[quoted]);
+    }
+    rows += chunk.rows[quoted];
+    row_pending = chunk.row_pending[quoted];
+    if (chunk.odd_quotes) {
+      quoted ^= 1;
+    }
+  }
+  // The last row ends at the end of the data without a line break, unless it is inside an unclosed quoted field.
+  if (quoted == 0 && row_pending) {
+    rows++;
+  }
+  return rows;
+}
+}  // namespace dataset
+}  // namespace mindspore
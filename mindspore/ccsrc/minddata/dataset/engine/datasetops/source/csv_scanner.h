@@ -0,0 +1,83 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef MINDSPORE_CCSRC_MINDDATA_DATASET_ENGINE_DATASETOPS_SOURCE_CSV_SCANNER_H_
+#define MINDSPORE_CCSRC_MINDDATA_DATASET_ENGINE_DATASETOPS_SOURCE_CSV_SCANNER_H_
+
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+namespace mindspore {
+namespace dataset {
+// The rows ended in a chunk of CSV data. A chunk does not know whether it starts inside a quoted field, so it is
+// scanned for both cases at once. Index 0 of the arrays assumes the chunk starts outside a quoted field, and index 1
+// assumes it starts inside one.
+struct CsvChunkRows {
+  // The number of rows ended in the chunk.
+  int64_t rows[2] = {0, 0};
+  // The offset in the chunk just after the end of its first row, or -1 if no row ends in the chunk.
+  int64_t first_row_end[2] = {-1, -1};
+  // Whether a row is left unfinished at the end of the chunk.
+  bool row_pending[2] = {false, true};
+  // Whether the chunk has an odd number of quotes, which flips the quote state of the next chunk.
+  bool odd_quotes = false;
+};
+
+// CsvScanner finds the characters which drive the state machine of the CSV parser with SIMD instructions, so the runs
+// of ordinary characters in between are skipped in blocks instead of one character at a time. AVX2 and SSE2 are used
+// on x86 and NEON on ARM when the compiler enables them, otherwise it falls back to a scalar loop.
+class CsvScanner {
+ public:
+  // Constructor of CsvScanner
+  // @param char field_delim - the delimiter to separate the fields
+  explicit CsvScanner(char field_delim) : field_delim_(field_delim) {}
+
+  // Destructor
+  ~CsvScanner() = default;
+
+  // Find the first field delimiter, quote, '\r' or '\n' in [begin, end).
+  // @return const char * - the position found, or end if there is none
+  const char *FindSpecialChar(const char *begin, const char *end) const;
+
+  // Find the first quote in [begin, end).
+  // @return const char * - the position found, or end if there is none
+  static const char *FindQuote(const char *begin, const char *end);
+
+  // Scan a chunk of CSV data for the ends of the rows. A row ends at the first line break outside a quoted field
+  // after some content of the row, so blank lines are not counted.
+  // @param const char *begin - the start of the chunk
+  // @param const char *end - the end of the chunk
+  // @param bool row_pending - whether a row is unfinished at the start of the chunk if it starts outside a quoted
+  //     field, that is the chunk is not at the start of the data and the character before it is not a line break
+  // @return CsvChunkRows - the rows ended in the chunk
+  static CsvChunkRows ScanRows(const char *begin, const char *end, bool row_pending);
+
+  // Resolve the quote state at the start of every chunk from the first chunk in order, and sum up the rows.
+  // @param const std::vector<CsvChunkRows> &chunks - the scan results of the consecutive chunks of the data
+  // @param const std::vector<int64_t> &chunk_offsets - the offsets of the chunks in the file
+  // @param std::vector<std::pair<int64_t, int64_t>> *row_starts - if not nullptr, it is filled with the pairs of the
+  //     number of rows before and the file offset of the first row starting in every chunk, which are the points the
+  //     parser could start from without knowing the data before them
+  // @return int64_t - the total number of rows in the chunks, including the unfinished row at the end of the data
+  static int64_t ResolveRows(const std::vector<CsvChunkRows> &chunks, const std::vector<int64_t> &chunk_offsets,
+                             std::vector<std::pair<int64_t, int64_t>> *row_starts);
+
+ private:
+  const char field_delim_;
+};
+}  // namespace dataset
+}  // namespace mindspore
+#endif  // MINDSPORE_CCSRC_MINDDATA_DATASET_ENGINE_DATASETOPS_SOURCE_CSV_SCANNER_H_
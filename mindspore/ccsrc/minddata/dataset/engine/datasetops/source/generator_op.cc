@@ -15,6 +15,8 @@
  */
 #include "minddata/dataset/engine/datasetops/source/generator_op.h"
 
+#include <algorithm>
+#include <chrono>
 #include <iomanip>
 
 #include "minddata/dataset/core/global_context.h"
@@ -25,14 +27,17 @@ namespace mindspore {
 namespace dataset {
 GeneratorOp::GeneratorOp(py::function generator_function, std::vector<std::string> column_names,
                          std::vector<DataType> column_types, int32_t prefetch_size, int32_t connector_size,
-                         std::shared_ptr<SamplerRT> sampler, int32_t num_parallel_workers)
+                         std::shared_ptr<SamplerRT> sampler, int32_t num_parallel_workers, int64_t shm_row_size)
     : PipelineOp(connector_size, std::move(sampler)),
       generator_function_(generator_function),
       column_names_(column_names),
       column_types_(std::move(column_types)),
       prefetch_size_(prefetch_size),
       generator_counter_(0),
-      num_parallel_workers_(num_parallel_workers) {}
+      num_parallel_workers_(num_parallel_workers),
+      zero_copy_(GlobalContext::config_manager()->generator_zero_copy()),
+      shm_row_size_(shm_row_size),
+      shm_epoch_rows_(0) {}
 
 void GeneratorOp::Print(std::ostream &out, bool show_all) const {
   if (!show_all) {
@@ -72,6 +77,20 @@ Status GeneratorOp::CreateGeneratorObject() {
         // Sampler is not null which means the source is RandomAccessible
         // get all samples and pass it to the Generator function
         RETURN_IF_NOT_OK(sampler_->GetAllIdsThenReset(&sample_ids));
+        if (shm_row_size_ > 0) {
+          // The generator function dispatches the samples to the worker processes, which write the rows into the
+          // rings of the shared memory instead of returning them.
+          if (shm_ring_ == nullptr) {
+            // Each ring holds the prefetched rows of a worker, as the queue of the worker process does.
+            int32_t prefetch_size = GlobalContext::config_manager()->prefetch_size();
+            int32_t num_slots =
+              std::max(kMinSharedRowSlots, std::min(prefetch_size, prefetch_size * 4 / num_parallel_workers_));
+            RETURN_IF_NOT_OK(SharedRowRing::Create(num_parallel_workers_, num_slots, shm_row_size_, &shm_ring_));
+          }
+          shm_epoch_rows_ = static_cast<int64_t>(sample_ids.size());
+          generator_ = generator_function_(sample_ids, shm_ring_->ShmId());
+          return Status::OK();
+        }
         // If sampler is a user-defined python sampler, sample_ids will flow from python to c++ and back to python
         generator_ = generator_function_(sample_ids);
       } else {
@@ -117,7 +136,11 @@ Status GeneratorOp::PyRowToTensorRow(py::object py_data, TensorRow *tensor_row)
                             std::string(ret_py_ele.get_type().str()));
     }
     std::shared_ptr<Tensor> tensor;
-    RETURN_IF_NOT_OK(Tensor::CreateFromNpArray(ret_py_ele.cast<py::array>(), &tensor));
+    if (zero_copy_) {
+      RETURN_IF_NOT_OK(Tensor::CreateFromNpArrayNoCopy(ret_py_ele.cast<py::array>(), &tensor));
+    } else {
+      RETURN_IF_NOT_OK(Tensor::CreateFromNpArray(ret_py_ele.cast<py::array>(), &tensor));
+    }
     if ((!column_types_.empty()) && (column_types_[i] != DataType::DE_UNKNOWN) &&
         (column_types_[i] != tensor->type())) {
       RETURN_STATUS_ERROR(StatusCode::kMDPyFuncException,
@@ -131,6 +154,54 @@ Status GeneratorOp::PyRowToTensorRow(py::object py_data, TensorRow *tensor_row)
   return Status::OK();
 }
 
+Status GeneratorOp::SharedRowToTensorRow(TensorRow *tensor_row, bool *eoe) {
+  RETURN_UNEXPECTED_IF_NULL(tensor_row);
+  RETURN_UNEXPECTED_IF_NULL(eoe);
+  if (generator_counter_ >= shm_epoch_rows_) {
+    *eoe = true;
+    return Status::OK();
+  }
+  // The samples are dispatched to the workers in turn, so the rows are taken from their rings in the same order.
+  auto ring_id = static_cast<int32_t>(generator_counter_ % shm_ring_->NumRings());
+  uint32_t check_interval = GlobalContext::config_manager()->multiprocessing_timeout_interval();
+  auto start = std::chrono::steady_clock::now();
+  int64_t wait_count = 1;
+  bool ready = false;
+  while (!ready) {
+    RETURN_IF_INTERRUPTED();
+    RETURN_IF_NOT_OK(shm_ring_->Read(ring_id, kSharedRowWaitMilliSeconds, tensor_row, &ready));
+    auto cost_time =
+      std::chrono::duration_cast<std::chrono::seconds>(std::chrono::steady_clock::now() - start).count();
+    if (!ready && check_interval > 0 && cost_time >= wait_count * check_interval) {
+      wait_count++;
+      MS_LOG(WARNING) << "It has been waiting for " << cost_time << "s for the worker process " << ring_id
+                      << " of GeneratorDataset to generate data. Check whether the source of GeneratorDataset has an "
+                         "infinite loop operation or the worker process is killed. You can also set the timeout "
+                         "interval by ds.config.set_multiprocessing_timeout_interval to adjust the output frequency "
+                         "of this log.";
+    }
+  }
+  if (tensor_row->size() != column_names_.size()) {
+    RETURN_STATUS_ERROR(
+      StatusCode::kMDPyFuncException,
+      "Invalid python function, the 'source' of 'GeneratorDataset' should return same number of NumPy arrays as "
+      "specified in column_names, the size of column_names is:" +
+        std::to_string(column_names_.size()) +
+        " and number of returned NumPy array is:" + std::to_string(tensor_row->size()));
+  }
+  for (size_t i = 0; i < column_types_.size() && i < tensor_row->size(); ++i) {
+    if (column_types_[i] != DataType::DE_UNKNOWN && column_types_[i] != (*tensor_row)[i]->type()) {
+      RETURN_STATUS_ERROR(StatusCode::kMDPyFuncException,
+                          "Invalid python function, type of returned data in 'GeneratorDataset' should be same with "
+                          "specified column_types, but the type of returned data: " +
+                            (*tensor_row)[i]->type().ToString() + ", specified column type: " +
+                            column_types_[i].ToString());
+    }
+  }
+  generator_counter_++;
+  return Status::OK();
+}
+
 // Entry point for Generator, called by launch()
 // Note that this function is very easy to break because of the Python GIL mechanism
 // The master thread has the following workflow
@@ -176,7 +247,10 @@ Status GeneratorOp::operator()() {
     // Create new row each iteration
     bool eoe = false;
     TensorRow new_row;
-    {
+    if (shm_ring_ != nullptr) {
+      // The rows written by the worker processes are taken without the GIL.
+      RETURN_IF_NOT_OK(SharedRowToTensorRow(&new_row, &eoe));
+    } else {
       py::gil_scoped_acquire gil_acquire;
       if (Py_IsInitialized() == 0) {
         RETURN_STATUS_ERROR(StatusCode::kMDPythonInterpreterFailure,
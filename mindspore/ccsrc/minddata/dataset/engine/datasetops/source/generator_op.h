@@ -26,6 +26,7 @@
 #include "minddata/dataset/core/tensor.h"
 #include "minddata/dataset/engine/data_schema.h"
 #include "minddata/dataset/engine/datasetops/pipeline_op.h"
+#include "minddata/dataset/engine/datasetops/source/shared_row_ring.h"
 #include "minddata/dataset/engine/datasetops/source/sampler/sampler.h"
 #include "minddata/dataset/util/wait_post.h"
 #include "pybind11/pybind11.h"
@@ -37,12 +38,14 @@ namespace dataset {
 #pragma GCC visibility push(hidden)
 
 constexpr int32_t kGetItemTimeOutMilliSeconds = 25000;
+constexpr int64_t kSharedRowWaitMilliSeconds = 100;
+constexpr int32_t kMinSharedRowSlots = 2;
 
 class GeneratorOp : public PipelineOp, public RandomAccessOp {
  public:
   GeneratorOp(py::function generator_function, std::vector<std::string> column_names,
               std::vector<DataType> column_types, int32_t prefetch_size, int32_t connector_size,
-              std::shared_ptr<SamplerRT> sampler, int32_t num_parallel_workers);
+              std::shared_ptr<SamplerRT> sampler, int32_t num_parallel_workers, int64_t shm_row_size = 0);
 
   ~GeneratorOp() = default;
 
@@ -90,6 +93,12 @@ class GeneratorOp : public PipelineOp, public RandomAccessOp {
   int32_t prefetch_size_;
   int64_t generator_counter_;
   int32_t num_parallel_workers_;
+  bool zero_copy_;  // share the arrays returned by the generator instead of copying them
+  // The max size in bytes of a row written by the worker processes into the shared memory, 0 means the rows are
+  // returned by the generator instead
+  int64_t shm_row_size_;
+  std::unique_ptr<SharedRowRing> shm_ring_;
+  int64_t shm_epoch_rows_;  // The number of rows dispatched to the worker processes in the current epoch
 
   py::object generator_;
 
@@ -97,6 +106,12 @@ class GeneratorOp : public PipelineOp, public RandomAccessOp {
 
   Status PyRowToTensorRow(py::object py_data, TensorRow *tensor_row);
 
+  /// Take the next row written by the worker processes from the shared memory, the GIL is not needed.
+  /// \param[out] tensor_row The row taken from the shared memory
+  /// \param[out] eoe Whether all the rows of the epoch are taken
+  /// \return Status The status code returned
+  Status SharedRowToTensorRow(TensorRow *tensor_row, bool *eoe);
+
   /// Private function for computing the assignment of the column name map.
   /// \return - Status
   Status ComputeColMap() override;
@@ -109,9 +109,9 @@ Status ImageFolderOp::LoadTensorRow(row_id_type row_id, TensorRow *trow) {
   std::shared_ptr<Tensor> image, label;
   RETURN_IF_NOT_OK(Tensor::CreateScalar(pair_ptr->second, &label));
 #ifdef ENABLE_PYTHON
-  RETURN_IF_NOT_OK(MappableLeafOp::ImageDecrypt(folder_path_ + (pair_ptr->first), &image, decrypt_));
+  RETURN_IF_NOT_OK(ReadImage(folder_path_ + (pair_ptr->first), &image, decrypt_));
 #else
-  RETURN_IF_NOT_OK(Tensor::CreateFromFile(folder_path_ + (pair_ptr->first), &image));
+  RETURN_IF_NOT_OK(ReadFile(folder_path_ + (pair_ptr->first), &image));
 #endif
 
   if (decode_ == true) {
@@ -127,6 +127,16 @@ Status ImageFolderOp::LoadTensorRow(row_id_type row_id, TensorRow *trow) {
   return Status::OK();
 }
 
+Status ImageFolderOp::PrefetchRow(row_id_type row_id) {
+#ifdef ENABLE_PYTHON
+  if (NeedDecrypt(decrypt_)) {
+    return Status::OK();
+  }
+#endif
+  PrefetchFile(folder_path_ + image_label_pairs_[row_id]->first);
+  return Status::OK();
+}
+
 void ImageFolderOp::Print(std::ostream &out, bool show_all) const {
   if (!show_all) {
     // Call the super class for displaying any common 1-liner info
@@ -134,6 +134,11 @@ class ImageFolderOp : public MappableLeafOp {
   // @return Status The status code returned
   Status LoadTensorRow(row_id_type row_id, TensorRow *row) override;
 
+  // Start to read the image file of a row ahead
+  // @param row_id_type row_id - id for the tensor row to load later
+  // @return Status The status code returned
+  Status PrefetchRow(row_id_type row_id) override;
+
   /// @param std::string & dir - dir to walk all images
   /// @param int64_t * cnt - number of non folder files under the current dir
   /// @return
@@ -59,7 +59,7 @@ Status ManifestOp::LoadTensorRow(row_id_type row_id, TensorRow *trow) {
     RETURN_IF_NOT_OK(label->Reshape(TensorShape(std::vector<dsize_t>(1, label_index.size()))));
   }
 
-  RETURN_IF_NOT_OK(Tensor::CreateFromFile(data.first, &image));
+  RETURN_IF_NOT_OK(ReadFile(data.first, &image));
   if (decode_ == true) {
     Status rc = Decode(image, &image);
     if (rc.IsError()) {
@@ -73,6 +73,11 @@ Status ManifestOp::LoadTensorRow(row_id_type row_id, TensorRow *trow) {
   return Status::OK();
 }
 
+Status ManifestOp::PrefetchRow(row_id_type row_id) {
+  PrefetchFile(image_labelname_[static_cast<size_t>(row_id)].first);
+  return Status::OK();
+}
+
 void ManifestOp::Print(std::ostream &out, bool show_all) const {
   if (!show_all) {
     // Call the super class for displaying any common 1-liner info
@@ -85,6 +85,11 @@ class ManifestOp : public MappableLeafOp {
   // @return Status The status code returned
   Status LoadTensorRow(row_id_type row_id, TensorRow *row) override;
 
+  // Start to read the image file of a row ahead
+  // @param row_id_type row_id - id for the tensor row to load later
+  // @return Status The status code returned
+  Status PrefetchRow(row_id_type row_id) override;
+
   // Parse manifest file to get image path and label and so on.
   // @return Status The status code returned
   Status PrepareData() override;
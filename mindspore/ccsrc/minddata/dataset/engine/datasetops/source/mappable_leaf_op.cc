@@ -16,19 +16,25 @@
 #include "minddata/dataset/engine/datasetops/source/mappable_leaf_op.h"
 #include "utils/ms_utils.h"
 #include "minddata/dataset/core/config_manager.h"
+#include "minddata/dataset/core/global_context.h"
 #include "minddata/dataset/engine/datasetops/source/sampler/sequential_sampler.h"
 #include "minddata/dataset/engine/execution_tree.h"
 
 namespace mindspore {
 namespace dataset {
 MappableLeafOp::MappableLeafOp(int32_t num_wkrs, int32_t queue_size, std::shared_ptr<SamplerRT> sampler)
-    : ParallelOp(num_wkrs, queue_size, std::move(sampler)) {}
+    : ParallelOp(num_wkrs, queue_size, std::move(sampler)) {
+  int32_t readahead_depth = GlobalContext::config_manager()->file_readahead_depth();
+  if (readahead_depth > 0) {
+    readahead_ = std::make_unique<FileReadahead>(readahead_depth);
+  }
+}
 
 #ifdef ENABLE_PYTHON
 Status MappableLeafOp::ImageDecrypt(const std::string &path, std::shared_ptr<Tensor> *tensor,
                                     const py::function &decrypt) {
   RETURN_UNEXPECTED_IF_NULL(tensor);
-  if (decrypt == nullptr || py::isinstance<py::none>(decrypt)) {
+  if (!NeedDecrypt(decrypt)) {
     RETURN_IF_NOT_OK(Tensor::CreateFromFile(path, tensor));
   } else {
     // Acquire Python GIL
@@ -52,8 +58,40 @@ Status MappableLeafOp::ImageDecrypt(const std::string &path, std::shared_ptr<Ten
   }
   return Status::OK();
 }
+
+bool MappableLeafOp::NeedDecrypt(const py::function &decrypt) {
+  return decrypt != nullptr && !py::isinstance<py::none>(decrypt);
+}
+
+Status MappableLeafOp::ReadImage(const std::string &path, std::shared_ptr<Tensor> *tensor,
+                                 const py::function &decrypt) const {
+  if (NeedDecrypt(decrypt)) {
+    return ImageDecrypt(path, tensor, decrypt);
+  }
+  return ReadFile(path, tensor);
+}
 #endif
 
+void MappableLeafOp::PrefetchFile(const std::string &path) const {
+  if (readahead_ != nullptr) {
+    readahead_->Prefetch(path);
+  }
+}
+
+Status MappableLeafOp::ReadFile(const std::string &path, std::shared_ptr<Tensor> *tensor) const {
+  if (readahead_ != nullptr) {
+    return readahead_->Read(path, tensor);
+  }
+  return Tensor::CreateFromFile(path, tensor);
+}
+
+std::unordered_map<std::string, int64_t> MappableLeafOp::GetProfilingMetrics() const {
+  if (readahead_ == nullptr) {
+    return {};
+  }
+  return readahead_->GetMetrics();
+}
+
 // Main logic, Register Queue with TaskGroup, launch all threads and do the functor's work
 Status MappableLeafOp::operator()() {
   // Registering and launching worker threads have to be before in sync with caller (i.e., before FindMe()::Post())
@@ -83,6 +121,9 @@ Status MappableLeafOp::operator()() {
         ep_step++;
         total_step++;
         RETURN_IF_NOT_OK(callback_manager_.StepBegin(CallbackParam(op_current_epochs_ + 1, ep_step, total_step)));
+        if (readahead_ != nullptr) {
+          RETURN_IF_NOT_OK(PrefetchRow(*itr));
+        }
         RETURN_IF_NOT_OK(
           worker_in_queues_[NextWorkerID()]->Add(std::make_unique<IOBlock>(*itr, IOBlock::kDeIoBlockNone)));
       }
@@ -23,6 +23,7 @@
 #include <algorithm>
 #include <map>
 #include <set>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 #include "minddata/dataset/core/tensor.h"
@@ -35,6 +36,7 @@
 #else
 #include "minddata/dataset/kernels/image/lite_image_utils.h"
 #endif
+#include "minddata/dataset/util/io_service.h"
 #include "minddata/dataset/util/path.h"
 #include "minddata/dataset/util/queue.h"
 #include "minddata/dataset/util/services.h"
@@ -68,6 +70,10 @@ class MappableLeafOp : public ParallelOp<std::unique_ptr<IOBlock>, TensorRow>, p
   /// @return Name of the current Op
   std::string Name() const override { return "MappableLeafPp"; }
 
+  /// Get the readahead metrics of the op for the dataset profiler
+  /// \return The metrics, which are empty if readahead is disabled
+  std::unordered_map<std::string, int64_t> GetProfilingMetrics() const override;
+
 #ifdef ENABLE_PYTHON
   /// \brief Decrypt the encrypted image data as a public function.
   /// \param[in] path - The path of the image that needs to be decrypted.
@@ -103,11 +109,45 @@ class MappableLeafOp : public ParallelOp<std::unique_ptr<IOBlock>, TensorRow>, p
   /// \return Status The status code returned
   virtual Status LoadTensorRow(row_id_type row_id, TensorRow *row) = 0;
 
+  /// Start to read the files of a row ahead. It is called by the master thread in the order of the sampler ids before
+  /// the row is sent to a worker when readahead is enabled. The derived class which reads the files of its rows by
+  /// ReadFile() should override it and call PrefetchFile() with the same paths.
+  /// \param row_id_type row_id - id of the tensor row to load later
+  /// \return Status The status code returned
+  virtual Status PrefetchRow(row_id_type row_id) { return Status::OK(); }
+
+  /// Start to read a whole file ahead, it is ignored if readahead is disabled
+  /// \param[in] path - The path of the file
+  void PrefetchFile(const std::string &path) const;
+
+  /// Read a whole file into a uint8 tensor, the bytes read ahead are taken if there are any
+  /// \param[in] path - The path of the file
+  /// \param[out] tensor - Returned tensor
+  /// \return Status code
+  Status ReadFile(const std::string &path, std::shared_ptr<Tensor> *tensor) const;
+
+#ifdef ENABLE_PYTHON
+  /// Check whether the images need decryption, which are not read ahead
+  /// \param[in] decrypt - Image decryption function
+  /// \return True if the decryption function is set
+  static bool NeedDecrypt(const py::function &decrypt);
+
+  /// Read an image file like ImageDecrypt(), the bytes read ahead are taken if the image needs no decryption
+  /// \param[in] path - The path of the image
+  /// \param[out] tensor - Returned tensor
+  /// \param[in] decrypt - Image decryption function
+  /// \return Status code
+  Status ReadImage(const std::string &path, std::shared_ptr<Tensor> *tensor, const py::function &decrypt) const;
+#endif
+
   /// Reset function to be called after every epoch to reset the source op after
   /// \return Status The status code returned
   Status Reset() override;
   Status SendWaitFlagToWorker(int32_t worker_id) override;
   Status SendQuitFlagToWorker(int32_t worker_id) override;
+
+  // Reads the files of the rows ahead, nullptr if readahead is disabled
+  std::unique_ptr<FileReadahead> readahead_;
 };
 }  // namespace dataset
 }  // namespace mindspore
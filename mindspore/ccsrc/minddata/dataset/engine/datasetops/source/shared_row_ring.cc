@@ -0,0 +1,305 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "minddata/dataset/engine/datasetops/source/shared_row_ring.h"
+
+#if !defined(_WIN32) && !defined(_WIN64)
+#include <sys/ipc.h>
+#include <sys/shm.h>
+#include <sys/stat.h>
+#endif
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstring>
+#include <thread>
+#include <utility>
+
+#include "minddata/dataset/util/log_adapter.h"
+
+namespace mindspore {
+namespace dataset {
+namespace {
+constexpr int64_t kRingMagic = 0x474E4952574F52;  // "ROWRING"
+constexpr int64_t kRingAlignment = 64;
+constexpr int64_t kMaxSleepMicroSeconds = 1000;
+constexpr int32_t kSlotEmpty = 0;
+constexpr int32_t kSlotRow = 1;
+constexpr int32_t kSlotError = 2;
+
+struct SegmentHeader {
+  int64_t magic;
+  int32_t num_rings;
+  int32_t num_slots;
+  int64_t slot_size;
+};
+
+int64_t AlignUp(int64_t size) { return (size + kRingAlignment - 1) / kRingAlignment * kRingAlignment; }
+
+void CopyBytes(uchar *dest, const void *src, int64_t size) {
+  if (size > 0) {
+    (void)std::memcpy(dest, src, static_cast<size_t>(size));
+  }
+}
+
+template <typename T>
+void PutValue(const T &value, uchar **pos) {
+  CopyBytes(*pos, &value, sizeof(T));
+  *pos += sizeof(T);
+}
+
+template <typename T>
+Status GetValue(const uchar *end, const uchar **pos, T *value) {
+  CHECK_FAIL_RETURN_UNEXPECTED(*pos + sizeof(T) <= end, "[Internal ERROR] The row in the shared memory is truncated.");
+  (void)std::memcpy(value, *pos, sizeof(T));
+  *pos += sizeof(T);
+  return Status::OK();
+}
+}  // namespace
+
+struct SharedRowRing::SlotHeader {
+  std::atomic<int32_t> state;
+  int32_t reserved;
+  int64_t length;
+};
+
+static_assert(std::atomic<int32_t>::is_always_lock_free,
+              "The state of the slots should be lock free to be shared between processes.");
+
+Status SharedRowRing::Create(int32_t num_rings, int32_t num_slots, int64_t slot_size,
+                             std::unique_ptr<SharedRowRing> *out) {
+  RETURN_UNEXPECTED_IF_NULL(out);
+  CHECK_FAIL_RETURN_UNEXPECTED(num_rings > 0 && num_slots > 0 && slot_size > 0,
+                               "[Internal ERROR] The number of rings and slots and the slot size should be positive.");
+#if defined(_WIN32) || defined(_WIN64)
+  RETURN_STATUS_UNEXPECTED("The shared memory ring of rows is not supported on Windows.");
+#else
+  int64_t slot_stride = AlignUp(static_cast<int64_t>(sizeof(SlotHeader)) + slot_size);
+  int64_t total_size = kRingAlignment + slot_stride * num_rings * num_slots;
+  int shm_id = shmget(IPC_PRIVATE, static_cast<size_t>(total_size), IPC_CREAT | IPC_EXCL | S_IRUSR | S_IWUSR);
+  if (shm_id == -1) {
+    RETURN_STATUS_UNEXPECTED("Failed to create the shared memory of " + std::to_string(total_size) +
+                             " bytes, errno: " + std::to_string(errno) +
+                             ". This might be caused by insufficient shm, try to decrease max_rowsize or "
+                             "num_parallel_workers.");
+  }
+  void *addr = shmat(shm_id, nullptr, 0);
+  if (addr == reinterpret_cast<void *>(-1)) {
+    (void)shmctl(shm_id, IPC_RMID, nullptr);
+    RETURN_STATUS_UNEXPECTED("Failed to attach the shared memory, errno: " + std::to_string(errno));
+  }
+  std::unique_ptr<SharedRowRing> ring(new SharedRowRing());
+  ring->shm_id_ = shm_id;
+  ring->base_ = static_cast<uchar *>(addr);
+  ring->owner_ = true;
+  auto *header = reinterpret_cast<SegmentHeader *>(ring->base_);
+  header->magic = kRingMagic;
+  header->num_rings = num_rings;
+  header->num_slots = num_slots;
+  header->slot_size = slot_size;
+  RETURN_IF_NOT_OK(ring->Init(true));
+  *out = std::move(ring);
+  return Status::OK();
+#endif
+}
+
+Status SharedRowRing::Attach(int32_t shm_id, std::unique_ptr<SharedRowRing> *out) {
+  RETURN_UNEXPECTED_IF_NULL(out);
+#if defined(_WIN32) || defined(_WIN64)
+  RETURN_STATUS_UNEXPECTED("The shared memory ring of rows is not supported on Windows.");
+#else
+  void *addr = shmat(shm_id, nullptr, 0);
+  if (addr == reinterpret_cast<void *>(-1)) {
+    RETURN_STATUS_UNEXPECTED("Failed to attach the shared memory with id: " + std::to_string(shm_id) +
+                             ", errno: " + std::to_string(errno));
+  }
+  std::unique_ptr<SharedRowRing> ring(new SharedRowRing());
+  ring->shm_id_ = shm_id;
+  ring->base_ = static_cast<uchar *>(addr);
+  RETURN_IF_NOT_OK(ring->Init(false));
+  *out = std::move(ring);
+  return Status::OK();
+#endif
+}
+
+SharedRowRing::~SharedRowRing() {
+#if !defined(_WIN32) && !defined(_WIN64)
+  if (base_ != nullptr && shmdt(base_) == -1) {
+    MS_LOG(WARNING) << "Failed to detach the shared memory with id: " << shm_id_ << ", errno: " << errno;
+  }
+  // The segment is removed after all the attached processes detach from it.
+  if (owner_ && shmctl(shm_id_, IPC_RMID, nullptr) == -1) {
+    MS_LOG(WARNING) << "Failed to remove the shared memory with id: " << shm_id_ << ", errno: " << errno
+                    << ". Please remove it manually using ipcrm -m command.";
+  }
+#endif
+  base_ = nullptr;
+}
+
+Status SharedRowRing::Init(bool owner) {
+  const auto *header = reinterpret_cast<const SegmentHeader *>(base_);
+  CHECK_FAIL_RETURN_UNEXPECTED(header->magic == kRingMagic && header->num_rings > 0 && header->num_slots > 0,
+                               "[Internal ERROR] The shared memory with id: " + std::to_string(shm_id_) +
+                                 " is not a ring of rows.");
+  num_rings_ = header->num_rings;
+  num_slots_ = header->num_slots;
+  slot_size_ = header->slot_size;
+  slot_stride_ = AlignUp(static_cast<int64_t>(sizeof(SlotHeader)) + slot_size_);
+  cursors_.assign(num_rings_, 0);
+  if (owner) {
+    for (int64_t i = 0; i < static_cast<int64_t>(num_rings_) * num_slots_; i++) {
+      auto *slot = new (base_ + kRingAlignment + i * slot_stride_) SlotHeader();
+      slot->state.store(kSlotEmpty, std::memory_order_release);
+      slot->length = 0;
+    }
+  }
+  return Status::OK();
+}
+
+Status SharedRowRing::NextSlot(int32_t ring_id, SlotHeader **slot) {
+  CHECK_FAIL_RETURN_UNEXPECTED(ring_id >= 0 && ring_id < num_rings_,
+                               "[Internal ERROR] The ring id: " + std::to_string(ring_id) + " is out of range.");
+  int64_t index = static_cast<int64_t>(ring_id) * num_slots_ + cursors_[ring_id] % num_slots_;
+  *slot = reinterpret_cast<SlotHeader *>(base_ + kRingAlignment + index * slot_stride_);
+  return Status::OK();
+}
+
+bool SharedRowRing::WaitSlot(const SlotHeader *slot, bool for_write, int64_t timeout_ms) {
+  auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(timeout_ms);
+  int64_t sleep_us = 1;
+  // The writer waits for the slot to be emptied, and the reader waits for it to be filled.
+  while ((slot->state.load(std::memory_order_acquire) == kSlotEmpty) != for_write) {
+    if (std::chrono::steady_clock::now() >= deadline) {
+      return false;
+    }
+    std::this_thread::sleep_for(std::chrono::microseconds(sleep_us));
+    sleep_us = std::min(sleep_us * 2, kMaxSleepMicroSeconds);
+  }
+  return true;
+}
+
+Status SharedRowRing::Write(int32_t ring_id, const TensorRow &row, int64_t timeout_ms, bool *written) {
+  RETURN_UNEXPECTED_IF_NULL(written);
+  int64_t length = sizeof(uint32_t);
+  for (const auto &tensor : row) {
+    RETURN_UNEXPECTED_IF_NULL(tensor);
+    CHECK_FAIL_RETURN_UNEXPECTED(tensor->shape().known(), "The shape of the tensor to write should be known.");
+    length += sizeof(uint8_t) + sizeof(uint32_t) + sizeof(int64_t) * (tensor->Rank() + 1) + tensor->SizeInBytes();
+  }
+  if (length > slot_size_) {
+    RETURN_STATUS_UNEXPECTED("The size of the row: " + std::to_string(length) +
+                             " bytes is larger than the size of the shared memory slot: " + std::to_string(slot_size_) +
+                             " bytes, try to increase max_rowsize.");
+  }
+  SlotHeader *slot = nullptr;
+  RETURN_IF_NOT_OK(NextSlot(ring_id, &slot));
+  *written = WaitSlot(slot, true, timeout_ms);
+  if (!*written) {
+    return Status::OK();
+  }
+  uchar *pos = reinterpret_cast<uchar *>(slot) + sizeof(SlotHeader);
+  PutValue<uint32_t>(static_cast<uint32_t>(row.size()), &pos);
+  for (const auto &tensor : row) {
+    PutValue<uint8_t>(static_cast<uint8_t>(tensor->type().value()), &pos);
+    std::vector<dsize_t> dims = tensor->shape().AsVector();
+    PutValue<uint32_t>(static_cast<uint32_t>(dims.size()), &pos);
+    for (auto dim : dims) {
+      PutValue<int64_t>(dim, &pos);
+    }
+    int64_t byte_size = tensor->SizeInBytes();
+    PutValue<int64_t>(byte_size, &pos);
+    CopyBytes(pos, tensor->GetBuffer(), byte_size);
+    pos += byte_size;
+  }
+  slot->length = length;
+  // Publish the row after it is fully written.
+  slot->state.store(kSlotRow, std::memory_order_release);
+  cursors_[ring_id]++;
+  return Status::OK();
+}
+
+Status SharedRowRing::WriteError(int32_t ring_id, const std::string &err_msg, int64_t timeout_ms, bool *written) {
+  RETURN_UNEXPECTED_IF_NULL(written);
+  SlotHeader *slot = nullptr;
+  RETURN_IF_NOT_OK(NextSlot(ring_id, &slot));
+  *written = WaitSlot(slot, true, timeout_ms);
+  if (!*written) {
+    return Status::OK();
+  }
+  // A long message is truncated to the size of the slot.
+  int64_t length = std::min(static_cast<int64_t>(err_msg.size()), slot_size_);
+  CopyBytes(reinterpret_cast<uchar *>(slot) + sizeof(SlotHeader), err_msg.data(), length);
+  slot->length = length;
+  slot->state.store(kSlotError, std::memory_order_release);
+  cursors_[ring_id]++;
+  return Status::OK();
+}
+
+Status SharedRowRing::Deserialize(const uchar *pos, const uchar *end, TensorRow *row) {
+  uint32_t num_tensors = 0;
+  RETURN_IF_NOT_OK(GetValue(end, &pos, &num_tensors));
+  TensorRow result;
+  for (uint32_t i = 0; i < num_tensors; i++) {
+    uint8_t type = 0;
+    RETURN_IF_NOT_OK(GetValue(end, &pos, &type));
+    CHECK_FAIL_RETURN_UNEXPECTED(type < DataType::NUM_OF_TYPES, "[Internal ERROR] Invalid type of the shared tensor.");
+    uint32_t rank = 0;
+    RETURN_IF_NOT_OK(GetValue(end, &pos, &rank));
+    std::vector<dsize_t> dims(rank);
+    for (uint32_t j = 0; j < rank; j++) {
+      RETURN_IF_NOT_OK(GetValue(end, &pos, &dims[j]));
+    }
+    int64_t byte_size = 0;
+    RETURN_IF_NOT_OK(GetValue(end, &pos, &byte_size));
+    CHECK_FAIL_RETURN_UNEXPECTED(byte_size >= 0 && byte_size <= end - pos,
+                                 "[Internal ERROR] The row in the shared memory is truncated.");
+    std::shared_ptr<Tensor> tensor;
+    DataType data_type(static_cast<DataType::Type>(type));
+    if (byte_size == 0) {
+      RETURN_IF_NOT_OK(Tensor::CreateEmpty(TensorShape(dims), data_type, &tensor));
+    } else {
+      RETURN_IF_NOT_OK(Tensor::CreateFromMemory(TensorShape(dims), data_type, pos, byte_size, &tensor));
+    }
+    pos += byte_size;
+    result.push_back(std::move(tensor));
+  }
+  *row = std::move(result);
+  return Status::OK();
+}
+
+Status SharedRowRing::Read(int32_t ring_id, int64_t timeout_ms, TensorRow *row, bool *ready) {
+  RETURN_UNEXPECTED_IF_NULL(row);
+  RETURN_UNEXPECTED_IF_NULL(ready);
+  SlotHeader *slot = nullptr;
+  RETURN_IF_NOT_OK(NextSlot(ring_id, &slot));
+  *ready = WaitSlot(slot, false, timeout_ms);
+  if (!*ready) {
+    return Status::OK();
+  }
+  const uchar *data = reinterpret_cast<const uchar *>(slot) + sizeof(SlotHeader);
+  const uchar *end = data + std::min(slot->length, slot_size_);
+  Status rc;
+  if (slot->state.load(std::memory_order_acquire) == kSlotError) {
+    rc = Status(StatusCode::kMDPyFuncException, std::string(reinterpret_cast<const char *>(data), end - data));
+  } else {
+    rc = Deserialize(data, end, row);
+  }
+  // The slot is released to the writer even if the row is invalid.
+  slot->state.store(kSlotEmpty, std::memory_order_release);
+  cursors_[ring_id]++;
+  return rc;
+}
+}  // namespace dataset
+}  // namespace mindspore
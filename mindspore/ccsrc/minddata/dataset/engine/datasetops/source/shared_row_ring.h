@@ -0,0 +1,116 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef MINDSPORE_CCSRC_MINDDATA_DATASET_ENGINE_DATASETOPS_SOURCE_SHARED_ROW_RING_H_
+#define MINDSPORE_CCSRC_MINDDATA_DATASET_ENGINE_DATASETOPS_SOURCE_SHARED_ROW_RING_H_
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "minddata/dataset/core/tensor_row.h"
+#include "minddata/dataset/util/status.h"
+
+namespace mindspore {
+namespace dataset {
+// SharedRowRing transfers the rows from the worker processes to the pipeline through a shared memory segment, so the
+// rows are not pickled. The segment is split into one ring for each worker, and each ring has a fixed number of slots
+// of a fixed size. A worker serializes its rows into the slots of its own ring in order and marks them full, and the
+// reader takes the rows of a ring in the same order and marks the slots empty again. Every ring has one writer and one
+// reader, so the processes only synchronize on the state of the slots.
+class SharedRowRing {
+ public:
+  // Create a shared memory segment which is removed when the object is destroyed.
+  // @param int32_t num_rings - the number of rings, one for each writer
+  // @param int32_t num_slots - the number of slots of each ring
+  // @param int64_t slot_size - the max size in bytes of a serialized row
+  // @param std::unique_ptr<SharedRowRing> *out - the created ring
+  // @return Status The status code returned
+  static Status Create(int32_t num_rings, int32_t num_slots, int64_t slot_size, std::unique_ptr<SharedRowRing> *out);
+
+  // Attach to a shared memory segment created by another process.
+  // @param int32_t shm_id - the id of the shared memory segment
+  // @param std::unique_ptr<SharedRowRing> *out - the attached ring
+  // @return Status The status code returned
+  static Status Attach(int32_t shm_id, std::unique_ptr<SharedRowRing> *out);
+
+  // Destructor, which detaches the segment and removes it if it is created by this object
+  ~SharedRowRing();
+
+  // Serialize a row into the next slot of a ring.
+  // @param int32_t ring_id - the ring to write
+  // @param const TensorRow &row - the row to write, all its tensors should have a known shape
+  // @param int64_t timeout_ms - the max time to wait for an empty slot
+  // @param bool *written - false if no slot is emptied before timeout
+  // @return Status The status code returned
+  Status Write(int32_t ring_id, const TensorRow &row, int64_t timeout_ms, bool *written);
+
+  // Write an error message into the next slot of a ring, the reader of the slot returns the error.
+  // @param int32_t ring_id - the ring to write
+  // @param const std::string &err_msg - the error message
+  // @param int64_t timeout_ms - the max time to wait for an empty slot
+  // @param bool *written - false if no slot is emptied before timeout
+  // @return Status The status code returned
+  Status WriteError(int32_t ring_id, const std::string &err_msg, int64_t timeout_ms, bool *written);
+
+  // Take the row in the next slot of a ring.
+  // @param int32_t ring_id - the ring to read
+  // @param int64_t timeout_ms - the max time to wait for a full slot
+  // @param TensorRow *row - the row read from the ring
+  // @param bool *ready - false if no slot is filled before timeout
+  // @return Status The status code returned, which is the error written by WriteError() if any
+  Status Read(int32_t ring_id, int64_t timeout_ms, TensorRow *row, bool *ready);
+
+  // @return int32_t - the id of the shared memory segment, which is used by the other processes to attach
+  int32_t ShmId() const { return shm_id_; }
+
+  // @return int32_t - the number of rings
+  int32_t NumRings() const { return num_rings_; }
+
+ private:
+  struct SlotHeader;
+
+  SharedRowRing() = default;
+
+  // Map the layout of the rings from the header of the segment.
+  Status Init(bool owner);
+
+  // Get the next slot of a ring to write or read.
+  // @param int32_t ring_id - the ring of the slot
+  // @param SlotHeader **slot - the slot
+  // @return Status The status code returned
+  Status NextSlot(int32_t ring_id, SlotHeader **slot);
+
+  // Restore a row from the bytes serialized by Write().
+  static Status Deserialize(const uchar *pos, const uchar *end, TensorRow *row);
+
+  // Wait until a slot is empty to write or filled to read, or until timeout.
+  // @return bool - false if the slot is not ready before timeout
+  static bool WaitSlot(const SlotHeader *slot, bool for_write, int64_t timeout_ms);
+
+  int32_t shm_id_ = -1;
+  uchar *base_ = nullptr;
+  bool owner_ = false;
+  int32_t num_rings_ = 0;
+  int32_t num_slots_ = 0;
+  int64_t slot_size_ = 0;
+  int64_t slot_stride_ = 0;
+  // The number of slots written or read of each ring by this process
+  std::vector<int64_t> cursors_;
+};
+}  // namespace dataset
+}  // namespace mindspore
+
+#endif  // MINDSPORE_CCSRC_MINDDATA_DATASET_ENGINE_DATASETOPS_SOURCE_SHARED_ROW_RING_H_
@@ -0,0 +1,382 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "minddata/dataset/engine/datasetops/source/tf_example_decoder.h"
+
+#include <algorithm>
+#include <cstring>
+
+namespace mindspore {
+namespace dataset {
+namespace {
+constexpr uint32_t kWireVarint = 0;
+constexpr uint32_t kWireFixed64 = 1;
+constexpr uint32_t kWireLengthDelimited = 2;
+constexpr uint32_t kWireFixed32 = 5;
+constexpr uint32_t kTagTypeBits = 3;
+constexpr uint64_t kTagTypeMask = 0x7;
+constexpr int kMaxVarintBytes = 10;
+constexpr int kVarintPayloadBits = 7;
+constexpr uint8_t kVarintPayloadMask = 0x7F;
+constexpr uint8_t kVarintMoreBit = 0x80;
+constexpr size_t kFixed32Size = 4;
+constexpr size_t kFixed64Size = 8;
+
+// The field numbers of the messages in an Example.
+constexpr uint32_t kExampleFeaturesField = 1;
+constexpr uint32_t kFeaturesMapField = 1;
+constexpr uint32_t kMapKeyField = 1;
+constexpr uint32_t kMapValueField = 2;
+constexpr uint32_t kListValueField = 1;
+
+// WireReader reads the fields of a serialized protobuf message one by one. All the reads fail on malformed data
+// instead of reading beyond the end of the message.
+class WireReader {
+ public:
+  WireReader(const uint8_t *data, size_t size) : pos_(data), end_(data + size) {}
+
+  bool Done() const { return pos_ >= end_; }
+
+  bool ReadVarint(uint64_t *value) {
+    uint64_t result = 0;
+    for (int i = 0; i < kMaxVarintBytes && pos_ < end_; ++i) {
+      uint8_t byte = *pos_++;
+      result |= static_cast<uint64_t>(byte & kVarintPayloadMask) << (i * kVarintPayloadBits);
+      if ((byte & kVarintMoreBit) == 0) {
+        *value = result;
+        return true;
+      }
+    }
+    return false;
+  }
+
+  bool ReadTag(uint32_t *field, uint32_t *wire_type) {
+    uint64_t tag = 0;
+    if (!ReadVarint(&tag)) {
+      return false;
+    }
+    *field = static_cast<uint32_t>(tag >> kTagTypeBits);
+    *wire_type = static_cast<uint32_t>(tag & kTagTypeMask);
+    return *field != 0;
+  }
+
+  bool ReadBytes(size_t size, const uint8_t **data) {
+    if (static_cast<size_t>(end_ - pos_) < size) {
+      return false;
+    }
+    *data = pos_;
+    pos_ += size;
+    return true;
+  }
+
+  bool ReadLengthDelimited(const uint8_t **data, size_t *size) {
+    uint64_t length = 0;
+    if (!ReadVarint(&length) || length > static_cast<uint64_t>(end_ - pos_)) {
+      return false;
+    }
+    *size = static_cast<size_t>(length);
+    return ReadBytes(*size, data);
+  }
+
+  bool Skip(uint32_t wire_type) {
+    uint64_t value = 0;
+    const uint8_t *data = nullptr;
+    size_t size = 0;
+    switch (wire_type) {
+      case kWireVarint:
+        return ReadVarint(&value);
+      case kWireFixed64:
+        return ReadBytes(kFixed64Size, &data);
+      case kWireLengthDelimited:
+        return ReadLengthDelimited(&data, &size);
+      case kWireFixed32:
+        return ReadBytes(kFixed32Size, &data);
+      default:
+        // The deprecated groups are not supported.
+        return false;
+    }
+  }
+
+ private:
+  const uint8_t *pos_;
+  const uint8_t *end_;
+};
+}  // namespace
+
+TFExampleDecoder::TFExampleDecoder(const std::vector<std::string> &column_names) : column_names_(column_names) {
+  for (size_t i = 0; i < column_names_.size(); ++i) {
+    column_index_[std::string_view(column_names_[i])] = i;
+  }
+}
+
+Status TFExampleDecoder::Decode(const uint8_t *data, size_t size, std::vector<FeatureView> *features,
+                                bool *supported) const {
+  RETURN_UNEXPECTED_IF_NULL(features);
+  RETURN_UNEXPECTED_IF_NULL(supported);
+  features->assign(column_names_.size(), FeatureView());
+  *supported = false;
+  WireReader example(data, size);
+  while (!example.Done()) {
+    uint32_t field = 0;
+    uint32_t wire_type = 0;
+    if (!example.ReadTag(&field, &wire_type)) {
+      return Status::OK();
+    }
+    if (field != kExampleFeaturesField || wire_type != kWireLengthDelimited) {
+      if (!example.Skip(wire_type)) {
+        return Status::OK();
+      }
+      continue;
+    }
+    // The Features fields which appear more than once are merged, so the map entries of all of them are decoded.
+    const uint8_t *features_data = nullptr;
+    size_t features_size = 0;
+    if (!example.ReadLengthDelimited(&features_data, &features_size)) {
+      return Status::OK();
+    }
+    WireReader reader(features_data, features_size);
+    while (!reader.Done()) {
+      if (!reader.ReadTag(&field, &wire_type)) {
+        return Status::OK();
+      }
+      if (field != kFeaturesMapField || wire_type != kWireLengthDelimited) {
+        if (!reader.Skip(wire_type)) {
+          return Status::OK();
+        }
+        continue;
+      }
+      const uint8_t *entry_data = nullptr;
+      size_t entry_size = 0;
+      if (!reader.ReadLengthDelimited(&entry_data, &entry_size) || !DecodeMapEntry(entry_data, entry_size, features)) {
+        return Status::OK();
+      }
+    }
+  }
+  *supported = true;
+  return Status::OK();
+}
+
+bool TFExampleDecoder::DecodeMapEntry(const uint8_t *data, size_t size, std::vector<FeatureView> *features) const {
+  WireReader reader(data, size);
+  std::string_view key;
+  const uint8_t *value_data = nullptr;
+  size_t value_size = 0;
+  bool has_value = false;
+  while (!reader.Done()) {
+    uint32_t field = 0;
+    uint32_t wire_type = 0;
+    if (!reader.ReadTag(&field, &wire_type)) {
+      return false;
+    }
+    const uint8_t *field_data = nullptr;
+    size_t field_size = 0;
+    if (field == kMapKeyField && wire_type == kWireLengthDelimited) {
+      if (!reader.ReadLengthDelimited(&field_data, &field_size)) {
+        return false;
+      }
+      key = std::string_view(reinterpret_cast<const char *>(field_data), field_size);
+    } else if (field == kMapValueField && wire_type == kWireLengthDelimited) {
+      // A value split into several fields should be merged.
+      if (has_value || !reader.ReadLengthDelimited(&value_data, &value_size)) {
+        return false;
+      }
+      has_value = true;
+    } else if (!reader.Skip(wire_type)) {
+      return false;
+    }
+  }
+  auto iter = column_index_.find(key);
+  if (iter == column_index_.end()) {
+    return true;
+  }
+  // The last entry of a key wins, the same as the map of protobuf.
+  FeatureView &feature = (*features)[iter->second];
+  feature = FeatureView();
+  feature.present = true;
+  return !has_value || DecodeFeature(value_data, value_size, &feature);
+}
+
+bool TFExampleDecoder::DecodeFeature(const uint8_t *data, size_t size, FeatureView *feature) {
+  WireReader reader(data, size);
+  while (!reader.Done()) {
+    uint32_t field = 0;
+    uint32_t wire_type = 0;
+    if (!reader.ReadTag(&field, &wire_type)) {
+      return false;
+    }
+    bool is_list = field == kBytesList || field == kFloatList || field == kInt64List;
+    if (!is_list || wire_type != kWireLengthDelimited) {
+      if (!reader.Skip(wire_type)) {
+        return false;
+      }
+      continue;
+    }
+    // A list split into several fields should be merged, while another kind replaces the former one of the oneof.
+    if (feature->kind == static_cast<FeatureKind>(field) ||
+        !reader.ReadLengthDelimited(&feature->data, &feature->size)) {
+      return false;
+    }
+    feature->kind = static_cast<FeatureKind>(field);
+  }
+  return true;
+}
+
+Status TFExampleDecoder::GetBytesList(const FeatureView &feature, std::vector<std::string_view> *values) {
+  RETURN_UNEXPECTED_IF_NULL(values);
+  values->clear();
+  WireReader reader(feature.data, feature.size);
+  while (!reader.Done()) {
+    uint32_t field = 0;
+    uint32_t wire_type = 0;
+    const uint8_t *data = nullptr;
+    size_t size = 0;
+    bool ok = reader.ReadTag(&field, &wire_type);
+    if (ok && field == kListValueField && wire_type == kWireLengthDelimited) {
+      ok = reader.ReadLengthDelimited(&data, &size);
+      if (ok) {
+        (void)values->emplace_back(reinterpret_cast<const char *>(data), size);
+      }
+    } else if (ok) {
+      ok = reader.Skip(wire_type);
+    }
+    CHECK_FAIL_RETURN_UNEXPECTED(ok, "Invalid data, failed to decode the bytes list in tfrecord file.");
+  }
+  return Status::OK();
+}
+
+Status TFExampleDecoder::CountFloatList(const FeatureView &feature, int64_t *count) {
+  RETURN_UNEXPECTED_IF_NULL(count);
+  *count = 0;
+  WireReader reader(feature.data, feature.size);
+  while (!reader.Done()) {
+    uint32_t field = 0;
+    uint32_t wire_type = 0;
+    const uint8_t *data = nullptr;
+    size_t size = 0;
+    bool ok = reader.ReadTag(&field, &wire_type);
+    if (ok && field == kListValueField && wire_type == kWireLengthDelimited) {
+      // The packed values
+      ok = reader.ReadLengthDelimited(&data, &size) && size % kFixed32Size == 0;
+      *count += static_cast<int64_t>(size / kFixed32Size);
+    } else if (ok && field == kListValueField && wire_type == kWireFixed32) {
+      ok = reader.ReadBytes(kFixed32Size, &data);
+      *count += 1;
+    } else if (ok) {
+      ok = reader.Skip(wire_type);
+    }
+    CHECK_FAIL_RETURN_UNEXPECTED(ok, "Invalid data, failed to decode the float list in tfrecord file.");
+  }
+  return Status::OK();
+}
+
+Status TFExampleDecoder::ReadFloatList(const FeatureView &feature, float *values, int64_t count) {
+  CHECK_FAIL_RETURN_UNEXPECTED(values != nullptr || count == 0, "[Internal ERROR] The memory of values is null.");
+  WireReader reader(feature.data, feature.size);
+  int64_t index = 0;
+  while (!reader.Done() && index < count) {
+    uint32_t field = 0;
+    uint32_t wire_type = 0;
+    const uint8_t *data = nullptr;
+    size_t size = 0;
+    bool ok = reader.ReadTag(&field, &wire_type);
+    if (ok && field == kListValueField && (wire_type == kWireLengthDelimited || wire_type == kWireFixed32)) {
+      if (wire_type == kWireLengthDelimited) {
+        ok = reader.ReadLengthDelimited(&data, &size);
+      } else {
+        size = kFixed32Size;
+        ok = reader.ReadBytes(size, &data);
+      }
+      // The floats are little-endian on the wire, the same as the hosts supported.
+      size_t num = std::min(static_cast<size_t>(count - index), size / kFixed32Size);
+      if (ok && num > 0) {
+        (void)memcpy(values + index, data, num * kFixed32Size);
+        index += static_cast<int64_t>(num);
+      }
+    } else if (ok) {
+      ok = reader.Skip(wire_type);
+    }
+    CHECK_FAIL_RETURN_UNEXPECTED(ok, "Invalid data, failed to decode the float list in tfrecord file.");
+  }
+  return Status::OK();
+}
+
+Status TFExampleDecoder::CountInt64List(const FeatureView &feature, int64_t *count) {
+  RETURN_UNEXPECTED_IF_NULL(count);
+  *count = 0;
+  WireReader reader(feature.data, feature.size);
+  while (!reader.Done()) {
+    uint32_t field = 0;
+    uint32_t wire_type = 0;
+    const uint8_t *data = nullptr;
+    size_t size = 0;
+    uint64_t value = 0;
+    bool ok = reader.ReadTag(&field, &wire_type);
+    if (ok && field == kListValueField && wire_type == kWireLengthDelimited) {
+      // Each packed varint ends with a byte without the more bit.
+      ok = reader.ReadLengthDelimited(&data, &size) && (size == 0 || (data[size - 1] & kVarintMoreBit) == 0);
+      for (size_t i = 0; ok && i < size; ++i) {
+        *count += (data[i] & kVarintMoreBit) == 0 ? 1 : 0;
+      }
+    } else if (ok && field == kListValueField && wire_type == kWireVarint) {
+      ok = reader.ReadVarint(&value);
+      *count += 1;
+    } else if (ok) {
+      ok = reader.Skip(wire_type);
+    }
+    CHECK_FAIL_RETURN_UNEXPECTED(ok, "Invalid data, failed to decode the int64 list in tfrecord file.");
+  }
+  return Status::OK();
+}
+
+template <typename T>
+Status TFExampleDecoder::ReadInt64List(const FeatureView &feature, T *values, int64_t count) {
+  CHECK_FAIL_RETURN_UNEXPECTED(values != nullptr || count == 0, "[Internal ERROR] The memory of values is null.");
+  WireReader reader(feature.data, feature.size);
+  int64_t index = 0;
+  while (!reader.Done() && index < count) {
+    uint32_t field = 0;
+    uint32_t wire_type = 0;
+    const uint8_t *data = nullptr;
+    size_t size = 0;
+    uint64_t value = 0;
+    bool ok = reader.ReadTag(&field, &wire_type);
+    if (ok && field == kListValueField && wire_type == kWireLengthDelimited) {
+      ok = reader.ReadLengthDelimited(&data, &size);
+      WireReader packed(data, size);
+      while (ok && !packed.Done() && index < count) {
+        ok = packed.ReadVarint(&value);
+        values[index++] = static_cast<T>(static_cast<int64_t>(value));
+      }
+    } else if (ok && field == kListValueField && wire_type == kWireVarint) {
+      ok = reader.ReadVarint(&value);
+      values[index++] = static_cast<T>(static_cast<int64_t>(value));
+    } else if (ok) {
+      ok = reader.Skip(wire_type);
+    }
+    CHECK_FAIL_RETURN_UNEXPECTED(ok, "Invalid data, failed to decode the int64 list in tfrecord file.");
+  }
+  return Status::OK();
+}
+
+template Status TFExampleDecoder::ReadInt64List<uint64_t>(const FeatureView &feature, uint64_t *values, int64_t count);
+template Status TFExampleDecoder::ReadInt64List<int64_t>(const FeatureView &feature, int64_t *values, int64_t count);
+template Status TFExampleDecoder::ReadInt64List<uint32_t>(const FeatureView &feature, uint32_t *values, int64_t count);
+template Status TFExampleDecoder::ReadInt64List<int32_t>(const FeatureView &feature, int32_t *values, int64_t count);
+template Status TFExampleDecoder::ReadInt64List<uint16_t>(const FeatureView &feature, uint16_t *values, int64_t count);
+template Status TFExampleDecoder::ReadInt64List<int16_t>(const FeatureView &feature, int16_t *values, int64_t count);
+template Status TFExampleDecoder::ReadInt64List<uint8_t>(const FeatureView &feature, uint8_t *values, int64_t count);
+template Status TFExampleDecoder::ReadInt64List<int8_t>(const FeatureView &feature, int8_t *values, int64_t count);
+}  // namespace dataset
+}  // namespace mindspore
@@ -0,0 +1,112 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef MINDSPORE_CCSRC_MINDDATA_DATASET_ENGINE_DATASETOPS_SOURCE_TF_EXAMPLE_DECODER_H_
+#define MINDSPORE_CCSRC_MINDDATA_DATASET_ENGINE_DATASETOPS_SOURCE_TF_EXAMPLE_DECODER_H_
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include "minddata/dataset/util/status.h"
+
+namespace mindspore {
+namespace dataset {
+// TFExampleDecoder walks the protobuf wire format of a serialized dataengine::Example directly, instead of parsing it
+// into protobuf messages. It only finds the features of the columns to load and skips the others, and the values of
+// a feature are read straight into the memory of its tensor later.
+// The wire format of an Example is:
+//   Example { Features features = 1; }
+//   Features { map<string, Feature> feature = 1; }, each map entry is { string key = 1; Feature value = 2; }
+//   Feature { oneof kind { BytesList bytes_list = 1; FloatList float_list = 2; Int64List int64_list = 3; } }
+//   BytesList { repeated bytes value = 1; }, FloatList { repeated float value = 1; },
+//   Int64List { repeated int64 value = 1; }
+class TFExampleDecoder {
+ public:
+  enum FeatureKind : uint8_t { kKindNotSet = 0, kBytesList = 1, kFloatList = 2, kInt64List = 3 };
+
+  // The serialized list of a feature in the Example, it points into the serialized Example.
+  struct FeatureView {
+    bool present = false;
+    FeatureKind kind = kKindNotSet;
+    const uint8_t *data = nullptr;
+    size_t size = 0;
+  };
+
+  // Constructor of TFExampleDecoder
+  // @param const std::vector<std::string> &column_names - the names of the features to find
+  explicit TFExampleDecoder(const std::vector<std::string> &column_names);
+
+  // Destructor
+  ~TFExampleDecoder() = default;
+
+  // Find the features of the columns in a serialized Example. It is thread safe.
+  // @param const uint8_t *data - the serialized Example
+  // @param size_t size - the size of the serialized Example
+  // @param std::vector<FeatureView> *features - the features found in the order of the columns
+  // @param bool *supported - false if the Example is malformed or uses the encodings the decoder does not handle,
+  //     such as a feature list split into several fields to merge, then it should be parsed by protobuf instead
+  // @return Status The status code returned
+  Status Decode(const uint8_t *data, size_t size, std::vector<FeatureView> *features, bool *supported) const;
+
+  // Get the values of a bytes list, the values point into the serialized Example.
+  // @param const FeatureView &feature - the bytes list feature
+  // @param std::vector<std::string_view> *values - the values of the list
+  // @return Status The status code returned
+  static Status GetBytesList(const FeatureView &feature, std::vector<std::string_view> *values);
+
+  // Count the values of a float list.
+  // @param const FeatureView &feature - the float list feature
+  // @param int64_t *count - the number of values
+  // @return Status The status code returned
+  static Status CountFloatList(const FeatureView &feature, int64_t *count);
+
+  // Read the values of a float list.
+  // @param const FeatureView &feature - the float list feature
+  // @param float *values - the memory to write the values to
+  // @param int64_t count - the max number of values to write
+  // @return Status The status code returned
+  static Status ReadFloatList(const FeatureView &feature, float *values, int64_t count);
+
+  // Count the values of an int64 list.
+  // @param const FeatureView &feature - the int64 list feature
+  // @param int64_t *count - the number of values
+  // @return Status The status code returned
+  static Status CountInt64List(const FeatureView &feature, int64_t *count);
+
+  // Read the values of an int64 list and cast them to type T.
+  // @param const FeatureView &feature - the int64 list feature
+  // @param T *values - the memory to write the values to
+  // @param int64_t count - the max number of values to write
+  // @return Status The status code returned
+  template <typename T>
+  static Status ReadInt64List(const FeatureView &feature, T *values, int64_t count);
+
+ private:
+  // Find the feature in a map entry of Features.
+  bool DecodeMapEntry(const uint8_t *data, size_t size, std::vector<FeatureView> *features) const;
+
+  // Find the kind and the list of a Feature.
+  static bool DecodeFeature(const uint8_t *data, size_t size, FeatureView *feature);
+
+  std::vector<std::string> column_names_;
+  // The index of each column, the keys are the views of column_names_.
+  std::unordered_map<std::string_view, size_t> column_index_;
+};
+}  // namespace dataset
+}  // namespace mindspore
+#endif  // MINDSPORE_CCSRC_MINDDATA_DATASET_ENGINE_DATASETOPS_SOURCE_TF_EXAMPLE_DECODER_H_
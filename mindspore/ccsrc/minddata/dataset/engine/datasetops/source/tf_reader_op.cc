@@ -21,6 +21,7 @@
 #include <memory>
 #include <mutex>
 #include <string>
+#include <string_view>
 #include <utility>
 #include <vector>
 
@@ -106,7 +107,8 @@ TFReaderOp::TFReaderOp(int32_t num_workers, int32_t worker_connector_size, int64
       dataset_files_list_(std::move(dataset_files_list)),
       columns_to_load_(std::move(columns_to_load)),
       data_schema_(std::move(data_schema)),
-      equal_rows_per_shard_(equal_rows_per_shard) {}
+      equal_rows_per_shard_(equal_rows_per_shard),
+      crc_check_(GlobalContext::config_manager()->enable_tfrecord_crc_check()) {}
 
 // A print method typically used for debugging
 void TFReaderOp::Print(std::ostream &out, bool show_all) const {
@@ -141,6 +143,12 @@ Status TFReaderOp::Init() {
     RETURN_IF_NOT_OK(CreateSchema(dataset_files_list_[0], columns_to_load_));
   }
 
+  std::vector<std::string> column_names;
+  for (int32_t i = 0; i < data_schema_->NumColumns(); ++i) {
+    column_names.push_back(data_schema_->Column(i).Name());
+  }
+  example_decoder_ = std::make_unique<TFExampleDecoder>(column_names);
+
   if (total_rows_ == 0) {
     total_rows_ = data_schema_->NumRows();
   }
@@ -339,8 +347,11 @@ Status TFReaderOp::LoadFile(const std::string &filename, int64_t start_offset, i
     RETURN_STATUS_UNEXPECTED("Invalid file, " + filename + " open failed: permission denied!");
   }
 
-  int64_t rows_read = 0;
   int64_t rows_total = 0;
+  int32_t num_columns = data_schema_->NumColumns();
+  // The buffers are reused by all the records of the file.
+  std::string serialized_example;
+  std::vector<TFExampleDecoder::FeatureView> features;
 
   while (reader.peek() != EOF) {
     if (!load_jagged_connector_) {
@@ -352,104 +363,113 @@ Status TFReaderOp::LoadFile(const std::string &filename, int64_t start_offset, i
     int64_t record_length = 0;
     (void)reader.read(reinterpret_cast<char *>(&record_length), static_cast<std::streamsize>(sizeof(int64_t)));
 
-    // ignore crc header
-    (void)reader.ignore(static_cast<std::streamsize>(sizeof(int32_t)));
+    // read or ignore crc header
+    uint32_t masked_crc = 0;
+    (void)reader.read(reinterpret_cast<char *>(&masked_crc), static_cast<std::streamsize>(sizeof(uint32_t)));
+    if (crc_check_) {
+      CHECK_FAIL_RETURN_UNEXPECTED(
+        masked_crc == system::Crc32c::GetMaskCrc32cValue(reinterpret_cast<char *>(&record_length), sizeof(int64_t)),
+        "Invalid file, the crc of the length of the record " + std::to_string(rows_total) + " in tfrecord file: " +
+          filename + " does not match, the file may be damaged.");
+    }
+
+    bool in_range = start_offset == kInvalidOffset || (rows_total >= start_offset && rows_total < end_offset);
+    if (!in_range && !crc_check_) {
+      if (rows_total >= end_offset) {
+        break;
+      }
+      // skip the data and the crc footer of the record out of range without reading them
+      (void)reader.seekg(static_cast<std::streamoff>(record_length + sizeof(uint32_t)), std::ios::cur);
+      rows_total++;
+      continue;
+    }
 
     // read serialized Example
-    std::string serialized_example;
     serialized_example.resize(record_length);
     (void)reader.read(&serialized_example[0], static_cast<std::streamsize>(record_length));
 
-    int32_t num_columns = data_schema_->NumColumns();
-    TensorRow newRow(num_columns, nullptr);
-
-    if (start_offset == kInvalidOffset || (rows_total >= start_offset && rows_total < end_offset)) {
-      dataengine::Example tf_file;
-      if (!tf_file.ParseFromString(serialized_example)) {
-        std::string errMsg = "Failed to parse tfrecord file: " + filename + ", make sure protobuf version is suitable.";
-        MS_LOG(DEBUG) << errMsg + ", details of string: " << serialized_example;
-        RETURN_STATUS_UNEXPECTED(errMsg);
-      }
+    // read or ignore crc footer
+    (void)reader.read(reinterpret_cast<char *>(&masked_crc), static_cast<std::streamsize>(sizeof(uint32_t)));
+    if (crc_check_) {
+      CHECK_FAIL_RETURN_UNEXPECTED(
+        reader.good() && masked_crc == system::Crc32c::GetMaskCrc32cValue(serialized_example.data(), record_length),
+        "Invalid file, the crc of the record " + std::to_string(rows_total) + " in tfrecord file: " + filename +
+          " does not match, the file may be damaged.");
+    }
 
+    if (in_range) {
+      TensorRow newRow(num_columns, nullptr);
       std::vector<std::string> file_path(num_columns, filename);
       newRow.setPath(file_path);
-      RETURN_IF_NOT_OK(LoadExample(&tf_file, &newRow));
-      rows_read++;
+      RETURN_IF_NOT_OK(LoadExample(filename, serialized_example, &features, &newRow));
       RETURN_IF_NOT_OK(jagged_rows_connector_->Add(worker_id, std::move(newRow)));
     }
-
-    // ignore crc footer
-    (void)reader.ignore(static_cast<std::streamsize>(sizeof(int32_t)));
     rows_total++;
   }
 
   return Status::OK();
 }
 
-// Parses a single row and puts the data into a tensor table.
-Status TFReaderOp::LoadExample(const dataengine::Example *tf_file, TensorRow *out_row) {
+// Decodes a single serialized Example and puts the data of the columns into a row.
+Status TFReaderOp::LoadExample(const std::string &filename, const std::string &serialized_example,
+                               std::vector<TFExampleDecoder::FeatureView> *features, TensorRow *out_row) {
+  bool supported = false;
+  RETURN_IF_NOT_OK(example_decoder_->Decode(reinterpret_cast<const uint8_t *>(serialized_example.data()),
+                                            serialized_example.size(), features, &supported));
+  // The features point into this buffer when the Example is reserialized by protobuf.
+  std::string canonical_example;
+  if (!supported) {
+    // The Example is malformed or uses the encodings the decoder does not handle, such as a list split into several
+    // fields, so let protobuf parse it and serialize it in the canonical form.
+    dataengine::Example tf_file;
+    if (!tf_file.ParseFromString(serialized_example)) {
+      std::string errMsg = "Failed to parse tfrecord file: " + filename + ", make sure protobuf version is suitable.";
+      MS_LOG(DEBUG) << errMsg + ", details of string: " << serialized_example;
+      RETURN_STATUS_UNEXPECTED(errMsg);
+    }
+    CHECK_FAIL_RETURN_UNEXPECTED(tf_file.SerializeToString(&canonical_example),
+                                 "[Internal ERROR] Failed to serialize the Example of tfrecord file: " + filename);
+    RETURN_IF_NOT_OK(example_decoder_->Decode(reinterpret_cast<const uint8_t *>(canonical_example.data()),
+                                              canonical_example.size(), features, &supported));
+    CHECK_FAIL_RETURN_UNEXPECTED(supported, "[Internal ERROR] Failed to decode the Example of tfrecord file: " +
+                                              filename);
+  }
+
   int32_t num_columns = data_schema_->NumColumns();
   for (int32_t col = 0; col < num_columns; ++col) {
-    const ColDescriptor current_col = data_schema_->Column(col);
-    const dataengine::Features &example_features = tf_file->features();
-    const google::protobuf::Map<std::string, dataengine::Feature> &feature_map = example_features.feature();
-    auto iter_column = feature_map.find(current_col.Name());
-    if (iter_column == feature_map.end()) {
+    const ColDescriptor &current_col = data_schema_->Column(col);
+    if (!(*features)[col].present) {
       RETURN_STATUS_UNEXPECTED("Invalid columns_list, column name: " + current_col.Name() +
                                " does not exist in tfrecord file, check tfrecord files.");
     }
-    const dataengine::Feature &column_values_list = iter_column->second;
-    RETURN_IF_NOT_OK(LoadFeature(out_row, column_values_list, current_col, col));
+    RETURN_IF_NOT_OK(LoadFeature(out_row, (*features)[col], current_col, col));
   }
 
   return Status::OK();
 }
 
 // Parses a single cell and puts the data into a tensor table.
-Status TFReaderOp::LoadFeature(TensorRow *tensor_row, const dataengine::Feature &column_values_list,
+Status TFReaderOp::LoadFeature(TensorRow *tensor_row, const TFExampleDecoder::FeatureView &feature,
                                const ColDescriptor &current_col, int32_t col) {
-  const dataengine::Feature::KindCase column_list_type = column_values_list.kind_case();
-  std::unique_ptr<float[]> float_array;     // For staging data from protobuf deserialization
-  const unsigned char *data_ptr = nullptr;  // Generic pointer used for populating the Tensor
-
-  // This variable will point into the above staging variables.
-  // Also used for creating shape attributes.
+  // The number of elements of the data, also used for creating shape attributes.
   int32_t num_elements = 0;
 
-  // we build a tensor first a read directly into it if we need to cast
+  // we build the tensor first and read directly into it
   std::shared_ptr<Tensor> ts;
 
-  // Depending on the type of data from the tf_file, we want to extract 2 things:
-  // 1) A pointer to the data as a const unsigned char *
-  // 2) The number of elements of the data
-  // After those are determined, we can then build the tensor to represent this data.
-  switch (column_list_type) {
-    case dataengine::Feature::KindCase::kBytesList: {
-      RETURN_IF_NOT_OK(LoadBytesList(current_col, column_values_list, &num_elements, &ts));
-
+  switch (feature.kind) {
+    case TFExampleDecoder::kBytesList: {
+      RETURN_IF_NOT_OK(LoadBytesList(current_col, feature, &num_elements, &ts));
       break;
     }
-    case dataengine::Feature::KindCase::kFloatList: {
-      RETURN_IF_NOT_OK(LoadFloatList(current_col, column_values_list, &num_elements, &float_array));
-
-      data_ptr = reinterpret_cast<const unsigned char *>(float_array.get());
-
-      // only floatList needs to create the tensor here, other two lists read directly
-      // into the tensor
-      TensorShape current_shape = TensorShape::CreateUnknownRankShape();
-      RETURN_IF_NOT_OK(current_col.MaterializeTensorShape(num_elements, &current_shape));
-      RETURN_IF_NOT_OK(Tensor::CreateFromMemory(current_shape, current_col.Type(), data_ptr, &ts));
+    case TFExampleDecoder::kFloatList: {
+      RETURN_IF_NOT_OK(LoadFloatList(current_col, feature, &num_elements, &ts));
       break;
     }
-    case dataengine::Feature::KindCase::kInt64List: {
-      RETURN_IF_NOT_OK(LoadIntListSwitch(current_col, column_values_list, &num_elements, &ts));
+    case TFExampleDecoder::kInt64List: {
+      RETURN_IF_NOT_OK(LoadIntListSwitch(current_col, feature, &num_elements, &ts));
       break;
     }
-    case dataengine::Feature::KindCase::KIND_NOT_SET: {
-      std::string err_msg =
-        "Unrecognized datatype, column type in tfrecord file must be uint8, int64 or float32, check tfrecord file.";
-      RETURN_STATUS_UNEXPECTED(err_msg);
-    }
     default: {
       std::string err_msg =
         "Unrecognized datatype, column type in tfrecord file must be uint8, int64 or float32, check tfrecord file.";
@@ -462,7 +482,7 @@ Status TFReaderOp::LoadFeature(TensorRow *tensor_row, const dataengine::Feature
   return Status::OK();
 }
 
-Status TFReaderOp::LoadBytesList(const ColDescriptor &current_col, const dataengine::Feature &column_values_list,
+Status TFReaderOp::LoadBytesList(const ColDescriptor &current_col, const TFExampleDecoder::FeatureView &feature,
                                  int32_t *num_elements, std::shared_ptr<Tensor> *tensor) {
   // kBytesList can map to the following DE types ONLY!
   // DE_UINT8, DE_INT8
@@ -474,24 +494,21 @@ Status TFReaderOp::LoadBytesList(const ColDescriptor &current_col, const dataeng
     RETURN_STATUS_UNEXPECTED(err_msg);
   }
 
-  const dataengine::BytesList &bytes_list = column_values_list.bytes_list();
+  std::vector<std::string_view> bytes_list;
+  RETURN_IF_NOT_OK(TFExampleDecoder::GetBytesList(feature, &bytes_list));
 
-  *num_elements = bytes_list.value_size();
+  *num_elements = static_cast<int32_t>(bytes_list.size());
 
   if (current_col.Type() == DataType::DE_STRING) {
     TensorShape shape = TensorShape::CreateScalar();
     RETURN_IF_NOT_OK(current_col.MaterializeTensorShape(*num_elements, &shape));
-    RETURN_IF_NOT_OK(Tensor::CreateFromByteList(bytes_list, shape, tensor));
+    RETURN_IF_NOT_OK(Tensor::CreateFromVector(bytes_list, shape, tensor));
     return Status::OK();
   }
 
   uint64_t max_size = 0;
-  for (uint32_t i = 0; i < bytes_list.value_size(); ++i) {
-#if defined(__APPLE__)
-    max_size = fmax(max_size, bytes_list.value(i).size());
-#else
-    max_size = std::max(max_size, bytes_list.value(i).size());
-#endif
+  for (const auto &value : bytes_list) {
+    max_size = std::max<uint64_t>(max_size, value.size());
   }
 
   int64_t pad_size = max_size;
@@ -522,16 +539,42 @@ Status TFReaderOp::LoadBytesList(const ColDescriptor &current_col, const dataeng
     }
   }
 
-  // know how many elements there are and the total bytes, create tensor here:
+  // know how many elements there are and the total bytes, create tensor here and read the bytes into it:
   TensorShape current_shape = TensorShape::CreateScalar();
   RETURN_IF_NOT_OK(current_col.MaterializeTensorShape((*num_elements) * pad_size, &current_shape));
-  RETURN_IF_NOT_OK(Tensor::CreateFromByteList(bytes_list, current_shape, current_col.Type(), pad_size, tensor));
+  RETURN_IF_NOT_OK(Tensor::CreateEmpty(current_shape, current_col.Type(), tensor));
+
+  int64_t tensor_bytes_remaining = (*num_elements) * pad_size;
+  if (tensor_bytes_remaining == 0) {
+    return Status::OK();
+  }
+  unsigned char *current_tensor_addr = &(*(*tensor)->begin<unsigned char>());
+  for (const auto &value : bytes_list) {
+    int64_t element_size = static_cast<int64_t>(value.size());
+    CHECK_FAIL_RETURN_UNEXPECTED(element_size <= tensor_bytes_remaining,
+                                 "memcpy_s failed when reading bytesList element into Tensor");
+    if (element_size > 0) {
+      int return_code = memcpy_s(current_tensor_addr, tensor_bytes_remaining, value.data(), element_size);
+      CHECK_FAIL_RETURN_UNEXPECTED(return_code == 0, "memcpy_s failed when reading bytesList element into Tensor");
+    }
+    current_tensor_addr += element_size;
+    tensor_bytes_remaining -= element_size;
+
+    // pad
+    int64_t chars_to_pad = pad_size - element_size;
+    if (chars_to_pad > 0) {
+      int return_code = memset_s(current_tensor_addr, tensor_bytes_remaining, static_cast<int>(' '), chars_to_pad);
+      CHECK_FAIL_RETURN_UNEXPECTED(return_code == 0, "memcpy_s failed when padding Tensor");
+      current_tensor_addr += chars_to_pad;
+      tensor_bytes_remaining -= chars_to_pad;
+    }
+  }
 
   return Status::OK();
 }
 
-Status TFReaderOp::LoadFloatList(const ColDescriptor &current_col, const dataengine::Feature &column_values_list,
-                                 int32_t *num_elements, std::unique_ptr<float[]> *float_array) {
+Status TFReaderOp::LoadFloatList(const ColDescriptor &current_col, const TFExampleDecoder::FeatureView &feature,
+                                 int32_t *num_elements, std::shared_ptr<Tensor> *tensor) {
   // KFloatList can only map to DE types:
   // DE_FLOAT32
   if (current_col.Type() != DataType::DE_FLOAT32) {
@@ -540,38 +583,41 @@ Status TFReaderOp::LoadFloatList(const ColDescriptor &current_col, const dataeng
     RETURN_STATUS_UNEXPECTED(err_msg);
   }
 
-  const dataengine::FloatList &float_list = column_values_list.float_list();
+  // Identify how many values we have and then create the tensor to read them into
+  int64_t count = 0;
+  RETURN_IF_NOT_OK(TFExampleDecoder::CountFloatList(feature, &count));
+  *num_elements = static_cast<int32_t>(count);
 
-  // Identify how many values we have and then create a local array of these
-  // to deserialize into
-  *num_elements = float_list.value_size();
-  *float_array = std::make_unique<float[]>(*num_elements);
-  for (int i = 0; i < float_list.value_size(); ++i) {
-    (*float_array)[i] = float_list.value(i);
+  TensorShape current_shape = TensorShape::CreateUnknownRankShape();
+  RETURN_IF_NOT_OK(current_col.MaterializeTensorShape(*num_elements, &current_shape));
+  RETURN_IF_NOT_OK(Tensor::CreateEmpty(current_shape, current_col.Type(), tensor));
+  count = std::min<int64_t>(count, (*tensor)->Size());
+  if (count > 0) {
+    RETURN_IF_NOT_OK(TFExampleDecoder::ReadFloatList(feature, &(*(*tensor)->begin<float>()), count));
   }
 
   return Status::OK();
 }
 
 // Determines which template type to use and calls LoadIntList
-Status TFReaderOp::LoadIntListSwitch(const ColDescriptor &current_col, const dataengine::Feature &column_values_list,
+Status TFReaderOp::LoadIntListSwitch(const ColDescriptor &current_col, const TFExampleDecoder::FeatureView &feature,
                                      int32_t *num_elements, std::shared_ptr<Tensor> *tensor) {
   if (current_col.Type() == DataType::DE_UINT64) {
-    RETURN_IF_NOT_OK(LoadIntList<uint64_t>(current_col, column_values_list, num_elements, tensor));
+    RETURN_IF_NOT_OK(LoadIntList<uint64_t>(current_col, feature, num_elements, tensor));
   } else if (current_col.Type() == DataType::DE_INT64) {
-    RETURN_IF_NOT_OK(LoadIntList<int64_t>(current_col, column_values_list, num_elements, tensor));
+    RETURN_IF_NOT_OK(LoadIntList<int64_t>(current_col, feature, num_elements, tensor));
   } else if (current_col.Type() == DataType::DE_UINT32) {
-    RETURN_IF_NOT_OK(LoadIntList<uint32_t>(current_col, column_values_list, num_elements, tensor));
+    RETURN_IF_NOT_OK(LoadIntList<uint32_t>(current_col, feature, num_elements, tensor));
   } else if (current_col.Type() == DataType::DE_INT32) {
-    RETURN_IF_NOT_OK(LoadIntList<int32_t>(current_col, column_values_list, num_elements, tensor));
+    RETURN_IF_NOT_OK(LoadIntList<int32_t>(current_col, feature, num_elements, tensor));
   } else if (current_col.Type() == DataType::DE_UINT16) {
-    RETURN_IF_NOT_OK(LoadIntList<uint16_t>(current_col, column_values_list, num_elements, tensor));
+    RETURN_IF_NOT_OK(LoadIntList<uint16_t>(current_col, feature, num_elements, tensor));
   } else if (current_col.Type() == DataType::DE_INT16) {
-    RETURN_IF_NOT_OK(LoadIntList<int16_t>(current_col, column_values_list, num_elements, tensor));
+    RETURN_IF_NOT_OK(LoadIntList<int16_t>(current_col, feature, num_elements, tensor));
   } else if (current_col.Type() == DataType::DE_UINT8) {
-    RETURN_IF_NOT_OK(LoadIntList<uint8_t>(current_col, column_values_list, num_elements, tensor));
+    RETURN_IF_NOT_OK(LoadIntList<uint8_t>(current_col, feature, num_elements, tensor));
   } else if (current_col.Type() == DataType::DE_INT8) {
-    RETURN_IF_NOT_OK(LoadIntList<int8_t>(current_col, column_values_list, num_elements, tensor));
+    RETURN_IF_NOT_OK(LoadIntList<int8_t>(current_col, feature, num_elements, tensor));
   } else {
     std::string err_msg = "Invalid column type, the column type of " + current_col.Name() +
                           " should be uint64, int64, uint32, int32, uint16, int16, uint8 or int8, but got " +
@@ -582,10 +628,10 @@ Status TFReaderOp::LoadIntListSwitch(const ColDescriptor &current_col, const dat
   return Status::OK();
 }
 
-// Reads values from a bytes list and casts the value to type T, must be an integral type
+// Reads values from an int64 list and casts the value to type T, must be an integral type
 // compatible with int64_t
 template <typename T>
-Status TFReaderOp::LoadIntList(const ColDescriptor &current_col, const dataengine::Feature &column_values_list,
+Status TFReaderOp::LoadIntList(const ColDescriptor &current_col, const TFExampleDecoder::FeatureView &feature,
                                int32_t *num_elements, std::shared_ptr<Tensor> *tensor) {
   if (!(current_col.Type().IsInt())) {
     std::string err_msg = "Invalid column type, the column type of " + current_col.Name() + " should be int, but got " +
@@ -593,22 +639,18 @@ Status TFReaderOp::LoadIntList(const ColDescriptor &current_col, const dataengin
     RETURN_STATUS_UNEXPECTED(err_msg);
   }
 
-  const dataengine::Int64List &int64_list = column_values_list.int64_list();
-
-  // Identify how many values we have and then create a local array of these
-  // to deserialize into
-  *num_elements = int64_list.value_size();
+  // Identify how many values we have and then create the tensor to read them into
+  int64_t count = 0;
+  RETURN_IF_NOT_OK(TFExampleDecoder::CountInt64List(feature, &count));
+  *num_elements = static_cast<int32_t>(count);
 
   // know how many elements there are, create tensor here:
   TensorShape current_shape = TensorShape::CreateUnknownRankShape();
   RETURN_IF_NOT_OK(current_col.MaterializeTensorShape(*num_elements, &current_shape));
   RETURN_IF_NOT_OK(Tensor::CreateEmpty(current_shape, current_col.Type(), tensor));
-
-  int64_t i = 0;
-  auto it = (*tensor)->begin<T>();
-  for (; it != (*tensor)->end<T>(); i++, ++it) {
-    T element = static_cast<T>(int64_list.value(i));
-    *it = element;
+  count = std::min<int64_t>(count, (*tensor)->Size());
+  if (count > 0) {
+    RETURN_IF_NOT_OK(TFExampleDecoder::ReadInt64List(feature, &(*(*tensor)->begin<T>()), count));
   }
 
   return Status::OK();
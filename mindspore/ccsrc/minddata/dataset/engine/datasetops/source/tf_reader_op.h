@@ -32,14 +32,9 @@
 #include "minddata/dataset/engine/data_schema.h"
 #include "minddata/dataset/engine/datasetops/parallel_op.h"
 #include "minddata/dataset/engine/datasetops/source/nonmappable_leaf_op.h"
+#include "minddata/dataset/engine/datasetops/source/tf_example_decoder.h"
 #include "minddata/dataset/engine/jagged_connector.h"
 
-namespace dataengine {
-class Example;
-class Feature;
-class BytesList;
-}  // namespace dataengine
-
 namespace mindspore {
 namespace dataset {
 template <typename T>
@@ -113,57 +108,61 @@ class TFReaderOp : public NonMappableLeafOp {
   // @return Status - the error code returned.
   Status LoadFile(const std::string &filename, int64_t start_offset, int64_t end_offset, int32_t worker_id) override;
 
-  // Parses a single row and puts the data into a tensor table.
-  // @param tf_file - the row to be parsed.
-  // @param tensor_table - the tensor table to put the parsed data in.
-  // @param row - the id of the row filled in the tensor table.
+  // Decodes a single serialized Example and puts the data of the columns into a row.
+  // @param filename - the tf_file file the Example is read from.
+  // @param serialized_example - the serialized Example.
+  // @param features - the features found by the decoder, reused across the rows.
+  // @param out_row - the row to put the parsed data in.
   // @return Status - the error code returned.
-  Status LoadExample(const dataengine::Example *tf_file, TensorRow *out_row);
+  Status LoadExample(const std::string &filename, const std::string &serialized_example,
+                     std::vector<TFExampleDecoder::FeatureView> *features, TensorRow *out_row);
 
   // Parses a single cell and puts the data into a tensor table.
-  // @param tensor_table - the tensor table to put the parsed data in.
-  // @param column_values_list - the cell to parse.
+  // @param tensor_row - the row to put the parsed data in.
+  // @param feature - the serialized feature of the cell to parse.
   // @param current_col - the column descriptor containing the expected shape and type of the data.
+  // @param col - the index of the column in the row.
   // @return Status - the error code returned.
-  Status LoadFeature(TensorRow *tensor_row, const dataengine::Feature &column_values_list,
+  Status LoadFeature(TensorRow *tensor_row, const TFExampleDecoder::FeatureView &feature,
                      const ColDescriptor &current_col, int32_t col);
 
   /// Reads values from a bytes list
   /// @param current_col - the column descriptor containing the expected shape and type of the data.
-  /// @param column_values_list - the cell that contains the bytes list to read from.
-  /// @param elementStr - the string we read the value into.
+  /// @param feature - the serialized feature that contains the bytes list to read from.
+  /// @Param num_elements - number of values in the bytes list.
+  /// @param tensor - the tensor we read the values into.
   /// @return Status - the error code returned.
-  static Status LoadBytesList(const ColDescriptor &current_col, const dataengine::Feature &column_values_list,
+  static Status LoadBytesList(const ColDescriptor &current_col, const TFExampleDecoder::FeatureView &feature,
                               int32_t *num_elements, std::shared_ptr<Tensor> *tensor);
 
   /// Reads values from a float list
   /// @param current_col - the column descriptor containing the expected shape and type of the data.
-  /// @param column_values_list - the cell that contains the float list to read from.
-  /// @Param numElements - number of values in the float list.
-  /// @param float_array - the array we read the values into.
+  /// @param feature - the serialized feature that contains the float list to read from.
+  /// @Param num_elements - number of values in the float list.
+  /// @param tensor - the tensor we read the values into.
   /// @return Status - the error code returned.
-  Status LoadFloatList(const ColDescriptor &current_col, const dataengine::Feature &column_values_list,
-                       int32_t *num_elements, std::unique_ptr<float[]> *float_array);
+  static Status LoadFloatList(const ColDescriptor &current_col, const TFExampleDecoder::FeatureView &feature,
+                              int32_t *num_elements, std::shared_ptr<Tensor> *tensor);
 
-  /// Reads values from a bytes list and casts the value to type T, must be an integral
+  /// Reads values from an int64 list and casts the value to type T, must be an integral
   /// type compatible with int64_t
   /// @param current_col - the column descriptor containing the expected shape and type of the data.
-  /// @param column_values_list - the cell that contains the int list to read from.
+  /// @param feature - the serialized feature that contains the int list to read from.
   /// @Param num_elements - number of values in the int list.
   /// @param tensor - the tensor we read the values into.
   /// @return Status - the error code returned.
   template <typename T>
-  Status LoadIntList(const ColDescriptor &current_col, const dataengine::Feature &column_values_list,
-                     int32_t *num_elements, std::shared_ptr<Tensor> *tensor);
+  static Status LoadIntList(const ColDescriptor &current_col, const TFExampleDecoder::FeatureView &feature,
+                            int32_t *num_elements, std::shared_ptr<Tensor> *tensor);
 
   /// Determines which template type to use and calls LoadIntList
   /// @param current_col - the column descriptor containing the expected shape and type of the data.
-  /// @param column_values_list - the cell that contains the int list to read from.
-  /// @Param numElements - number of values in the int list.
+  /// @param feature - the serialized feature that contains the int list to read from.
+  /// @Param num_elements - number of values in the int list.
   /// @param tensor - the tensor we read the values into.
   /// @return Status - the error code returned.
-  Status LoadIntListSwitch(const ColDescriptor &current_col, const dataengine::Feature &column_values_list,
-                           int32_t *num_elements, std::shared_ptr<Tensor> *tensor);
+  static Status LoadIntListSwitch(const ColDescriptor &current_col, const TFExampleDecoder::FeatureView &feature,
+                                  int32_t *num_elements, std::shared_ptr<Tensor> *tensor);
 
   /// Reads one row of data from a tf file and creates a schema based on that row
   /// @return Status - the error code returned.
@@ -204,8 +203,12 @@ class TFReaderOp : public NonMappableLeafOp {
   std::vector<std::string> dataset_files_list_;
   std::vector<std::string> columns_to_load_;
   std::unique_ptr<DataSchema> data_schema_;
+  // Decodes the serialized Examples into the columns of data_schema_ without protobuf messages.
+  std::unique_ptr<TFExampleDecoder> example_decoder_;
 
   bool equal_rows_per_shard_;
+  // Whether to verify the crc of the length and the data of each record, which is off by default.
+  bool crc_check_;
 };
 }  // namespace dataset
 }  // namespace mindspore
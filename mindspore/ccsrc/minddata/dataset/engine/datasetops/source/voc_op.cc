@@ -88,6 +88,20 @@ void VOCOp::Print(std::ostream &out, bool show_all) const {
   }
 }
 
+Status VOCOp::PrefetchRow(row_id_type row_id) {
+#ifdef ENABLE_PYTHON
+  if (NeedDecrypt(decrypt_)) {
+    return Status::OK();
+  }
+#endif
+  const std::string &image_id = image_ids_[row_id];
+  PrefetchFile(folder_path_ + std::string(kJPEGImagesFolder) + image_id + std::string(kImageExtension));
+  if (task_type_ == TaskType::Segmentation) {
+    PrefetchFile(folder_path_ + std::string(kSegmentationClassFolder) + image_id + std::string(kSegmentationExtension));
+  }
+  return Status::OK();
+}
+
 Status VOCOp::LoadTensorRow(row_id_type row_id, TensorRow *trow) {
   std::string image_id = image_ids_[row_id];
   std::vector<std::string> path_list;
@@ -271,9 +285,9 @@ Status VOCOp::PrepareData() {
 }
 Status VOCOp::ReadImageToTensor(const std::string &path, const ColDescriptor &col, std::shared_ptr<Tensor> *tensor) {
 #ifdef ENABLE_PYTHON
-  RETURN_IF_NOT_OK(MappableLeafOp::ImageDecrypt(path, tensor, decrypt_));
+  RETURN_IF_NOT_OK(ReadImage(path, tensor, decrypt_));
 #else
-  RETURN_IF_NOT_OK(Tensor::CreateFromFile(path, tensor));
+  RETURN_IF_NOT_OK(ReadFile(path, tensor));
 #endif
   if (decode_ == true) {
     Status rc = Decode(*tensor, tensor);
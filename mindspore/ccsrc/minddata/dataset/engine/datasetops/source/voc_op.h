@@ -112,6 +112,11 @@ class VOCOp : public MappableLeafOp {
   // @return Status The status code returned
   Status LoadTensorRow(row_id_type row_id, TensorRow *row) override;
 
+  // Start to read the image file, and the segmentation file for the Segmentation task, of a row ahead
+  // @param row_id_type row_id - id for the tensor row to load later
+  // @return Status The status code returned
+  Status PrefetchRow(row_id_type row_id) override;
+
   // @param const std::string &path - path to the image file
   // @param const ColDescriptor &col - contains tensor implementation and datatype
   // @param std::shared_ptr<Tensor> tensor - return
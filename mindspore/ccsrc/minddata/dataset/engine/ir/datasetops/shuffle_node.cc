@@ -20,6 +20,7 @@
 #include <string>
 #include <vector>
 
+#include "minddata/dataset/core/config_manager.h"
 #include "minddata/dataset/engine/datasetops/shuffle_op.h"
 #include "minddata/dataset/util/random.h"
 #include "minddata/dataset/util/status.h"
@@ -44,7 +45,9 @@ void ShuffleNode::Print(std::ostream &out) const {
 
 // Function to build the ShuffleOp
 Status ShuffleNode::Build(std::vector<std::shared_ptr<DatasetOp>> *const node_ops) {
-  auto op = std::make_shared<ShuffleOp>(shuffle_size_, shuffle_seed_, connector_que_size_, reset_every_epoch_);
+  int64_t memory_limit = GlobalContext::config_manager()->shuffle_memory_limit();
+  auto op = std::make_shared<ShuffleOp>(shuffle_size_, shuffle_seed_, connector_que_size_, reset_every_epoch_,
+                                        memory_limit);
   op->SetTotalRepeats(GetTotalRepeats());
   op->SetNumRepeatsPerEpoch(GetNumRepeatsPerEpoch());
   node_ops->push_back(op);
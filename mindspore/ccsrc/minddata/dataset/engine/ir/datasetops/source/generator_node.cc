@@ -27,7 +27,7 @@ namespace mindspore {
 namespace dataset {
 GeneratorNode::GeneratorNode(py::function generator_function, const std::vector<std::string> &column_names,
                              const std::vector<DataType> &column_types, int64_t source_len,
-                             std::shared_ptr<SamplerObj> sampler, uint32_t num_parallel_workers)
+                             std::shared_ptr<SamplerObj> sampler, uint32_t num_parallel_workers, int64_t shm_row_size)
     : MappableSourceNode(),
       generator_function_(generator_function),
       column_names_(column_names),
@@ -35,25 +35,29 @@ GeneratorNode::GeneratorNode(py::function generator_function, const std::vector<
       source_len_(source_len),
       sampler_(std::move(sampler)),
       num_parallel_workers_(num_parallel_workers),
+      shm_row_size_(shm_row_size),
       reset_ancestor_(nullptr) {}
 
 GeneratorNode::GeneratorNode(py::function generator_function, const std::shared_ptr<SchemaObj> &schema,
-                             int64_t source_len, std::shared_ptr<SamplerObj> sampler, uint32_t num_parallel_workers)
+                             int64_t source_len, std::shared_ptr<SamplerObj> sampler, uint32_t num_parallel_workers,
+                             int64_t shm_row_size)
     : MappableSourceNode(),
       generator_function_(generator_function),
       schema_(schema),
       source_len_(source_len),
       sampler_(std::move(sampler)),
       num_parallel_workers_(num_parallel_workers),
+      shm_row_size_(shm_row_size),
       reset_ancestor_(nullptr) {}
 
 std::shared_ptr<DatasetNode> GeneratorNode::Copy() {
   std::shared_ptr<GeneratorNode> node;
   if (schema_ == nullptr) {
     node = std::make_shared<GeneratorNode>(generator_function_, column_names_, column_types_, source_len_, sampler_,
-                                           num_parallel_workers_);
+                                           num_parallel_workers_, shm_row_size_);
   } else {
-    node = std::make_shared<GeneratorNode>(generator_function_, schema_, source_len_, sampler_, num_parallel_workers_);
+    node = std::make_shared<GeneratorNode>(generator_function_, schema_, source_len_, sampler_, num_parallel_workers_,
+                                           shm_row_size_);
   }
   node->SetNumWorkers(num_workers_);
   node->SetConnectorQueueSize(connector_que_size_);
@@ -84,8 +88,9 @@ Status GeneratorNode::Build(std::vector<std::shared_ptr<DatasetOp>> *const node_
 
   // GeneratorOp's constructor takes in a prefetch_size, which isn't being set by user nor is it being used by
   // GeneratorOp internally. Here it is given a zero which is the default in generator builder
-  std::shared_ptr<GeneratorOp> op = std::make_shared<GeneratorOp>(
-    generator_function_, column_names_, column_types_, 0, connector_que_size_, sampler_rt, num_parallel_workers_);
+  std::shared_ptr<GeneratorOp> op =
+    std::make_shared<GeneratorOp>(generator_function_, column_names_, column_types_, 0, connector_que_size_, sampler_rt,
+                                  num_parallel_workers_, shm_row_size_);
   // set the number of rows from source length
   op->SetNumRows(source_len_);
 
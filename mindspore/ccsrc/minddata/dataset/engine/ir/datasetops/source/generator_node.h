@@ -35,11 +35,11 @@ class GeneratorNode : public MappableSourceNode {
   /// \brief Constructor
   GeneratorNode(py::function generator_function, const std::vector<std::string> &column_names,
                 const std::vector<DataType> &column_types, int64_t source_len, std::shared_ptr<SamplerObj> sampler,
-                uint32_t num_parallel_workers);
+                uint32_t num_parallel_workers, int64_t shm_row_size = 0);
 
   /// \brief Constructor
   GeneratorNode(py::function generator_function, const std::shared_ptr<SchemaObj> &schema, int64_t source_len,
-                std::shared_ptr<SamplerObj> sampler, uint32_t num_parallel_workers);
+                std::shared_ptr<SamplerObj> sampler, uint32_t num_parallel_workers, int64_t shm_row_size = 0);
 
   /// \brief Destructor
   ~GeneratorNode() override = default;
@@ -110,6 +110,9 @@ class GeneratorNode : public MappableSourceNode {
   std::shared_ptr<SamplerObj> sampler_;
   uint32_t num_parallel_workers_;
   int64_t source_len_;  // Length of the dataset source provided by the user, -1 means it's unknown
+  // The max size in bytes of a row written by the worker processes into the shared memory, 0 means the rows are
+  // returned by the generator instead
+  int64_t shm_row_size_;
 
   /// \brief Base-class override for accepting IRNodePass visitor
   /// \param[in] p The node to visit
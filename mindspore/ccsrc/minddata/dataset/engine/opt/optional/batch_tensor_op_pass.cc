@@ -0,0 +1,112 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "minddata/dataset/engine/opt/optional/batch_tensor_op_pass.h"
+
+#include <algorithm>
+#include <set>
+#include <string>
+
+#include "minddata/dataset/engine/ir/datasetops/batch_node.h"
+#include "minddata/dataset/engine/ir/datasetops/map_node.h"
+#include "minddata/dataset/kernels/data/batched_tensor_op.h"
+#include "minddata/dataset/kernels/ir/data/transforms_ir.h"
+#include "minddata/dataset/kernels/ir/vision/hwc_to_chw_ir.h"
+#include "minddata/dataset/kernels/ir/vision/normalize_ir.h"
+#include "minddata/dataset/kernels/ir/vision/random_color_adjust_ir.h"
+#include "minddata/dataset/kernels/ir/vision/random_horizontal_flip_ir.h"
+#include "minddata/dataset/kernels/ir/vision/rescale_ir.h"
+
+namespace mindspore {
+namespace dataset {
+namespace {
+// The ops which keep the shape of the images uniform and compute the batch the same as they compute the rows.
+const std::set<std::string> kBatchableOperations = {vision::kNormalizeOperation,
+                                                    vision::kHwcToChwOperation,
+                                                    vision::kRescaleOperation,
+                                                    transforms::kTypeCastOperation,
+                                                    vision::kRandomHorizontalFlipOperation,
+                                                    vision::kRandomColorAdjustOperation};
+}  // namespace
+
+// Record the BatchNode whose only child is a MapNode.
+Status BatchTensorOpPass::BatchNodeFinder::Visit(std::shared_ptr<BatchNode> node, bool *const modified) {
+  RETURN_UNEXPECTED_IF_NULL(node);
+  RETURN_UNEXPECTED_IF_NULL(modified);
+  *modified = false;
+  if (node->Children().size() == 1 && std::dynamic_pointer_cast<MapNode>(node->Children()[0]) != nullptr) {
+    batch_nodes_.push_back(node);
+  }
+  return Status::OK();
+}
+
+Status BatchTensorOpPass::MoveOpsPastBatch(const std::shared_ptr<BatchNode> &node, bool *const modified) {
+#ifdef ENABLE_PYTHON
+  // The batch should stack the columns as they are.
+  RETURN_OK_IF_TRUE(node->Pad() || node->BatchSizeFunc() || node->BatchMapFunc() || !node->InColNames().empty() ||
+                    !node->OutColNames().empty() || !node->ColOrder().empty());
+#endif
+  auto map_node = std::dynamic_pointer_cast<MapNode>(node->Children()[0]);
+  RETURN_UNEXPECTED_IF_NULL(map_node);
+  // The moved ops keep working on the same single column, and the callbacks of the map still see all the ops.
+  RETURN_OK_IF_TRUE(map_node->IsCached() || !map_node->Callbacks().empty() || !map_node->ProjectColumns().empty() ||
+                    map_node->InputColumns().size() > 1 || map_node->GetOffload() == ManualOffloadMode::kEnabled);
+  RETURN_OK_IF_TRUE(!map_node->OutputColumns().empty() && map_node->OutputColumns() != map_node->InputColumns());
+
+  std::vector<std::shared_ptr<TensorOperation>> ops = map_node->operations();
+  auto first_moved = std::find_if(ops.rbegin(), ops.rend(), [](const std::shared_ptr<TensorOperation> &op) {
+                       return op == nullptr || kBatchableOperations.count(op->Name()) == 0;
+                     }).base();
+  RETURN_OK_IF_TRUE(first_moved == ops.end());
+
+  std::vector<std::shared_ptr<TensorOperation>> batched_ops;
+  for (auto itr = first_moved; itr != ops.end(); ++itr) {
+    std::shared_ptr<TensorOp> tensor_op = (*itr)->Build();
+    RETURN_UNEXPECTED_IF_NULL(tensor_op);
+    (void)batched_ops.emplace_back(
+      std::make_shared<transforms::PreBuiltOperation>(std::make_shared<BatchedTensorOp>(tensor_op)));
+  }
+  MS_LOG(INFO) << "Moving " << batched_ops.size() << " tensor ops of the map past the batch to run on whole batches.";
+  auto batched_map = std::make_shared<MapNode>(nullptr, batched_ops, map_node->InputColumns(),
+                                               map_node->OutputColumns());
+  (void)batched_map->SetNumWorkers(map_node->NumWorkers());
+  RETURN_IF_NOT_OK(node->InsertAbove(batched_map));
+  (void)ops.erase(first_moved, ops.end());
+  if (ops.empty()) {
+    RETURN_IF_NOT_OK(map_node->Drop());
+  } else {
+    map_node->setOperations(ops);
+  }
+  *modified = true;
+  return Status::OK();
+}
+
+// Walk the tree to find the BatchNodes, then move the ops of their child MapNodes.
+Status BatchTensorOpPass::RunOnTree(std::shared_ptr<DatasetNode> root_ir, bool *const modified) {
+  RETURN_UNEXPECTED_IF_NULL(root_ir);
+  RETURN_UNEXPECTED_IF_NULL(modified);
+  MS_LOG(INFO) << "Optional pass: batch tensor op pass started.";
+  auto finder = std::make_unique<BatchTensorOpPass::BatchNodeFinder>();
+  RETURN_IF_NOT_OK(finder->Run(root_ir, modified));
+  *modified = false;
+  for (const auto &node : finder->batch_nodes()) {
+    RETURN_IF_NOT_OK(MoveOpsPastBatch(node, modified));
+  }
+  MS_LOG(INFO) << "Optional pass: batch tensor op pass complete.";
+  return Status::OK();
+}
+}  // namespace dataset
+}  // namespace mindspore
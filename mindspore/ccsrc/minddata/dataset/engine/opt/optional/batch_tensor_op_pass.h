@@ -0,0 +1,80 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef MINDSPORE_CCSRC_MINDDATA_DATASET_ENGINE_OPT_OPTIONAL_BATCH_TENSOR_OP_PASS_H_
+#define MINDSPORE_CCSRC_MINDDATA_DATASET_ENGINE_OPT_OPTIONAL_BATCH_TENSOR_OP_PASS_H_
+
+#include <memory>
+#include <vector>
+#include "minddata/dataset/engine/opt/pass.h"
+
+namespace mindspore {
+namespace dataset {
+
+/// \class BatchTensorOpPass batch_tensor_op_pass.h
+/// \brief An optional optimization pass moving the trailing tensor ops of a MapNode past its parent BatchNode, so
+///     that the ops run once on the whole NHWC batch instead of once for each row. Only the ops which work on the
+///     batch in the same way as on the rows are moved, such as Normalize, HWC2CHW, Rescale, TypeCast,
+///     RandomHorizontalFlip and RandomColorAdjust.
+class BatchTensorOpPass : public IRTreePass {
+  /// \class BatchNodeFinder
+  /// \brief This is a NodePass whose job is to find the BatchNodes whose child is a MapNode.
+  class BatchNodeFinder : public IRNodePass {
+   public:
+    /// \brief Constructor
+    BatchNodeFinder() = default;
+
+    /// \brief Destructor
+    ~BatchNodeFinder() = default;
+
+    /// \brief Record the BatchNode if its child is a MapNode
+    /// \param[in] node The node being visited
+    /// \param[in, out] modified Indicator if the node was changed at all
+    /// \return Status The status code returned
+    Status Visit(std::shared_ptr<BatchNode> node, bool *const modified) override;
+
+    /// \brief Getter
+    /// \return All the BatchNodes found
+    const std::vector<std::shared_ptr<BatchNode>> &batch_nodes() const { return batch_nodes_; }
+
+   private:
+    std::vector<std::shared_ptr<BatchNode>> batch_nodes_;
+  };
+
+ public:
+  /// \brief Constructor
+  BatchTensorOpPass() = default;
+
+  /// \brief Destructor
+  ~BatchTensorOpPass() = default;
+
+  /// \brief Runs a BatchNodeFinder first to find the BatchNodes, then moves the ops of their child MapNodes.
+  /// \param[in, out] root_ir The tree to operate on.
+  /// \param[in, out] modified Indicate of the tree was modified.
+  /// \return Status The status code returned
+  Status RunOnTree(std::shared_ptr<DatasetNode> root_ir, bool *const modified) override;
+
+ private:
+  /// \brief Move the trailing eligible ops of the child MapNode into a new MapNode inserted above the BatchNode.
+  /// \param[in] node The BatchNode whose child is a MapNode
+  /// \param[in, out] modified Indicate of the tree was modified.
+  /// \return Status The status code returned
+  Status MoveOpsPastBatch(const std::shared_ptr<BatchNode> &node, bool *const modified);
+};
+}  // namespace dataset
+}  // namespace mindspore
+
+#endif  // MINDSPORE_CCSRC_MINDDATA_DATASET_ENGINE_OPT_OPTIONAL_BATCH_TENSOR_OP_PASS_H_
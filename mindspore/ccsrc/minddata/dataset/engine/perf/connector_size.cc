@@ -19,10 +19,12 @@
 #include <algorithm>
 #include <fstream>
 #include <memory>
+#include <utility>
 
 #include "minddata/dataset/core/config_manager.h"
 #include "minddata/dataset/engine/execution_tree.h"
 #include "minddata/dataset/util/path.h"
+#include "minddata/dataset/util/size_class_pool.h"
 
 using json = nlohmann::json;
 namespace mindspore {
@@ -37,6 +39,13 @@ Status ConnectorSize::Sample() {
   Qrow cur_row;
   (void)std::transform(tree_->begin(), tree_->end(), std::back_inserter(cur_row),
                        [](const DatasetOp &op) { return op.ConnectorSize(); });
+  std::map<int32_t, std::unordered_map<std::string, int64_t>> cur_metrics;
+  for (auto &op : *tree_) {
+    auto metrics = op.GetProfilingMetrics();
+    if (!metrics.empty()) {
+      cur_metrics[op.id()] = std::move(metrics);
+    }
+  }
   // Tree Iterator is in PostOrder (leaf first, e.g., 3,2,1)
   // reverse the order of the vector to get the root first.
   std::reverse(cur_row.begin(), cur_row.end());
@@ -44,6 +53,9 @@ Status ConnectorSize::Sample() {
   // Push new row of sample
   sample_table_.push_back(cur_row);
   (void)ts_.emplace_back(ProfilingTime::GetCurMilliSecond());
+  for (auto &metrics : cur_metrics) {
+    op_metrics_[metrics.first] = std::move(metrics.second);
+  }
   return Status::OK();
 }
 
@@ -95,6 +107,22 @@ Status ConnectorSize::SaveToFile(const std::string &dir_path, const std::string
     }
   }
 
+  // Add the latest op specific metrics sampled while the pipeline runs
+  for (auto &op_data : output["op_info"]) {
+    auto iter = op_metrics_.find(op_data["op_id"].get<int32_t>());
+    if (iter == op_metrics_.end()) {
+      continue;
+    }
+    for (const auto &metric : iter->second) {
+      op_data["metrics"][metric.first] = metric.second;
+    }
+  }
+
+  // Add the statistics of the tensor memory pool shared by all the pipelines
+  if (GlobalContext::config_manager()->enable_tensor_memory_pool()) {
+    output["tensor_memory_pool"] = GlobalContext::Instance()->size_class_pool()->GetStatistics();
+  }
+
   // Discard the content of the file when opening.
   std::ofstream os(file_path, std::ios::trunc);
   os << output;
@@ -118,6 +146,7 @@ Status ConnectorSize::Init() {
 void ConnectorSize::Clear() {
   ts_.clear();
   sample_table_.clear();
+  op_metrics_.clear();
   initial_nodes_data.clear();
 }
 
@@ -16,7 +16,9 @@
 #ifndef MINDSPORE_CCSRC_MINDDATA_DATASET_CONNECTOR_SIZE_H
 #define MINDSPORE_CCSRC_MINDDATA_DATASET_CONNECTOR_SIZE_H
 
+#include <map>
 #include <string>
+#include <unordered_map>
 #include <vector>
 #include <nlohmann/json.hpp>
 #include "minddata/dataset/engine/perf/profiling.h"
@@ -76,6 +78,8 @@ class ConnectorSize : public Sampling {
   ExecutionTree *tree_ = nullptr;          // ExecutionTree pointer
   ConnectorSizeSampleTable sample_table_;  // Dataset structure to store all samples of connector size sampling
   Timestamps ts_;                          // time of sample
+  // The latest op specific metrics sampled, keyed by the op id
+  std::map<int32_t, std::unordered_map<std::string, int64_t>> op_metrics_;
   Path GetFileName(const std::string &dir_path, const std::string &rank_id) override;
 };
 
@@ -300,6 +300,7 @@ Serdes::InitializeFuncPtr() {
   ops_ptr[vision::kCutMixBatchOperation] = &(vision::CutMixBatchOperation::from_json);
   ops_ptr[vision::kCutOutOperation] = &(vision::CutOutOperation::from_json);
   ops_ptr[vision::kDecodeOperation] = &(vision::DecodeOperation::from_json);
+  ops_ptr[vision::kDecodeResizeOperation] = &(vision::DecodeResizeOperation::from_json);
 #ifdef ENABLE_ACL
   ops_ptr[vision::kDvppCropJpegOperation] = &(vision::DvppCropJpegOperation::from_json);
   ops_ptr[vision::kDvppDecodeResizeOperation] = &(vision::DvppDecodeResizeOperation::from_json);
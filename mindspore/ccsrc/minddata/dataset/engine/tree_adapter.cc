@@ -19,6 +19,7 @@
 #include "minddata/dataset/core/client.h"
 #include "minddata/dataset/engine/ir/datasetops/root_node.h"
 #ifndef ENABLE_ANDROID
+#include "minddata/dataset/engine/opt/optional/batch_tensor_op_pass.h"
 #include "minddata/dataset/engine/opt/optional/tensor_op_fusion_pass.h"
 #include "minddata/dataset/engine/opt/pre/cache_transform_pass.h"
 #include "minddata/dataset/engine/opt/pre/node_offload_pass.h"
@@ -92,10 +93,11 @@ Status TreeAdapter::PrePass(std::shared_ptr<DatasetNode> ir) {
 Status TreeAdapter::Optimize(std::shared_ptr<DatasetNode> ir) {
   RETURN_UNEXPECTED_IF_NULL(ir);
   // Vector of optimizations
-  std::vector<std::unique_ptr<IRNodePass>> optimizations;
+  std::vector<std::unique_ptr<IRPass>> optimizations;
   MS_LOG(INFO) << "Running optimization pass loops";
 #ifndef ENABLE_ANDROID
   optimizations.emplace_back(std::make_unique<TensorOpFusionPass>());
+  optimizations.emplace_back(std::make_unique<BatchTensorOpPass>());
 #endif
   // Apply optimization pass actions
   for (auto i = 0; i < optimizations.size(); i++) {
@@ -287,6 +287,44 @@ class MS_API CutOut final : public TensorTransform {
   std::shared_ptr<Data> data_;
 };
 
+/// \brief Decode the input image and resize it to the given size. For JPEG images, the image is decoded at a
+///     reduced scale before resizing when the reduced image is still not smaller than the given size.
+class MS_API DecodeResize final : public TensorTransform {
+ public:
+  /// \brief Constructor.
+  /// \param[in] size A vector representing the output size of the resized image.
+  ///     If the size is a single value, the image will be resized to this value with
+  ///     the same image aspect ratio. If the size has 2 values, it should be (height, width).
+  /// \param[in] interpolation An enum for the mode of interpolation.
+  ///   - InterpolationMode::kLinear, Interpolation method is blinear interpolation.
+  ///   - InterpolationMode::kNearestNeighbour, Interpolation method is nearest-neighbor interpolation.
+  ///   - InterpolationMode::kCubic, Interpolation method is bicubic interpolation.
+  ///   - InterpolationMode::kArea, Interpolation method is pixel area interpolation.
+  ///   - InterpolationMode::kCubicPil, Interpolation method is bicubic interpolation like implemented in pillow.
+  /// \par Example
+  /// \code
+  ///     /* Define operations */
+  ///     auto decode_resize_op = vision::DecodeResize({224, 224});
+  ///
+  ///     /* dataset is an instance of Dataset object */
+  ///     dataset = dataset->Map({decode_resize_op},  // operations
+  ///                            {"image"});          // input columns
+  /// \endcode
+  explicit DecodeResize(const std::vector<int32_t> &size, InterpolationMode interpolation = InterpolationMode::kLinear);
+
+  /// \brief Destructor.
+  ~DecodeResize() = default;
+
+ protected:
+  /// \brief The function to convert a TensorTransform object into a TensorOperation object.
+  /// \return Shared pointer to TensorOperation object.
+  std::shared_ptr<TensorOperation> Parse() override;
+
+ private:
+  struct Data;
+  std::shared_ptr<Data> data_;
+};
+
 /// \brief Apply histogram equalization on the input image.
 class MS_API Equalize final : public TensorTransform {
  public:
@@ -740,6 +778,9 @@ class MS_API RandomCropDecodeResize final : public TensorTransform {
   ///   - InterpolationMode::kCubicPil, Interpolation method is bicubic interpolation like implemented in pillow.
   /// \param[in] max_attempts The maximum number of attempts to propose a valid crop_area (default=10).
   ///               If exceeded, fall back to use center_crop instead.
+  /// \param[in] scaled_decode Whether to decode a JPEG image at the smallest DCT scale (1/2, 1/4 or 1/8) which still
+  ///               covers the output size (default=false). It is faster, but the output is no longer the same as that
+  ///               of decoding at full scale.
   /// \par Example
   /// \code
   ///     /* Define operations */
@@ -752,7 +793,7 @@ class MS_API RandomCropDecodeResize final : public TensorTransform {
   explicit RandomCropDecodeResize(const std::vector<int32_t> &size, const std::vector<float> &scale = {0.08, 1.0},
                                   const std::vector<float> &ratio = {3. / 4, 4. / 3},
                                   InterpolationMode interpolation = InterpolationMode::kLinear,
-                                  int32_t max_attempts = 10);
+                                  int32_t max_attempts = 10, bool scaled_decode = false);
 
   /// \brief Destructor.
   ~RandomCropDecodeResize() = default;
@@ -0,0 +1,70 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "minddata/dataset/kernels/data/batched_tensor_op.h"
+
+#include <utility>
+
+#include "minddata/dataset/util/status.h"
+
+namespace mindspore {
+namespace dataset {
+BatchedTensorOp::BatchedTensorOp(std::shared_ptr<TensorOp> op) : op_(std::move(op)) {
+  is_deterministic_ = op_ == nullptr || op_->Deterministic();
+}
+
+void BatchedTensorOp::Print(std::ostream &out) const {
+  out << Name() << ": ";
+  if (op_ != nullptr) {
+    op_->Print(out);
+  } else {
+    out << std::endl;
+  }
+}
+
+Status BatchedTensorOp::Compute(const std::shared_ptr<Tensor> &input, std::shared_ptr<Tensor> *output) {
+  IO_CHECK(input, output);
+  RETURN_UNEXPECTED_IF_NULL(op_);
+  return op_->BatchCompute(input, output);
+}
+
+Status BatchedTensorOp::OutputShape(const std::vector<TensorShape> &inputs, std::vector<TensorShape> &outputs) {
+  RETURN_UNEXPECTED_IF_NULL(op_);
+  RETURN_IF_NOT_OK(TensorOp::OutputShape(inputs, outputs));
+  // The op works on the shape of one row, so the batch dimension is removed before and restored after it.
+  std::vector<TensorShape> row_inputs;
+  for (const auto &shape : inputs) {
+    CHECK_FAIL_RETURN_UNEXPECTED(shape.known() && shape.Rank() >= 1,
+                                 Name() + ": the input shape should be a known batch shape, but got: " +
+                                   shape.ToString());
+    std::vector<dsize_t> dims = shape.AsVector();
+    (void)row_inputs.emplace_back(std::vector<dsize_t>(dims.begin() + 1, dims.end()));
+  }
+  std::vector<TensorShape> row_outputs;
+  RETURN_IF_NOT_OK(op_->OutputShape(row_inputs, row_outputs));
+  outputs.clear();
+  for (size_t i = 0; i < row_outputs.size(); i++) {
+    (void)outputs.emplace_back(row_outputs[i].PrependDim(inputs[0][0]));
+  }
+  return Status::OK();
+}
+
+Status BatchedTensorOp::OutputType(const std::vector<DataType> &inputs, std::vector<DataType> &outputs) {
+  RETURN_UNEXPECTED_IF_NULL(op_);
+  return op_->OutputType(inputs, outputs);
+}
+}  // namespace dataset
+}  // namespace mindspore
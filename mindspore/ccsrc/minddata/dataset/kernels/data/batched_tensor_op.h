@@ -0,0 +1,65 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef MINDSPORE_CCSRC_MINDDATA_DATASET_KERNELS_DATA_BATCHED_TENSOR_OP_H_
+#define MINDSPORE_CCSRC_MINDDATA_DATASET_KERNELS_DATA_BATCHED_TENSOR_OP_H_
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "minddata/dataset/core/tensor.h"
+#include "minddata/dataset/kernels/tensor_op.h"
+
+namespace mindspore {
+namespace dataset {
+/// BatchedTensorOp runs a 1-to-1 TensorOp on the batch Tensors produced by BatchOp, so the op processes the whole
+/// batch in one BatchCompute() call instead of being dispatched once for each row.
+class BatchedTensorOp : public TensorOp {
+ public:
+  /// constructor
+  /// \param[in] op the TensorOp to run on the batches
+  explicit BatchedTensorOp(std::shared_ptr<TensorOp> op);
+
+  /// default destructor
+  ~BatchedTensorOp() override = default;
+
+  void Print(std::ostream &out) const override;
+
+  /// \param[in] input the batch Tensor whose first dimension is the batch size
+  /// \param[out] output the batch of results
+  /// \return Status code
+  Status Compute(const std::shared_ptr<Tensor> &input, std::shared_ptr<Tensor> *output) override;
+
+  /// \param[in] inputs
+  /// \param[out] outputs
+  /// \return Status code
+  Status OutputShape(const std::vector<TensorShape> &inputs, std::vector<TensorShape> &outputs) override;
+
+  /// \param[in] inputs
+  /// \param[out] outputs
+  /// \return Status code
+  Status OutputType(const std::vector<DataType> &inputs, std::vector<DataType> &outputs) override;
+
+  std::string Name() const override { return kBatchedTensorOp; }
+
+ private:
+  std::shared_ptr<TensorOp> op_;
+};
+}  // namespace dataset
+}  // namespace mindspore
+
+#endif  // MINDSPORE_CCSRC_MINDDATA_DATASET_KERNELS_DATA_BATCHED_TENSOR_OP_H_
@@ -29,6 +29,12 @@ Status TypeCastOp::Compute(const std::shared_ptr<Tensor> &input, std::shared_ptr
   IO_CHECK(input, output);
   return TypeCast(input, output, type_);
 }
+// The cast is element-wise, so the whole batch is cast at once.
+Status TypeCastOp::BatchCompute(const std::shared_ptr<Tensor> &input, std::shared_ptr<Tensor> *output) {
+  IO_CHECK(input, output);
+  return TypeCast(input, output, type_);
+}
+
 Status TypeCastOp::OutputType(const std::vector<DataType> &inputs, std::vector<DataType> &outputs) {
   RETURN_IF_NOT_OK(TensorOp::OutputType(inputs, outputs));
   outputs[0] = type_;
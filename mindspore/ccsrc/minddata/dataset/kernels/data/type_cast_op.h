@@ -39,6 +39,8 @@ class TypeCastOp : public TensorOp {
 
   Status Compute(const std::shared_ptr<Tensor> &input, std::shared_ptr<Tensor> *output) override;
 
+  Status BatchCompute(const std::shared_ptr<Tensor> &input, std::shared_ptr<Tensor> *output) override;
+
   Status OutputType(const std::vector<DataType> &inputs, std::vector<DataType> &outputs) override;
 
   std::string Name() const override { return kTypeCastOp; }
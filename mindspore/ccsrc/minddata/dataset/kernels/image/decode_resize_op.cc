@@ -0,0 +1,67 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "minddata/dataset/kernels/image/decode_resize_op.h"
+
+#include "minddata/dataset/kernels/image/decode_op.h"
+
+namespace mindspore {
+namespace dataset {
+Status DecodeResizeOp::Compute(const std::shared_ptr<Tensor> &input, std::shared_ptr<Tensor> *output) {
+  IO_CHECK(input, output);
+  if (input->Rank() != 1) {
+    RETURN_STATUS_UNEXPECTED("DecodeResize: invalid input shape, only support 1D input, got rank: " +
+                             std::to_string(input->Rank()));
+  }
+  if (!IsNonEmptyJPEG(input)) {
+    std::shared_ptr<Tensor> decoded;
+    RETURN_IF_NOT_OK(DecodeOp(true).Compute(input, &decoded));
+    return ResizeOp::Compute(decoded, output);
+  }
+  int input_h = 0;
+  int input_w = 0;
+  RETURN_IF_NOT_OK(GetJpegImageInfo(input, &input_w, &input_h));
+  int32_t output_h = 0;
+  int32_t output_w = 0;
+  RETURN_IF_NOT_OK(OutputSize(input_h, input_w, &output_h, &output_w));
+  return JpegCropDecodeResize(input, output, 0, 0, input_w, input_h, output_h, output_w, interpolation_);
+}
+
+Status DecodeResizeOp::OutputShape(const std::vector<TensorShape> &inputs, std::vector<TensorShape> &outputs) {
+  RETURN_IF_NOT_OK(TensorOp::OutputShape(inputs, outputs));
+  outputs.clear();
+  int32_t output_h = -1;
+  int32_t output_w = -1;
+  // if size2_ == 0, the output shape depends on the size of the encoded image --> set it to <-1,-1,3>
+  if (size2_ != 0) {
+    output_h = size1_;
+    output_w = size2_;
+  }
+  if (inputs[0].Rank() == 1) {
+    (void)outputs.emplace_back(TensorShape({output_h, output_w, kDefaultImageChannel}));
+    return Status::OK();
+  }
+  return Status(StatusCode::kMDUnexpectedError,
+                "DecodeResize: invalid input shape, expected 1D input, but got input dimension is:" +
+                  std::to_string(inputs[0].Rank()));
+}
+
+Status DecodeResizeOp::OutputType(const std::vector<DataType> &inputs, std::vector<DataType> &outputs) {
+  RETURN_IF_NOT_OK(TensorOp::OutputType(inputs, outputs));
+  outputs[0] = DataType(DataType::DE_UINT8);
+  return Status::OK();
+}
+}  // namespace dataset
+}  // namespace mindspore
@@ -0,0 +1,60 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef MINDSPORE_CCSRC_MINDDATA_DATASET_KERNELS_IMAGE_DECODE_RESIZE_OP_H_
+#define MINDSPORE_CCSRC_MINDDATA_DATASET_KERNELS_IMAGE_DECODE_RESIZE_OP_H_
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "minddata/dataset/core/tensor.h"
+#include "minddata/dataset/kernels/image/image_utils.h"
+#include "minddata/dataset/kernels/image/resize_op.h"
+#include "minddata/dataset/kernels/tensor_op.h"
+#include "minddata/dataset/util/status.h"
+
+namespace mindspore {
+namespace dataset {
+class DecodeResizeOp : public ResizeOp {
+ public:
+  // Decodes the image and resizes it to the output size, the arguments are the same as ResizeOp.
+  // The JPEG image is decoded at the smallest DCT scale which still covers the output size before the resize, the
+  // other images are decoded at full resolution and then resized.
+  // @param size1: the first size of output. If only this parameter is provided
+  // the smaller dimension will be resized to this and then the other dimension changes
+  // such that the aspect ratio is maintained.
+  // @param size2: the second size of output. If this is also provided, the output size
+  // will be (size1, size2)
+  // @param InterpolationMode: the interpolation mode being used.
+  explicit DecodeResizeOp(int32_t size1, int32_t size2 = kDefWidth, InterpolationMode interpolation = kDefInterpolation)
+      : ResizeOp(size1, size2, interpolation) {}
+
+  ~DecodeResizeOp() override = default;
+
+  void Print(std::ostream &out) const override { out << Name() << ": " << size1_ << " " << size2_; }
+
+  Status Compute(const std::shared_ptr<Tensor> &input, std::shared_ptr<Tensor> *output) override;
+
+  Status OutputShape(const std::vector<TensorShape> &inputs, std::vector<TensorShape> &outputs) override;
+
+  Status OutputType(const std::vector<DataType> &inputs, std::vector<DataType> &outputs) override;
+
+  std::string Name() const override { return kDecodeResizeOp; }
+};
+}  // namespace dataset
+}  // namespace mindspore
+
+#endif  // MINDSPORE_CCSRC_MINDDATA_DATASET_KERNELS_IMAGE_DECODE_RESIZE_OP_H_
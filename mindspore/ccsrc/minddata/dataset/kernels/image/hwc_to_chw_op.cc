@@ -24,12 +24,74 @@
 
 namespace mindspore {
 namespace dataset {
+namespace {
+// Transpose the images of the contiguous NHWC batch into NCHW, T only decides the size of the element to move.
+template <typename T>
+void TransposeNHWCToNCHW(const T *src, T *dst, int64_t num_images, int64_t num_pixels, int64_t num_channels) {
+  for (int64_t n = 0; n < num_images; n++) {
+    for (int64_t c = 0; c < num_channels; c++) {
+      const T *src_channel = src + c;
+      for (int64_t i = 0; i < num_pixels; i++) {
+        dst[i] = src_channel[i * num_channels];
+      }
+      dst += num_pixels;
+    }
+    src += num_pixels * num_channels;
+  }
+}
+}  // namespace
+
 Status HwcToChwOp::Compute(const std::shared_ptr<Tensor> &input, std::shared_ptr<Tensor> *output) {
   IO_CHECK(input, output);
   // input.shape == HWC
   // output.shape == CHW
   return HwcToChw(input, output);
 }
+Status HwcToChwOp::BatchCompute(const std::shared_ptr<Tensor> &input, std::shared_ptr<Tensor> *output) {
+  IO_CHECK(input, output);
+  constexpr dsize_t kBatchImageRank = 4;
+  constexpr int64_t kHeightIndex = 1;
+  constexpr int64_t kWidthIndex = 2;
+  constexpr int64_t kChannelIndex = 3;
+  if (input->Rank() != kBatchImageRank || !input->type().IsNumeric()) {
+    return TensorOp::BatchCompute(input, output);
+  }
+  int64_t num_images = input->shape()[0];
+  int64_t num_pixels = input->shape()[kHeightIndex] * input->shape()[kWidthIndex];
+  int64_t num_channels = input->shape()[kChannelIndex];
+  std::shared_ptr<Tensor> batch_output;
+  RETURN_IF_NOT_OK(Tensor::CreateEmpty(
+    TensorShape{num_images, num_channels, input->shape()[kHeightIndex], input->shape()[kWidthIndex]}, input->type(),
+    &batch_output));
+  if (input->shape().NumOfElements() == 0) {
+    *output = std::move(batch_output);
+    return Status::OK();
+  }
+  const uchar *src = input->GetBuffer();
+  uchar *dst = &(*batch_output->begin<uint8_t>());
+  switch (input->type().SizeInBytes()) {
+    case sizeof(uint8_t):
+      TransposeNHWCToNCHW(src, dst, num_images, num_pixels, num_channels);
+      break;
+    case sizeof(uint16_t):
+      TransposeNHWCToNCHW(reinterpret_cast<const uint16_t *>(src), reinterpret_cast<uint16_t *>(dst), num_images,
+                          num_pixels, num_channels);
+      break;
+    case sizeof(uint32_t):
+      TransposeNHWCToNCHW(reinterpret_cast<const uint32_t *>(src), reinterpret_cast<uint32_t *>(dst), num_images,
+                          num_pixels, num_channels);
+      break;
+    case sizeof(uint64_t):
+      TransposeNHWCToNCHW(reinterpret_cast<const uint64_t *>(src), reinterpret_cast<uint64_t *>(dst), num_images,
+                          num_pixels, num_channels);
+      break;
+    default:
+      return TensorOp::BatchCompute(input, output);
+  }
+  *output = std::move(batch_output);
+  return Status::OK();
+}
+
 Status HwcToChwOp::OutputShape(const std::vector<TensorShape> &inputs, std::vector<TensorShape> &outputs) {
   RETURN_IF_NOT_OK(TensorOp::OutputShape(inputs, outputs));
   outputs.clear();
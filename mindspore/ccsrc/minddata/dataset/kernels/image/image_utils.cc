@@ -426,8 +426,10 @@ void JpegErrorExitCustom(j_common_ptr cinfo) {
   throw std::runtime_error(jpeg_last_error_msg);
 }
 
-Status JpegCropAndDecode(const std::shared_ptr<Tensor> &input, std::shared_ptr<Tensor> *output, int crop_x, int crop_y,
-                         int crop_w, int crop_h) {
+// Decode the crop of the JPEG image at the DCT scale 1/scale_denom. The crop box is given in the coordinates of the
+// full-resolution image and is mapped into the scaled image, only the MCUs covering the crop box are decoded.
+static Status JpegCropAndDecodeScaled(const std::shared_ptr<Tensor> &input, std::shared_ptr<Tensor> *output, int crop_x,
+                                      int crop_y, int crop_w, int crop_h, unsigned int scale_denom) {
   struct jpeg_decompress_struct cinfo;
   auto DestroyDecompressAndReturnError = [&cinfo](const std::string &err) {
     jpeg_destroy_decompress(&cinfo);
@@ -441,6 +443,8 @@ Status JpegCropAndDecode(const std::shared_ptr<Tensor> &input, std::shared_ptr<T
     JpegSetSource(&cinfo, input->GetBuffer(), input->SizeInBytes());
     (void)jpeg_read_header(&cinfo, TRUE);
     RETURN_IF_NOT_OK(JpegSetColorSpace(&cinfo));
+    cinfo.scale_num = 1;
+    cinfo.scale_denom = scale_denom;
     jpeg_calc_output_dimensions(&cinfo);
   } catch (std::runtime_error &e) {
     return DestroyDecompressAndReturnError(e.what());
@@ -452,15 +456,25 @@ Status JpegCropAndDecode(const std::shared_ptr<Tensor> &input, std::shared_ptr<T
                                "JpegCropAndDecode: addition(crop y and crop height) out of bounds, got crop y:" +
                                  std::to_string(crop_y) + ", and crop height:" + std::to_string(crop_h));
   if (crop_x == 0 && crop_y == 0 && crop_w == 0 && crop_h == 0) {
-    crop_w = cinfo.output_width;
-    crop_h = cinfo.output_height;
-  } else if (crop_w == 0 || static_cast<unsigned int>(crop_w + crop_x) > cinfo.output_width || crop_h == 0 ||
-             static_cast<unsigned int>(crop_h + crop_y) > cinfo.output_height) {
+    crop_w = cinfo.image_width;
+    crop_h = cinfo.image_height;
+  } else if (crop_w == 0 || static_cast<unsigned int>(crop_w + crop_x) > cinfo.image_width || crop_h == 0 ||
+             static_cast<unsigned int>(crop_h + crop_y) > cinfo.image_height) {
     return DestroyDecompressAndReturnError(
       "Crop: invalid crop size, corresponding crop value equal to 0 or too big, got crop width: " +
       std::to_string(crop_w) + ", crop height:" + std::to_string(crop_h) +
       ", and crop x coordinate:" + std::to_string(crop_x) + ", crop y coordinate:" + std::to_string(crop_y));
   }
+  if (scale_denom > 1) {
+    // the scaled crop box covers all the pixels of the crop box
+    const int scale = static_cast<int>(scale_denom);
+    const int crop_end_x = std::min((crop_x + crop_w + scale - 1) / scale, static_cast<int>(cinfo.output_width));
+    const int crop_end_y = std::min((crop_y + crop_h + scale - 1) / scale, static_cast<int>(cinfo.output_height));
+    crop_x = crop_x / scale;
+    crop_y = crop_y / scale;
+    crop_w = crop_end_x - crop_x;
+    crop_h = crop_end_y - crop_y;
+  }
   const int mcu_size = cinfo.min_DCT_scaled_size;
   CHECK_FAIL_RETURN_UNEXPECTED(mcu_size != 0, "JpegCropAndDecode: divisor mcu_size is zero.");
   unsigned int crop_x_aligned = (crop_x / mcu_size) * mcu_size;
@@ -500,6 +514,33 @@ Status JpegCropAndDecode(const std::shared_ptr<Tensor> &input, std::shared_ptr<T
   return Status::OK();
 }
 
+Status JpegCropAndDecode(const std::shared_ptr<Tensor> &input, std::shared_ptr<Tensor> *output, int crop_x, int crop_y,
+                         int crop_w, int crop_h) {
+  return JpegCropAndDecodeScaled(input, output, crop_x, crop_y, crop_w, crop_h, 1);
+}
+
+Status JpegCropDecodeResize(const std::shared_ptr<Tensor> &input, std::shared_ptr<Tensor> *output, int crop_x,
+                            int crop_y, int crop_w, int crop_h, int32_t target_height, int32_t target_width,
+                            InterpolationMode mode) {
+  CHECK_FAIL_RETURN_UNEXPECTED(target_height > 0 && target_width > 0,
+                               "JpegCropDecodeResize: the target size should be positive, got target height: " +
+                                 std::to_string(target_height) + ", and target width: " + std::to_string(target_width));
+  // libjpeg scales the DCT blocks by 1/2, 1/4 or 1/8 while decoding, pick the smallest scale whose decoded crop is
+  // still no smaller than the target size, so the pixels dropped by the resize are not decoded
+  constexpr int kMaxScaleDenom = 8;
+  int scale_denom = kMaxScaleDenom;
+  while (scale_denom > 1 && (crop_w / scale_denom < target_width || crop_h / scale_denom < target_height)) {
+    scale_denom /= 2;
+  }
+  std::shared_ptr<Tensor> decoded;
+  RETURN_IF_NOT_OK(JpegCropAndDecodeScaled(input, &decoded, crop_x, crop_y, crop_w, crop_h, scale_denom));
+  if (decoded->shape()[0] == target_height && decoded->shape()[1] == target_width) {
+    *output = decoded;
+    return Status::OK();
+  }
+  return Resize(decoded, output, target_height, target_width, 0.0, 0.0, mode);
+}
+
 Status Rescale(const std::shared_ptr<Tensor> &input, std::shared_ptr<Tensor> *output, float rescale, float shift) {
   std::shared_ptr<CVTensor> input_cv = CVTensor::AsCVTensor(input);
   if (!input_cv->mat().data) {
@@ -147,6 +147,22 @@ void JpegSetSource(j_decompress_ptr c_info, const void *data, int64_t data_size)
 Status JpegCropAndDecode(const std::shared_ptr<Tensor> &input, std::shared_ptr<Tensor> *output, int x = 0, int y = 0,
                          int w = 0, int h = 0);
 
+/// \brief Decode the crop of a JPEG image and resize it to the target size. The crop is decoded with the DCT-domain
+///     downscaling of libjpeg (1/2, 1/4 or 1/8), and the smallest scale whose decoded crop still covers the target size
+///     is picked, then the decoded crop is resized to the target size.
+/// \param input: Tensor of the encoded JPEG image.
+/// \param output: Tensor of shape <target_height,target_width,3> and type DE_UINT8.
+/// \param x: starting horizontal position of the crop in the full-resolution image
+/// \param y: starting vertical position of the crop in the full-resolution image
+/// \param w: width of the crop in the full-resolution image, which should be positive
+/// \param h: height of the crop in the full-resolution image, which should be positive
+/// \param target_height: height of the output image
+/// \param target_width: width of the output image
+/// \param mode: interpolation mode of the final resize
+Status JpegCropDecodeResize(const std::shared_ptr<Tensor> &input, std::shared_ptr<Tensor> *output, int x, int y, int w,
+                            int h, int32_t target_height, int32_t target_width,
+                            InterpolationMode mode = InterpolationMode::kLinear);
+
 /// \brief Returns Rescaled image
 /// \param input: Tensor of shape <H,W,C> or <H,W> and any OpenCv compatible type, see CVTensor.
 /// \param rescale: rescale parameter
@@ -15,6 +15,7 @@
  */
 #include "minddata/dataset/kernels/image/normalize_op.h"
 
+#include <algorithm>
 #include <random>
 #include <vector>
 
@@ -27,6 +28,22 @@
 
 namespace mindspore {
 namespace dataset {
+namespace {
+// Normalize the contiguous NHWC batch in one loop over all the pixels of the batch.
+template <typename T>
+void NormalizeNHWC(const T *src, float *dst, int64_t num_pixels, const std::vector<float> &mean,
+                   const std::vector<float> &std) {
+  const size_t num_channels = mean.size();
+  for (int64_t i = 0; i < num_pixels; i++) {
+    for (size_t c = 0; c < num_channels; c++) {
+      dst[c] = (static_cast<float>(src[c]) - mean[c]) / std[c];
+    }
+    src += num_channels;
+    dst += num_channels;
+  }
+}
+}  // namespace
+
 NormalizeOp::NormalizeOp(const std::vector<float> &mean, const std::vector<float> &std, bool is_hwc)
     : mean_(mean), std_(std), is_hwc_(is_hwc) {}
 
@@ -40,6 +57,42 @@ Status NormalizeOp::Compute(const std::shared_ptr<Tensor> &input, std::shared_pt
 #endif
 }
 
+Status NormalizeOp::BatchCompute(const std::shared_ptr<Tensor> &input, std::shared_ptr<Tensor> *output) {
+  IO_CHECK(input, output);
+  constexpr dsize_t kBatchImageRank = 4;
+  constexpr dsize_t kBatchChannelIndex = 3;
+  bool supported_type = input->type() == DataType::DE_UINT8 || input->type() == DataType::DE_FLOAT32;
+  if (!is_hwc_ || !supported_type || input->Rank() != kBatchImageRank || mean_.empty() ||
+      mean_.size() != std_.size()) {
+    return TensorOp::BatchCompute(input, output);
+  }
+  dsize_t num_channels = input->shape()[kBatchChannelIndex];
+  std::vector<float> mean = mean_;
+  std::vector<float> std = std_;
+  // 1 mean/std value is duplicated for all the channels as Normalize does
+  if (mean.size() == 1) {
+    mean.assign(num_channels, mean_[0]);
+    std.assign(num_channels, std_[0]);
+  }
+  CHECK_FAIL_RETURN_UNEXPECTED(static_cast<dsize_t>(mean.size()) == num_channels,
+                               "Normalize: number of channels does not match the size of mean and std vectors, got "
+                               "channels: " + std::to_string(num_channels) +
+                                 ", size of mean: " + std::to_string(mean_.size()));
+  std::shared_ptr<Tensor> batch_output;
+  RETURN_IF_NOT_OK(Tensor::CreateEmpty(input->shape(), DataType(DataType::DE_FLOAT32), &batch_output));
+  int64_t num_pixels = input->shape().NumOfElements() / std::max<dsize_t>(num_channels, 1);
+  if (num_pixels > 0) {
+    float *dst = &(*batch_output->begin<float>());
+    if (input->type() == DataType::DE_UINT8) {
+      NormalizeNHWC(reinterpret_cast<const uint8_t *>(input->GetBuffer()), dst, num_pixels, mean, std);
+    } else {
+      NormalizeNHWC(reinterpret_cast<const float *>(input->GetBuffer()), dst, num_pixels, mean, std);
+    }
+  }
+  *output = std::move(batch_output);
+  return Status::OK();
+}
+
 void NormalizeOp::Print(std::ostream &out) const {
   out << "NormalizeOp, mean: ";
   for (const auto &m : mean_) {
@@ -36,6 +36,8 @@ class NormalizeOp : public TensorOp {
 
   Status Compute(const std::shared_ptr<Tensor> &input, std::shared_ptr<Tensor> *output) override;
 
+  Status BatchCompute(const std::shared_ptr<Tensor> &input, std::shared_ptr<Tensor> *output) override;
+
   std::string Name() const override { return kNormalizeOp; }
 
  private:
@@ -21,11 +21,15 @@
 
 namespace mindspore {
 namespace dataset {
+const bool RandomCropDecodeResizeOp::kDefScaledDecode = false;
+
 RandomCropDecodeResizeOp::RandomCropDecodeResizeOp(int32_t target_height, int32_t target_width, float scale_lb,
                                                    float scale_ub, float aspect_lb, float aspect_ub,
-                                                   InterpolationMode interpolation, int32_t max_attempts)
+                                                   InterpolationMode interpolation, int32_t max_attempts,
+                                                   bool scaled_decode)
     : RandomCropAndResizeOp(target_height, target_width, scale_lb, scale_ub, aspect_lb, aspect_ub, interpolation,
-                            max_attempts) {}
+                            max_attempts),
+      scaled_decode_(scaled_decode) {}
 
 Status RandomCropDecodeResizeOp::Compute(const TensorRow &input, TensorRow *output) {
   IO_CHECK_VECTOR(input, output);
@@ -52,6 +56,13 @@ Status RandomCropDecodeResizeOp::Compute(const TensorRow &input, TensorRow *outp
       if (i == 0) {
         RETURN_IF_NOT_OK(GetCropBox(h_in, w_in, &x, &y, &crop_height, &crop_width));
       }
+      // by default decode the crop at full scale, so the output is the same as that of Decode followed by
+      // RandomResizedCrop
+      if (scaled_decode_) {
+        RETURN_IF_NOT_OK(JpegCropDecodeResize(input[i], &(*output)[i], x, y, crop_width, crop_height, target_height_,
+                                              target_width_, interpolation_));
+        continue;
+      }
       std::shared_ptr<Tensor> decoded_tensor = nullptr;
       RETURN_IF_NOT_OK(JpegCropAndDecode(input[i], &decoded_tensor, x, y, crop_width, crop_height));
       RETURN_IF_NOT_OK(Resize(decoded_tensor, &(*output)[i], target_height_, target_width_, 0.0, 0.0, interpolation_));
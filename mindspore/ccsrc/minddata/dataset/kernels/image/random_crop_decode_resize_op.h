@@ -31,9 +31,12 @@ namespace mindspore {
 namespace dataset {
 class RandomCropDecodeResizeOp : public RandomCropAndResizeOp {
  public:
+  static const bool kDefScaledDecode;
+
   RandomCropDecodeResizeOp(int32_t target_height, int32_t target_width, float scale_lb = kDefScaleLb,
                            float scale_ub = kDefScaleUb, float aspect_lb = kDefAspectLb, float aspect_ub = kDefAspectUb,
-                           InterpolationMode interpolation = kDefInterpolation, int32_t max_attempts = kDefMaxIter);
+                           InterpolationMode interpolation = kDefInterpolation, int32_t max_attempts = kDefMaxIter,
+                           bool scaled_decode = kDefScaledDecode);
 
   explicit RandomCropDecodeResizeOp(const RandomCropAndResizeOp &rhs) : RandomCropAndResizeOp(rhs) {}
 
@@ -46,6 +49,10 @@ class RandomCropDecodeResizeOp : public RandomCropAndResizeOp {
   Status Compute(const TensorRow &input, TensorRow *output) override;
 
   std::string Name() const override { return kRandomCropDecodeResizeOp; }
+
+ private:
+  // Whether a JPEG image is decoded at a reduced DCT scale rather than at full scale.
+  bool scaled_decode_{kDefScaledDecode};
 };
 }  // namespace dataset
 }  // namespace mindspore
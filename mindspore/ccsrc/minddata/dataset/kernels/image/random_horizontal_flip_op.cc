@@ -15,6 +15,8 @@
  */
 #include "minddata/dataset/kernels/image/random_horizontal_flip_op.h"
 
+#include <algorithm>
+
 #include "minddata/dataset/kernels/image/image_utils.h"
 #include "minddata/dataset/util/status.h"
 
@@ -41,5 +43,50 @@ Status RandomHorizontalFlipOp::Compute(const TensorRow &input, TensorRow *output
   *output = input;
   return Status::OK();
 }
+
+Status RandomHorizontalFlipOp::BatchCompute(const std::shared_ptr<Tensor> &input, std::shared_ptr<Tensor> *output) {
+  IO_CHECK(input, output);
+  constexpr dsize_t kBatchImageRank = 4;
+  constexpr dsize_t kBatchGrayImageRank = 3;
+  constexpr dsize_t kWidthIndex = 2;
+  RETURN_IF_NOT_OK(ValidateImageDtype("RandomHorizontalFlip", input->type()));
+  if (input->Rank() != kBatchImageRank && input->Rank() != kBatchGrayImageRank) {
+    return TensorOp::BatchCompute(input, output);
+  }
+  std::shared_ptr<Tensor> batch_output;
+  RETURN_IF_NOT_OK(Tensor::CreateEmpty(input->shape(), input->type(), &batch_output));
+  if (input->shape().NumOfElements() == 0) {
+    *output = std::move(batch_output);
+    return Status::OK();
+  }
+  dsize_t num_images = input->shape()[0];
+  dsize_t num_rows = input->shape()[1];
+  dsize_t width = input->shape()[kWidthIndex];
+  size_t pixel_size = static_cast<size_t>(input->SizeInBytes() / (num_images * num_rows * width));
+  size_t row_size = pixel_size * static_cast<size_t>(width);
+  size_t image_size = row_size * static_cast<size_t>(num_rows);
+  const uchar *src = input->GetBuffer();
+  uchar *dst = &(*batch_output->begin<uint8_t>());
+  for (dsize_t n = 0; n < num_images; n++) {
+    if (!distribution_(rnd_)) {
+      int ret_code = memcpy_s(dst, image_size, src, image_size);
+      CHECK_FAIL_RETURN_UNEXPECTED(ret_code == EOK, "RandomHorizontalFlip: failed to copy the image in the batch.");
+    } else {
+      // Copy the pixels of every row in reverse order.
+      for (dsize_t h = 0; h < num_rows; h++) {
+        const uchar *src_row = src + h * row_size;
+        uchar *dst_row = dst + h * row_size;
+        for (dsize_t w = 0; w < width; w++) {
+          const uchar *src_pixel = src_row + (width - 1 - w) * pixel_size;
+          std::copy(src_pixel, src_pixel + pixel_size, dst_row + w * pixel_size);
+        }
+      }
+    }
+    src += image_size;
+    dst += image_size;
+  }
+  *output = std::move(batch_output);
+  return Status::OK();
+}
 }  // namespace dataset
 }  // namespace mindspore
@@ -47,6 +47,9 @@ class RandomHorizontalFlipOp : public TensorOp {
 
   Status Compute(const TensorRow &input, TensorRow *output) override;
 
+  // Flip the images of the batch independently, each image draws its own random decision.
+  Status BatchCompute(const std::shared_ptr<Tensor> &input, std::shared_ptr<Tensor> *output) override;
+
   std::string Name() const override { return kRandomHorizontalFlipOp; }
 
   uint32_t NumInput() override { return 1; }
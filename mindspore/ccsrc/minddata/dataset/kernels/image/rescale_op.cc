@@ -20,10 +20,40 @@
 
 namespace mindspore {
 namespace dataset {
+namespace {
+// Rescale all the elements of the contiguous batch in one loop.
+template <typename T>
+void RescaleElements(const T *src, float *dst, int64_t num_elements, float rescale, float shift) {
+  for (int64_t i = 0; i < num_elements; i++) {
+    dst[i] = static_cast<float>(src[i]) * rescale + shift;
+  }
+}
+}  // namespace
+
 Status RescaleOp::Compute(const std::shared_ptr<Tensor> &input, std::shared_ptr<Tensor> *output) {
   IO_CHECK(input, output);
   return Rescale(input, output, rescale_, shift_);
 }
+Status RescaleOp::BatchCompute(const std::shared_ptr<Tensor> &input, std::shared_ptr<Tensor> *output) {
+  IO_CHECK(input, output);
+  if (input->type() != DataType::DE_UINT8 && input->type() != DataType::DE_FLOAT32) {
+    return TensorOp::BatchCompute(input, output);
+  }
+  std::shared_ptr<Tensor> batch_output;
+  RETURN_IF_NOT_OK(Tensor::CreateEmpty(input->shape(), DataType(DataType::DE_FLOAT32), &batch_output));
+  int64_t num_elements = input->shape().NumOfElements();
+  if (num_elements > 0) {
+    float *dst = &(*batch_output->begin<float>());
+    if (input->type() == DataType::DE_UINT8) {
+      RescaleElements(reinterpret_cast<const uint8_t *>(input->GetBuffer()), dst, num_elements, rescale_, shift_);
+    } else {
+      RescaleElements(reinterpret_cast<const float *>(input->GetBuffer()), dst, num_elements, rescale_, shift_);
+    }
+  }
+  *output = std::move(batch_output);
+  return Status::OK();
+}
+
 Status RescaleOp::OutputType(const std::vector<DataType> &inputs, std::vector<DataType> &outputs) {
   RETURN_IF_NOT_OK(TensorOp::OutputType(inputs, outputs));
   outputs[0] = DataType(DataType::DE_FLOAT32);
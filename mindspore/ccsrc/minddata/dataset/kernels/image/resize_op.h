@@ -62,6 +62,14 @@ class ResizeOp : public TensorOp {
   std::string Name() const override { return kResizeOp; }
 
  protected:
+  // Compute the output size of the image from the input size and the size arguments.
+  // @param input_h: the height of the input image
+  // @param input_w: the width of the input image
+  // @param output_h: the height of the output image
+  // @param output_w: the width of the output image
+  // @return Status
+  Status OutputSize(int32_t input_h, int32_t input_w, int32_t *output_h, int32_t *output_w) const;
+
   int32_t size1_;
   int32_t size2_;
   InterpolationMode interpolation_;
@@ -32,8 +32,9 @@ namespace vision {
 RandomCropDecodeResizeOperation::RandomCropDecodeResizeOperation(const std::vector<int32_t> &size,
                                                                  const std::vector<float> &scale,
                                                                  const std::vector<float> &ratio,
-                                                                 InterpolationMode interpolation, int32_t max_attempts)
-    : RandomResizedCropOperation(size, scale, ratio, interpolation, max_attempts) {}
+                                                                 InterpolationMode interpolation, int32_t max_attempts,
+                                                                 bool scaled_decode)
+    : RandomResizedCropOperation(size, scale, ratio, interpolation, max_attempts), scaled_decode_(scaled_decode) {}
 
 RandomCropDecodeResizeOperation::~RandomCropDecodeResizeOperation() = default;
 
@@ -58,9 +59,9 @@ std::shared_ptr<TensorOp> RandomCropDecodeResizeOperation::Build() {
   float aspect_lower_bound = ratio_[dimension_zero];
   float aspect_upper_bound = ratio_[dimension_one];
 
-  auto tensor_op =
-    std::make_shared<RandomCropDecodeResizeOp>(crop_height, crop_width, scale_lower_bound, scale_upper_bound,
-                                               aspect_lower_bound, aspect_upper_bound, interpolation_, max_attempts_);
+  auto tensor_op = std::make_shared<RandomCropDecodeResizeOp>(crop_height, crop_width, scale_lower_bound,
+                                                              scale_upper_bound, aspect_lower_bound, aspect_upper_bound,
+                                                              interpolation_, max_attempts_, scaled_decode_);
   return tensor_op;
 }
 
@@ -74,6 +75,7 @@ Status RandomCropDecodeResizeOperation::to_json(nlohmann::json *out_json) {
   args["ratio"] = ratio_;
   args["interpolation"] = interpolation_;
   args["max_attempts"] = max_attempts_;
+  args["scaled_decode"] = scaled_decode_;
   *out_json = args;
   return Status::OK();
 }
@@ -90,8 +92,10 @@ Status RandomCropDecodeResizeOperation::from_json(nlohmann::json op_params,
   std::vector<float> ratio = op_params["ratio"];
   InterpolationMode interpolation = static_cast<InterpolationMode>(op_params["interpolation"]);
   int32_t max_attempts = op_params["max_attempts"];
-  *operation =
-    std::make_shared<vision::RandomCropDecodeResizeOperation>(size, scale, ratio, interpolation, max_attempts);
+  // scaled_decode is absent from the pipelines serialized before it was added
+  bool scaled_decode = op_params.find("scaled_decode") != op_params.end() && op_params["scaled_decode"].get<bool>();
+  *operation = std::make_shared<vision::RandomCropDecodeResizeOperation>(size, scale, ratio, interpolation,
+                                                                         max_attempts, scaled_decode);
   return Status::OK();
 }
 
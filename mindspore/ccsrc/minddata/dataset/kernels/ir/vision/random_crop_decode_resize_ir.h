@@ -40,7 +40,7 @@ class RandomCropDecodeResizeOperation : public RandomResizedCropOperation {
  public:
   RandomCropDecodeResizeOperation(const std::vector<int32_t> &size, const std::vector<float> &scale,
                                   const std::vector<float> &ratio, InterpolationMode interpolation,
-                                  int32_t max_attempts);
+                                  int32_t max_attempts, bool scaled_decode = false);
 
   explicit RandomCropDecodeResizeOperation(const RandomResizedCropOperation &base);
 
@@ -53,6 +53,9 @@ class RandomCropDecodeResizeOperation : public RandomResizedCropOperation {
   Status to_json(nlohmann::json *out_json) override;
 
   static Status from_json(nlohmann::json op_params, std::shared_ptr<TensorOperation> *operation);
+
+ private:
+  bool scaled_decode_{false};
 };
 
 }  // namespace vision
@@ -47,6 +47,53 @@ Status TensorOp::Compute(const TensorRow &input, TensorRow *output) {
                 "Is this TensorOp oneToOne? If no, please implement this Compute() in the derived class.");
 }
 
+// Name: BatchCompute()
+// Description: This BatchCompute() takes the batch Tensor and computes the Tensors in the batch one by one.
+//              The derived class could override this function to compute the whole batch at once.
+Status TensorOp::BatchCompute(const std::shared_ptr<Tensor> &input, std::shared_ptr<Tensor> *output) {
+  IO_CHECK(input, output);
+  CHECK_FAIL_RETURN_UNEXPECTED(input->Rank() >= 1 && input->type().IsNumeric(),
+                               Name() + ": the batch input should be a numeric tensor with at least 1 dimension.");
+  std::vector<dsize_t> dims = input->shape().AsVector();
+  TensorShape row_shape(std::vector<dsize_t>(dims.begin() + 1, dims.end()));
+  std::shared_ptr<Tensor> batch_output;
+  for (dsize_t i = 0; i < dims[0]; i++) {
+    uchar *start_addr = nullptr;
+    TensorShape remaining = TensorShape::CreateUnknownRankShape();
+    std::shared_ptr<Tensor> row_input;
+    if (row_shape.NumOfElements() == 0) {
+      RETURN_IF_NOT_OK(Tensor::CreateEmpty(row_shape, input->type(), &row_input));
+    } else {
+      RETURN_IF_NOT_OK(input->StartAddrOfIndex({i}, &start_addr, &remaining));
+      RETURN_IF_NOT_OK(Tensor::CreateFromMemory(row_shape, input->type(), start_addr, &row_input));
+    }
+    TensorRow row_output;
+    RETURN_IF_NOT_OK(Compute(TensorRow(0, {row_input}), &row_output));
+    CHECK_FAIL_RETURN_UNEXPECTED(row_output.size() == 1 && row_output[0] != nullptr,
+                                 Name() + ": the op should produce one tensor for each tensor in the batch.");
+    const std::shared_ptr<Tensor> &result = row_output[0];
+    // The first result decides the shape and type of the batch output.
+    if (batch_output == nullptr) {
+      CHECK_FAIL_RETURN_UNEXPECTED(result->type().IsNumeric(), Name() + ": the batch output should be numeric.");
+      RETURN_IF_NOT_OK(Tensor::CreateEmpty(result->shape().PrependDim(dims[0]), result->type(), &batch_output));
+    }
+    CHECK_FAIL_RETURN_UNEXPECTED(result->type() == batch_output->type() &&
+                                   result->shape().PrependDim(dims[0]) == batch_output->shape(),
+                                 Name() + ": the results of the tensors in the batch should have the same shape and "
+                                          "type, but got shape: " + result->shape().ToString() + " and type: " +
+                                   result->type().ToString());
+    if (result->shape().NumOfElements() != 0) {
+      RETURN_IF_NOT_OK(batch_output->InsertTensor({i}, result));
+    }
+  }
+  if (batch_output == nullptr) {
+    // An empty batch produces an empty batch of the same shape.
+    RETURN_IF_NOT_OK(Tensor::CreateEmpty(input->shape(), input->type(), &batch_output));
+  }
+  *output = std::move(batch_output);
+  return Status::OK();
+}
+
 Status TensorOp::Compute(const std::shared_ptr<DeviceTensor> &input, std::shared_ptr<DeviceTensor> *output) {
   IO_CHECK(input, output);
   return Status(StatusCode::kMDUnexpectedError,
@@ -59,6 +59,7 @@ constexpr char kAutoAugmentOp[] = "AutoAugmentOp";
 constexpr char kAutoContrastOp[] = "AutoContrastOp";
 constexpr char kBoundingBoxAugmentOp[] = "BoundingBoxAugmentOp";
 constexpr char kDecodeOp[] = "DecodeOp";
+constexpr char kDecodeResizeOp[] = "DecodeResizeOp";
 constexpr char kCenterCropOp[] = "CenterCropOp";
 constexpr char kConvertColorOp[] = "ConvertColorOp";
 constexpr char kCutMixBatchOp[] = "CutMixBatchOp";
@@ -197,6 +198,7 @@ constexpr char kVadOp[] = "VadOp";
 constexpr char kVolOp[] = "VolOp";
 
 // data
+constexpr char kBatchedTensorOp[] = "BatchedTensorOp";
 constexpr char kConcatenateOp[] = "ConcatenateOp";
 constexpr char kDuplicateOp[] = "DuplicateOp";
 constexpr char kFillOp[] = "FillOp";
@@ -247,6 +249,14 @@ class TensorOp {
   // @return Status
   virtual Status Compute(const TensorRow &input, TensorRow *output);
 
+  // Perform the 1-to-1 operation on a batch of Tensors stacked along the first dimension, e.g. an NHWC batch of
+  // images, and produce the batch of results. The default implementation computes the Tensors of the batch one by
+  // one, and the derived class could override it to process the contiguous batch in one loop.
+  // @param input the batch Tensor whose first dimension is the batch size.
+  // @param output the address to a shared_ptr where the batch of results will be placed.
+  // @return Status
+  virtual Status BatchCompute(const std::shared_ptr<Tensor> &input, std::shared_ptr<Tensor> *output);
+
   // Perform an operation on one DeviceTensor and produce one DeviceTensor. This is for 1-to-1 column MapOp
   // @param input shares the ownership of the Tensor (increase the ref count).
   // @param output the address to a shared_ptr where the result will be placed.
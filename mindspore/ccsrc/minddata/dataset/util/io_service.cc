@@ -0,0 +1,178 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "minddata/dataset/util/io_service.h"
+
+#include <algorithm>
+#include <chrono>
+#include <exception>
+#include <utility>
+
+#include "minddata/dataset/util/log_adapter.h"
+
+namespace mindspore {
+namespace dataset {
+namespace {
+int64_t ElapsedMicroseconds(const std::chrono::steady_clock::time_point &start) {
+  return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count();
+}
+}  // namespace
+
+IOService &IOService::GetInstance() {
+  static IOService instance;
+  return instance;
+}
+
+IOService::~IOService() {
+  {
+    std::unique_lock<std::mutex> lock(mux_);
+    quit_ = true;
+    tasks_.clear();
+  }
+  cv_.notify_all();
+  for (auto &thread : threads_) {
+    if (thread.joinable()) {
+      thread.join();
+    }
+  }
+}
+
+void IOService::Reserve(int32_t num_threads) {
+  std::unique_lock<std::mutex> lock(mux_);
+  size_t target = static_cast<size_t>(std::min(std::max(num_threads, 0), kMaxIOThreads));
+  while (threads_.size() < target && !quit_) {
+    try {
+      (void)threads_.emplace_back(&IOService::Run, this);
+    } catch (const std::exception &e) {
+      MS_LOG(WARNING) << "Failed to start the I/O thread, the I/O service runs with " << threads_.size()
+                      << " threads, error: " << e.what();
+      break;
+    }
+  }
+}
+
+void IOService::Submit(std::function<void()> task) {
+  {
+    std::unique_lock<std::mutex> lock(mux_);
+    if (!threads_.empty() && !quit_) {
+      tasks_.push_back(std::move(task));
+      cv_.notify_one();
+      return;
+    }
+  }
+  // No thread is available to run the task, so run it in the caller.
+  task();
+}
+
+void IOService::Run() {
+  while (true) {
+    std::function<void()> task;
+    {
+      std::unique_lock<std::mutex> lock(mux_);
+      cv_.wait(lock, [this]() { return quit_ || !tasks_.empty(); });
+      if (quit_) {
+        return;
+      }
+      task = std::move(tasks_.front());
+      tasks_.pop_front();
+    }
+    task();
+  }
+}
+
+FileReadahead::FileReadahead(int32_t depth) : depth_(depth), state_(std::make_shared<State>()) {
+  IOService::GetInstance().Reserve(depth_);
+}
+
+void FileReadahead::Prefetch(const std::string &path) {
+  auto entry = std::make_shared<Entry>();
+  {
+    std::unique_lock<std::mutex> lock(state_->mux);
+    if (state_->entries.find(path) != state_->entries.end()) {
+      return;
+    }
+    if (state_->entries.size() >= static_cast<size_t>(depth_)) {
+      ++state_->dropped;
+      return;
+    }
+    state_->entries[path] = entry;
+  }
+  IOService::GetInstance().Submit([state = state_, entry, path]() {
+    auto start = std::chrono::steady_clock::now();
+    std::shared_ptr<Tensor> tensor;
+    Status rc;
+    try {
+      rc = Tensor::CreateFromFile(path, &tensor);
+    } catch (const std::exception &e) {
+      rc = Status(StatusCode::kMDUnexpectedError, "Failed to read file: " + path + ", error: " + e.what());
+    }
+    state->read_us += ElapsedMicroseconds(start);
+    if (rc.IsOk() && tensor != nullptr) {
+      state->bytes_read += tensor->SizeInBytes();
+    }
+    {
+      std::unique_lock<std::mutex> lock(state->mux);
+      entry->rc = rc;
+      entry->tensor = std::move(tensor);
+      entry->done = true;
+    }
+    state->cv.notify_all();
+  });
+}
+
+Status FileReadahead::Read(const std::string &path, std::shared_ptr<Tensor> *tensor) {
+  RETURN_UNEXPECTED_IF_NULL(tensor);
+  std::shared_ptr<Entry> entry;
+  {
+    std::unique_lock<std::mutex> lock(state_->mux);
+    auto iter = state_->entries.find(path);
+    if (iter != state_->entries.end()) {
+      entry = iter->second;
+      if (!entry->done) {
+        auto start = std::chrono::steady_clock::now();
+        state_->cv.wait(lock, [&entry]() { return entry->done; });
+        state_->wait_us += ElapsedMicroseconds(start);
+      }
+      // The same file may be read by several rows, only the read which takes the entry gets its bytes, the others
+      // read the file again.
+      iter = state_->entries.find(path);
+      if (iter != state_->entries.end() && iter->second == entry) {
+        (void)state_->entries.erase(iter);
+      } else {
+        entry = nullptr;
+      }
+    }
+  }
+  if (entry == nullptr) {
+    ++state_->misses;
+    return Tensor::CreateFromFile(path, tensor);
+  }
+  ++state_->hits;
+  RETURN_IF_NOT_OK(entry->rc);
+  *tensor = std::move(entry->tensor);
+  return Status::OK();
+}
+
+std::unordered_map<std::string, int64_t> FileReadahead::GetMetrics() const {
+  return {{"readahead_depth", depth_},
+          {"readahead_hits", state_->hits.load()},
+          {"readahead_misses", state_->misses.load()},
+          {"readahead_dropped", state_->dropped.load()},
+          {"readahead_bytes", state_->bytes_read.load()},
+          {"readahead_read_us", state_->read_us.load()},
+          {"readahead_wait_us", state_->wait_us.load()}};
+}
+}  // namespace dataset
+}  // namespace mindspore
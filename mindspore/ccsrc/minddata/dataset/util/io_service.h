@@ -0,0 +1,126 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef MINDSPORE_CCSRC_MINDDATA_DATASET_UTIL_IO_SERVICE_H_
+#define MINDSPORE_CCSRC_MINDDATA_DATASET_UTIL_IO_SERVICE_H_
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include "minddata/dataset/core/tensor.h"
+#include "minddata/dataset/util/status.h"
+
+namespace mindspore {
+namespace dataset {
+// IOService is the pool of I/O threads shared by all the pipelines of the process. The blocking reads submitted to it
+// run in its threads, so the reads of many files are in flight at the same time instead of one by one in each worker.
+// The pool starts without threads and grows to the largest number of concurrent reads requested by its users.
+class IOService {
+ public:
+  // The max number of the I/O threads
+  static constexpr int32_t kMaxIOThreads = 64;
+
+  // Get the shared instance, which is created on the first use.
+  // @return IOService & - the shared instance
+  static IOService &GetInstance();
+
+  IOService(const IOService &) = delete;
+
+  IOService &operator=(const IOService &) = delete;
+
+  // Destructor, the pending tasks are dropped and the running ones are waited for.
+  ~IOService();
+
+  // Grow the pool to run the given number of reads at the same time.
+  // @param int32_t num_threads - the number of reads to run at the same time, which is capped by kMaxIOThreads
+  void Reserve(int32_t num_threads);
+
+  // Run a task in an I/O thread.
+  // @param std::function<void()> task - the task, which should not throw
+  void Submit(std::function<void()> task);
+
+ private:
+  IOService() = default;
+
+  // The loop of each I/O thread
+  void Run();
+
+  std::mutex mux_;
+  std::condition_variable cv_;
+  std::deque<std::function<void()>> tasks_;
+  std::vector<std::thread> threads_;
+  bool quit_ = false;
+};
+
+// FileReadahead reads the whole files of the rows a leaf op is going to load in the threads of IOService, so the bytes
+// are already in memory when a worker loads the row. The number of the files read ahead and not taken yet is limited
+// by the depth, and the readahead of a file beyond the depth is dropped, then the file is read by the worker as before.
+class FileReadahead {
+ public:
+  // Constructor of FileReadahead
+  // @param int32_t depth - the max number of the files read ahead and not taken yet
+  explicit FileReadahead(int32_t depth);
+
+  // Destructor, the reads in flight finish in the background and their bytes are dropped.
+  ~FileReadahead() = default;
+
+  // Start to read a file ahead, it is ignored if the depth is reached or the file is already being read ahead.
+  // @param const std::string &path - the path of the file
+  void Prefetch(const std::string &path);
+
+  // Take the bytes of a file read ahead as a uint8 tensor, or read it now if it is not read ahead.
+  // @param const std::string &path - the path of the file
+  // @param std::shared_ptr<Tensor> *tensor - the bytes of the file
+  // @return Status The status code returned
+  Status Read(const std::string &path, std::shared_ptr<Tensor> *tensor);
+
+  // @return std::unordered_map<std::string, int64_t> - the I/O metrics for the dataset profiler
+  std::unordered_map<std::string, int64_t> GetMetrics() const;
+
+ private:
+  // A file read ahead
+  struct Entry {
+    bool done = false;
+    Status rc;
+    std::shared_ptr<Tensor> tensor;
+  };
+
+  // The state shared with the reads in flight, which may finish after the FileReadahead is destroyed.
+  struct State {
+    std::mutex mux;
+    std::condition_variable cv;
+    std::unordered_map<std::string, std::shared_ptr<Entry>> entries;
+    std::atomic<int64_t> hits{0};
+    std::atomic<int64_t> misses{0};
+    std::atomic<int64_t> dropped{0};
+    std::atomic<int64_t> bytes_read{0};
+    std::atomic<int64_t> read_us{0};
+    std::atomic<int64_t> wait_us{0};
+  };
+
+  const int32_t depth_;
+  std::shared_ptr<State> state_;
+};
+}  // namespace dataset
+}  // namespace mindspore
+#endif  // MINDSPORE_CCSRC_MINDDATA_DATASET_UTIL_IO_SERVICE_H_
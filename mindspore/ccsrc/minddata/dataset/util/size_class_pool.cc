@@ -0,0 +1,391 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "minddata/dataset/util/size_class_pool.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <iterator>
+#include <limits>
+#include <mutex>
+#include <vector>
+
+#include "./securec.h"
+
+namespace mindspore {
+namespace dataset {
+namespace {
+constexpr int32_t kMinBlockLog = 7;
+constexpr int32_t kMaxBlockLog = 26;
+constexpr int32_t kSubClassLog = 2;
+constexpr int32_t kSubClasses = 1 << kSubClassLog;
+constexpr int32_t kNumClasses = 1 + (kMaxBlockLog - kMinBlockLog) * kSubClasses;
+constexpr int64_t kPercent = 100;
+
+// The header kept at the base address of each block
+struct BlockHeader {
+  uint64_t block_size;
+  int32_t size_class;
+};
+
+// The thread caches of a thread are gone while the thread is exiting, then the blocks go to the shared free lists.
+thread_local bool g_thread_cache_alive = true;
+
+void AtomicMax(std::atomic<int64_t> *target, int64_t value) {
+  int64_t current = target->load(std::memory_order_relaxed);
+  while (current < value && !target->compare_exchange_weak(current, value, std::memory_order_relaxed)) {
+  }
+}
+}  // namespace
+
+struct SizeClassPool::Shared {
+  struct FreeList {
+    std::mutex mux;
+    std::vector<void *> blocks;
+  };
+
+  ~Shared() {
+    for (auto &list : lists) {
+      for (void *base : list.blocks) {
+        free(base);
+      }
+    }
+  }
+
+  // Return all the blocks in the shared free lists to the system.
+  void Release() {
+    for (int32_t i = 0; i < kNumClasses; i++) {
+      std::vector<void *> blocks;
+      {
+        std::unique_lock<std::mutex> lock(lists[i].mux);
+        blocks.swap(lists[i].blocks);
+      }
+      for (void *base : blocks) {
+        free(base);
+      }
+      int64_t bytes = static_cast<int64_t>(blocks.size() * ClassBlockSize(i));
+      (void)cached_bytes.fetch_sub(bytes, std::memory_order_relaxed);
+      (void)system_frees.fetch_add(static_cast<int64_t>(blocks.size()), std::memory_order_relaxed);
+    }
+  }
+
+  // Move blocks of a size class into the shared free list, or return them to the system if the pool is destroyed.
+  void Put(int32_t size_class, std::vector<void *> *blocks, size_t num) {
+    auto first = blocks->end() - static_cast<std::ptrdiff_t>(num);
+    if (closed.load(std::memory_order_acquire)) {
+      std::for_each(first, blocks->end(), [](void *base) { free(base); });
+      int64_t bytes = static_cast<int64_t>(num * ClassBlockSize(size_class));
+      (void)cached_bytes.fetch_sub(bytes, std::memory_order_relaxed);
+      (void)system_frees.fetch_add(static_cast<int64_t>(num), std::memory_order_relaxed);
+    } else {
+      std::unique_lock<std::mutex> lock(lists[size_class].mux);
+      (void)lists[size_class].blocks.insert(lists[size_class].blocks.end(), first, blocks->end());
+    }
+    blocks->erase(first, blocks->end());
+  }
+
+  FreeList lists[kNumClasses];
+  std::atomic<bool> closed{false};
+  std::atomic<int64_t> limit{0};
+  std::atomic<int64_t> in_use_bytes{0};
+  std::atomic<int64_t> peak_in_use_bytes{0};
+  std::atomic<int64_t> cached_bytes{0};
+  std::atomic<int64_t> allocations{0};
+  std::atomic<int64_t> thread_cache_hits{0};
+  std::atomic<int64_t> free_list_hits{0};
+  std::atomic<int64_t> system_allocations{0};
+  std::atomic<int64_t> system_frees{0};
+  std::atomic<int64_t> failed_allocations{0};
+};
+
+struct SizeClassPool::ThreadCache {
+  explicit ThreadCache(std::shared_ptr<Shared> s) : shared(std::move(s)) {}
+
+  ~ThreadCache() {
+    for (int32_t i = 0; i < kNumClasses; i++) {
+      if (!blocks[i].empty()) {
+        shared->Put(i, &blocks[i], blocks[i].size());
+      }
+    }
+  }
+
+  // Move the last num blocks of a size class to the shared free list.
+  void Release(int32_t size_class, size_t num) {
+    bytes -= num * ClassBlockSize(size_class);
+    shared->Put(size_class, &blocks[size_class], num);
+  }
+
+  std::shared_ptr<Shared> shared;
+  std::vector<void *> blocks[kNumClasses];
+  size_t bytes = 0;
+};
+
+struct SizeClassPool::ThreadCacheRegistry {
+  ~ThreadCacheRegistry() { g_thread_cache_alive = false; }
+
+  std::unordered_map<const Shared *, std::unique_ptr<ThreadCache>> caches;
+  const Shared *last_shared = nullptr;
+  ThreadCache *last_cache = nullptr;
+};
+
+SizeClassPool::SizeClassPool(int64_t limit) : shared_(std::make_shared<Shared>()) { SetLimit(limit); }
+
+SizeClassPool::~SizeClassPool() {
+  shared_->closed.store(true, std::memory_order_release);
+  Trim();
+}
+
+int32_t SizeClassPool::SizeClass(size_t n) {
+  if (n > kMaxBlockSize - kHeaderSize) {
+    return -1;
+  }
+  size_t total = n + kHeaderSize;
+  if (total <= kMinBlockSize) {
+    return 0;
+  }
+  // (2^k, 2^(k+1)] is split into kSubClasses classes of the same step.
+  auto k = static_cast<int32_t>(std::numeric_limits<unsigned long long>::digits) - 1 -
+           __builtin_clzll(static_cast<unsigned long long>(total - 1));
+  size_t step = size_t{1} << static_cast<size_t>(k - kSubClassLog);
+  auto sub = static_cast<int32_t>(((total - 1) - (size_t{1} << static_cast<size_t>(k))) / step);
+  return 1 + (k - kMinBlockLog) * kSubClasses + sub;
+}
+
+size_t SizeClassPool::ClassBlockSize(int32_t size_class) {
+  if (size_class == 0) {
+    return kMinBlockSize;
+  }
+  int32_t k = kMinBlockLog + (size_class - 1) / kSubClasses;
+  int32_t sub = (size_class - 1) % kSubClasses + 1;
+  return (size_t{1} << static_cast<size_t>(k)) + static_cast<size_t>(sub) * (size_t{1} << (k - kSubClassLog));
+}
+
+SizeClassPool::ThreadCacheRegistry &SizeClassPool::Registry() {
+  thread_local ThreadCacheRegistry registry;
+  return registry;
+}
+
+SizeClassPool::ThreadCache *SizeClassPool::GetThreadCache() {
+  if (!g_thread_cache_alive) {
+    return nullptr;
+  }
+  ThreadCacheRegistry &registry = Registry();
+  if (registry.last_shared == shared_.get()) {
+    return registry.last_cache;
+  }
+  auto iter = registry.caches.find(shared_.get());
+  if (iter == registry.caches.end()) {
+    // Drop the caches of the destroyed pools before adding a new one, their blocks are returned to the system.
+    registry.last_shared = nullptr;
+    for (auto it = registry.caches.begin(); it != registry.caches.end();) {
+      it = it->first->closed.load(std::memory_order_acquire) ? registry.caches.erase(it) : std::next(it);
+    }
+    iter = registry.caches.emplace(shared_.get(), std::make_unique<ThreadCache>(shared_)).first;
+  }
+  registry.last_shared = shared_.get();
+  registry.last_cache = iter->second.get();
+  return registry.last_cache;
+}
+
+void *SizeClassPool::TakeFreeBlock(int32_t size_class) {
+  ThreadCache *cache = GetThreadCache();
+  if (cache != nullptr && !cache->blocks[size_class].empty()) {
+    void *base = cache->blocks[size_class].back();
+    cache->blocks[size_class].pop_back();
+    cache->bytes -= ClassBlockSize(size_class);
+    (void)shared_->thread_cache_hits.fetch_add(1, std::memory_order_relaxed);
+    return base;
+  }
+  // Refill the thread cache with a batch of blocks, so the next allocations of the class do not take the lock.
+  size_t block_size = ClassBlockSize(size_class);
+  size_t batch = 1;
+  if (cache != nullptr) {
+    batch = std::max<size_t>(1, std::min(kThreadCacheBlocks / 2, kThreadCacheBytes / 4 / block_size));
+  }
+  void *base = nullptr;
+  {
+    auto &list = shared_->lists[size_class];
+    std::unique_lock<std::mutex> lock(list.mux);
+    if (list.blocks.empty()) {
+      return nullptr;
+    }
+    base = list.blocks.back();
+    list.blocks.pop_back();
+    size_t num = std::min(batch - 1, list.blocks.size());
+    if (num > 0) {
+      auto first = list.blocks.end() - static_cast<std::ptrdiff_t>(num);
+      (void)cache->blocks[size_class].insert(cache->blocks[size_class].end(), first, list.blocks.end());
+      list.blocks.erase(first, list.blocks.end());
+      cache->bytes += num * block_size;
+    }
+  }
+  (void)shared_->free_list_hits.fetch_add(1, std::memory_order_relaxed);
+  return base;
+}
+
+void SizeClassPool::CacheFreeBlock(int32_t size_class, void *base) {
+  ThreadCache *cache = GetThreadCache();
+  if (cache == nullptr) {
+    std::vector<void *> blocks{base};
+    shared_->Put(size_class, &blocks, 1);
+    return;
+  }
+  auto &blocks = cache->blocks[size_class];
+  blocks.push_back(base);
+  cache->bytes += ClassBlockSize(size_class);
+  // Hand half of the blocks of the class to the other threads when the thread cache is full.
+  if (blocks.size() > kThreadCacheBlocks || cache->bytes > kThreadCacheBytes) {
+    cache->Release(size_class, (blocks.size() + 1) / 2);
+    if (cache->bytes > kThreadCacheBytes) {
+      cache->Release(size_class, blocks.size());
+    }
+  }
+}
+
+Status SizeClassPool::Allocate(size_t n, void **p) {
+  RETURN_UNEXPECTED_IF_NULL(p);
+  if (n > std::numeric_limits<size_t>::max() - kHeaderSize) {
+    return Status(StatusCode::kMDOutOfMemory, "The size to allocate is too large: " + std::to_string(n));
+  }
+  int32_t size_class = SizeClass(n);
+  size_t block_size = size_class < 0 ? n + kHeaderSize : ClassBlockSize(size_class);
+  auto bytes = static_cast<int64_t>(block_size);
+  int64_t limit = shared_->limit.load(std::memory_order_relaxed);
+  int64_t in_use = shared_->in_use_bytes.fetch_add(bytes, std::memory_order_relaxed) + bytes;
+  if (limit > 0 && in_use > limit) {
+    (void)shared_->in_use_bytes.fetch_sub(bytes, std::memory_order_relaxed);
+    (void)shared_->failed_allocations.fetch_add(1, std::memory_order_relaxed);
+    return Status(StatusCode::kMDOutOfMemory, "The tensor memory pool can not allocate " + std::to_string(n) +
+                                                " bytes within its limit of " + std::to_string(limit) +
+                                                " bytes, the bytes in use are " + std::to_string(in_use - bytes) + ".");
+  }
+  AtomicMax(&shared_->peak_in_use_bytes, in_use);
+  (void)shared_->allocations.fetch_add(1, std::memory_order_relaxed);
+
+  void *base = size_class < 0 ? nullptr : TakeFreeBlock(size_class);
+  if (base != nullptr) {
+    (void)shared_->cached_bytes.fetch_sub(bytes, std::memory_order_relaxed);
+  } else {
+    // Return the cached blocks of the other classes before the memory held by the pool grows beyond the limit.
+    if (limit > 0 && in_use + shared_->cached_bytes.load(std::memory_order_relaxed) > limit) {
+      Trim();
+    }
+    base = malloc(block_size);
+    if (base == nullptr) {
+      (void)shared_->in_use_bytes.fetch_sub(bytes, std::memory_order_relaxed);
+      (void)shared_->failed_allocations.fetch_add(1, std::memory_order_relaxed);
+      return Status(StatusCode::kMDOutOfMemory, "Failed to allocate " + std::to_string(n) + " bytes of memory.");
+    }
+    (void)shared_->system_allocations.fetch_add(1, std::memory_order_relaxed);
+  }
+  auto header = static_cast<BlockHeader *>(base);
+  header->block_size = block_size;
+  header->size_class = size_class;
+  *p = static_cast<char *>(base) + kHeaderSize;
+  return Status::OK();
+}
+
+Status SizeClassPool::Reallocate(void **p, size_t old_sz, size_t new_sz) {
+  RETURN_UNEXPECTED_IF_NULL(p);
+  if (*p == nullptr) {
+    return Allocate(new_sz, p);
+  }
+  auto header = reinterpret_cast<BlockHeader *>(static_cast<char *>(*p) - kHeaderSize);
+  CHECK_FAIL_RETURN_UNEXPECTED(old_sz <= header->block_size - kHeaderSize,
+                               "The old size " + std::to_string(old_sz) + " is larger than the allocated block.");
+  if (new_sz <= header->block_size - kHeaderSize) {
+    return Status::OK();
+  }
+  void *q = nullptr;
+  RETURN_IF_NOT_OK(Allocate(new_sz, &q));
+  if (old_sz > 0) {
+    errno_t err = memcpy_s(q, new_sz, *p, old_sz);
+    if (err != EOK) {
+      Deallocate(q);
+      RETURN_STATUS_UNEXPECTED("Failed to copy the memory to reallocate, error code: " + std::to_string(err));
+    }
+  }
+  Deallocate(*p);
+  *p = q;
+  return Status::OK();
+}
+
+void SizeClassPool::Deallocate(void *p) {
+  if (p == nullptr) {
+    return;
+  }
+  void *base = static_cast<char *>(p) - kHeaderSize;
+  auto header = static_cast<BlockHeader *>(base);
+  int32_t size_class = header->size_class;
+  auto bytes = static_cast<int64_t>(header->block_size);
+  int64_t in_use = shared_->in_use_bytes.fetch_sub(bytes, std::memory_order_relaxed) - bytes;
+  int64_t limit = shared_->limit.load(std::memory_order_relaxed);
+  // Keep the memory held by the pool within the limit, the block is returned to the system if it can not be cached.
+  if (size_class < 0 ||
+      (limit > 0 && in_use + shared_->cached_bytes.load(std::memory_order_relaxed) + bytes > limit)) {
+    free(base);
+    (void)shared_->system_frees.fetch_add(1, std::memory_order_relaxed);
+    return;
+  }
+  (void)shared_->cached_bytes.fetch_add(bytes, std::memory_order_relaxed);
+  CacheFreeBlock(size_class, base);
+}
+
+uint64_t SizeClassPool::get_max_size() const {
+  int64_t limit = shared_->limit.load(std::memory_order_relaxed);
+  return limit > 0 ? static_cast<uint64_t>(limit) : std::numeric_limits<uint64_t>::max();
+}
+
+int SizeClassPool::PercentFree() const {
+  int64_t limit = shared_->limit.load(std::memory_order_relaxed);
+  if (limit <= 0) {
+    return static_cast<int>(kPercent);
+  }
+  int64_t in_use = std::min(shared_->in_use_bytes.load(std::memory_order_relaxed), limit);
+  return static_cast<int>((limit - in_use) * kPercent / limit);
+}
+
+void SizeClassPool::SetLimit(int64_t limit) {
+  shared_->limit.store(std::max<int64_t>(limit, 0), std::memory_order_relaxed);
+}
+
+void SizeClassPool::Trim() {
+  if (g_thread_cache_alive) {
+    ThreadCacheRegistry &registry = Registry();
+    auto iter = registry.caches.find(shared_.get());
+    if (iter != registry.caches.end()) {
+      for (int32_t i = 0; i < kNumClasses; i++) {
+        iter->second->Release(i, iter->second->blocks[i].size());
+      }
+    }
+  }
+  shared_->Release();
+}
+
+std::unordered_map<std::string, int64_t> SizeClassPool::GetStatistics() const {
+  return {{"limit", shared_->limit.load()},
+          {"in_use_bytes", shared_->in_use_bytes.load()},
+          {"peak_in_use_bytes", shared_->peak_in_use_bytes.load()},
+          {"cached_bytes", shared_->cached_bytes.load()},
+          {"allocations", shared_->allocations.load()},
+          {"thread_cache_hits", shared_->thread_cache_hits.load()},
+          {"free_list_hits", shared_->free_list_hits.load()},
+          {"system_allocations", shared_->system_allocations.load()},
+          {"system_frees", shared_->system_frees.load()},
+          {"failed_allocations", shared_->failed_allocations.load()}};
+}
+}  // namespace dataset
+}  // namespace mindspore
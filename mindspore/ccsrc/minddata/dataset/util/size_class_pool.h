@@ -0,0 +1,122 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef MINDSPORE_CCSRC_MINDDATA_DATASET_UTIL_SIZE_CLASS_POOL_H_
+#define MINDSPORE_CCSRC_MINDDATA_DATASET_UTIL_SIZE_CLASS_POOL_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <unordered_map>
+
+#include "minddata/dataset/util/memory_pool.h"
+
+namespace mindspore {
+namespace dataset {
+// SizeClassPool is a MemoryPool for the data of the tensors. Each request is rounded up to one of the size classes,
+// four classes for each power of two, and the freed blocks are kept in the free lists of their class for reuse
+// instead of being returned to the system. A thread caches a few freed blocks of each class for itself, so the
+// allocations and frees of the map workers do not take any lock in the steady state, and only a batch of blocks moves
+// between the thread cache and the shared free lists at a time. The requests larger than the largest class are served
+// by the system allocator directly.
+// With a limit, the bytes allocated from the pool and not freed yet never exceed it, and the cached blocks are returned
+// to the system before the memory held by the pool grows beyond it.
+class SizeClassPool : public MemoryPool {
+ public:
+  // The bytes ahead of the data of each block to keep its size, which keep the alignment of the system allocator
+  static constexpr size_t kHeaderSize = 64;
+  // The smallest block, including the header
+  static constexpr size_t kMinBlockSize = 128;
+  // The largest block kept in the free lists, including the header
+  static constexpr size_t kMaxBlockSize = 64 * 1024 * 1024;
+  // The max number of the blocks of one class cached by a thread
+  static constexpr size_t kThreadCacheBlocks = 32;
+  // The max bytes of the blocks cached by a thread
+  static constexpr size_t kThreadCacheBytes = 8 * 1024 * 1024;
+
+  // Constructor of SizeClassPool
+  // @param int64_t limit - the max bytes allocated from the pool at the same time, 0 means no limit
+  explicit SizeClassPool(int64_t limit = 0);
+
+  SizeClassPool(const SizeClassPool &) = delete;
+
+  SizeClassPool &operator=(const SizeClassPool &) = delete;
+
+  // Destructor, the cached blocks are returned to the system. The blocks cached by the other threads are returned
+  // when the threads exit.
+  ~SizeClassPool() override;
+
+  Status Allocate(size_t n, void **p) override;
+
+  Status Reallocate(void **p, size_t old_sz, size_t new_sz) override;
+
+  void Deallocate(void *p) override;
+
+  uint64_t get_max_size() const override;
+
+  int PercentFree() const override;
+
+  // Change the limit, the blocks allocated already are not affected.
+  // @param int64_t limit - the max bytes allocated from the pool at the same time, 0 means no limit
+  void SetLimit(int64_t limit);
+
+  // Return the blocks in the shared free lists and in the cache of the calling thread to the system.
+  // The blocks cached by the other threads are kept.
+  void Trim();
+
+  // Get the statistics of the pool.
+  // @return std::unordered_map<std::string, int64_t> - the statistics keyed by their names
+  std::unordered_map<std::string, int64_t> GetStatistics() const;
+
+  // Get the size class of a request.
+  // @param size_t n - the bytes requested
+  // @return int32_t - the size class, or -1 if the block is larger than kMaxBlockSize
+  static int32_t SizeClass(size_t n);
+
+  // Get the block size of a size class, including the header.
+  // @param int32_t size_class - the size class
+  // @return size_t - the block size
+  static size_t ClassBlockSize(int32_t size_class);
+
+ private:
+  struct Shared;
+  struct ThreadCache;
+  struct ThreadCacheRegistry;
+
+  // Get the caches of the calling thread for all the pools.
+  static ThreadCacheRegistry &Registry();
+
+  // Get the cache of the calling thread for this pool, which is created on the first use.
+  // @return ThreadCache * - the cache, or nullptr if the thread is exiting
+  ThreadCache *GetThreadCache();
+
+  // Take a free block of a size class from the thread cache or the shared free lists.
+  // @param int32_t size_class - the size class
+  // @return void * - the base address of the block, or nullptr if there is no free block of the class
+  void *TakeFreeBlock(int32_t size_class);
+
+  // Keep a freed block of a size class in the thread cache.
+  // @param int32_t size_class - the size class
+  // @param void *base - the base address of the block
+  void CacheFreeBlock(int32_t size_class, void *base);
+
+  // The free lists and the counters, shared with the thread caches which may outlive the pool
+  std::shared_ptr<Shared> shared_;
+};
+}  // namespace dataset
+}  // namespace mindspore
+
+#endif  // MINDSPORE_CCSRC_MINDDATA_DATASET_UTIL_SIZE_CLASS_POOL_H_
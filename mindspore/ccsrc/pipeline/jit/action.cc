@@ -156,6 +156,8 @@ void ExecuteActionForMindRT(const ResourcePtr &resource) {
   auto bc_ptr = resource->GetBackend();
   auto mindrt_bc_ptr = (std::dynamic_pointer_cast<compile::MindRTBackend>(bc_ptr)).get();
   MS_EXCEPTION_IF_NULL(mindrt_bc_ptr);
+  // The actor info is kept for the input prefetch of graph executor.
+  resource->SetResult(kActorInfo, actor_info);
 
   // Construct the graph run function ptr.
   compile::VmEvalFuncPtr run =
@@ -107,6 +107,8 @@ PYBIND11_MODULE(_c_expression, m) {
   (void)py::class_<GraphExecutorPy, std::shared_ptr<GraphExecutorPy>>(m, "GraphExecutor_")
     .def_static("get_instance", &GraphExecutorPy::GetInstance, "Executor get_instance.")
     .def("__call__", &GraphExecutorPy::Run, py::arg("args"), py::arg("phase") = py::str(""), "Executor run function.")
+    .def("prefetch_inputs", &GraphExecutorPy::PrefetchInputs, py::arg("args"), py::arg("phase") = py::str(""),
+         "Stage the inputs of the next step.")
     .def("del_net_res", &GraphExecutorPy::DelNetRes, py::arg("network_id") = py::set(), "Delete network resource.")
     .def("get_func_graph", &GraphExecutorPy::GetFuncGraph, py::arg("phase") = py::str(""), "Get graph pointer.")
     .def("get_func_graph_proto", &GraphExecutorPy::GetFuncGraphProto, py::arg("phase") = py::str(""),
@@ -563,6 +565,24 @@ PYBIND11_MODULE(_c_expression, m) {
     .def("participation_time_level", &PSContext::participation_time_level, "Get participation time level.")
     .def("set_continuous_failure_times", &PSContext::set_continuous_failure_times, "Set continuous failure times")
     .def("continuous_failure_times", &PSContext::continuous_failure_times, "Get continuous failure times.")
+    .def("set_staleness_bound", &PSContext::set_staleness_bound, "Set staleness bound of parameter server.")
+    .def("staleness_bound", &PSContext::staleness_bound, "Get staleness bound of parameter server.")
+    .def("set_push_compress_type", &PSContext::set_push_compress_type, "Set push compress type of parameter server.")
+    .def("push_compress_type", &PSContext::push_compress_type, "Get push compress type of parameter server.")
+    .def("set_push_topk_ratio", &PSContext::set_push_topk_ratio, "Set top-k ratio of push compression.")
+    .def("push_topk_ratio", &PSContext::push_topk_ratio, "Get top-k ratio of push compression.")
+    .def("set_embedding_storage_path", &PSContext::set_embedding_storage_path,
+         "Set the directory of embedding tables stored on disk.")
+    .def("embedding_storage_path", &PSContext::embedding_storage_path,
+         "Get the directory of embedding tables stored on disk.")
+    .def("set_embedding_cache_size", &PSContext::set_embedding_cache_size,
+         "Set the memory size in MB of embedding table rows cached in memory.")
+    .def("embedding_cache_size", &PSContext::embedding_cache_size,
+         "Get the memory size in MB of embedding table rows cached in memory.")
+    .def("set_incremental_checkpoint", &PSContext::set_incremental_checkpoint,
+         "Set whether the embedding tables are persisted incrementally.")
+    .def("incremental_checkpoint", &PSContext::incremental_checkpoint,
+         "Get whether the embedding tables are persisted incrementally.")
     .def("enable_distributed_mindrt", &PSContext::enable_distributed_mindrt, "Whether distributed MindRT is enabled.");
   (void)m.def("_encrypt", &mindspore::pipeline::PyEncrypt, "Encrypt the data.");
   (void)m.def("_decrypt", &mindspore::pipeline::PyDecrypt, "Decrypt the data.");
@@ -1312,6 +1312,27 @@ py::object GraphExecutorPy::Run(const py::tuple &args, const py::object &phase_o
   return ret;
 }  // namespace pipeline
 
+void GraphExecutorPy::PrefetchInputs(const py::tuple &args, const py::object &phase_obj) {
+  if (!py::isinstance<py::str>(phase_obj)) {
+    MS_LOG(EXCEPTION) << "Prefetch inputs failed, phase input is not a str";
+  }
+  auto phase = py::cast<std::string>(phase_obj);
+  auto resource = GetResource(phase);
+  // Only the graph run by the actors of mindRT backend supports the prefetch.
+  if ((resource == nullptr) || (!resource->HasResult(kActorInfo))) {
+    MS_LOG(DEBUG) << "The phase " << phase << " doesn't support the input prefetch.";
+    return;
+  }
+  const auto &mindrt_backend = std::dynamic_pointer_cast<compile::MindRTBackend>(resource->GetBackend());
+  if (mindrt_backend == nullptr) {
+    return;
+  }
+  VectorRef arg_list;
+  ProcessVmArgInner(args, resource, &arg_list);
+  const auto &actor_info = resource->GetResult(kActorInfo).cast<compile::ActorInfo>();
+  mindrt_backend->PrefetchInputs(actor_info, arg_list);
+}
+
 FuncGraphPtr GraphExecutorPy::BuildGraph(const py::dict &init_params, const std::string &phase,
                                          const py::object &broadcast_params) const {
 #ifdef ENABLE_D
@@ -85,6 +85,8 @@ class GraphExecutorPy : public std::enable_shared_from_this<GraphExecutorPy> {
 
   // for pynative mode when use_vm is on
   py::object Run(const py::tuple &args, const py::object &phase_obj);
+  // Stage the inputs of the next step in the background while the current step of phase is running.
+  void PrefetchInputs(const py::tuple &args, const py::object &phase_obj);
   ResourcePtr GetResource(const std::string &phase);
   FuncGraphPtr GetFuncGraph(const std::string &phase);
   FuncGraphPtr GetGradGraph(const std::string &phase);
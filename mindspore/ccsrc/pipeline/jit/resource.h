@@ -51,6 +51,7 @@ namespace py = pybind11;
 
 const char kStepParallelGraph[] = "step_parallel";
 const char kOutput[] = "output";
+const char kActorInfo[] = "actor_info";
 const char kPynativeGraphId[] = "graph_id";
 
 class InferenceResource;
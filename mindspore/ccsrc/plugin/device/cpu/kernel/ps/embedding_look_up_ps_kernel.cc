@@ -18,6 +18,8 @@
 #include <vector>
 #include <memory>
 #include <functional>
+#include <algorithm>
+#include <atomic>
 #include "kernel/common_utils.h"
 #include "ps/util.h"
 
@@ -27,6 +29,8 @@ namespace ps {
 using mindspore::ps::Util;
 constexpr int kAxis = 0;
 constexpr size_t kEmbeddingLookUpPSInputSize = 3;
+// The element number from which the embedding rows are updated by multiple threads.
+constexpr size_t kParallelUpdateSize = 65536;
 
 void EmbeddingLookUpPSKernelMod::InitKernel(const std::shared_ptr<std::vector<std::shared_ptr<ShapeVector>>> &shapes) {
   const std::vector<std::shared_ptr<ShapeVector>> &shape_vec = *shapes;
@@ -89,17 +93,42 @@ void EmbeddingLookUpPSKernelMod::UpdateEmbeddings(float *embedding_table, const
                                                   const float *update_vals, size_t ids_size) {
   size_t copy_len = outer_dim_size_ * sizeof(float);
   size_t dest_len = copy_len;
+  // The rows of the large update are copied in parallel, unless the ids are duplicated and the last row must win.
+  bool parallel = ids_size * outer_dim_size_ >= kParallelUpdateSize;
+  std::vector<bool> updated(parallel ? first_dim_size_ : 0, false);
   for (size_t i = 0; i < ids_size; ++i) {
     int index = SizeToInt(lookup_ids[i]) - LongToInt(offset_);
     if (index < 0 || index >= SizeToInt(first_dim_size_)) {
       MS_LOG(EXCEPTION) << "UpdateEmbeddings index invalid.";
     }
-    auto ret = memcpy_s(embedding_table + IntToSize(index) * outer_dim_size_, dest_len,
-                        update_vals + i * outer_dim_size_, copy_len);
-    if (ret != EOK) {
-      MS_LOG(EXCEPTION) << "LookUpTable task memcpy failed.";
+    if (parallel) {
+      parallel = !updated[IntToSize(index)];
+      updated[IntToSize(index)] = true;
     }
   }
+
+  std::atomic_bool copy_success{true};
+  auto task = [&](size_t start, size_t end) {
+    for (size_t i = start; i < end; ++i) {
+      size_t index = IntToSize(SizeToInt(lookup_ids[i]) - LongToInt(offset_));
+      auto ret = memcpy_s(embedding_table + index * outer_dim_size_, dest_len, update_vals + i * outer_dim_size_,
+                          copy_len);
+      if (ret != EOK) {
+        copy_success = false;
+        return;
+      }
+    }
+  };
+  if (parallel) {
+    size_t row_size = std::max(outer_dim_size_, static_cast<size_t>(1));
+    float block_size = static_cast<float>(std::max(kParallelUpdateSize / row_size, static_cast<size_t>(1)));
+    CPUKernelUtils::ParallelFor(task, ids_size, block_size);
+  } else {
+    task(0, ids_size);
+  }
+  if (!copy_success) {
+    MS_LOG(EXCEPTION) << "LookUpTable task memcpy failed.";
+  }
 }
 
 const std::vector<size_t> &EmbeddingLookUpPSKernelMod::input_sizes() const { return input_shape_; }
@@ -95,6 +95,10 @@ constexpr char kNodeId[] = "node_id";
 constexpr char kSuccessCode[] = "0";
 constexpr char kErrorCode[] = "1";
 
+// The response of a request which the server fails to handle. A serialized protobuf message never starts with a zero
+// byte, so it is told apart from the response data and from the empty response of a successful push.
+constexpr unsigned char kFailedResponse = 0;
+
 constexpr int64_t kSubmitTaskIntervalInMs = 1;
 constexpr int64_t kMaxTaskNum = 10240;
 constexpr int64_t kSubmitTimeOutInMs = 30000;
@@ -22,7 +22,6 @@ namespace core {
 TaskExecutor::TaskExecutor(size_t thread_num, size_t max_task_num, size_t submit_timeout)
     : running_(true),
       thread_num_(thread_num),
-      idle_thread_num_(0),
       submit_timeout_(submit_timeout),
       max_task_num_(max_task_num),
       task_num_(0) {
@@ -30,46 +29,21 @@ TaskExecutor::TaskExecutor(size_t thread_num, size_t max_task_num, size_t submit
     working_threads_.emplace_back([this]() {
       std::function<void()> task;
       while (true) {
-        std::unique_lock<std::mutex> lock(mtx_);
-        // Idle thread number increases when the mtx_ is locked.
-        idle_thread_num_++;
-
-        if (!running_) {
-          // To avoid thread from blocking after destructor.
-          return;
-        }
-
-        cv_.wait(lock);
-
-        if (!running_ || task_queue_.empty()) {
-          return;
-        }
-
-        task = task_queue_.front();
-        task_queue_.pop();
-        if (lock.owns_lock()) {
-          lock.unlock();
+        {
+          // The submission wakes up one working thread directly, so the task runs without the polling delay.
+          std::unique_lock<std::mutex> lock(mtx_);
+          cv_.wait(lock, [this]() { return !running_ || !task_queue_.empty(); });
+          if (!running_) {
+            return;
+          }
+          task = std::move(task_queue_.front());
+          task_queue_.pop();
+          task_num_--;
         }
-
         task();
       }
     });
   }
-  notify_thread_ = std::thread([this]() {
-    // If there is no idle thread, wait until the working thread is available.
-    while (running_) {
-      {
-        std::unique_lock<std::mutex> lock(mtx_);
-        if (idle_thread_num_ > 0 && task_num_ > 0) {
-          idle_thread_num_--;
-          task_num_--;
-          lock.unlock();
-          cv_.notify_one();
-        }
-      }
-      std::this_thread::sleep_for(std::chrono::milliseconds(kSubmitTaskIntervalInMs));
-    }
-  });
 }
 
 TaskExecutor::~TaskExecutor() {
@@ -81,7 +55,6 @@ TaskExecutor::~TaskExecutor() {
   for (auto &t : working_threads_) {
     t.join();
   }
-  notify_thread_.join();
 }
 }  // namespace core
 }  // namespace ps
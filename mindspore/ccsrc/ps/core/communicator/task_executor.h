@@ -66,9 +66,12 @@ class TaskExecutor {
       MS_LOG(WARNING) << "Submit task failed after " << submit_timeout_ << " ms.";
       return false;
     }
-    std::unique_lock<std::mutex> lock(mtx_);
-    task_num_++;
-    task_queue_.push(task);
+    {
+      std::unique_lock<std::mutex> lock(mtx_);
+      task_num_++;
+      task_queue_.push(task);
+    }
+    cv_.notify_one();
     return true;
   }
 
@@ -77,8 +80,6 @@ class TaskExecutor {
 
   // The number of tasks actually running
   size_t thread_num_;
-  // The number of idle threads that can execute tasks
-  size_t idle_thread_num_;
 
   // The timeout period of the task submission, in milliseconds. default timeout is 3000 milliseconds.
   size_t submit_timeout_;
@@ -90,7 +91,6 @@ class TaskExecutor {
   // The number of currently submitted to the task queue
   size_t task_num_;
 
-  std::thread notify_thread_;
   std::mutex mtx_;
   std::condition_variable cv_;
 
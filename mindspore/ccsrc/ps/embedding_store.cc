@@ -0,0 +1,251 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ps/embedding_store.h"
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#include <algorithm>
+#include <atomic>
+#include <cstdio>
+#include <iterator>
+#include "distributed/persistent/storage/file_io_utils.h"
+#include "utils/log_adapter.h"
+
+namespace mindspore {
+namespace ps {
+namespace {
+// The advice range of the pages covering the bytes for reading, or the pages inside the bytes for dropping, so the
+// pages shared with the adjacent blocks are not dropped.
+bool PageRange(size_t begin, size_t end, size_t page_size, bool inside, size_t *page_begin, size_t *page_end) {
+  if (inside) {
+    *page_begin = (begin + page_size - 1) / page_size * page_size;
+    *page_end = end / page_size * page_size;
+  } else {
+    *page_begin = begin / page_size * page_size;
+    *page_end = (end + page_size - 1) / page_size * page_size;
+  }
+  return *page_end > *page_begin;
+}
+}  // namespace
+
+EmbeddingStore::EmbeddingStore(const std::string &dir, const Key &key, size_t row_num, size_t row_size,
+                               size_t cache_size)
+    : dir_(dir), key_(key), row_num_(row_num), row_size_(row_size), cache_size_(cache_size) {
+  if (row_num_ == 0 || row_size_ == 0) {
+    MS_LOG(EXCEPTION) << "The shape of embedding table " << key_ << " is empty.";
+  }
+  size_t row_bytes = row_size_ * sizeof(float);
+  rows_per_block_ = std::max(kEmbeddingBlockSize / row_bytes, static_cast<size_t>(1));
+  block_num_ = (row_num_ + rows_per_block_ - 1) / rows_per_block_;
+  slot_bytes_ = row_num_ * row_bytes;
+  page_size_ = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+  lru_positions_.resize(block_num_);
+  cached_.resize(block_num_, false);
+  // The servers on one host share the storage path, so the block files are named by the process id and the store id to
+  // avoid truncating and removing the files of other stores.
+  static std::atomic<size_t> store_id_counter{0};
+  file_prefix_ = dir_ + "/embedding_" + std::to_string(getpid()) + "_" + std::to_string(store_id_counter.fetch_add(1)) +
+                 "_" + std::to_string(key_) + "_";
+  if (!distributed::storage::FileIOUtils::IsFileOrDirExist(dir_)) {
+    distributed::storage::FileIOUtils::CreateDirRecursive(dir_);
+  }
+  evict_thread_ = std::thread(&EmbeddingStore::EvictLoop, this);
+  MS_LOG(INFO) << "The embedding table " << key_ << " is stored in " << dir_ << ", the block number: " << block_num_
+               << ", the cache size: " << cache_size_;
+}
+
+EmbeddingStore::~EmbeddingStore() {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    running_ = false;
+  }
+  evict_cv_.notify_one();
+  if (evict_thread_.joinable()) {
+    evict_thread_.join();
+  }
+  for (auto &slot : slots_) {
+    (void)munmap(slot.data, slot_bytes_);
+    (void)close(slot.fd);
+    (void)std::remove(slot.file_name.c_str());
+  }
+}
+
+float *EmbeddingStore::AllocSlot() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  Slot slot;
+  slot.file_name = file_prefix_ + std::to_string(slots_.size()) + ".bin";
+  slot.fd = open(slot.file_name.c_str(), O_RDWR | O_CREAT | O_TRUNC, S_IRUSR | S_IWUSR);
+  if (slot.fd < 0) {
+    MS_LOG(EXCEPTION) << "Open the embedding block file " << slot.file_name << " failed.";
+  }
+  // The file extended by truncating is filled with zero, and the blocks are allocated on disk when written.
+  if (ftruncate(slot.fd, static_cast<off_t>(slot_bytes_)) != 0) {
+    (void)close(slot.fd);
+    MS_LOG(EXCEPTION) << "Extend the embedding block file " << slot.file_name << " to " << slot_bytes_
+                      << " bytes failed.";
+  }
+  void *addr = mmap(nullptr, slot_bytes_, PROT_READ | PROT_WRITE, MAP_SHARED, slot.fd, 0);
+  if (addr == MAP_FAILED) {
+    (void)close(slot.fd);
+    MS_LOG(EXCEPTION) << "Map the embedding block file " << slot.file_name << " failed.";
+  }
+  slot.data = static_cast<float *>(addr);
+  slots_.push_back(slot);
+  return slot.data;
+}
+
+void EmbeddingStore::Prefetch(const int *ids, size_t id_num, int64_t offset) {
+  MS_EXCEPTION_IF_NULL(ids);
+  std::vector<size_t> blocks;
+  blocks.reserve(id_num);
+  for (size_t i = 0; i < id_num; ++i) {
+    int64_t row = static_cast<int64_t>(ids[i]) - offset;
+    if (row >= 0 && static_cast<size_t>(row) < row_num_) {
+      blocks.push_back(static_cast<size_t>(row) / rows_per_block_);
+    }
+  }
+  std::sort(blocks.begin(), blocks.end());
+  blocks.erase(std::unique(blocks.begin(), blocks.end()), blocks.end());
+
+  std::vector<size_t> reading_blocks;
+  std::vector<Slot> slots;
+  bool evict = false;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (slots_.empty()) {
+      return;
+    }
+    for (auto block : blocks) {
+      if (cached_[block]) {
+        lru_blocks_.splice(lru_blocks_.begin(), lru_blocks_, lru_positions_[block]);
+        continue;
+      }
+      cached_[block] = true;
+      lru_blocks_.push_front(block);
+      lru_positions_[block] = lru_blocks_.begin();
+      reading_blocks.push_back(block);
+    }
+    // The blocks of this batch are always kept, even if they exceed the cache size.
+    size_t block_bytes = rows_per_block_ * row_size_ * sizeof(float) * slots_.size();
+    size_t cache_block_num = std::max(cache_size_ / block_bytes, blocks.size());
+    while (lru_blocks_.size() > cache_block_num) {
+      auto block = lru_blocks_.back();
+      lru_blocks_.pop_back();
+      cached_[block] = false;
+      evicting_blocks_.push_back(block);
+      evict = true;
+    }
+    slots = slots_;
+  }
+  if (evict) {
+    evict_cv_.notify_one();
+  }
+
+  // The adjacent blocks are read by one request, and the reading is asynchronous.
+  size_t row_bytes = row_size_ * sizeof(float);
+  for (size_t i = 0; i < reading_blocks.size();) {
+    size_t j = i;
+    while (j + 1 < reading_blocks.size() && reading_blocks[j + 1] == reading_blocks[j] + 1) {
+      ++j;
+    }
+    size_t begin = reading_blocks[i] * rows_per_block_ * row_bytes;
+    size_t end = std::min((reading_blocks[j] + 1) * rows_per_block_, row_num_) * row_bytes;
+    size_t page_begin = 0;
+    size_t page_end = 0;
+    if (PageRange(begin, end, page_size_, false, &page_begin, &page_end)) {
+      for (const auto &slot : slots) {
+        (void)madvise(reinterpret_cast<char *>(slot.data) + page_begin, page_end - page_begin, MADV_WILLNEED);
+      }
+    }
+    i = j + 1;
+  }
+}
+
+void EmbeddingStore::EvictBlocks(const std::vector<size_t> &blocks) {
+  std::vector<Slot> slots;
+  std::vector<size_t> evicting_blocks;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    slots = slots_;
+    // The block prefetched again after it is selected isn't dropped.
+    (void)std::copy_if(blocks.begin(), blocks.end(), std::back_inserter(evicting_blocks),
+                       [this](size_t block) { return !cached_[block]; });
+  }
+  size_t row_bytes = row_size_ * sizeof(float);
+  for (auto block : evicting_blocks) {
+    size_t begin = block * rows_per_block_ * row_bytes;
+    size_t end = std::min((block + 1) * rows_per_block_, row_num_) * row_bytes;
+    size_t page_begin = 0;
+    size_t page_end = 0;
+    if (!PageRange(begin, end, page_size_, true, &page_begin, &page_end)) {
+      continue;
+    }
+    for (const auto &slot : slots) {
+      char *addr = reinterpret_cast<char *>(slot.data) + page_begin;
+      size_t length = page_end - page_begin;
+      // The dirty pages are written back before dropped, so the rows are read from the file next time.
+      if (msync(addr, length, MS_SYNC) != 0) {
+        MS_LOG(WARNING) << "Write back the block " << block << " of embedding table " << key_ << " failed.";
+        continue;
+      }
+      (void)madvise(addr, length, MADV_DONTNEED);
+      (void)posix_fadvise(slot.fd, static_cast<off_t>(page_begin), static_cast<off_t>(length), POSIX_FADV_DONTNEED);
+    }
+  }
+}
+
+void EmbeddingStore::EvictLoop() {
+  while (true) {
+    std::vector<size_t> blocks;
+    {
+      std::unique_lock<std::mutex> lock(mutex_);
+      evict_cv_.wait(lock, [this] { return !running_ || !evicting_blocks_.empty(); });
+      if (!running_) {
+        return;
+      }
+      blocks.swap(evicting_blocks_);
+    }
+    EvictBlocks(blocks);
+  }
+}
+
+void EmbeddingStore::Release() {
+  std::vector<Slot> slots;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (auto block : lru_blocks_) {
+      cached_[block] = false;
+    }
+    lru_blocks_.clear();
+    slots = slots_;
+  }
+  for (const auto &slot : slots) {
+    if (msync(slot.data, slot_bytes_, MS_SYNC) != 0) {
+      MS_LOG(WARNING) << "Write back the embedding block file " << slot.file_name << " failed.";
+      continue;
+    }
+    (void)madvise(slot.data, slot_bytes_, MADV_DONTNEED);
+    (void)posix_fadvise(slot.fd, 0, static_cast<off_t>(slot_bytes_), POSIX_FADV_DONTNEED);
+  }
+}
+
+size_t EmbeddingStore::cached_block_num() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return lru_blocks_.size();
+}
+}  // namespace ps
+}  // namespace mindspore
@@ -0,0 +1,104 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef MINDSPORE_CCSRC_PS_EMBEDDING_STORE_H_
+#define MINDSPORE_CCSRC_PS_EMBEDDING_STORE_H_
+
+#include <condition_variable>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include "ps/constants.h"
+
+namespace mindspore {
+namespace ps {
+// The bytes of rows in one block, which is the unit of paging in and evicting.
+constexpr size_t kEmbeddingBlockSize = 256 << 10;
+
+// The embedding store keeps the embedding table and the optimizer states of the same shape in the block files on disk,
+// and only the hot blocks are kept in memory, so the server can host the tables larger than its memory.
+// Every slot(the table or one optimizer state) is a file mapped into memory, so the kernels access the rows by the
+// contiguous address as before. The lookups and the optimizer updates prefetch the blocks of their rows, the blocks
+// not in memory are read asynchronously in batch by coalescing the adjacent blocks, and the least recently used blocks
+// exceeding the cache size are written back and dropped from memory by the evicting thread.
+class EmbeddingStore {
+ public:
+  EmbeddingStore(const std::string &dir, const Key &key, size_t row_num, size_t row_size, size_t cache_size);
+  ~EmbeddingStore();
+
+  // Create a slot of the table shape in the block files, and the memory is filled with zero.
+  float *AllocSlot();
+  // Page in the blocks of rows in all slots before the rows are accessed, the id minus the offset is the row index.
+  void Prefetch(const int *ids, size_t id_num, int64_t offset = 0);
+  // Write back and drop all the blocks from memory, which is used after the table is initialized.
+  void Release();
+
+  size_t cached_block_num();
+
+ private:
+  struct Slot {
+    int fd;
+    float *data;
+    std::string file_name;
+  };
+
+  void EvictBlocks(const std::vector<size_t> &blocks);
+  void EvictLoop();
+
+  std::string dir_;
+  // The prefix of the block file names, which is unique among the stores on one host.
+  std::string file_prefix_;
+  Key key_;
+  size_t row_num_;
+  size_t row_size_;
+  size_t cache_size_;
+  size_t rows_per_block_;
+  size_t block_num_;
+  size_t slot_bytes_;
+  size_t page_size_;
+
+  std::mutex mutex_;
+  std::vector<Slot> slots_;
+  // The blocks in memory, the most recently used block is at the front.
+  std::list<size_t> lru_blocks_;
+  std::vector<std::list<size_t>::iterator> lru_positions_;
+  std::vector<bool> cached_;
+
+  std::condition_variable evict_cv_;
+  std::vector<size_t> evicting_blocks_;
+  bool running_{true};
+  std::thread evict_thread_;
+};
+
+// The weight whose memory is the table slot of the embedding store.
+class TieredWeight : public Weight {
+ public:
+  TieredWeight(const std::shared_ptr<EmbeddingStore> &store, size_t size,
+               const std::shared_ptr<std::vector<int>> &shape = nullptr)
+      : Weight(store->AllocSlot(), size, shape), store_(store) {}
+  ~TieredWeight() override = default;
+
+  const std::shared_ptr<EmbeddingStore> &store() const { return store_; }
+
+ private:
+  std::shared_ptr<EmbeddingStore> store_;
+};
+}  // namespace ps
+}  // namespace mindspore
+#endif  // MINDSPORE_CCSRC_PS_EMBEDDING_STORE_H_
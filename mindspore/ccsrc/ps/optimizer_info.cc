@@ -23,6 +23,22 @@
 
 namespace mindspore {
 namespace ps {
+namespace {
+// The element number from which the dense gradients are accumulated by multiple threads.
+constexpr float kParallelAccumBlockSize = 65536.0;
+
+void ParallelCompute(const kernel::CTask &task, size_t size) {
+  if (size == 0) {
+    return;
+  }
+  if (static_cast<float>(size) < kParallelAccumBlockSize) {
+    task(0, size);
+  } else {
+    kernel::CPUKernelUtils::ParallelFor(task, size, kParallelAccumBlockSize);
+  }
+}
+}  // namespace
+
 void OptimizerInfo::AddWorkspace(const AddressPtr &workspace) {
   MS_EXCEPTION_IF_NULL(workspace);
   workspaces_.push_back(workspace);
@@ -93,9 +109,13 @@ void DenseOptimInfo::Accumulate(const Values &values, const Lengths &lengths) {
 #define google mindspore_private
   CHECK_EQ(size, IntToSize(lengths[grad_index]));
 #undef google
-  for (size_t i = 0; i < size; i++) {
-    accum_grad_data[i] += grad_data[i];
-  }
+  ParallelCompute(
+    [accum_grad_data, grad_data](size_t start, size_t end) {
+      for (size_t i = start; i < end; i++) {
+        accum_grad_data[i] += grad_data[i];
+      }
+    },
+    size);
 }
 
 void DenseOptimInfo::ComputeMean(const std::vector<ShapeVector> &, size_t n, size_t, size_t) {
@@ -103,9 +123,13 @@ void DenseOptimInfo::ComputeMean(const std::vector<ShapeVector> &, size_t n, siz
     MS_EXCEPTION_IF_NULL(gradient()->addr);
     float *accum_grad_data = reinterpret_cast<float *>(gradient()->addr);
     size_t size = gradient()->size / sizeof(float);
-    for (size_t i = 0; i < size; i++) {
-      accum_grad_data[i] /= n;
-    }
+    ParallelCompute(
+      [accum_grad_data, n](size_t start, size_t end) {
+        for (size_t i = start; i < end; i++) {
+          accum_grad_data[i] /= n;
+        }
+      },
+      size);
   }
 }
 
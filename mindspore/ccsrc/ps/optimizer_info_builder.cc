@@ -18,7 +18,9 @@
 #include <vector>
 #include <memory>
 #include <functional>
+#include <algorithm>
 #include "plugin/device/cpu/kernel/ps/sparse_apply_ftrl_ps_kernel.h"
+#include "ps/embedding_store.h"
 
 namespace mindspore {
 namespace ps {
@@ -52,6 +54,23 @@ void OptimizerInfoBuilder::BuildWorkspaces(OptimizerInfo *info, const std::vecto
   }
 }
 
+float *OptimizerInfoBuilder::AllocStateMemory(const WeightPtr &weight, float init_value) const {
+  MS_EXCEPTION_IF_NULL(weight);
+  auto tiered_weight = std::dynamic_pointer_cast<TieredWeight>(weight);
+  if (tiered_weight != nullptr) {
+    // The slot of embedding store is filled with zero already.
+    float *state = tiered_weight->store()->AllocSlot();
+    if (init_value != 0.0f) {
+      std::fill(state, state + weight->size(), init_value);
+      tiered_weight->store()->Release();
+    }
+    return state;
+  }
+  float *state = new float[weight->size()];
+  std::fill(state, state + weight->size(), init_value);
+  return state;
+}
+
 template <typename T>
 AddressPtr OptimizerInfoBuilder::GenInputAddrPtr(const std::string &optim_type, const std::string &input_name,
                                                  void *ps_data, const Lengths &ps_lens,
@@ -154,32 +173,16 @@ OptimizerInfo *SparseAdamOptimInfoBuilder::BuildInputs(const WeightPtr &weight,
   AddressPtr m = std::make_shared<kernel::Address>();
   MS_EXCEPTION_IF_NULL(m);
 
-  m->addr = new float[weight->size()];
+  m->addr = AllocStateMemory(weight, 0.0f);
   MS_EXCEPTION_IF_NULL(m->addr);
   m->size = weight->size() * sizeof(float);
-  int64_t ret = memset_s(m->addr, m->size, 0x00, m->size);
-  if (ret != 0) {
-    MS_LOG(EXCEPTION) << "memset_s error, errorno(" << ret << ")";
-    delete[] reinterpret_cast<float *>(m->addr);
-    m->addr = nullptr;
-    return nullptr;
-  }
 
   AddressPtr v = std::make_shared<kernel::Address>();
   MS_EXCEPTION_IF_NULL(v);
 
-  v->addr = new float[weight->size()];
+  v->addr = AllocStateMemory(weight, 0.0f);
   MS_EXCEPTION_IF_NULL(v->addr);
   v->size = weight->size() * sizeof(float);
-  ret = memset_s(v->addr, v->size, 0x00, v->size);
-  if (ret != 0) {
-    MS_LOG(EXCEPTION) << "memset_s error, errorno(" << ret << ")";
-    delete[] reinterpret_cast<float *>(v->addr);
-    v->addr = nullptr;
-    delete[] reinterpret_cast<float *>(m->addr);
-    m->addr = nullptr;
-    return nullptr;
-  }
 
   AddressPtr beta1_power = GenInputAddrPtr<float>(kSparseAdam, "beta1_power", const_cast<float *>(values.data()), lens);
   MS_EXCEPTION_IF_NULL(beta1_power);
@@ -215,27 +218,18 @@ OptimizerInfo *SparseFtrlOptimInfoBuilder::BuildInputs(const WeightPtr &weight,
   AddressPtr accum = std::make_shared<kernel::Address>();
   MS_EXCEPTION_IF_NULL(accum);
 
-  accum->addr = new float[weight->size()];
+  auto ftrl_kernel = std::dynamic_pointer_cast<SparseApplyFtrlPSKernelMod>(pserver_kernel);
+  MS_EXCEPTION_IF_NULL(ftrl_kernel);
+  accum->addr = AllocStateMemory(weight, ftrl_kernel->init_accum());
   MS_EXCEPTION_IF_NULL(accum->addr);
   accum->size = weight->size() * sizeof(float);
-  for (size_t i = 0; i < weight->size(); i++) {
-    float *tmp = reinterpret_cast<float *>(accum->addr);
-    tmp[i] = std::dynamic_pointer_cast<SparseApplyFtrlPSKernelMod>(pserver_kernel)->init_accum();
-  }
 
   AddressPtr linear = std::make_shared<kernel::Address>();
   MS_EXCEPTION_IF_NULL(linear);
 
-  linear->addr = new float[weight->size()];
+  linear->addr = AllocStateMemory(weight, 0.0f);
   MS_EXCEPTION_IF_NULL(linear->addr);
   linear->size = weight->size() * sizeof(float);
-  int64_t ret = memset_s(linear->addr, weight->size() * sizeof(float), 0x00, weight->size() * sizeof(float));
-  if (ret != 0) {
-    MS_LOG(EXCEPTION) << "memset_s error, errorno(" << ret << ")";
-    delete[] reinterpret_cast<float *>(linear->addr);
-    linear->addr = nullptr;
-    return nullptr;
-  }
 
   AddressPtr grad = GenInputAddrPtr<float>(kSparseFtrl, "grad", const_cast<float *>(values.data()), lens, inputs_shape);
   MS_EXCEPTION_IF_NULL(grad);
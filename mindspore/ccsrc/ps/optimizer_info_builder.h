@@ -48,6 +48,8 @@ class OptimizerInfoBuilder {
   template <typename T>
   AddressPtr GenInputAddrPtr(const std::string &optim_type, const std::string &input_name, void *ps_data,
                              const Lengths &lens, const InputsShapePtr &inputs_shape = nullptr);
+  // Allocate the optimizer state of the weight shape, which is stored with the table if the weight is on disk.
+  float *AllocStateMemory(const WeightPtr &weight, float init_value) const;
 
   size_t worker_num_;
 };
@@ -20,6 +20,8 @@
 #include <set>
 
 #include "utils/file_utils.h"
+#include "ps/push_compressor.h"
+#include "ps/embedding_store.h"
 
 namespace mindspore {
 namespace ps {
@@ -59,15 +61,23 @@ void ParameterServer::Run(const FuncGraphPtr &func_graph) {
   if (!server_node_->Stop()) {
     MS_LOG(WARNING) << "Parameter server stop failed.";
   }
+  handler_executor_ = nullptr;
   MS_LOG(INFO) << "PServer finalized successfully.";
 }
 
 bool ParameterServer::Init(const FuncGraphPtr &func_graph) {
   pserver_num_ = std::strtol(mindspore::common::GetEnv(kEnvPServerNum).c_str(), nullptr, kBase);
   worker_num_ = std::strtol(mindspore::common::GetEnv(kEnvWorkerNum).c_str(), nullptr, kBase);
+  staleness_bound_ = PSContext::instance()->staleness_bound();
+  if (EnableBoundedStaleness()) {
+    MS_LOG(INFO) << "Parameter server runs in the bounded staleness mode, the staleness bound is " << staleness_bound_;
+  }
+  weight_clock_ = std::make_unique<WeightClock>(worker_num_, staleness_bound_);
   func_graph_ = func_graph;
   handler_.reset(new ServerHandler(this));
   handler_->Init();
+  size_t handler_thread_num = std::max(IntToSize(1), static_cast<size_t>(std::min(kMaxThreadNum, kCPUCoreNum)));
+  handler_executor_ = std::make_unique<core::TaskExecutor>(handler_thread_num);
 
   recover_handler_ = std::make_unique<RecoverHandler>(this);
 
@@ -170,8 +180,10 @@ void ParameterServer::InitWeight(const Key &key, const WeightPtr &weight) {
   if ((weights_.count(key) == 0) || (is_embedding_[key] && weights_.count(key) != 0)) {
     MS_LOG(INFO) << "Initializing weight for key " << key << ", server rank " << server_node_->rank_id();
     weights_[key] = weight;
-    tokens_[key] = 0;
     is_embedding_[key] = false;
+    // The requests only access the initialized keys of optimizer infos, so the entry is created here.
+    (void)optim_infos_.emplace(key, nullptr);
+    weight_clock_->AddWeight(key);
   }
 }
 
@@ -179,7 +191,7 @@ void ParameterServer::InitGrad(const Key &key, const GradPtr &grad) {
   MS_EXCEPTION_IF_NULL(grad);
   if (grads_.count(key) == 0) {
     grads_[key] = grad;
-    grads_accum_counter_[key] = 0;
+    weight_clock_->AddGrad(key);
   }
 }
 
@@ -312,6 +324,9 @@ void ParameterServer::PersistInitParameters(const Key &key, const WeightPtr &par
   MS_EXCEPTION_IF_NULL(persistent_weight);
   std::map<std::string, std::string> config_map;
   config_map[distributed::storage::kFileStoragePath] = real_storage_file_path;
+  if (PSContext::instance()->incremental_checkpoint()) {
+    config_map[distributed::storage::kIncrementalPersist] = "true";
+  }
   persistent_weight->Initialize(config_map);
 
   (void)weights_dirty_info_.emplace(key, distributed::storage::DirtyInfo());
@@ -349,8 +364,7 @@ void ParameterServer::InitEmbeddingTable(const Key &key,
     (void)std::transform(input_shapes.begin(), input_shapes.end(), std::back_inserter(*embedding_shape),
                          [](size_t dim) { return static_cast<int>(dim); });
 
-    WeightPtr embedding =
-      Util::MakeWeightPtr(std::make_shared<std::vector<float>>(total_dims, 0), EnableRecovery(), embedding_shape);
+    WeightPtr embedding = CreateEmbeddingWeight(key, input_shapes, embedding_shape);
     MS_EXCEPTION_IF_NULL(embedding);
     float *embedding_data = embedding->data();
 
@@ -379,13 +393,41 @@ void ParameterServer::InitEmbeddingTable(const Key &key,
     }
 
     PersistInitParameters(key, embedding);
+    auto tiered_weight = std::dynamic_pointer_cast<TieredWeight>(embedding);
+    if (tiered_weight != nullptr) {
+      tiered_weight->store()->Release();
+    }
 
     weights_[key] = embedding;
-    MS_LOG(DEBUG) << "The key:" << key << " the embedding:" << *(embedding->MutableData());
-    tokens_[key] = 0;
+    MS_LOG(DEBUG) << "The key:" << key << " the embedding size:" << embedding->size();
     is_embedding_[key] = true;
+    (void)optim_infos_.emplace(key, nullptr);
+    weight_clock_->AddWeight(key);
+    weight_clock_->AddGrad(key);
+  }
+}
 
-    grads_accum_counter_[key] = 0;
+WeightPtr ParameterServer::CreateEmbeddingWeight(const Key &key, const std::vector<size_t> &input_shapes,
+                                                 const std::shared_ptr<std::vector<int>> &embedding_shape) {
+  size_t total_dims =
+    std::accumulate(input_shapes.begin(), input_shapes.end(), IntToSize(1), std::multiplies<size_t>());
+  const std::string &storage_path = PSContext::instance()->embedding_storage_path();
+  if (!storage_path.empty() && EnableRecovery()) {
+    MS_LOG(WARNING) << "The embedding table " << key << " isn't stored on disk in the disaster recovery mode.";
+  }
+  if (storage_path.empty() || EnableRecovery() || input_shapes.empty() || total_dims == 0) {
+    return Util::MakeWeightPtr(std::make_shared<std::vector<float>>(total_dims, 0), EnableRecovery(), embedding_shape);
+  }
+  size_t row_num = input_shapes.front();
+  size_t cache_size = static_cast<size_t>(PSContext::instance()->embedding_cache_size()) * kMBToByte;
+  auto store = std::make_shared<EmbeddingStore>(storage_path, key, row_num, total_dims / row_num, cache_size);
+  return std::make_shared<TieredWeight>(store, total_dims, embedding_shape);
+}
+
+void ParameterServer::PrefetchEmbeddingRows(const WeightPtr &weight, const int *ids, size_t id_num, int64_t offset) {
+  auto tiered_weight = std::dynamic_pointer_cast<TieredWeight>(weight);
+  if (tiered_weight != nullptr) {
+    tiered_weight->store()->Prefetch(ids, id_num, offset);
   }
 }
 
@@ -393,7 +435,9 @@ bool ParameterServer::HasWeight(const Key &key) { return (weights_.count(key) >
 
 void ParameterServer::Finalize() {
   running_ = false;
-  apply_grads_cv_.notify_one();
+  if (weight_clock_ != nullptr) {
+    weight_clock_->Stop();
+  }
 
   if (persist_thread_ != nullptr && persist_thread_->joinable()) {
     persist_thread_->join();
@@ -401,96 +445,139 @@ void ParameterServer::Finalize() {
 }
 
 void ParameterServer::UpdateWeights() {
-  while (true) {
-    MS_LOG(INFO) << "The running is:" << running_ << " the ready is:" << this->ReadyForUpdateWeights();
-    std::unique_lock<std::mutex> lock(mutex_);
-    apply_grads_cv_.wait(lock, [this] { return this->ReadyForUpdateWeights() || !running_; });
-    if (!running_) {
-      break;
-    }
-
+  MS_EXCEPTION_IF_NULL(weight_clock_);
+  while (weight_clock_->WaitForUpdate()) {
+    // Only the key being updated is locked, so the weights updated already can be pulled and the embedding tables of
+    // other keys can be looked up during the update.
+    std::shared_lock<std::shared_mutex> lock(mutex_);
     for (auto iter = weights_.begin(); iter != weights_.end(); iter++) {
       Key key = iter->first;
-      WeightPtr weight_ptr = iter->second;
-
-      std::shared_ptr<PServerKernel> optimizer = nullptr;
-      if (weight_key_to_optims_.count(key) > 0) {
-        optimizer = optimizers_[key];
-      }
-      MS_EXCEPTION_IF_NULL(optimizer);
-
-      std::shared_ptr<OptimizerInfo> optim_info = optim_infos_[key];
-      if (optim_info != nullptr) {
-        const std::vector<kernel::AddressPtr> &inputs = optim_info->inputs();
-        const std::vector<kernel::AddressPtr> &workspaces = optim_info->workspaces();
-        const std::vector<kernel::AddressPtr> &outputs = optim_info->outputs();
-
-        std::vector<ShapeVector> shapes = {};
-        ShapeVector indices_shape = {};
-        indices_shape.emplace_back(SizeToLong(optim_info->indice_size()));
-        shapes.push_back(indices_shape);
-
-        if (original_optim_inputs_shape_.count(key) != 0) {
-          std::transform((*(original_optim_inputs_shape_[key])).begin(), (*(original_optim_inputs_shape_[key])).end(),
-                         std::back_inserter(shapes),
-                         [](const std::shared_ptr<ShapeVector> &input_shapes) -> ShapeVector { return *input_shapes; });
-        }
-        optimizer->ReInit(shapes);
-        optim_info->ComputeMean(shapes, worker_num_, pserver_num_, server_node_->rank_id());
-        optimizer->Execute(inputs, workspaces, outputs);
-        optim_info->Reset();
-      }
-      if (!is_embedding_[key]) {
-        tokens_[key] = worker_num_;
+      std::unique_lock<std::mutex> key_lock(key_mutex(key));
+      size_t grad_num = weight_clock_->GradNumToApply(key);
+      if (grad_num == 0) {
+        continue;
       }
+      ApplyGradients(key, grad_num);
+      auto embedding_iter = is_embedding_.find(key);
+      weight_clock_->Applied(key, embedding_iter == is_embedding_.end() || !embedding_iter->second);
     }
-    ResetGradAccumCount();
+    lock.unlock();
+    weight_clock_->FinishUpdate();
   }
 }
 
-void ParameterServer::AccumGrad(const Keys &keys, const Values &values, const Lengths &lengths) {
-  std::unique_lock<std::mutex> lock(mutex_);
+void ParameterServer::ApplyGradients(const Key &key, size_t grad_num) {
+  std::shared_ptr<PServerKernel> optimizer = nullptr;
+  if (weight_key_to_optims_.count(key) > 0) {
+    auto optimizer_iter = optimizers_.find(key);
+    optimizer = optimizer_iter != optimizers_.end() ? optimizer_iter->second : nullptr;
+  }
+  MS_EXCEPTION_IF_NULL(optimizer);
+
+  auto optim_info_iter = optim_infos_.find(key);
+  std::shared_ptr<OptimizerInfo> optim_info = optim_info_iter != optim_infos_.end() ? optim_info_iter->second : nullptr;
+  if (optim_info == nullptr) {
+    return;
+  }
+  const std::vector<kernel::AddressPtr> &inputs = optim_info->inputs();
+  const std::vector<kernel::AddressPtr> &workspaces = optim_info->workspaces();
+  const std::vector<kernel::AddressPtr> &outputs = optim_info->outputs();
+
+  std::vector<ShapeVector> shapes = {};
+  ShapeVector indices_shape = {};
+  indices_shape.emplace_back(SizeToLong(optim_info->indice_size()));
+  shapes.push_back(indices_shape);
+
+  auto shape_iter = original_optim_inputs_shape_.find(key);
+  if (shape_iter != original_optim_inputs_shape_.end()) {
+    std::transform((*(shape_iter->second)).begin(), (*(shape_iter->second)).end(), std::back_inserter(shapes),
+                   [](const std::shared_ptr<ShapeVector> &input_shapes) -> ShapeVector { return *input_shapes; });
+  }
+  optimizer->ReInit(shapes);
+  optim_info->ComputeMean(shapes, grad_num, pserver_num_, server_node_->rank_id());
+  // The indices are the rows of local shard after computing mean.
+  auto weight_iter = weights_.find(key);
+  if (!optim_info->IsSparse() || weight_iter == weights_.end()) {
+    optimizer->Execute(inputs, workspaces, outputs);
+    optim_info->Reset();
+    return;
+  }
+  const AddressPtr &indices = optim_info->indices();
+  MS_EXCEPTION_IF_NULL(indices);
+  int *indices_data = reinterpret_cast<int *>(indices->addr);
+  size_t indices_num = indices->size / sizeof(int);
+  PrefetchEmbeddingRows(weight_iter->second, indices_data, indices_num);
+
+  // The rows updated by the sparse optimizer are persisted in the disaster recovery mode, and the persisting task
+  // doesn't copy the rows being updated.
+  auto dirty_iter = weights_dirty_info_.end();
+  std::unique_lock<std::mutex> locker(access_weight_mutex_, std::defer_lock);
+  if (EnableRecovery()) {
+    locker.lock();
+    dirty_iter = weights_dirty_info_.find(key);
+  }
+  optimizer->Execute(inputs, workspaces, outputs);
+  if (dirty_iter != weights_dirty_info_.end()) {
+    (void)dirty_iter->second.insert(dirty_iter->second.end(), indices_data, indices_data + indices_num);
+  }
+  optim_info->Reset();
+}
+
+void ParameterServer::AccumGrad(const Keys &keys, const Values &values, const Lengths &lengths, uint32_t rank_id) {
+  std::shared_lock<std::shared_mutex> lock(mutex_);
   const Key &key = keys[0];
   bool no_sparse_grad = values.size() == 1 && values[0] == kGradValue;
-  if (!no_sparse_grad) {
-    std::shared_ptr<OptimizerInfo> optim_info = optim_infos_[key];
-
-    // Create or update the optimizer info
-    if (optim_info == nullptr) {
-      const std::shared_ptr<OptimizerInfoBuilder> &builder = optim_info_builders_[weight_key_to_optims_[key]];
-      std::shared_ptr<kernel::ps::PServerKernel> pserver_kernel = optimizers_[key];
-      if (pserver_kernel == nullptr) {
-        MS_LOG(EXCEPTION) << "no optimizer found for key " << key << " optim name " << weight_key_to_optims_[key];
+  {
+    std::unique_lock<std::mutex> key_lock(key_mutex(key));
+    if (!no_sparse_grad) {
+      auto optim_info_iter = optim_infos_.find(key);
+      if (optim_info_iter == optim_infos_.end()) {
+        MS_LOG(EXCEPTION) << "The weight of key " << key << " is not initialized.";
+      }
+      std::shared_ptr<OptimizerInfo> &optim_info = optim_info_iter->second;
+
+      // Create or update the optimizer info
+      if (optim_info == nullptr) {
+        auto optim_iter = weight_key_to_optims_.find(key);
+        auto optimizer_iter = optimizers_.find(key);
+        if (optim_iter == weight_key_to_optims_.end() || optimizer_iter == optimizers_.end() ||
+            optimizer_iter->second == nullptr) {
+          MS_LOG(EXCEPTION) << "no optimizer found for key " << key;
+        }
+        auto builder_iter = optim_info_builders_.find(optim_iter->second);
+        if (builder_iter == optim_info_builders_.end()) {
+          MS_LOG(EXCEPTION) << "no optimizer info builder found for key " << key << " optim name "
+                            << optim_iter->second;
+        }
+        const std::shared_ptr<OptimizerInfoBuilder> &builder = builder_iter->second;
+        MS_EXCEPTION_IF_NULL(builder);
+        std::shared_ptr<kernel::ps::PServerKernel> pserver_kernel = optimizer_iter->second;
+        auto shape_iter = optim_inputs_shape_.find(key);
+        InputsShapePtr inputs_shape = shape_iter != optim_inputs_shape_.end() ? shape_iter->second : nullptr;
+        auto embedding_iter = is_embedding_.find(key);
+        bool is_embedding = embedding_iter != is_embedding_.end() && embedding_iter->second;
+        OptimizerInfo *optim = builder->Build(pserver_kernel, weights_.at(key), keys, values, lengths, inputs_shape,
+                                              worker_num_, is_embedding);
+        optim_info.reset(optim);
+      } else {
+        optim_info->Update(values, lengths);
+        optim_info->Accumulate(values, lengths);
       }
-      MS_EXCEPTION_IF_NULL(pserver_kernel);
-      OptimizerInfo *optim = builder->Build(pserver_kernel, weights_[key], keys, values, lengths,
-                                            optim_inputs_shape_[key], worker_num_, is_embedding_[key]);
-      optim_info.reset(optim);
-      optim_infos_[key] = optim_info;
-    } else {
-      optim_info->Update(values, lengths);
-      optim_info->Accumulate(values, lengths);
     }
-  }
 
-  grads_accum_counter_[key] += 1;
-  if (grads_accum_counter_[key] == worker_num_) {
-    grad_accum_count_++;
-  }
-  if (ReadyForUpdateWeights()) {
-    apply_grads_cv_.notify_one();
+    // The clock is updated with the accumulated gradients in the key lock, so the update thread applies them together.
+    weight_clock_->Push(key, rank_id, !no_sparse_grad);
   }
 }
 
-WeightPtr ParameterServer::weight(const Key &key) {
-  std::unique_lock<std::mutex> lock(mutex_);
-  if (weights_.count(key) == 0) {
+void ParameterServer::CopyWeight(const Key &key, KVMessage *res) {
+  std::shared_lock<std::shared_mutex> lock(mutex_);
+  auto weight_iter = weights_.find(key);
+  if (weight_iter == weights_.end()) {
     MS_LOG(EXCEPTION) << "Invalid weight key " << key;
   }
-  WeightPtr weight_ptr = weights_[key];
-  MS_EXCEPTION_IF_NULL(weight_ptr);
-  tokens_[key] -= 1;
-  return weight_ptr;
+  CopyWeight(weight_iter->second, &key_mutex(key), res);
+  weight_clock_->Pull(key);
 }
 
 void ParameterServer::DoEmbeddingLookup(Key key, const LookupIds &lookup_ids, KVMessage *res) {
@@ -500,19 +587,23 @@ void ParameterServer::DoEmbeddingLookup(Key key, const LookupIds &lookup_ids, KV
     }
   }
 
-  std::unique_lock<std::mutex> lock(mutex_);
+  std::shared_lock<std::shared_mutex> lock(mutex_);
   MS_EXCEPTION_IF_NULL(res);
-  if (weights_.count(key) == 0) {
+  auto weight_iter = weights_.find(key);
+  if (weight_iter == weights_.end()) {
     MS_LOG(ERROR) << "Invalid embedding table key " << key;
     return;
   }
-  if (embedding_lookup_ops_.count(key) == 0) {
+  auto lookup_op_iter = embedding_lookup_ops_.find(key);
+  if (lookup_op_iter == embedding_lookup_ops_.end()) {
     MS_LOG(ERROR) << "Invalid embedding lookup op key " << key;
     return;
   }
-  WeightPtr table_ptr = weights_[key];
+  // The lookup operator is reinitialized by the shape of ids, so the lookups of one key are serial.
+  std::unique_lock<std::mutex> key_lock(key_mutex(key));
+  WeightPtr table_ptr = weight_iter->second;
   MS_EXCEPTION_IF_NULL(table_ptr);
-  std::shared_ptr<PServerKernel> table_lookup_op = embedding_lookup_ops_[key];
+  std::shared_ptr<PServerKernel> table_lookup_op = lookup_op_iter->second;
   MS_EXCEPTION_IF_NULL(table_lookup_op);
 
   // Update shapes of lookup operator
@@ -540,6 +631,7 @@ void ParameterServer::DoEmbeddingLookup(Key key, const LookupIds &lookup_ids, KV
   }
   indices->addr = tmp_ids.get();
   indices->size = lookup_ids.size() * sizeof(int);
+  PrefetchEmbeddingRows(table_ptr, tmp_ids.get(), lookup_ids.size(), table_lookup_op->offset());
 
   std::vector<kernel::AddressPtr> workspaces;
   std::vector<kernel::AddressPtr> outputs;
@@ -564,20 +656,29 @@ void ParameterServer::UpdateEmbeddings(const Key &key, const LookupIds &lookup_i
     }
   }
 
-  std::unique_lock<std::mutex> locker(access_weight_mutex_);
-
-  if (weights_.count(key) == 0) {
+  std::shared_lock<std::shared_mutex> lock(mutex_);
+  auto weight_iter = weights_.find(key);
+  if (weight_iter == weights_.end()) {
     MS_LOG(ERROR) << "Invalid embedding table key " << key;
     return;
   }
-  if (embedding_lookup_ops_.count(key) == 0) {
+  auto lookup_op_iter = embedding_lookup_ops_.find(key);
+  if (lookup_op_iter == embedding_lookup_ops_.end()) {
     MS_LOG(ERROR) << "Invalid embedding lookup op key " << key;
     return;
   }
-  WeightPtr table_ptr = weights_[key];
+  std::unique_lock<std::mutex> key_lock(key_mutex(key));
+  std::unique_lock<std::mutex> locker(access_weight_mutex_);
+  WeightPtr table_ptr = weight_iter->second;
   MS_EXCEPTION_IF_NULL(table_ptr);
-  std::shared_ptr<PServerKernel> lookup_op = embedding_lookup_ops_[key];
+  std::shared_ptr<PServerKernel> lookup_op = lookup_op_iter->second;
   MS_EXCEPTION_IF_NULL(lookup_op);
+  if (std::dynamic_pointer_cast<TieredWeight>(table_ptr) != nullptr) {
+    std::vector<int> ids(lookup_ids.size());
+    (void)std::transform(lookup_ids.begin(), lookup_ids.end(), ids.begin(),
+                         [](const Key &id) { return static_cast<int>(id); });
+    PrefetchEmbeddingRows(table_ptr, ids.data(), ids.size(), lookup_op->offset());
+  }
   lookup_op->UpdateEmbeddings(table_ptr->data(), lookup_ids.data(), vals.data(), lookup_ids.size());
 
   UpdateDirtyInfo(key, lookup_ids, lookup_op->offset());
@@ -600,33 +701,14 @@ void ParameterServer::UpdateDirtyInfo(const Key &key, const LookupIds &lookup_id
   }
 }
 
-inline bool ParameterServer::ReadyForUpdateWeights() const {
-  return grads_accum_counter_.size() > 0 && grad_accum_count_ == grads_accum_counter_.size();
-}
-
-inline bool ParameterServer::ReadyForPush(const Key &key) {
-  std::unique_lock<std::mutex> lock(mutex_);
-  if (weights_.empty()) {
-    MS_LOG(EXCEPTION) << "The weights in server is empty. Many reasons could cause this: 1.The Worker didn't send "
-                         "kInitWeightsCmd command. 2.The Server failed to initialize weights.";
-  }
-  return grad_accum_count_ < weights_.size() && tokens_[key] == 0;
-}
-
-inline bool ParameterServer::ReadyForPull(const Key &key) {
-  std::unique_lock<std::mutex> lock(mutex_);
-  if (tokens_.count(key) == 0 || weights_[key] == 0) {
-    MS_LOG(EXCEPTION) << "Invalid weight key " << key;
-  }
-  MS_LOG(INFO) << "ReadyForPull: " << (tokens_[key] > 0);
-  return tokens_[key] > 0;
+inline bool ParameterServer::ReadyForPush(const Key &key, uint32_t rank_id) {
+  std::shared_lock<std::shared_mutex> lock(mutex_);
+  return weight_clock_->ReadyForPush(key, rank_id);
 }
 
-inline void ParameterServer::ResetGradAccumCount() {
-  grad_accum_count_ = 0;
-  for (auto iter = grads_accum_counter_.begin(); iter != grads_accum_counter_.end(); iter++) {
-    grads_accum_counter_[iter->first] = 0;
-  }
+inline bool ParameterServer::ReadyForPull(const Key &key, uint32_t rank_id) {
+  std::shared_lock<std::shared_mutex> lock(mutex_);
+  return weight_clock_->ReadyForPull(key, rank_id);
 }
 
 const CNodePtr ParameterServer::GetCNode(const std::string &name) const {
@@ -641,7 +723,9 @@ const CNodePtr ParameterServer::GetCNode(const std::string &name) const {
   return nullptr;
 }
 
-inline std::mutex &ParameterServer::mutex() { return mutex_; }
+inline std::shared_mutex &ParameterServer::mutex() { return mutex_; }
+
+inline std::mutex &ParameterServer::key_mutex(const Key &key) { return key_mutexes_[key % kKeyMutexShardNum]; }
 
 void ParameterServer::GetEmbeddingTableParamPtr() {
   if (ps::PsDataPrefetch::GetInstance().cache_enable()) {
@@ -767,10 +851,16 @@ void ParameterServer::RecoverParameters(const std::vector<Key> &keys) {
 
       std::map<std::string, std::string> config_map;
       config_map[distributed::storage::kFileStoragePath] = real_storage_file_path;
+      if (PSContext::instance()->incremental_checkpoint()) {
+        config_map[distributed::storage::kIncrementalPersist] = "true";
+      }
       embedding->Initialize(config_map);
       embedding->Restore();
       weights_[key] = embedding;
       (void)weights_dirty_info_.emplace(key, distributed::storage::DirtyInfo());
+      (void)is_embedding_.emplace(key, true);
+      (void)optim_infos_.emplace(key, nullptr);
+      weight_clock_->AddWeight(key);
     }
   }
 }
@@ -875,13 +965,13 @@ void ParameterServer::ServerHandler::Init() {
   handlers_[kInitWeightToOptimIdCmd] = &ServerHandler::HandleInitWeightToOptimId;
   handlers_[kInitOptimInputsShapeCmd] = &ServerHandler::HandleInitInputsShape;
   handlers_[kInitEmbeddingsCmd] = &ServerHandler::HandleInitEmbeddings;
-  handlers_[kCheckReadyForPushCmd] = &ServerHandler::HandleCheckReadyForPush;
-  handlers_[kCheckReadyForPullCmd] = &ServerHandler::HandleCheckReadyForPull;
   handlers_[kEmbeddingLookupCmd] = &ServerHandler::HandleEmbeddingLookup;
   handlers_[kUpdateEmbeddingsCmd] = &ServerHandler::HandleUpdateEmbeddings;
   handlers_[kFinalizeCmd] = &ServerHandler::HandleFinalize;
-  handlers_[kPushCmd] = &ServerHandler::HandlePushReq;
   handlers_[kPullCmd] = &ServerHandler::HandlePullReq;
+  worker_handlers_[kCheckReadyForPushCmd] = &ServerHandler::HandleCheckReadyForPush;
+  worker_handlers_[kCheckReadyForPullCmd] = &ServerHandler::HandleCheckReadyForPull;
+  worker_handlers_[kPushCmd] = &ServerHandler::HandlePushReq;
   commands_[kInitWeightsCmd] = "kInitWeightsCmd";
   commands_[kInitWeightToOptimIdCmd] = "kInitWeightToOptimIdCmd";
   commands_[kInitOptimInputsShapeCmd] = "kInitOptimInputsShapeCmd";
@@ -893,20 +983,58 @@ void ParameterServer::ServerHandler::Init() {
   commands_[kFinalizeCmd] = "kFinalizeCmd";
   commands_[kPushCmd] = "kPushCmd";
   commands_[kPullCmd] = "kPullCmd";
+  concurrent_commands_ = {kCheckReadyForPushCmd, kCheckReadyForPullCmd, kEmbeddingLookupCmd,
+                          kUpdateEmbeddingsCmd,  kPushCmd,              kPullCmd};
 }
 
 void ParameterServer::ServerHandler::operator()(const std::shared_ptr<core::TcpConnection> &conn,
                                                 const std::shared_ptr<core::MessageMeta> &meta, const void *data,
                                                 size_t size) {
   MS_EXCEPTION_IF_NULL(data);
-  auto output = std::make_shared<std::vector<unsigned char>>();
+  MS_EXCEPTION_IF_NULL(meta);
   if (commands_.count(meta->user_cmd()) == 0) {
     MS_LOG(EXCEPTION) << "The command:" << meta->user_cmd() << " is not supported!";
   }
   MS_LOG(INFO) << "The command is:" << commands_[meta->user_cmd()];
 
-  auto &handler_ptr = handlers_[meta->user_cmd()];
-  (this->*handler_ptr)(data, size, output);
+  if (concurrent_commands_.count(meta->user_cmd()) > 0 && ps_->handler_executor_ != nullptr) {
+    // The data is released after this callback returns, so it is copied for the handler executor.
+    auto request = std::make_shared<std::vector<unsigned char>>(static_cast<const unsigned char *>(data),
+                                                                static_cast<const unsigned char *>(data) + size);
+    auto task = [this, conn, meta, request]() {
+      try {
+        HandleRequest(conn, meta, request->data(), request->size());
+      } catch (const std::exception &e) {
+        MS_LOG(ERROR) << "Handle the command " << commands_[meta->user_cmd()] << " failed: " << e.what();
+        // The worker waits for the response of every request, and kFailedResponse tells the worker that the request
+        // failed.
+        ps_->server_node_->Response(conn, meta, &kFailedResponse, sizeof(kFailedResponse));
+      }
+    };
+    if (ps_->handler_executor_->Submit(task)) {
+      return;
+    }
+    MS_LOG(WARNING) << "Submit the command " << commands_[meta->user_cmd()] << " failed, handle it in place.";
+  }
+  HandleRequest(conn, meta, data, size);
+}
+
+void ParameterServer::ServerHandler::HandleRequest(const std::shared_ptr<core::TcpConnection> &conn,
+                                                   const std::shared_ptr<core::MessageMeta> &meta, const void *data,
+                                                   size_t size) {
+  auto output = std::make_shared<std::vector<unsigned char>>();
+  auto worker_handler_iter = worker_handlers_.find(meta->user_cmd());
+  if (worker_handler_iter != worker_handlers_.end()) {
+    auto &handler_ptr = worker_handler_iter->second;
+    (this->*handler_ptr)(data, size, meta->rank_id(), output);
+  } else {
+    auto handler_iter = handlers_.find(meta->user_cmd());
+    if (handler_iter == handlers_.end()) {
+      MS_LOG(EXCEPTION) << "The command:" << meta->user_cmd() << " is not supported!";
+    }
+    auto &handler_ptr = handler_iter->second;
+    (this->*handler_ptr)(data, size, output);
+  }
   MS_LOG(DEBUG) << "The output size is:" << output->size();
 
   if (output->size() > 0) {
@@ -923,16 +1051,24 @@ void ParameterServer::ServerHandler::operator()(const std::shared_ptr<core::TcpC
                      .count();
 }
 
-void ParameterServer::ServerHandler::HandlePushReq(const void *data, size_t size, const VectorPtr &res) {
+void ParameterServer::ServerHandler::HandlePushReq(const void *data, size_t size, uint32_t rank_id,
+                                                   const VectorPtr &res) {
   MS_EXCEPTION_IF_NULL(data);
   MS_EXCEPTION_IF_NULL(res);
   KVMessage input;
   CHECK_RETURN_TYPE(input.ParseFromArray(data, SizeToInt(size)));
   Keys keys = {input.keys().begin(), input.keys().end()};
-  Values values = {input.values().begin(), input.values().end()};
+  Values values;
+  if (input.compressed_segments_size() > 0) {
+    if (!PushCompressor::Decompress(input, &values)) {
+      MS_LOG(EXCEPTION) << "Decompress the push message from worker " << rank_id << " failed.";
+    }
+  } else {
+    values = {input.values().begin(), input.values().end()};
+  }
   Lengths lens = {input.len().begin(), input.len().end()};
   MS_LOG(DEBUG) << "The keys:" << keys << " the values:" << values << " the len:" << lens;
-  ps_->AccumGrad(keys, values, lens);
+  ps_->AccumGrad(keys, values, lens, rank_id);
 }
 
 void ParameterServer::ServerHandler::HandlePullReq(const void *data, size_t size, const VectorPtr &res) {
@@ -943,10 +1079,7 @@ void ParameterServer::ServerHandler::HandlePullReq(const void *data, size_t size
   KVMessage res_data;
   *res_data.mutable_keys() = input.keys();
   Key key = input.keys()[0];
-  auto weight = ps_->weight(key);
-  auto weight_data = weight->MutableData();
-  MS_EXCEPTION_IF_NULL(weight_data);
-  *res_data.mutable_values() = {weight_data->begin(), weight_data->end()};
+  ps_->CopyWeight(key, &res_data);
   res->resize(res_data.ByteSizeLong());
   size_t dest_size = res_data.ByteSizeLong();
   size_t src_size = res_data.ByteSizeLong();
@@ -957,7 +1090,7 @@ void ParameterServer::ServerHandler::HandlePullReq(const void *data, size_t size
 }
 
 void ParameterServer::ServerHandler::HandleInitWeights(const void *data, size_t size, const VectorPtr &res) {
-  std::unique_lock<std::mutex> lock(ps_->mutex());
+  std::unique_lock<std::shared_mutex> lock(ps_->mutex());
   MS_EXCEPTION_IF_NULL(data);
   MS_EXCEPTION_IF_NULL(res);
   KVMessage input;
@@ -984,7 +1117,7 @@ void ParameterServer::ServerHandler::HandleInitWeights(const void *data, size_t
 }
 
 void ParameterServer::ServerHandler::HandleInitWeightToOptimId(const void *data, size_t size, const VectorPtr &res) {
-  std::unique_lock<std::mutex> lock(ps_->mutex());
+  std::unique_lock<std::shared_mutex> lock(ps_->mutex());
   MS_EXCEPTION_IF_NULL(data);
   MS_EXCEPTION_IF_NULL(res);
   KVMessage input;
@@ -1003,7 +1136,7 @@ void ParameterServer::ServerHandler::HandleInitWeightToOptimId(const void *data,
 }
 
 void ParameterServer::ServerHandler::HandleInitInputsShape(const void *data, size_t size, const VectorPtr &res) {
-  std::unique_lock<std::mutex> lock(ps_->mutex());
+  std::unique_lock<std::shared_mutex> lock(ps_->mutex());
   MS_EXCEPTION_IF_NULL(data);
   MS_EXCEPTION_IF_NULL(res);
   KVMessage input;
@@ -1021,7 +1154,7 @@ void ParameterServer::ServerHandler::HandleInitInputsShape(const void *data, siz
 }
 
 void ParameterServer::ServerHandler::HandleInitEmbeddings(const void *data, size_t size, const VectorPtr &) {
-  std::unique_lock<std::mutex> lock(ps_->mutex());
+  std::unique_lock<std::shared_mutex> lock(ps_->mutex());
   MS_EXCEPTION_IF_NULL(data);
   EmbeddingTableMeta embedding_table_meta;
   CHECK_RETURN_TYPE(embedding_table_meta.ParseFromArray(data, SizeToInt(size)));
@@ -1058,13 +1191,14 @@ void ParameterServer::ServerHandler::HandleInitEmbeddings(const void *data, size
   ps_->InitEmbeddingTable(key, shapes, param_init_info);
 }
 
-void ParameterServer::ServerHandler::HandleCheckReadyForPush(const void *data, size_t size, const VectorPtr &res) {
+void ParameterServer::ServerHandler::HandleCheckReadyForPush(const void *data, size_t size, uint32_t rank_id,
+                                                             const VectorPtr &res) {
   MS_EXCEPTION_IF_NULL(data);
   MS_EXCEPTION_IF_NULL(res);
   KVMessage input;
   CHECK_RETURN_TYPE(input.ParseFromArray(data, SizeToInt(size)));
   const Key &key = input.keys()[0];
-  bool ready = ps_->ReadyForPush(key);
+  bool ready = ps_->ReadyForPush(key, rank_id);
   MS_LOG(INFO) << "The ready is:" << ready;
   KVMessage res_data;
   res_data.add_keys(key);
@@ -1078,13 +1212,14 @@ void ParameterServer::ServerHandler::HandleCheckReadyForPush(const void *data, s
   }
 }
 
-void ParameterServer::ServerHandler::HandleCheckReadyForPull(const void *data, size_t size, const VectorPtr &res) {
+void ParameterServer::ServerHandler::HandleCheckReadyForPull(const void *data, size_t size, uint32_t rank_id,
+                                                             const VectorPtr &res) {
   MS_EXCEPTION_IF_NULL(data);
   MS_EXCEPTION_IF_NULL(res);
   KVMessage input;
   CHECK_RETURN_TYPE(input.ParseFromArray(data, SizeToInt(size)));
   const Key &key = input.keys()[0];
-  bool ready = ps_->ReadyForPull(key);
+  bool ready = ps_->ReadyForPull(key, rank_id);
   KVMessage res_data;
   res_data.add_keys(key);
   res_data.add_values(ready);
@@ -1120,7 +1255,6 @@ void ParameterServer::ServerHandler::HandleEmbeddingLookup(const void *data, siz
 }
 
 void ParameterServer::ServerHandler::HandleUpdateEmbeddings(const void *data, size_t size, const VectorPtr &res) {
-  std::unique_lock<std::mutex> lock(ps_->mutex());
   MS_EXCEPTION_IF_NULL(data);
   MS_EXCEPTION_IF_NULL(res);
   KVMessage input;
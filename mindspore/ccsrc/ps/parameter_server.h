@@ -23,6 +23,7 @@
 #include <memory>
 #include <vector>
 #include <mutex>
+#include <shared_mutex>
 #include <condition_variable>
 #include <thread>
 #include <cmath>
@@ -32,8 +33,11 @@
 #include <map>
 #include <functional>
 #include <algorithm>
+#include <array>
+#include <atomic>
 
 #include "utils/hash_map.h"
+#include "utils/hash_set.h"
 #include "ir/func_graph.h"
 #include "backend/common/session/session_basic.h"
 #include "backend/common/session/anf_runtime_algorithm.h"
@@ -58,15 +62,20 @@
 #include "ps/constants.h"
 #include "ps/util.h"
 #include "ps/embedding_table_shard_metadata.h"
+#include "ps/weight_clock.h"
 #include "utils/log_adapter.h"
 #include "proto/comm.pb.h"
 #include "proto/ps.pb.h"
 #include "ps/core/ps_server_node.h"
 #include "ps/core/node.h"
+#include "ps/core/communicator/task_executor.h"
 #include "include/backend/visible.h"
 
 namespace mindspore {
 namespace ps {
+// The number of mutex shards of the weight keys, the key is locked by the mutex of shard key % kKeyMutexShardNum.
+constexpr size_t kKeyMutexShardNum = 64;
+
 class BACKEND_EXPORT ParameterServer {
  public:
   static ParameterServer &GetInstance();
@@ -76,7 +85,6 @@ class BACKEND_EXPORT ParameterServer {
   ParameterServer()
       : pserver_num_(0),
         worker_num_(0),
-        grad_accum_count_(0),
         handler_(nullptr),
         func_graph_(nullptr),
         sess_(nullptr),
@@ -88,6 +96,18 @@ class BACKEND_EXPORT ParameterServer {
   ParameterServer(const ParameterServer &) = delete;
   ParameterServer &operator=(const ParameterServer &) = delete;
 
+  // Copy the weight into the values of res in the key mutex, in which the optimizer applies the gradients to the
+  // weight, so a pull never returns a weight that is updated halfway.
+  static void CopyWeight(const WeightPtr &weight, std::mutex *key_mutex, KVMessage *res) {
+    MS_EXCEPTION_IF_NULL(weight);
+    MS_EXCEPTION_IF_NULL(key_mutex);
+    MS_EXCEPTION_IF_NULL(res);
+    std::unique_lock<std::mutex> key_lock(*key_mutex);
+    const float *weight_data = weight->data();
+    MS_EXCEPTION_IF_NULL(weight_data);
+    *res->mutable_values() = {weight_data, weight_data + weight->size()};
+  }
+
   class ServerHandler {
    public:
     explicit ServerHandler(ParameterServer *ps) : ps_(ps) {}
@@ -95,14 +115,17 @@ class BACKEND_EXPORT ParameterServer {
     void Init();
     void operator()(const std::shared_ptr<core::TcpConnection> &conn, const std::shared_ptr<core::MessageMeta> &meta,
                     const void *data, size_t size);
-    void HandlePushReq(const void *data, size_t size, const VectorPtr &res);
+    // Run the handler of command and send the response.
+    void HandleRequest(const std::shared_ptr<core::TcpConnection> &conn, const std::shared_ptr<core::MessageMeta> &meta,
+                       const void *data, size_t size);
+    void HandlePushReq(const void *data, size_t size, uint32_t rank_id, const VectorPtr &res);
     void HandlePullReq(const void *data, size_t size, const VectorPtr &res);
     void HandleInitWeights(const void *data, size_t size, const VectorPtr &res);
     void HandleInitWeightToOptimId(const void *data, size_t size, const VectorPtr &res);
     void HandleInitInputsShape(const void *data, size_t size, const VectorPtr &res);
     void HandleInitEmbeddings(const void *data, size_t size, const VectorPtr &res);
-    void HandleCheckReadyForPush(const void *data, size_t size, const VectorPtr &res);
-    void HandleCheckReadyForPull(const void *data, size_t size, const VectorPtr &res);
+    void HandleCheckReadyForPush(const void *data, size_t size, uint32_t rank_id, const VectorPtr &res);
+    void HandleCheckReadyForPull(const void *data, size_t size, uint32_t rank_id, const VectorPtr &res);
     void HandleEmbeddingLookup(const void *data, size_t size, const VectorPtr &res);
     void HandleUpdateEmbeddings(const void *data, size_t size, const VectorPtr &res);
     void HandleFinalize(const void *data, size_t size, const VectorPtr &res);
@@ -110,8 +133,15 @@ class BACKEND_EXPORT ParameterServer {
    private:
     ParameterServer *ps_;
     typedef void (ServerHandler::*RequestHandler)(const void *data, size_t size, const VectorPtr &res);
+    // The handlers of the commands which depend on the clock of the sender worker.
+    typedef void (ServerHandler::*WorkerRequestHandler)(const void *data, size_t size, uint32_t rank_id,
+                                                        const VectorPtr &res);
     mindspore::HashMap<int, RequestHandler> handlers_;
+    mindspore::HashMap<int, WorkerRequestHandler> worker_handlers_;
     mindspore::HashMap<int, std::string> commands_;
+    // The commands accessing the initialized keys are handled in the handler executor concurrently, and the others are
+    // handled in the communication thread to keep the initialization order.
+    mindspore::HashSet<int> concurrent_commands_;
     mindspore::HashMap<Key, bool> init_weights_;
     mindspore::HashMap<Key, bool> init_weight_to_optim_;
     mindspore::HashMap<Key, bool> init_optim_info_;
@@ -153,16 +183,27 @@ class BACKEND_EXPORT ParameterServer {
   bool HasWeight(const Key &key);
   void Finalize();
   void UpdateWeights();
-  void AccumGrad(const Keys &key, const Values &values, const Lengths &lengths);
-  WeightPtr weight(const Key &key);
+  // Apply the accumulated gradients of the key to the weight by the optimizer, the key mutex should be locked.
+  void ApplyGradients(const Key &key, size_t grad_num);
+  void AccumGrad(const Keys &key, const Values &values, const Lengths &lengths, uint32_t rank_id);
+  // Copy the weight of the key into res for the pull of a worker.
+  void CopyWeight(const Key &key, KVMessage *res);
   void DoEmbeddingLookup(Key key, const LookupIds &lookup_ids, KVMessage *res);
   void UpdateEmbeddings(const Key &key, const LookupIds &lookup_ids, const Values &vals);
-  inline bool ReadyForUpdateWeights() const;
-  inline bool ReadyForPush(const Key &key);
-  inline bool ReadyForPull(const Key &key);
-  inline void ResetGradAccumCount();
+  inline bool ReadyForPush(const Key &key, uint32_t rank_id);
+  inline bool ReadyForPull(const Key &key, uint32_t rank_id);
+
+  // In the bounded staleness mode, the gradients are applied by the update thread as soon as they arrive.
+  bool EnableBoundedStaleness() const { return staleness_bound_ > 0; }
+
+  // The embedding table is stored in the block files on disk when the embedding storage path is set, and the rows
+  // are paged in before the lookups and the optimizer updates.
+  WeightPtr CreateEmbeddingWeight(const Key &key, const std::vector<size_t> &input_shapes,
+                                  const std::shared_ptr<std::vector<int>> &embedding_shape);
+  void PrefetchEmbeddingRows(const WeightPtr &weight, const int *ids, size_t id_num, int64_t offset = 0);
   const CNodePtr GetCNode(const std::string &name) const;
-  inline std::mutex &mutex();
+  inline std::shared_mutex &mutex();
+  inline std::mutex &key_mutex(const Key &key);
   void GetEmbeddingTableParamPtr();
   void SyncEmbeddingTables();
   // Cache embedding table parameter by map, key: parameter name, value: parameter node pointer
@@ -203,11 +244,11 @@ class BACKEND_EXPORT ParameterServer {
 
   size_t pserver_num_;
   size_t worker_num_;
-  size_t grad_accum_count_;
+  uint64_t staleness_bound_{0};
   std::unique_ptr<ServerHandler> handler_;
   FuncGraphPtr func_graph_;
   std::shared_ptr<session::SessionBasic> sess_;
-  bool running_;
+  std::atomic_bool running_;
   bool embedding_param_ptr_cached_{false};
   // Used to cache embedding table parameter, key: parameter name, value: parameter node pointer
   mindspore::HashMap<std::string, ParameterPtr> embedding_parameter_tables_;
@@ -224,12 +265,19 @@ class BACKEND_EXPORT ParameterServer {
   mindspore::HashMap<Key, WeightPtr> weights_;
   mindspore::HashMap<Key, bool> is_embedding_;
   mindspore::HashMap<Key, GradPtr> grads_;
-  mindspore::HashMap<Key, size_t> grads_accum_counter_;
   mindspore::HashMap<Key, std::shared_ptr<PServerKernel>> embedding_lookup_ops_;
-  mindspore::HashMap<Key, uint64_t> tokens_;
 
-  std::mutex mutex_;
-  std::condition_variable apply_grads_cv_;
+  // The clocks of the weights decide when the gradients are pushed and applied and when the weights are pulled.
+  std::unique_ptr<WeightClock> weight_clock_;
+
+  // The mutex protects the structure of the maps above. It is locked exclusively by the initialization which inserts
+  // the keys, and is shared by the requests which only access the values of initialized keys.
+  std::shared_mutex mutex_;
+  // The weight, optimizer info and lookup operator of one key are protected by the mutex of key shard, so the
+  // requests of different keys run concurrently.
+  std::array<std::mutex, kKeyMutexShardNum> key_mutexes_;
+  // Handle the requests of pushing, pulling and embedding concurrently.
+  std::unique_ptr<core::TaskExecutor> handler_executor_;
 
   std::mutex access_weight_mutex_;
   std::unique_ptr<std::thread> thread_;
@@ -598,6 +598,46 @@ void PSContext::set_continuous_failure_times(uint32_t continuous_failure_times)
 
 uint32_t PSContext::continuous_failure_times() { return continuous_failure_times_; }
 
+void PSContext::set_staleness_bound(uint64_t staleness_bound) { staleness_bound_ = staleness_bound; }
+
+uint64_t PSContext::staleness_bound() const { return staleness_bound_; }
+
+void PSContext::set_push_compress_type(const std::string &push_compress_type) {
+  push_compress_type_ = push_compress_type;
+}
+
+const std::string &PSContext::push_compress_type() const { return push_compress_type_; }
+
+void PSContext::set_push_topk_ratio(float push_topk_ratio) {
+  if (push_topk_ratio <= 0.0f || push_topk_ratio > 1.0f) {
+    MS_LOG(EXCEPTION) << "The push_topk_ratio must be in (0, 1], but got " << push_topk_ratio;
+  }
+  push_topk_ratio_ = push_topk_ratio;
+}
+
+float PSContext::push_topk_ratio() const { return push_topk_ratio_; }
+
+void PSContext::set_embedding_storage_path(const std::string &embedding_storage_path) {
+  embedding_storage_path_ = embedding_storage_path;
+}
+
+const std::string &PSContext::embedding_storage_path() const { return embedding_storage_path_; }
+
+void PSContext::set_embedding_cache_size(uint64_t embedding_cache_size) {
+  if (embedding_cache_size == 0) {
+    MS_LOG(EXCEPTION) << "The embedding_cache_size must be greater than 0.";
+  }
+  embedding_cache_size_ = embedding_cache_size;
+}
+
+uint64_t PSContext::embedding_cache_size() const { return embedding_cache_size_; }
+
+void PSContext::set_incremental_checkpoint(bool incremental_checkpoint) {
+  incremental_checkpoint_ = incremental_checkpoint;
+}
+
+bool PSContext::incremental_checkpoint() const { return incremental_checkpoint_; }
+
 bool PSContext::enable_distributed_mindrt() const {
   bool ms_cluster_enabled = distributed::cluster::ClusterContext::instance()->initialized();
   return ms_cluster_enabled;
@@ -254,6 +254,31 @@ class BACKEND_EXPORT PSContext {
   void set_continuous_failure_times(uint32_t continuous_failure_times);
   uint32_t continuous_failure_times();
 
+  // The staleness bound of parameter server training, 0 means the fully synchronous training.
+  void set_staleness_bound(uint64_t staleness_bound);
+  uint64_t staleness_bound() const;
+
+  // The compression of gradients pushed by workers: NO_COMPRESS, FP16, BF16, INT8 or TOP_K.
+  void set_push_compress_type(const std::string &push_compress_type);
+  const std::string &push_compress_type() const;
+
+  // The ratio of elements sent by the TOP_K push compression.
+  void set_push_topk_ratio(float push_topk_ratio);
+  float push_topk_ratio() const;
+
+  // The directory of block files storing the embedding tables of parameter server, empty means keeping the tables in
+  // memory.
+  void set_embedding_storage_path(const std::string &embedding_storage_path);
+  const std::string &embedding_storage_path() const;
+
+  // The memory size in MB of the rows of one embedding table kept in memory when the table is stored on disk.
+  void set_embedding_cache_size(uint64_t embedding_cache_size);
+  uint64_t embedding_cache_size() const;
+
+  // Whether the embedding tables are persisted incrementally in the disaster recovery mode.
+  void set_incremental_checkpoint(bool incremental_checkpoint);
+  bool incremental_checkpoint() const;
+
   // Whether distributed MindRT is enabled.
   bool enable_distributed_mindrt() const;
 
@@ -316,7 +341,13 @@ class BACKEND_EXPORT PSContext {
         checkpoint_dir_(""),
         instance_name_(""),
         participation_time_level_("5,15"),
-        continuous_failure_times_(10) {}
+        continuous_failure_times_(10),
+        staleness_bound_(0),
+        push_compress_type_("NO_COMPRESS"),
+        push_topk_ratio_(0.01f),
+        embedding_storage_path_(""),
+        embedding_cache_size_(1024),
+        incremental_checkpoint_(false) {}
   bool ps_enabled_;
   bool is_worker_;
   bool is_pserver_;
@@ -467,6 +498,24 @@ class BACKEND_EXPORT PSContext {
 
   // The times of iteration continuous failure
   uint32_t continuous_failure_times_;
+
+  // The maximum number of steps that a worker can run ahead of the slowest worker for one key in parameter server.
+  uint64_t staleness_bound_;
+
+  // The compression type of gradients pushed by workers in parameter server.
+  std::string push_compress_type_;
+
+  // The ratio of gradient elements sent to servers by the top-k compression.
+  float push_topk_ratio_;
+
+  // The directory of block files of the embedding tables stored on disk in parameter server.
+  std::string embedding_storage_path_;
+
+  // The memory size in MB of the hot rows of one embedding table stored on disk.
+  uint64_t embedding_cache_size_;
+
+  // Whether only the changed rows of embedding tables are appended to the delta logs in background when persisting.
+  bool incremental_checkpoint_;
 };
 }  // namespace ps
 }  // namespace mindspore
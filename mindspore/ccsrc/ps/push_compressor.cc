@@ -0,0 +1,296 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ps/push_compressor.h"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <numeric>
+#include "base/float16.h"
+#include "utils/convert_utils_base.h"
+#include "utils/log_adapter.h"
+
+namespace mindspore {
+namespace ps {
+namespace {
+constexpr float kInt8MaxValue = 127.0;
+constexpr uint32_t kBf16RoundBias = 0x7fff;
+constexpr uint32_t kBf16Shift = 16;
+constexpr uint16_t kBf16QuietNanBit = 0x40;
+
+uint16_t FloatToFp16(float value) {
+  float16 half(value);
+  uint16_t bits = 0;
+  (void)std::memcpy(&bits, &half, sizeof(bits));
+  return bits;
+}
+
+float Fp16ToFloat(uint16_t bits) {
+  float16 half(0.0f);
+  (void)std::memcpy(&half, &bits, sizeof(bits));
+  return static_cast<float>(half);
+}
+
+// Round to the nearest even, and keep the nan as nan.
+uint16_t FloatToBf16(float value) {
+  uint32_t bits = 0;
+  (void)std::memcpy(&bits, &value, sizeof(bits));
+  if (std::isnan(value)) {
+    return static_cast<uint16_t>((bits >> kBf16Shift) | kBf16QuietNanBit);
+  }
+  bits += kBf16RoundBias + ((bits >> kBf16Shift) & 1);
+  return static_cast<uint16_t>(bits >> kBf16Shift);
+}
+
+float Bf16ToFloat(uint16_t bf16) {
+  uint32_t bits = static_cast<uint32_t>(bf16) << kBf16Shift;
+  float value = 0;
+  (void)std::memcpy(&value, &bits, sizeof(value));
+  return value;
+}
+
+bool DecompressSegment(const CompressedSegment &segment, size_t size, float *output) {
+  const auto &data = segment.data();
+  switch (segment.type()) {
+    case PUSH_FP16:
+    case PUSH_BF16: {
+      if (data.size() != size * sizeof(uint16_t)) {
+        return false;
+      }
+      auto convert = segment.type() == PUSH_FP16 ? Fp16ToFloat : Bf16ToFloat;
+      for (size_t i = 0; i < size; ++i) {
+        uint16_t bits = 0;
+        (void)std::memcpy(&bits, data.data() + i * sizeof(uint16_t), sizeof(uint16_t));
+        output[i] = convert(bits);
+      }
+      return true;
+    }
+    case PUSH_INT8: {
+      size_t block_num = (size + kInt8CompressBlockSize - 1) / kInt8CompressBlockSize;
+      if (data.size() != size || IntToSize(segment.scales_size()) != block_num) {
+        return false;
+      }
+      for (size_t i = 0; i < size; ++i) {
+        output[i] = static_cast<float>(static_cast<int8_t>(data[i])) * segment.scales(i / kInt8CompressBlockSize);
+      }
+      return true;
+    }
+    case PUSH_TOP_K: {
+      constexpr size_t kTopKElementBytes = sizeof(uint32_t) + sizeof(float);
+      if (data.size() % kTopKElementBytes != 0) {
+        return false;
+      }
+      size_t k = data.size() / kTopKElementBytes;
+      std::fill(output, output + size, 0.0f);
+      for (size_t i = 0; i < k; ++i) {
+        uint32_t index = 0;
+        float value = 0;
+        (void)std::memcpy(&index, data.data() + i * sizeof(uint32_t), sizeof(uint32_t));
+        (void)std::memcpy(&value, data.data() + k * sizeof(uint32_t) + i * sizeof(float), sizeof(float));
+        if (index >= size) {
+          return false;
+        }
+        output[index] = value;
+      }
+      return true;
+    }
+    default:
+      return false;
+  }
+}
+}  // namespace
+
+PushCompressType PushCompressor::GetCompressType(const std::string &name) {
+  static const std::map<std::string, PushCompressType> kCompressTypes = {{"NO_COMPRESS", PUSH_NO_COMPRESS},
+                                                                         {"FP16", PUSH_FP16},
+                                                                         {"BF16", PUSH_BF16},
+                                                                         {"INT8", PUSH_INT8},
+                                                                         {"TOP_K", PUSH_TOP_K}};
+  auto iter = kCompressTypes.find(name);
+  if (iter == kCompressTypes.end()) {
+    MS_LOG(EXCEPTION) << "The push compress type " << name << " is not supported.";
+  }
+  return iter->second;
+}
+
+void PushCompressor::Compress(int64_t compress_index, KVMessage *message) {
+  MS_EXCEPTION_IF_NULL(message);
+  if (message->keys().empty()) {
+    return;
+  }
+  const Key key = message->keys(0);
+  size_t raw_bytes = message->ByteSizeLong();
+  size_t total_size = std::accumulate(message->len().begin(), message->len().end(), static_cast<size_t>(0));
+  // The message without the lengths of segments, such as the empty sparse gradient, isn't compressed.
+  if (type_ == PUSH_NO_COMPRESS || compress_index == kCompressNoSegment ||
+      total_size != IntToSize(message->values_size())) {
+    RecordTraffic(key, raw_bytes, raw_bytes);
+    return;
+  }
+
+  Values values(message->values().begin(), message->values().end());
+  message->clear_values();
+  size_t offset = 0;
+  for (int i = 0; i < message->len_size(); ++i) {
+    size_t size = message->len(i);
+    const float *data = values.data() + offset;
+    offset += size;
+    bool selected = compress_index == kCompressAllSegments || compress_index == i;
+    if (!selected || size < kMinCompressSegmentSize) {
+      for (size_t j = 0; j < size; ++j) {
+        message->add_values(data[j]);
+      }
+      continue;
+    }
+    // The sparse gradients use the fp16 instead of the top-k.
+    auto type = (type_ == PUSH_TOP_K && compress_index != kCompressAllSegments) ? PUSH_FP16 : type_;
+    CompressSegment(key, IntToSize(i), data, size, type, message->add_compressed_segments());
+  }
+  RecordTraffic(key, raw_bytes, message->ByteSizeLong());
+}
+
+bool PushCompressor::Decompress(const KVMessage &message, Values *values) {
+  MS_EXCEPTION_IF_NULL(values);
+  const auto &segments = message.compressed_segments();
+  size_t total_size = std::accumulate(message.len().begin(), message.len().end(), static_cast<size_t>(0));
+  values->resize(total_size);
+  int segment_index = 0;
+  size_t value_offset = 0;
+  size_t offset = 0;
+  for (int i = 0; i < message.len_size(); ++i) {
+    size_t size = message.len(i);
+    float *output = values->data() + offset;
+    offset += size;
+    // The compressed segments are in the order of segment index.
+    if (segment_index < segments.size() && segments[segment_index].index() == IntToSize(i)) {
+      if (!DecompressSegment(segments[segment_index], size, output)) {
+        MS_LOG(ERROR) << "Decompress the segment " << i << " of key " << message.keys(0) << " failed.";
+        return false;
+      }
+      ++segment_index;
+      continue;
+    }
+    if (value_offset + size > IntToSize(message.values_size())) {
+      MS_LOG(ERROR) << "The values size " << message.values_size() << " of push message is less than the lengths.";
+      return false;
+    }
+    std::copy(message.values().begin() + value_offset, message.values().begin() + value_offset + size, output);
+    value_offset += size;
+  }
+  return segment_index == segments.size();
+}
+
+void PushCompressor::CompressSegment(const Key &key, size_t index, const float *data, size_t size,
+                                     PushCompressType type, CompressedSegment *segment) {
+  MS_EXCEPTION_IF_NULL(data);
+  MS_EXCEPTION_IF_NULL(segment);
+  segment->set_index(index);
+  segment->set_type(type);
+  auto bytes = segment->mutable_data();
+  switch (type) {
+    case PUSH_FP16:
+    case PUSH_BF16: {
+      auto convert = type == PUSH_FP16 ? FloatToFp16 : FloatToBf16;
+      bytes->resize(size * sizeof(uint16_t));
+      for (size_t i = 0; i < size; ++i) {
+        uint16_t bits = convert(data[i]);
+        (void)std::memcpy(&(*bytes)[i * sizeof(uint16_t)], &bits, sizeof(uint16_t));
+      }
+      break;
+    }
+    case PUSH_INT8: {
+      bytes->resize(size);
+      for (size_t begin = 0; begin < size; begin += kInt8CompressBlockSize) {
+        size_t end = std::min(begin + kInt8CompressBlockSize, size);
+        float max_abs = 0;
+        for (size_t i = begin; i < end; ++i) {
+          max_abs = std::max(max_abs, std::fabs(data[i]));
+        }
+        float scale = max_abs / kInt8MaxValue;
+        segment->add_scales(scale);
+        for (size_t i = begin; i < end; ++i) {
+          float quantized = scale > 0 ? std::round(data[i] / scale) : 0.0f;
+          quantized = std::min(std::max(quantized, -kInt8MaxValue), kInt8MaxValue);
+          (*bytes)[i] = static_cast<char>(static_cast<int8_t>(quantized));
+        }
+      }
+      break;
+    }
+    case PUSH_TOP_K:
+      CompressTopK(key, index, data, size, segment);
+      break;
+    default:
+      MS_LOG(EXCEPTION) << "The push compress type " << type << " is invalid.";
+  }
+}
+
+void PushCompressor::CompressTopK(const Key &key, size_t index, const float *data, size_t size,
+                                  CompressedSegment *segment) {
+  std::vector<float> *residual = nullptr;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    residual = &residuals_[std::make_pair(key, index)];
+  }
+  if (residual->size() != size) {
+    residual->assign(size, 0.0f);
+  }
+  // The residual becomes the gradient accumulated with the residual, and the selected elements are cleared after sent.
+  for (size_t i = 0; i < size; ++i) {
+    (*residual)[i] += data[i];
+  }
+  size_t k = std::min(size, std::max(static_cast<size_t>(1), static_cast<size_t>(size * topk_ratio_)));
+  std::vector<uint32_t> indices(size);
+  std::iota(indices.begin(), indices.end(), 0);
+  const auto &accumulation = *residual;
+  std::nth_element(indices.begin(), indices.begin() + (k - 1), indices.end(), [&accumulation](uint32_t a, uint32_t b) {
+    return std::fabs(accumulation[a]) > std::fabs(accumulation[b]);
+  });
+  indices.resize(k);
+  std::sort(indices.begin(), indices.end());
+
+  auto bytes = segment->mutable_data();
+  bytes->resize(k * (sizeof(uint32_t) + sizeof(float)));
+  for (size_t i = 0; i < k; ++i) {
+    float value = (*residual)[indices[i]];
+    (*residual)[indices[i]] = 0.0f;
+    (void)std::memcpy(&(*bytes)[i * sizeof(uint32_t)], &indices[i], sizeof(uint32_t));
+    (void)std::memcpy(&(*bytes)[k * sizeof(uint32_t) + i * sizeof(float)], &value, sizeof(float));
+  }
+}
+
+void PushCompressor::RecordTraffic(const Key &key, size_t raw_bytes, size_t wire_bytes) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  auto &traffic = traffic_[key];
+  traffic.push_count++;
+  traffic.raw_bytes += raw_bytes;
+  traffic.wire_bytes += wire_bytes;
+}
+
+std::map<Key, PushTraffic> PushCompressor::traffic() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return traffic_;
+}
+
+void PushCompressor::PrintTraffic() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  for (const auto &item : traffic_) {
+    const auto &traffic = item.second;
+    MS_LOG(INFO) << "The push traffic of key " << item.first << ": push count " << traffic.push_count
+                 << ", raw bytes " << traffic.raw_bytes << ", bytes on wire " << traffic.wire_bytes;
+  }
+}
+}  // namespace ps
+}  // namespace mindspore
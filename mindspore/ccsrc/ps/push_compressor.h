@@ -0,0 +1,85 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef MINDSPORE_CCSRC_PS_PUSH_COMPRESSOR_H_
+#define MINDSPORE_CCSRC_PS_PUSH_COMPRESSOR_H_
+
+#include <map>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+#include "ps/constants.h"
+#include "proto/ps.pb.h"
+
+namespace mindspore {
+namespace ps {
+// Compress all the segments of the push message, which is used by the dense gradients.
+constexpr int64_t kCompressAllSegments = -1;
+// Don't compress the push message.
+constexpr int64_t kCompressNoSegment = -2;
+// The segments smaller than this element number, such as the learning rate and the hyper parameters, aren't compressed.
+constexpr size_t kMinCompressSegmentSize = 1024;
+// The element number of every int8 block sharing one scale.
+constexpr size_t kInt8CompressBlockSize = 256;
+
+struct PushTraffic {
+  size_t push_count{0};
+  // The bytes of the push message without the compression.
+  size_t raw_bytes{0};
+  // The bytes of the push message sent to the servers.
+  size_t wire_bytes{0};
+};
+
+// The push compressor compresses the gradient segments of the push messages in the worker, and the servers decompress
+// the messages before accumulating the gradients. The fp16, bf16 and int8 compression are lossy casts of every
+// element, and the int8 uses one scale for every block. The top-k compression only sends the k elements of the
+// largest magnitude, and the elements not sent are kept as the residual of the worker and added to the next push of the
+// key, so the gradients aren't lost. The top-k compression is only used by the dense gradients, because the rows of
+// sparse gradients change by step. The index segments of sparse gradients are never compressed.
+class PushCompressor {
+ public:
+  PushCompressor(PushCompressType type, float topk_ratio) : type_(type), topk_ratio_(topk_ratio) {}
+  ~PushCompressor() = default;
+
+  static PushCompressType GetCompressType(const std::string &name);
+
+  // Compress the segments of message selected by the compress index, which is kCompressAllSegments, kCompressNoSegment
+  // or the segment index of sparse gradient. The traffic of the key is recorded.
+  void Compress(int64_t compress_index, KVMessage *message);
+  // Rebuild the values of all the segments from the message with the compressed segments.
+  static bool Decompress(const KVMessage &message, Values *values);
+
+  std::map<Key, PushTraffic> traffic();
+  void PrintTraffic();
+
+ private:
+  void CompressSegment(const Key &key, size_t index, const float *data, size_t size, PushCompressType type,
+                       CompressedSegment *segment);
+  void CompressTopK(const Key &key, size_t index, const float *data, size_t size, CompressedSegment *segment);
+  void RecordTraffic(const Key &key, size_t raw_bytes, size_t wire_bytes);
+
+  PushCompressType type_;
+  float topk_ratio_;
+
+  std::mutex mutex_;
+  // The residual of the top-k compression for every segment of keys, the same key isn't pushed concurrently.
+  std::map<std::pair<Key, size_t>, std::vector<float>> residuals_;
+  std::map<Key, PushTraffic> traffic_;
+};
+}  // namespace ps
+}  // namespace mindspore
+#endif  // MINDSPORE_CCSRC_PS_PUSH_COMPRESSOR_H_
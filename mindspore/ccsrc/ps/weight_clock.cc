@@ -0,0 +1,192 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ps/weight_clock.h"
+#include <algorithm>
+#include "utils/log_adapter.h"
+
+namespace mindspore {
+namespace ps {
+void WeightClock::AddWeight(const Key &key) {
+  std::unique_lock<std::mutex> lock(mutex_);
+  auto iter = key_clocks_.find(key);
+  if (iter != key_clocks_.end()) {
+    // The weight is initialized again, and it can't be pulled until updated.
+    iter->second.tokens = 0;
+    return;
+  }
+  KeyClock clock;
+  clock.push_clocks.resize(worker_num_, 0);
+  clock.applied_clocks.resize(worker_num_, 0);
+  (void)key_clocks_.emplace(key, std::move(clock));
+}
+
+void WeightClock::AddGrad(const Key &key) {
+  std::unique_lock<std::mutex> lock(mutex_);
+  grads_accum_counter_[key] = 0;
+}
+
+WeightClock::KeyClock &WeightClock::GetKeyClock(const Key &key, uint32_t rank_id) {
+  auto iter = key_clocks_.find(key);
+  if (iter == key_clocks_.end() || rank_id >= worker_num_) {
+    MS_LOG(EXCEPTION) << "Invalid weight key " << key << " or worker rank " << rank_id;
+  }
+  return iter->second;
+}
+
+bool WeightClock::ReadyForPush(const Key &key, uint32_t rank_id) {
+  std::unique_lock<std::mutex> lock(mutex_);
+  if (EnableBoundedStaleness()) {
+    const KeyClock &clock = GetKeyClock(key, rank_id);
+    // The gradient buffers of the optimizer info hold the gradients of worker_num_ pushes at most.
+    if (clock.pending_grad_num >= worker_num_) {
+      return false;
+    }
+    uint64_t min_clock = *std::min_element(clock.push_clocks.begin(), clock.push_clocks.end());
+    return clock.push_clocks[rank_id] < min_clock + staleness_bound_;
+  }
+
+  if (key_clocks_.empty()) {
+    MS_LOG(EXCEPTION) << "The weights in server is empty. Many reasons could cause this: 1.The Worker didn't send "
+                         "kInitWeightsCmd command. 2.The Server failed to initialize weights.";
+  }
+  // The updated weight must be pulled by all the workers before the gradients of the next round are pushed.
+  auto iter = key_clocks_.find(key);
+  if (iter != key_clocks_.end() && iter->second.tokens != 0) {
+    return false;
+  }
+  return grad_accum_count_ < key_clocks_.size();
+}
+
+bool WeightClock::ReadyForPull(const Key &key, uint32_t rank_id) {
+  std::unique_lock<std::mutex> lock(mutex_);
+  const KeyClock &clock = GetKeyClock(key, rank_id);
+  if (!EnableBoundedStaleness()) {
+    MS_LOG(DEBUG) << "ReadyForPull: " << (clock.tokens > 0) << ", key: " << key;
+    return clock.tokens > 0;
+  }
+  // The weight includes the gradients of the worker itself, and misses staleness_bound_ pushes of others at most.
+  bool ready = clock.applied_clocks[rank_id] == clock.push_clocks[rank_id];
+  MS_LOG(DEBUG) << "ReadyForPull: " << ready << ", key: " << key << ", version: " << clock.version
+                << ", worker rank: " << rank_id << ", clock: " << clock.push_clocks[rank_id];
+  return ready;
+}
+
+void WeightClock::Push(const Key &key, uint32_t rank_id, bool has_grad) {
+  std::unique_lock<std::mutex> lock(mutex_);
+  if (EnableBoundedStaleness()) {
+    KeyClock &clock = GetKeyClock(key, rank_id);
+    clock.push_clocks[rank_id]++;
+    if (!has_grad) {
+      // Nothing is accumulated, the push is regarded as applied unless the gradients of other workers are pending.
+      if (clock.pending_grad_num == 0) {
+        clock.applied_clocks[rank_id] = clock.push_clocks[rank_id];
+      }
+      return;
+    }
+    clock.pending_grad_num++;
+    pending_grad_num_++;
+    update_cv_.notify_one();
+    return;
+  }
+
+  auto &accum_count = grads_accum_counter_[key];
+  accum_count++;
+  if (accum_count == worker_num_) {
+    grad_accum_count_++;
+  }
+  if (ReadyForUpdate()) {
+    update_cv_.notify_one();
+  }
+}
+
+void WeightClock::Pull(const Key &key) {
+  if (EnableBoundedStaleness()) {
+    return;
+  }
+  std::unique_lock<std::mutex> lock(mutex_);
+  auto iter = key_clocks_.find(key);
+  if (iter == key_clocks_.end()) {
+    MS_LOG(EXCEPTION) << "Invalid weight key " << key;
+  }
+  if (iter->second.tokens > 0) {
+    iter->second.tokens--;
+  }
+}
+
+bool WeightClock::ReadyForUpdate() const {
+  if (EnableBoundedStaleness()) {
+    return pending_grad_num_ > 0;
+  }
+  return grads_accum_counter_.size() > 0 && grad_accum_count_ == grads_accum_counter_.size();
+}
+
+bool WeightClock::WaitForUpdate() {
+  std::unique_lock<std::mutex> lock(mutex_);
+  update_cv_.wait(lock, [this] { return ReadyForUpdate() || stopped_; });
+  if (stopped_) {
+    return false;
+  }
+  // The gradients pushed after this point are applied in this update or trigger the next update.
+  pending_grad_num_ = 0;
+  return true;
+}
+
+size_t WeightClock::GradNumToApply(const Key &key) {
+  if (!EnableBoundedStaleness()) {
+    return worker_num_;
+  }
+  std::unique_lock<std::mutex> lock(mutex_);
+  auto iter = key_clocks_.find(key);
+  return iter == key_clocks_.end() ? 0 : iter->second.pending_grad_num;
+}
+
+void WeightClock::Applied(const Key &key, bool need_pull) {
+  std::unique_lock<std::mutex> lock(mutex_);
+  auto iter = key_clocks_.find(key);
+  if (iter == key_clocks_.end()) {
+    return;
+  }
+  KeyClock &clock = iter->second;
+  if (EnableBoundedStaleness()) {
+    clock.pending_grad_num = 0;
+    clock.applied_clocks = clock.push_clocks;
+  } else if (need_pull) {
+    clock.tokens = worker_num_;
+  }
+  clock.version++;
+}
+
+void WeightClock::FinishUpdate() {
+  if (EnableBoundedStaleness()) {
+    return;
+  }
+  std::unique_lock<std::mutex> lock(mutex_);
+  grad_accum_count_ = 0;
+  for (auto &accum_counter : grads_accum_counter_) {
+    accum_counter.second = 0;
+  }
+}
+
+void WeightClock::Stop() {
+  {
+    std::unique_lock<std::mutex> lock(mutex_);
+    stopped_ = true;
+  }
+  update_cv_.notify_one();
+}
+}  // namespace ps
+}  // namespace mindspore
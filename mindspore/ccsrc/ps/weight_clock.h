@@ -0,0 +1,101 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef MINDSPORE_CCSRC_PS_WEIGHT_CLOCK_H_
+#define MINDSPORE_CCSRC_PS_WEIGHT_CLOCK_H_
+
+#include <condition_variable>
+#include <mutex>
+#include <vector>
+#include "utils/hash_map.h"
+#include "ps/constants.h"
+
+namespace mindspore {
+namespace ps {
+// The weight clock decides when the workers can push the gradients and pull the weights of the keys, and when the
+// server applies the gradients. All the methods are thread safe, and the callers lock the key when the clock of the
+// key must be consistent with the weight data.
+//
+// In the synchronous mode, every worker pushes one gradient of every key in one round. The gradients are applied
+// after all the gradients of the round arrive, and every worker pulls the weight once before the next round.
+// In the bounded staleness mode, every key has the clocks of workers. A worker can push the gradient of a key when it
+// is less than staleness_bound pushes ahead of the slowest worker, and can pull the weight after its gradients are
+// applied. The gradients are applied as soon as they arrive, without waiting for the gradients of all workers.
+class WeightClock {
+ public:
+  WeightClock(size_t worker_num, uint64_t staleness_bound)
+      : worker_num_(worker_num), staleness_bound_(staleness_bound) {}
+  ~WeightClock() = default;
+
+  bool EnableBoundedStaleness() const { return staleness_bound_ > 0; }
+
+  // Add the key of the weight which is pushed and pulled by the workers, the weight can't be pulled until updated.
+  void AddWeight(const Key &key);
+  // Add the key of the gradient which is accumulated in the synchronous round.
+  void AddGrad(const Key &key);
+
+  bool ReadyForPush(const Key &key, uint32_t rank_id);
+  bool ReadyForPull(const Key &key, uint32_t rank_id);
+  // Record the gradient pushed by the worker, has_grad is false when the worker pushes nothing to accumulate.
+  void Push(const Key &key, uint32_t rank_id, bool has_grad);
+  // Record the weight pulled by a worker.
+  void Pull(const Key &key);
+
+  // Wait until there are gradients to apply, return false when the clock is stopped.
+  bool WaitForUpdate();
+  // The number of gradients of the key to apply in the update, and 0 means the key is skipped.
+  size_t GradNumToApply(const Key &key);
+  // Record that the gradients of the key are applied, and the weight is pulled by every worker once if need_pull.
+  void Applied(const Key &key, bool need_pull);
+  // Start the next round after all the keys are updated.
+  void FinishUpdate();
+  // Wake up and stop the update waiting.
+  void Stop();
+
+ private:
+  struct KeyClock {
+    // The number of gradients pushed by every worker.
+    std::vector<uint64_t> push_clocks;
+    // The number of gradients of every worker which have been applied to the weight.
+    std::vector<uint64_t> applied_clocks;
+    // The number of updates applied to the weight.
+    uint64_t version{0};
+    // The number of gradients accumulated but not applied.
+    size_t pending_grad_num{0};
+    // The number of pulls left of the updated weight in the synchronous mode.
+    size_t tokens{0};
+  };
+  // Find the clock of the key, which must be called in the lock.
+  KeyClock &GetKeyClock(const Key &key, uint32_t rank_id);
+  bool ReadyForUpdate() const;
+
+  size_t worker_num_;
+  uint64_t staleness_bound_;
+
+  std::mutex mutex_;
+  std::condition_variable update_cv_;
+  bool stopped_{false};
+  mindspore::HashMap<Key, KeyClock> key_clocks_;
+  // The gradient number of keys accumulated in the current synchronous round.
+  mindspore::HashMap<Key, size_t> grads_accum_counter_;
+  // The number of keys whose gradients of all workers are accumulated in the current synchronous round.
+  size_t grad_accum_count_{0};
+  // The number of gradients pushed in the bounded staleness mode but not applied.
+  size_t pending_grad_num_{0};
+};
+}  // namespace ps
+}  // namespace mindspore
+#endif  // MINDSPORE_CCSRC_PS_WEIGHT_CLOCK_H_
@@ -21,6 +21,12 @@ namespace mindspore {
 namespace ps {
 namespace {
 constexpr int kRetryDuration = 2000;
+
+// The server responds kFailedResponse when it fails to handle a request.
+bool IsFailedResponse(const VectorPtr &resp) {
+  MS_EXCEPTION_IF_NULL(resp);
+  return resp->size() == sizeof(kFailedResponse) && resp->at(0) == kFailedResponse;
+}
 }  // namespace
 
 Worker &Worker::GetInstance() {
@@ -320,6 +326,10 @@ bool Worker::DoPSEmbeddingLookup(const Key &key, const std::vector<int> &lookup_
   std::shared_ptr<std::vector<Key>> keys = std::make_shared<std::vector<Key>>();
   int64_t value_offset = 0;
   for (size_t i = 0; i < resp.size(); ++i) {
+    if (IsFailedResponse(resp.at(i)) || resp.at(i)->empty()) {
+      MS_LOG(ERROR) << "The server " << rank_ids[i] << " failed to look up the embedding table " << key;
+      return false;
+    }
     KVMessage message;
     CHECK_RETURN_TYPE(message.ParseFromArray(resp.at(i)->data(), resp.at(i)->size()));
     for (auto j = 0; j < message.values_size(); j++) {
@@ -385,15 +395,22 @@ bool Worker::UpdateEmbeddingTable(const std::vector<Key> &keys, const std::vecto
       data_strs.emplace_back(messages.at(i).second.SerializeAsString());
     }
   }
-  while (!worker_node_.Send(core::NodeRole::SERVER, rank_ids, data_strs, LongToInt(kUpdateEmbeddingsCmd))) {
+  std::vector<VectorPtr> resp;
+  while (!worker_node_.Send(core::NodeRole::SERVER, rank_ids, data_strs, LongToInt(kUpdateEmbeddingsCmd), &resp)) {
     MS_LOG(INFO) << "Worker send failed!, retrying.";
     if (!running_) {
       MS_LOG(ERROR) << "Worker send failed!";
       return false;
     }
+    resp.clear();
     std::this_thread::sleep_for(std::chrono::milliseconds(kRetryDuration));
   }
-
+  for (size_t i = 0; i < resp.size(); ++i) {
+    if (IsFailedResponse(resp.at(i))) {
+      MS_LOG(ERROR) << "The server " << rank_ids[i] << " failed to update the embedding table.";
+      return false;
+    }
+  }
   return true;
 }
 
@@ -407,6 +424,9 @@ void Worker::Finalize() {
     worker_node_.Broadcast(core::NodeRole::SERVER, kv_data, kFinalizeCmd);
     worker_node_.Finish();
     worker_node_.Stop();
+    if (push_compressor_ != nullptr) {
+      push_compressor_->PrintTraffic();
+    }
     running_ = false;
     MS_LOG(INFO) << "Worker finalized successfully.";
   }
@@ -431,6 +451,8 @@ void Worker::Initialize() {
   broadcast_partitioner_ = [this](auto &&send, auto &&partition, auto &&attrs) {
     BroadcastPartitioner(send, partition, attrs);
   };
+  auto compress_type = PushCompressor::GetCompressType(PSContext::instance()->push_compress_type());
+  push_compressor_ = std::make_unique<PushCompressor>(compress_type, PSContext::instance()->push_topk_ratio());
 }
 
 bool Worker::IsKeyInit(const size_t key) {
@@ -641,7 +663,7 @@ void Worker::PushData(const std::vector<Key> &keys, const std::vector<float> &va
       worker_node_.Broadcast(core::NodeRole::SERVER, kv_data, cmd);
     }
   } else {
-    SendForPush(cmd, kvs, round_robin_partitioner_, {});
+    SendForPush(cmd, kvs, round_robin_partitioner_, {}, cmd == kPushCmd ? kCompressAllSegments : kCompressNoSegment);
   }
 }
 
@@ -653,9 +675,9 @@ void Worker::PushSparseData(const std::vector<Key> &keys, const std::vector<floa
   *kvs.mutable_len() = {lens.begin(), lens.end()};
   if (embedding_table_ranges_.count(keys[0])) {
     std::map<int64_t, int64_t> attrs{{0, grad_index}, {1, indice_index}, {2, first_dim_size}, {3, outer_dim_size}};
-    SendForPush(kPushCmd, kvs, sparse_partitioner_, attrs);
+    SendForPush(kPushCmd, kvs, sparse_partitioner_, attrs, SizeToLong(grad_index));
   } else {
-    SendForPush(kPushCmd, kvs, round_robin_partitioner_, {});
+    SendForPush(kPushCmd, kvs, round_robin_partitioner_, {}, SizeToLong(grad_index));
   }
 }
 
@@ -926,18 +948,29 @@ void Worker::BroadcastPartitioner(const KVMessage &send, PartitionKVMessages *pa
 }
 
 void Worker::SendForPush(int cmd, const KVMessage &send, const KVPartitioner &partitioner,
-                         const std::map<int64_t, int64_t> &attrs) {
+                         const std::map<int64_t, int64_t> &attrs, int64_t compress_index) {
   PartitionKVMessages messages;
   partitioner(send, &messages, attrs);
   std::vector<uint32_t> rank_ids;
   std::vector<std::string> data_strs;
   for (size_t i = 0; i < messages.size(); i++) {
     if (messages.at(i).first) {
+      if (cmd == kPushCmd && push_compressor_ != nullptr) {
+        push_compressor_->Compress(compress_index, &messages.at(i).second);
+      }
       rank_ids.push_back(i);
       data_strs.emplace_back(messages.at(i).second.SerializeAsString());
     }
   }
-  worker_node_.Send(core::NodeRole::SERVER, rank_ids, data_strs, cmd);
+  std::vector<VectorPtr> resp;
+  if (!worker_node_.Send(core::NodeRole::SERVER, rank_ids, data_strs, cmd, &resp)) {
+    MS_LOG(EXCEPTION) << "Send the command " << cmd << " to the servers failed.";
+  }
+  for (size_t i = 0; i < resp.size(); ++i) {
+    if (IsFailedResponse(resp.at(i))) {
+      MS_LOG(EXCEPTION) << "The server " << rank_ids[i] << " failed to handle the command " << cmd;
+    }
+  }
 }
 
 void Worker::SendForPull(int cmd, const KVMessage &send, const KVPartitioner &partitioner,
@@ -957,6 +990,9 @@ void Worker::SendForPull(int cmd, const KVMessage &send, const KVPartitioner &pa
   worker_node_.Send(core::NodeRole::SERVER, rank_ids, data_strs, cmd, &resp);
   vals->clear();
   for (size_t i = 0; i < resp.size(); ++i) {
+    if (IsFailedResponse(resp.at(i)) || resp.at(i)->empty()) {
+      MS_LOG(EXCEPTION) << "The server " << rank_ids[i] << " failed to handle the command " << cmd;
+    }
     KVMessage message;
     CHECK_RETURN_TYPE(message.ParseFromArray(resp.at(i)->data(), SizeToInt(resp.at(i)->size())));
     std::copy(message.values().begin(), message.values().end(), std::back_inserter(*vals));
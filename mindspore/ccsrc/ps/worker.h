@@ -37,6 +37,7 @@
 #include "ps/ps_cache/ps_data/ps_data_prefetch.h"
 #include "ps/core/ps_worker_node.h"
 #include "ps/embedding_table_shard_metadata.h"
+#include "ps/push_compressor.h"
 #include "proto/comm.pb.h"
 #include "proto/ps.pb.h"
 #include "ps/ps_context.h"
@@ -119,8 +120,9 @@ class BACKEND_EXPORT Worker {
                                   const std::map<int64_t, int64_t> &attrs);
   void BroadcastPartitioner(const KVMessage &send, PartitionKVMessages *partition,
                             const std::map<int64_t, int64_t> &attrs);
+  // The compress index selects the segments of partitioned push messages to be compressed.
   void SendForPush(int cmd, const KVMessage &send, const KVPartitioner &partitioner,
-                   const std::map<int64_t, int64_t> &attrs);
+                   const std::map<int64_t, int64_t> &attrs, int64_t compress_index = kCompressNoSegment);
   void SendForPull(int cmd, const KVMessage &send, const KVPartitioner &partitioner,
                    const std::map<int64_t, int64_t> &attrs, std::vector<float> *vals, std::vector<int> *lens);
 
@@ -145,6 +147,9 @@ class BACKEND_EXPORT Worker {
   mindspore::HashMap<Key, size_t> embedding_row_cnt_;
 
   mindspore::HashMap<Key, std::shared_ptr<std::vector<EmbeddingTableShardMetadata>>> embedding_table_ranges_;
+
+  // Compress the gradients pushed to the servers and record the push traffic of keys.
+  std::unique_ptr<PushCompressor> push_compressor_;
 };
 }  // namespace ps
 }  // namespace mindspore
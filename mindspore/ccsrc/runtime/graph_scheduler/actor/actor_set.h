@@ -52,6 +52,7 @@
 namespace mindspore {
 namespace runtime {
 using ActorInfo = std::string;
+class GraphReplayer;
 
 // Control actor set is a series of actors used to implement control flow:
 // switch actor judges which branch to output according to the input index;
@@ -112,6 +113,8 @@ struct ActorSet {
 #ifdef ENABLE_RPC_ACTOR
   RpcActorSetPtr rpc_actors_{nullptr};
 #endif
+  // The graph replayer runs the static cpu graph without the actor messages after the first step.
+  std::shared_ptr<GraphReplayer> graph_replayer_{nullptr};
   ActorInfo name_;
   // The related statistics information of multi thread and single thread to decide whether use the multi thread.
   bool is_multi_thread_execution_{true};
@@ -416,6 +416,49 @@ void DataPrepareActor::PrepareData(const std::vector<std::vector<TensorPtr>> &in
   }
 }
 
+void DataPrepareActor::StageNextData(const std::vector<std::vector<TensorPtr>> &input_tensors) const {
+  if ((strategy_ != GraphExecutionStrategy::kPipeline) || (host_data_source_actor_ == nullptr) ||
+      (input_tensors.size() < graph_compiler_info_->graphs_.size())) {
+    return;
+  }
+
+  // The host tensors are arranged in the same way as the host tensor queue.
+  std::vector<TensorPtr> host_tensors;
+  host_tensors.resize(host_data_source_actor_->data_nodes().size());
+  for (size_t i = 0; i < graph_compiler_info_->graphs_.size(); ++i) {
+    const auto &graph = graph_compiler_info_->graphs_[i];
+    MS_EXCEPTION_IF_NULL(graph);
+    const auto &input_nodes = graph->input_nodes();
+    const auto &tensors = input_tensors[i];
+    if (input_nodes.size() != tensors.size()) {
+      return;
+    }
+    for (size_t j = 0; j < input_nodes.size(); ++j) {
+      const auto &input_node = input_nodes[j];
+      MS_EXCEPTION_IF_NULL(input_node);
+      if (!IsHostQueueDSActor(input_node, graph, graph_compiler_info_->origin_parameters_order_, strategy_) ||
+          (tensors[j] == nullptr)) {
+        continue;
+      }
+      auto tensor_position = host_data_source_actor_->FetchNodePosition(input_node);
+      if (tensor_position < host_tensors.size()) {
+        host_tensors[tensor_position] = tensors[j];
+      }
+    }
+  }
+  host_data_source_actor_->StageData(host_tensors);
+}
+
+void DataPrepareActor::PrepareDataForReplay(const std::vector<std::vector<TensorPtr>> &input_tensors,
+                                            OpContext<DeviceTensor> *const context) {
+  MS_EXCEPTION_IF_NULL(context);
+  if (input_tensors.empty()) {
+    return;
+  }
+  SyncTensorTrunk(input_tensors);
+  PrepareDataForDeviceTensorStore(input_tensors, context);
+}
+
 void DataPrepareActor::SendDebugReq(OpContext<DeviceTensor> *const context) {
   ActorDispatcher::SendSync(*debug_aid_, &DebugActor::DebugOnStepBegin, graph_compiler_info_->graphs_,
                             graph_compiler_info_->origin_parameters_order_, graph_compiler_info_->device_contexts_,
@@ -52,6 +52,12 @@ class DataPrepareActor : public DebugAwareActor {
   // The process entry of data prepare.
   void PrepareData(const std::vector<std::vector<TensorPtr>> &input_tensors, OpContext<DeviceTensor> *const context,
                    GraphExecutionStrategy real_strategy);
+  // Stage the host tensors of the next step into the second device buffers of host data source actor, which is called
+  // during the running of current step to overlap the host to device copy with the graph execution.
+  void StageNextData(const std::vector<std::vector<TensorPtr>> &input_tensors) const;
+  // Prepare the device tensor store synchronously for the step which is replayed without actors.
+  void PrepareDataForReplay(const std::vector<std::vector<TensorPtr>> &input_tensors,
+                            OpContext<DeviceTensor> *const context);
 
   // The debug related operation interface.
   void SendDebugReq(OpContext<DeviceTensor> *const context) override;
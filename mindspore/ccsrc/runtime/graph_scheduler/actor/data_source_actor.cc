@@ -21,6 +21,7 @@
 #include "runtime/graph_scheduler/actor/recorder_actor.h"
 #include "runtime/graph_scheduler/actor/debug_actor.h"
 #include "mindrt/include/async/async.h"
+#include "mindrt/src/actor/actormgr.h"
 #include "utils/log_adapter.h"
 #include "kernel/common_utils.h"
 
@@ -263,12 +264,18 @@ void HostQueueDataSourceActor::OnMemoryAllocFinish(OpContext<DeviceTensor> *cons
                                       "The length of host tensors is not equal to the length of device tensors.");
   }
 
+  // The staged host tensors have been copied by the staging task, only need swap the device memory.
+  auto staged = FetchStagedData(host_tensors, device_tensors);
+
   // Copy data from host tensor to device tensor.
   for (size_t i = 0; i < host_tensors.size(); ++i) {
     auto &host_tensor = host_tensors[i];
     auto &device_tensor = device_tensors[i];
     MS_EXCEPTION_IF_NULL(device_tensor);
     MS_EXCEPTION_IF_NULL(host_tensor);
+    if (staged[i]) {
+      continue;
+    }
     auto tensor_device_address = std::dynamic_pointer_cast<DeviceTensor>(host_tensor->device_address());
     // Sync data from host_tensor_device_address to device_tensor.
     if (tensor_device_address != nullptr) {
@@ -293,6 +300,191 @@ void HostQueueDataSourceActor::OnMemoryAllocFinish(OpContext<DeviceTensor> *cons
   PostRun(context);
 }
 
+void DataStagerActor::StageData(const std::vector<TensorPtr> &host_tensors) {
+  MS_EXCEPTION_IF_NULL(data_source_actor_);
+  data_source_actor_->StageDataTask(host_tensors);
+}
+
+void HostQueueDataSourceActor::StageData(const std::vector<TensorPtr> &host_tensors) {
+  if (host_tensors.size() != data_nodes_.size()) {
+    MS_LOG(WARNING) << "The staging host tensors size " << host_tensors.size() << " is not equal to data nodes size "
+                    << data_nodes_.size() << " of actor: " << GetAID().Name();
+    return;
+  }
+  std::lock_guard<std::mutex> lock(staging_mutex_);
+  if (!staging_enabled_) {
+    return;
+  }
+  // The staging can't be posted to the mailbox of this actor, which would be queued behind the data of current step.
+  if (stager_actor_ == nullptr) {
+    auto actor_manager = ActorMgr::GetActorMgrRef();
+    MS_EXCEPTION_IF_NULL(actor_manager);
+    stager_actor_ = std::make_shared<DataStagerActor>(GetAID().Name() + "_stager", this);
+    (void)actor_manager->Spawn(stager_actor_);
+  }
+  Async(stager_actor_->GetAID(), &DataStagerActor::StageData, host_tensors);
+}
+
+HostQueueDataSourceActor::StagingBuffer *HostQueueDataSourceActor::TakeStagingBuffer() {
+  StagingBuffer *staging_buffer = nullptr;
+  for (auto &buffer : staging_buffers_) {
+    bool consumed = std::none_of(buffer.slots_.begin(), buffer.slots_.end(),
+                                 [](const StagingSlot &slot) { return slot.ready_; });
+    if (consumed) {
+      staging_buffer = &buffer;
+      break;
+    }
+    if ((staging_buffer == nullptr) || (buffer.sequence_ < staging_buffer->sequence_)) {
+      staging_buffer = &buffer;
+    }
+  }
+  MS_EXCEPTION_IF_NULL(staging_buffer);
+  // The staged data which is not consumed in the oldest buffer is overwritten by the newer step.
+  staging_buffer->slots_.resize(data_nodes_.size());
+  for (auto &slot : staging_buffer->slots_) {
+    slot.ready_ = false;
+    slot.host_tensor_ = nullptr;
+  }
+  staging_buffer->sequence_ = ++staging_sequence_;
+  staging_buffer->filling_ = true;
+  return staging_buffer;
+}
+
+void HostQueueDataSourceActor::StageDataTask(const std::vector<TensorPtr> &host_tensors) {
+  StagingBuffer *staging_buffer = nullptr;
+  {
+    std::lock_guard<std::mutex> lock(staging_mutex_);
+    if (!staging_enabled_) {
+      return;
+    }
+    staging_buffer = TakeStagingBuffer();
+  }
+
+  // The copy runs without the lock, the step only reads the buffers which are not being filled.
+  auto &staging_slots = staging_buffer->slots_;
+  std::vector<bool> ready(staging_slots.size(), false);
+  for (size_t i = 0; i < host_tensors.size() && i < staging_slots.size(); ++i) {
+    const auto &host_tensor = host_tensors[i];
+    // The host tensor which has the device address is used or copied by device directly.
+    if ((host_tensor == nullptr) || (host_tensor->device_address() != nullptr) || (i >= device_contexts_.size())) {
+      continue;
+    }
+    // The exception can't escape from the actor thread, the failed staging data is copied in the step as before.
+    try {
+      ready[i] = StageHostTensor(i, host_tensor, &staging_slots[i]);
+    } catch (const std::exception &e) {
+      MS_LOG(WARNING) << "Stage the data of actor " << GetAID().Name() << " failed: " << e.what();
+      ready[i] = false;
+    }
+  }
+
+  std::lock_guard<std::mutex> lock(staging_mutex_);
+  for (size_t i = 0; i < staging_slots.size(); ++i) {
+    staging_slots[i].ready_ = ready[i];
+    staging_slots[i].host_tensor_ = ready[i] ? host_tensors[i] : nullptr;
+  }
+  staging_buffer->filling_ = false;
+}
+
+bool HostQueueDataSourceActor::StageHostTensor(size_t index, const TensorPtr &host_tensor, StagingSlot *staging_slot) {
+  MS_EXCEPTION_IF_NULL(host_tensor);
+  MS_EXCEPTION_IF_NULL(staging_slot);
+  const auto &device_context = device_contexts_[index];
+  MS_EXCEPTION_IF_NULL(device_context);
+  auto data_size = LongToSize(host_tensor->data().nbytes());
+  auto &staging_device_tensor = staging_slot->device_tensor_;
+  if ((staging_device_tensor != nullptr) && (staging_device_tensor->GetSize() != data_size)) {
+    if (staging_device_tensor->GetPtr() != nullptr) {
+      device_context->device_res_manager_->FreeMemory(staging_device_tensor.get());
+    }
+    staging_device_tensor = nullptr;
+  }
+  if (staging_device_tensor == nullptr) {
+    const auto &device_tensor = AnfAlgo::GetMutableOutputAddr(data_nodes_[index], 0, false);
+    MS_EXCEPTION_IF_NULL(device_tensor);
+    staging_device_tensor = device_context->device_res_manager_->CreateDeviceAddress(
+      nullptr, data_size, device_tensor->format(), device_tensor->type_id(), device_tensor->host_shape());
+    MS_EXCEPTION_IF_NULL(staging_device_tensor);
+  }
+  if ((staging_device_tensor->GetPtr() == nullptr) &&
+      (!device_context->device_res_manager_->AllocateMemory(staging_device_tensor.get()))) {
+    MS_LOG(INFO) << "Allocate the staging memory failed and the data is copied in the step, size: " << data_size;
+    return false;
+  }
+  staging_slot->tensor_data_ = host_tensor->data_ptr().get();
+  staging_slot->host_data_ = host_tensor->data_c();
+  staging_slot->data_size_ = data_size;
+  return staging_device_tensor->SyncHostToDevice(trans::GetRuntimePaddingShape(data_nodes_[index], 0), data_size,
+                                                 host_tensor->data_type(), host_tensor->data_c(),
+                                                 host_tensor->device_info().host_format_);
+}
+
+std::vector<bool> HostQueueDataSourceActor::FetchStagedData(const std::vector<TensorPtr> &host_tensors,
+                                                            const std::vector<DeviceTensor *> &device_tensors) {
+  std::vector<bool> staged(host_tensors.size(), false);
+  std::lock_guard<std::mutex> lock(staging_mutex_);
+  for (auto &staging_buffer : staging_buffers_) {
+    if (staging_buffer.filling_) {
+      continue;
+    }
+    auto &staging_slots = staging_buffer.slots_;
+    for (size_t i = 0; i < host_tensors.size() && i < staging_slots.size(); ++i) {
+      auto &staging_slot = staging_slots[i];
+      const auto &host_tensor = host_tensors[i];
+      auto device_tensor = device_tensors[i];
+      if (staged[i] || (!staging_slot.ready_) || (staging_slot.host_tensor_ != host_tensor) ||
+          (host_tensor == nullptr) || (device_tensor == nullptr) || (host_tensor->device_address() != nullptr) ||
+          (!device_tensor->from_mem_pool()) || (staging_slot.device_tensor_->GetSize() != device_tensor->GetSize())) {
+        continue;
+      }
+      staging_slot.ready_ = false;
+      staging_slot.host_tensor_ = nullptr;
+      // The data of same tensor object may be replaced after the staging, which must be copied in the step.
+      if ((host_tensor->data_ptr().get() != staging_slot.tensor_data_) ||
+          (host_tensor->data_c() != staging_slot.host_data_) ||
+          (LongToSize(host_tensor->data().nbytes()) != staging_slot.data_size_)) {
+        MS_LOG(DEBUG) << "The data of staged tensor changes and is copied in the step, actor: " << GetAID().Name();
+        continue;
+      }
+      // Swap the buffers, the memory just allocated for the step becomes the staging memory of the later step.
+      auto staging_ptr = staging_slot.device_tensor_->GetMutablePtr();
+      staging_slot.device_tensor_->set_ptr(device_tensor->GetMutablePtr());
+      device_tensor->set_ptr(staging_ptr);
+      staged[i] = true;
+    }
+  }
+  return staged;
+}
+
+void HostQueueDataSourceActor::ClearStagingData() {
+  std::shared_ptr<DataStagerActor> stager_actor = nullptr;
+  {
+    // The staging message which is still in the mailbox of stager is ignored after disabled.
+    std::lock_guard<std::mutex> lock(staging_mutex_);
+    staging_enabled_ = false;
+    stager_actor = stager_actor_;
+    stager_actor_ = nullptr;
+  }
+  // Wait for the running staging task, which writes the staging buffer without the lock.
+  if (stager_actor != nullptr) {
+    auto actor_manager = ActorMgr::GetActorMgrRef();
+    MS_EXCEPTION_IF_NULL(actor_manager);
+    actor_manager->Terminate(stager_actor->GetAID());
+  }
+
+  std::lock_guard<std::mutex> lock(staging_mutex_);
+  for (auto &staging_buffer : staging_buffers_) {
+    for (size_t i = 0; i < staging_buffer.slots_.size(); ++i) {
+      auto &staging_device_tensor = staging_buffer.slots_[i].device_tensor_;
+      if ((staging_device_tensor != nullptr) && (staging_device_tensor->GetPtr() != nullptr)) {
+        device_contexts_[i]->device_res_manager_->FreeMemory(staging_device_tensor.get());
+      }
+    }
+    staging_buffer.slots_.clear();
+    staging_buffer.filling_ = false;
+  }
+}
+
 size_t HostQueueDataSourceActor::FetchNodePosition(const AnfNodePtr &data_node) const {
   MS_EXCEPTION_IF_NULL(data_node);
   const auto &iter = data_node_position_map_.find(data_node);
@@ -22,6 +22,8 @@
 #include <memory>
 #include <queue>
 #include <utility>
+#include <mutex>
+#include <array>
 #include "utils/hash_map.h"
 #include "runtime/graph_scheduler/actor/actor_common.h"
 #include "runtime/graph_scheduler/actor/debug_aware_actor.h"
@@ -108,6 +110,21 @@ class DeviceQueueDataSourceActor : public DataSourceActor {
   KernelLaunchInfo launch_info_;
 };
 
+class HostQueueDataSourceActor;
+// The stager actor copies the host data of next step in its own mailbox, so the staging runs in parallel with the
+// host queue data source actor and the kernels of current step.
+class DataStagerActor : public ActorBase {
+ public:
+  DataStagerActor(const std::string &name, HostQueueDataSourceActor *data_source_actor)
+      : ActorBase(name), data_source_actor_(data_source_actor) {}
+  ~DataStagerActor() override = default;
+
+  void StageData(const std::vector<TensorPtr> &host_tensors);
+
+ private:
+  HostQueueDataSourceActor *data_source_actor_;
+};
+
 // The class represents that the data source is host queue.
 class HostQueueDataSourceActor : public DataSourceActor {
  public:
@@ -130,22 +147,65 @@ class HostQueueDataSourceActor : public DataSourceActor {
 
   void ReleaseDataNodeAddress() override;
 
+  // Copy the host tensors of the next step into the staging device tensors in the stager actor, which overlaps the
+  // copy with the running of current step. The staging device tensors are swapped with the data node device tensors
+  // when the next step fetches the same host tensors with the same data. The data written in place after the staging
+  // can't be detected, so the host tensors must not be modified in place after staged.
+  void StageData(const std::vector<TensorPtr> &host_tensors);
+  // Stop the stager actor and free the staging device tensors.
+  void ClearStagingData();
+
  protected:
   void FillDataBuffer() override;
 
  private:
   friend class GraphScheduler;
   friend class ControlNodeScheduler;
+  friend class DataStagerActor;
 
   // Judge all the data_nodes_ is from the same device.
   bool IsSameDeviceType() const;
 
+  // The staging state of one data node, the host data is checked in the step because the tensor may be updated.
+  struct StagingSlot {
+    DeviceTensorPtr device_tensor_{nullptr};
+    TensorPtr host_tensor_{nullptr};
+    const void *tensor_data_{nullptr};
+    const void *host_data_{nullptr};
+    size_t data_size_{0};
+    bool ready_{false};
+  };
+  // The staged data of one step. The buffer being filled is only accessed by the stager actor, and the others are
+  // consumed by the steps.
+  struct StagingBuffer {
+    std::vector<StagingSlot> slots_;
+    size_t sequence_{0};
+    bool filling_{false};
+  };
+  void StageDataTask(const std::vector<TensorPtr> &host_tensors);
+  // Take the buffer which has been consumed or the oldest one for the staging.
+  StagingBuffer *TakeStagingBuffer();
+  bool StageHostTensor(size_t index, const TensorPtr &host_tensor, StagingSlot *staging_slot);
+  // Return the positions whose host tensor has been staged and swap the staging memory into the device tensors.
+  std::vector<bool> FetchStagedData(const std::vector<TensorPtr> &host_tensors,
+                                    const std::vector<DeviceTensor *> &device_tensors);
+
   HostTensorQueuePtr host_queue_;
   // Input data nodes fetch data from host queue.
   std::vector<AnfNodePtr> data_nodes_;
 
   // The location of the data node in the data source actor.
   mindspore::HashMap<AnfNodePtr, size_t> data_node_position_map_;
+
+  // The staging buffers are filled by the stager actor without holding the mutex, so the step running in parallel
+  // only waits for the swap of staged memory. Two buffers let the inputs of a step be staged before the staged inputs
+  // of the previous step are consumed.
+  static constexpr size_t kStagingBufferNum = 2;
+  std::mutex staging_mutex_;
+  std::array<StagingBuffer, kStagingBufferNum> staging_buffers_;
+  size_t staging_sequence_{0};
+  bool staging_enabled_{true};
+  std::shared_ptr<DataStagerActor> stager_actor_{nullptr};
 };
 
 using DataSourceActorPtr = std::shared_ptr<DataSourceActor>;
@@ -20,6 +20,7 @@
 #include "runtime/graph_scheduler/actor/recorder_actor.h"
 #include "runtime/graph_scheduler/actor/debug_actor.h"
 #include "mindrt/include/async/async.h"
+#include "mindrt/include/actor/trace.h"
 #include "utils/log_adapter.h"
 #include "distributed/recovery/recovery_context.h"
 #include "distributed/collective/collective_manager.h"
@@ -193,6 +194,9 @@ void FreeMemory(const std::vector<DeviceTensor *> &free_list, const DeviceContex
 
 void KernelActor::SendMemoryAllocReq(OpContext<DeviceTensor> *const context) {
   running_dependent_msg_num_ = 1;
+  if (ActorTrace::enabled()) {
+    memory_alloc_req_time_ = ActorTrace::NowNs();
+  }
   if (strategy_ == GraphExecutionStrategy::kPipeline) {
     if (ActorDispatcher::is_memory_allocation_sync()) {
       ActorDispatcher::SendSync(memory_manager_aid_, &MemoryManagerActor::AllocateMemory, &memory_alloc_list_,
@@ -233,6 +237,10 @@ void KernelActor::OnMemoryAllocFinish(OpContext<DeviceTensor> *const context) {
   MS_EXCEPTION_IF_NULL(context);
   MS_EXCEPTION_IF_NULL(kernel_);
   MS_EXCEPTION_IF_NULL(device_contexts_[0]);
+  if (memory_alloc_req_time_ != 0) {
+    ActorTrace::Record(TraceEventType::kMemoryWait, GetAID().Name(), memory_alloc_req_time_, ActorTrace::NowNs());
+    memory_alloc_req_time_ = 0;
+  }
   if (IsRunningFailed(context)) {
     return;
   }
@@ -245,6 +253,7 @@ void KernelActor::OnMemoryAllocFinish(OpContext<DeviceTensor> *const context) {
       MS_LOG(WARNING) << "Collective communication need reinitialize, skip launch kernel: "
                       << kernel_->fullname_with_scope();
     } else {
+      TraceScope trace_scope(TraceEventType::kKernelLaunch, GetAID().Name());
       auto ret = LaunchKernel();
       if (!ret) {
         std::string error_info = "Launch kernel failed: " + kernel_->fullname_with_scope();
@@ -104,6 +104,7 @@ class KernelActor : public DebugAwareActor {
  private:
   friend class GraphScheduler;
   friend class ControlNodeScheduler;
+  friend class GraphReplayer;
 
   // Fetch the device tensor for launch.
   void FetchInputDeviceTensor(OpContext<DeviceTensor> *const context);
@@ -153,6 +154,9 @@ class KernelActor : public DebugAwareActor {
 
   // Cache output data by output index to modify the output data effectively.
   std::vector<std::vector<OpData<DeviceTensor> *>> output_data_by_output_index_;
+
+  // The time of sending the memory alloc request, which is recorded only when the actor trace is enabled.
+  int64_t memory_alloc_req_time_{0};
 };
 
 using KernelActorPtr = std::shared_ptr<KernelActor>;
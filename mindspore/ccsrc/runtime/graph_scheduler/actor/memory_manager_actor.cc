@@ -18,6 +18,7 @@
 #include "runtime/graph_scheduler/actor/data_source_actor.h"
 #include "runtime/graph_scheduler/actor/kernel_actor.h"
 #include "mindrt/include/async/async.h"
+#include "mindrt/include/actor/trace.h"
 #include "utils/log_adapter.h"
 
 namespace mindspore {
@@ -36,6 +37,7 @@ void MemoryManagerActor::AllocateMemory(const std::vector<DeviceTensor *> *alloc
   MS_EXCEPTION_IF_NULL(alloc_list);
   MS_EXCEPTION_IF_NULL(device_context);
   MS_EXCEPTION_IF_NULL(op_context);
+  TraceScope trace_scope(TraceEventType::kMemoryAlloc, from_aid.Name());
 
   for (auto &device_tensor : *alloc_list) {
     MS_EXCEPTION_IF_NULL(device_tensor);
@@ -75,6 +77,7 @@ void MemoryManagerActor::AllocateContinuousMemory(const std::vector<std::vector<
     SET_OPCONTEXT_FAIL_RET_WITH_ERROR(
       (*op_context), "The size of alloc_list_list, size_list_list, total_size_list and device_contexts are not equal.");
   }
+  TraceScope trace_scope(TraceEventType::kMemoryAlloc, from_aid.Name());
 
   for (size_t i = 0; i < (*alloc_list_list).size(); ++i) {
     auto &alloc_list = (*alloc_list_list)[i];
@@ -125,6 +128,7 @@ void MemoryManagerActor::AllocateBatchMemory(const std::vector<DeviceTensor *> *
     SET_OPCONTEXT_FAIL_RET_WITH_ERROR((*op_context),
                                       "The size of alloc list is not equal to the size of device contexts.");
   }
+  TraceScope trace_scope(TraceEventType::kMemoryAlloc, from_aid.Name());
 
   for (size_t i = 0; i < (*alloc_list).size(); ++i) {
     auto &device_tensor = (*alloc_list)[i];
@@ -155,8 +159,20 @@ void MemoryManagerActor::AllocateBatchMemory(const std::vector<DeviceTensor *> *
 void MemoryManagerActor::FreeMemory(const std::vector<DeviceTensor *> *free_list, const DeviceContext *device_context,
                                     OpContext<DeviceTensor> *, const AID &from_aid) {
   MS_EXCEPTION_IF_NULL(free_list);
-  for (auto &device_tensor : *free_list) {
-    FreeMemoryByRefCount(device_tensor, device_context, from_aid.Name());
+  TraceScope trace_scope(TraceEventType::kMemoryFree, from_aid.Name());
+  // The reference counts of the whole list are decreased in one lock, and the memory is freed out of the lock.
+  thread_local std::vector<DeviceTensor *> need_free_device_tensors;
+  need_free_device_tensors.clear();
+  {
+    std::lock_guard<std::mutex> locker(mem_free_mutex_);
+    for (auto &device_tensor : *free_list) {
+      if (DecreaseRefCount(device_tensor, from_aid.Name())) {
+        need_free_device_tensors.push_back(device_tensor);
+      }
+    }
+  }
+  for (auto &device_tensor : need_free_device_tensors) {
+    FreeMemoryByDeviceContext(device_tensor, device_context);
   }
 }
 
@@ -170,11 +186,20 @@ void MemoryManagerActor::FreeBatchMemory(const std::vector<DeviceTensor *> *free
     SET_OPCONTEXT_FAIL_RET_WITH_ERROR((*op_context),
                                       "The size of free list is not equal to the size of device contexts.");
   }
-
-  for (size_t i = 0; i < (*free_list).size(); ++i) {
-    auto &device_tensor = (*free_list)[i];
-    auto &device_context = (*device_contexts)[i];
-    FreeMemoryByRefCount(device_tensor, device_context, from_aid.Name());
+  TraceScope trace_scope(TraceEventType::kMemoryFree, from_aid.Name());
+
+  thread_local std::vector<size_t> need_free_indexes;
+  need_free_indexes.clear();
+  {
+    std::lock_guard<std::mutex> locker(mem_free_mutex_);
+    for (size_t i = 0; i < (*free_list).size(); ++i) {
+      if (DecreaseRefCount((*free_list)[i], from_aid.Name())) {
+        need_free_indexes.push_back(i);
+      }
+    }
+  }
+  for (auto index : need_free_indexes) {
+    FreeMemoryByDeviceContext((*free_list)[index], (*device_contexts)[index]);
   }
 }
 
@@ -184,11 +209,8 @@ void MemoryManagerActor::Wait(OpContext<DeviceTensor> *const op_context, const A
 }
 
 // Only one of the static and dynamic reference counts will take effect.
-void MemoryManagerActor::FreeMemoryByRefCount(DeviceTensor *const device_tensor, const DeviceContext *device_context,
-                                              const std::string &op_name) {
+bool MemoryManagerActor::DecreaseRefCount(DeviceTensor *const device_tensor, const std::string &op_name) {
   MS_EXCEPTION_IF_NULL(device_tensor);
-
-  std::lock_guard<std::mutex> locker(mem_free_mutex_);
   if (device_tensor->original_ref_count() != SIZE_MAX) {
     // The static reference count is decremented to zero to free memory, and reset to the original count.
     device_tensor->DecreaseRefCount();
@@ -197,10 +219,9 @@ void MemoryManagerActor::FreeMemoryByRefCount(DeviceTensor *const device_tensor,
       if (device_tensor->GetPtr() != nullptr) {
         auto held_by_nodes = device_tensor->held_by_nodes();
         if (held_by_nodes.empty()) {
-          FreeMemoryByDeviceContext(device_tensor, device_context);
-        } else {
-          FreeMemoryByValueNode(held_by_nodes, device_tensor);
+          return true;
         }
+        FreeMemoryByValueNode(held_by_nodes, device_tensor);
       }
     }
   } else if (device_tensor->dynamic_ref_count() != INT32_MAX) {
@@ -208,9 +229,10 @@ void MemoryManagerActor::FreeMemoryByRefCount(DeviceTensor *const device_tensor,
     device_tensor->DecreaseDynamicRefCount(op_name);
     if ((device_tensor->dynamic_ref_count() == 0) && (device_tensor->GetPtr() != nullptr)) {
       MS_LOG(DEBUG) << "Free memory by the dynamic reference count, device address" << device_tensor->GetPtr();
-      FreeMemoryByDeviceContext(device_tensor, device_context);
+      return true;
     }
   }
+  return false;
 }
 
 void MemoryManagerActor::SetOpContextMemoryAllocFail(const std::string &kernel_name,
@@ -64,8 +64,9 @@ class MemoryManagerActor : public ActorBase {
   void Wait(OpContext<DeviceTensor> *const op_context, const AID &from_aid);
 
  private:
-  void FreeMemoryByRefCount(DeviceTensor *const device_tensor, const DeviceContext *device_context,
-                            const std::string &op_name);
+  // Decrease the reference count in the memory free lock, and return whether the memory needs to be freed by the
+  // device context. The memory free of device context is out of the lock to reduce the lock contention.
+  bool DecreaseRefCount(DeviceTensor *const device_tensor, const std::string &op_name);
 
   // When allocate device memory fail, print error log and set op context failed status.
   void SetOpContextMemoryAllocFail(const std::string &kernel_name, const DeviceContext *device_context,
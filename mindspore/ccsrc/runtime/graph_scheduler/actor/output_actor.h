@@ -76,6 +76,7 @@ class OutputActor : public AbstractActor {
  private:
   friend class GraphScheduler;
   friend class ControlNodeScheduler;
+  friend class GraphReplayer;
 
   TensorPtr CreateOutputTensor(const AnfNodePtr &output_node, size_t output_index, size_t output_position);
 
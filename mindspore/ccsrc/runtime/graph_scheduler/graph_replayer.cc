@@ -0,0 +1,473 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "runtime/graph_scheduler/graph_replayer.h"
+#include <set>
+#include <algorithm>
+#include "runtime/graph_scheduler/actor/actor_common.h"
+#include "runtime/graph_scheduler/device_tensor_store.h"
+#include "runtime/device/ms_device_shape_transfer.h"
+#include "backend/common/session/anf_runtime_algorithm.h"
+#include "include/common/utils/anfalgo.h"
+#include "distributed/recovery/recovery_context.h"
+#include "utils/ms_utils.h"
+#include "utils/log_adapter.h"
+
+namespace mindspore {
+namespace runtime {
+using distributed::recovery::RecoveryContext;
+namespace {
+// The input shapes of some graphs alternate between steps, stop recording them to avoid the repeated recording.
+constexpr size_t kMaxInvalidatedCount = 3;
+}  // namespace
+
+bool GraphReplayer::IsReplayable(const ActorSet *actor_set, const GraphCompilerInfo &graph_compiler_info) {
+  MS_EXCEPTION_IF_NULL(actor_set);
+  if (common::GetEnv(kGraphReplayEnableEnv) != "1") {
+    return false;
+  }
+  if ((graph_compiler_info.strategy_ != GraphExecutionStrategy::kPipeline) ||
+      (graph_compiler_info.control_nodes_.size() > 0) || RecoveryContext::GetInstance()->enable_recovery()) {
+    return false;
+  }
+  if ((actor_set->data_prepare_actor_ == nullptr) || (actor_set->output_actor_ == nullptr) ||
+      (actor_set->loop_count_actor_ == nullptr) || (actor_set->loop_count_actor_->loop_count() > 1)) {
+    return false;
+  }
+  if ((actor_set->control_actors_ != nullptr) || (actor_set->copy_actors_.size() > 0) ||
+      (actor_set->super_kernel_actors_.size() > 0) || (actor_set->custom_actors_.size() > 0) ||
+      (actor_set->kernel_actors_.size() == 0) ||
+      (actor_set->data_prepare_actor_->continuous_memory_nodes().size() > 0)) {
+    return false;
+  }
+#ifdef ENABLE_RPC_ACTOR
+  if ((actor_set->rpc_actors_ != nullptr) &&
+      ((actor_set->rpc_actors_->send_actors_.size() > 0) || (actor_set->rpc_actors_->recv_actors_.size() > 0))) {
+    return false;
+  }
+#endif
+
+  for (const auto &data_source_actor : actor_set->data_source_actors_) {
+    MS_EXCEPTION_IF_NULL(data_source_actor);
+    if (data_source_actor->type() != KernelTransformType::kHostDataSourceActor) {
+      return false;
+    }
+  }
+  for (const auto &device_context : graph_compiler_info.device_contexts_) {
+    MS_EXCEPTION_IF_NULL(device_context);
+    if (device_context->GetDeviceType() != device::DeviceType::kCPU) {
+      return false;
+    }
+  }
+  for (const auto &kernel_actor : actor_set->kernel_actors_) {
+    MS_EXCEPTION_IF_NULL(kernel_actor);
+    MS_EXCEPTION_IF_NULL(kernel_actor->device_contexts_[0]);
+    if ((kernel_actor->device_contexts_[0]->GetDeviceType() != device::DeviceType::kCPU) ||
+        common::AnfAlgo::IsDynamicShape(kernel_actor->kernel()) || (kernel_actor->debug_aid_ != nullptr) ||
+        (kernel_actor->recorder_aid_ != nullptr)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+void GraphReplayer::Record(const std::vector<std::vector<TensorPtr>> &input_tensors) {
+  if (recorded_ || disabled_) {
+    return;
+  }
+  if (!RecordInputSlots(input_tensors) || !RecordOutputSlots() || !RecordLaunchList()) {
+    MS_LOG(INFO) << "The actor set " << actor_set_->name_ << " can't be recorded and keeps running by the actors.";
+    Invalidate();
+    disabled_ = true;
+    return;
+  }
+  recorded_ = true;
+  MS_LOG(INFO) << "Record the actor set " << actor_set_->name_ << " with " << launch_list_.size() << " kernels, "
+               << input_slots_.size() << " inputs and " << output_slots_.size() << " outputs.";
+}
+
+bool GraphReplayer::RecordInputSlots(const std::vector<std::vector<TensorPtr>> &input_tensors) {
+  if ((input_tensors.size() < graphs_.size()) || (device_contexts_.size() < graphs_.size())) {
+    return false;
+  }
+  for (size_t i = 0; i < graphs_.size(); ++i) {
+    const auto &graph = graphs_[i];
+    const auto &device_context = device_contexts_[i];
+    MS_EXCEPTION_IF_NULL(graph);
+    MS_EXCEPTION_IF_NULL(device_context);
+    const auto &input_nodes = graph->input_nodes();
+    if (input_nodes.size() != input_tensors[i].size()) {
+      return false;
+    }
+    for (size_t j = 0; j < input_nodes.size(); ++j) {
+      const auto &input_node = input_nodes[j];
+      const auto &input_tensor = input_tensors[i][j];
+      MS_EXCEPTION_IF_NULL(input_node);
+      if (!IsHostQueueDSActor(input_node, graph, origin_parameters_order_)) {
+        continue;
+      }
+      if (input_tensor == nullptr) {
+        return false;
+      }
+      const auto &device_tensor = AnfAlgo::GetMutableOutputAddr(input_node, 0, false);
+      MS_EXCEPTION_IF_NULL(device_tensor);
+      auto buffer = device_context->device_res_manager_->CreateDeviceAddress(
+        nullptr, device_tensor->GetSize(), device_tensor->format(), device_tensor->type_id(),
+        device_tensor->host_shape());
+      MS_EXCEPTION_IF_NULL(buffer);
+      if (!device_context->device_res_manager_->AllocateMemory(buffer.get())) {
+        return false;
+      }
+      input_slot_by_node_[input_node] = input_slots_.size();
+      (void)input_slots_.emplace_back(
+        InputSlot{input_node, i, j, input_tensor->shape(), input_tensor->data_type(), buffer, device_context, {}});
+    }
+  }
+  return true;
+}
+
+bool GraphReplayer::RecordOutputSlots() {
+  const auto &output_actor = actor_set_->output_actor_;
+  std::set<size_t> device_tensor_store_positions;
+  for (const auto &device_tensor_store_key : output_actor->device_tensor_store_keys_) {
+    (void)device_tensor_store_positions.insert(device_tensor_store_key.first);
+  }
+
+  for (size_t i = 0; i < output_actor->output_device_tensors_.size(); ++i) {
+    if (device_tensor_store_positions.count(i) > 0) {
+      continue;
+    }
+    auto device_tensor = output_actor->output_device_tensors_[i];
+    const auto &output_node = output_actor->output_nodes_[i].first;
+    // Only the output of kernel can be allocated by step, the other outputs are passed through the output actor.
+    if ((device_tensor == nullptr) || (output_node == nullptr) || (!output_node->isa<CNode>()) ||
+        device_tensor->is_ptr_persisted()) {
+      return false;
+    }
+    auto iter = output_slot_by_device_tensor_.find(device_tensor);
+    if (iter != output_slot_by_device_tensor_.end()) {
+      (void)output_slots_[iter->second].output_positions_.emplace_back(i);
+      continue;
+    }
+    output_slot_by_device_tensor_[device_tensor] = output_slots_.size();
+    (void)output_slots_.emplace_back(OutputSlot{device_tensor, output_actor->device_contexts_[i], {i}, {}});
+  }
+  return true;
+}
+
+bool GraphReplayer::RecordLaunchList() {
+  mindspore::HashMap<AnfNodePtr, KernelActor *> kernel_to_actor;
+  for (const auto &kernel_actor : actor_set_->kernel_actors_) {
+    kernel_to_actor[kernel_actor->kernel()] = kernel_actor.get();
+  }
+
+  for (const auto &graph : graphs_) {
+    MS_EXCEPTION_IF_NULL(graph);
+    for (const auto &kernel : graph->execution_order()) {
+      auto iter = kernel_to_actor.find(kernel);
+      if (iter == kernel_to_actor.end()) {
+        return false;
+      }
+      auto kernel_actor = iter->second;
+      MS_EXCEPTION_IF_NULL(kernel_actor);
+      auto device_context = kernel_actor->device_contexts_[0];
+      if (std::any_of(kernel_actor->copy_input_device_tensors_.begin(),
+                      kernel_actor->copy_input_device_tensors_.end(),
+                      [](const DeviceTensorPtr &device_tensor) { return device_tensor != nullptr; })) {
+        return false;
+      }
+
+      LaunchEntry entry{kernel, device_context, {}};
+      mindspore::HashMap<size_t, AnfNodePtr> store_keys;
+      for (const auto &device_tensor_store_key : kernel_actor->device_tensor_store_keys_) {
+        store_keys[device_tensor_store_key.first] = device_tensor_store_key.second;
+      }
+      for (size_t i = 0; i < kernel_actor->input_device_tensors_.size(); ++i) {
+        auto address = std::make_shared<Address>();
+        auto store_key_iter = store_keys.find(i);
+        const auto &store_key = (store_key_iter == store_keys.end()) ? nullptr : store_key_iter->second;
+        if (!BindAddress(kernel_actor->input_device_tensors_[i], address, store_key)) {
+          return false;
+        }
+        (void)entry.launch_info_.inputs_.emplace_back(address);
+      }
+      // The kernel outputs are recorded before the binding, because the ref output shares the device tensor of input.
+      for (auto output_device_tensor : kernel_actor->output_device_tensors_) {
+        if (!AllocateStaticMemory(output_device_tensor, device_context)) {
+          return false;
+        }
+        (void)recorded_outputs_.insert(output_device_tensor);
+        auto address = std::make_shared<Address>();
+        if (!BindAddress(output_device_tensor, address)) {
+          return false;
+        }
+        (void)entry.launch_info_.outputs_.emplace_back(address);
+      }
+      for (auto workspace_device_tensor : kernel_actor->workspace_device_tensors_) {
+        if (!AllocateStaticMemory(workspace_device_tensor, device_context)) {
+          return false;
+        }
+        auto address = std::make_shared<Address>();
+        if (!BindAddress(workspace_device_tensor, address)) {
+          return false;
+        }
+        (void)entry.launch_info_.workspaces_.emplace_back(address);
+      }
+      (void)launch_list_.emplace_back(std::move(entry));
+    }
+  }
+  return launch_list_.size() == actor_set_->kernel_actors_.size();
+}
+
+bool GraphReplayer::AllocateStaticMemory(DeviceTensor *device_tensor, const DeviceContext *device_context) {
+  MS_EXCEPTION_IF_NULL(device_context);
+  if ((device_tensor == nullptr) || (output_slot_by_device_tensor_.count(device_tensor) > 0) ||
+      (device_tensor->GetPtr() != nullptr)) {
+    return device_tensor != nullptr;
+  }
+  device::DynamicMemAllocatorDebugInfo::SetDebugInfo(actor_set_->name_, device::AllocatorType::kKernelOutput);
+  if (!device_context->device_res_manager_->AllocateMemory(device_tensor)) {
+    MS_LOG(WARNING) << "Allocate the replay memory failed, size: " << device_tensor->GetSize();
+    return false;
+  }
+  (void)static_device_tensors_.emplace_back(device_tensor, device_context);
+  return true;
+}
+
+bool GraphReplayer::BindAddress(DeviceTensor *device_tensor, const AddressPtr &address, const AnfNodePtr &store_key) {
+  MS_EXCEPTION_IF_NULL(address);
+  if (device_tensor == nullptr) {
+    return false;
+  }
+  address->size = device_tensor->GetSize();
+
+  const auto &node = device_tensor->GetNodeIndex().first;
+  auto input_iter = input_slot_by_node_.find(node);
+  if (input_iter != input_slot_by_node_.end()) {
+    (void)input_slots_[input_iter->second].addresses_.emplace_back(address);
+    return true;
+  }
+  auto output_iter = output_slot_by_device_tensor_.find(device_tensor);
+  if (output_iter != output_slot_by_device_tensor_.end()) {
+    (void)output_slots_[output_iter->second].addresses_.emplace_back(address);
+    return true;
+  }
+
+  // The kernel output must be produced by the previous kernel in the launch list.
+  if ((node != nullptr) && node->isa<CNode>() && (recorded_outputs_.count(device_tensor) == 0)) {
+    return false;
+  }
+  if (device_tensor->GetPtr() == nullptr) {
+    return false;
+  }
+  address->addr = device_tensor->GetMutablePtr();
+  RecordFixedAddress(device_tensor, store_key);
+  return true;
+}
+
+void GraphReplayer::RecordFixedAddress(DeviceTensor *device_tensor, const AnfNodePtr &store_key) {
+  MS_EXCEPTION_IF_NULL(device_tensor);
+  FixedAddress fixed_address{device_tensor, device_tensor->GetMutablePtr(), nullptr, nullptr};
+  if (store_key != nullptr) {
+    // Hold the device tensor of store, the replaced one is detected by the identity in the replay.
+    for (const auto &store_device_tensor : DeviceTensorStore::GetInstance().Fetch(store_key.get())) {
+      if (store_device_tensor.get() == device_tensor) {
+        fixed_address.store_key_ = store_key;
+        fixed_address.store_device_tensor_ = store_device_tensor;
+        break;
+      }
+    }
+  }
+  (void)fixed_addresses_.emplace_back(std::move(fixed_address));
+}
+
+bool GraphReplayer::CheckFixedAddresses() const {
+  for (const auto &fixed_address : fixed_addresses_) {
+    if (fixed_address.store_key_ != nullptr) {
+      MS_EXCEPTION_IF_NULL(fixed_address.store_device_tensor_);
+      auto current_device_tensor = DeviceTensorStore::GetInstance().Fetch(
+        fixed_address.store_key_.get(), fixed_address.store_device_tensor_->GetDeviceType());
+      if (current_device_tensor != fixed_address.device_tensor_) {
+        return false;
+      }
+    }
+    if (fixed_address.device_tensor_->GetPtr() != fixed_address.ptr_) {
+      return false;
+    }
+  }
+  return true;
+}
+
+void GraphReplayer::InvalidateForChange(const std::string &reason) {
+  MS_LOG(INFO) << "The " << reason << " of actor set " << actor_set_->name_ << " changes and falls back to the actors.";
+  Invalidate();
+  if (++invalidated_count_ >= kMaxInvalidatedCount) {
+    disabled_ = true;
+  }
+}
+
+bool GraphReplayer::Run(const std::vector<std::vector<TensorPtr>> &input_tensors) {
+  if (!recorded_) {
+    return false;
+  }
+  // The replay can't go on when the input shape or type changes.
+  for (const auto &input_slot : input_slots_) {
+    if ((input_slot.graph_index_ >= input_tensors.size()) ||
+        (input_slot.input_index_ >= input_tensors[input_slot.graph_index_].size())) {
+      MS_LOG(EXCEPTION) << "The input tensors size is wrong for the actor set " << actor_set_->name_;
+    }
+    const auto &input_tensor = input_tensors[input_slot.graph_index_][input_slot.input_index_];
+    if ((input_tensor == nullptr) || (input_tensor->shape() != input_slot.shape_) ||
+        (input_tensor->data_type() != input_slot.type_id_)) {
+      InvalidateForChange("input");
+      return false;
+    }
+  }
+
+  if (!PrepareWeights(input_tensors)) {
+    return false;
+  }
+  // The weights and the other addresses resolved in the recording may be reallocated or replaced after the recording.
+  if (!CheckFixedAddresses()) {
+    InvalidateForChange("fixed address");
+    return false;
+  }
+  BindInputs(input_tensors);
+  BindOutputs();
+
+  for (auto &entry : launch_list_) {
+    MS_EXCEPTION_IF_NULL(entry.device_context_);
+    MS_EXCEPTION_IF_NULL(entry.device_context_->kernel_executor_);
+    if (!entry.device_context_->kernel_executor_->LaunchKernel(entry.kernel_, entry.launch_info_.inputs_,
+                                                                entry.launch_info_.workspaces_,
+                                                                entry.launch_info_.outputs_)) {
+      MS_LOG(EXCEPTION) << "Launch kernel failed in the replay, kernel: " << entry.kernel_->fullname_with_scope();
+    }
+  }
+
+  CollectOutputs();
+  return true;
+}
+
+bool GraphReplayer::PrepareWeights(const std::vector<std::vector<TensorPtr>> &input_tensors) {
+  // The weights may be updated by the host, which are prepared by the data prepare actor synchronously.
+  OpContext<DeviceTensor> op_context;
+  std::vector<Promise<int>> result(1);
+  op_context.sequential_num_ = RandInt::Instance().Get();
+  op_context.results_ = &result;
+  actor_set_->data_prepare_actor_->PrepareDataForReplay(input_tensors, &op_context);
+  if (IsRunningFailed(&op_context)) {
+    MS_LOG(EXCEPTION) << op_context.error_info_;
+  }
+  return true;
+}
+
+void GraphReplayer::BindInputs(const std::vector<std::vector<TensorPtr>> &input_tensors) {
+  for (auto &input_slot : input_slots_) {
+    const auto &input_tensor = input_tensors[input_slot.graph_index_][input_slot.input_index_];
+    MS_EXCEPTION_IF_NULL(input_tensor);
+    MS_EXCEPTION_IF_NULL(input_slot.buffer_);
+    void *input_ptr = input_slot.buffer_->GetMutablePtr();
+    auto tensor_address = std::dynamic_pointer_cast<DeviceTensor>(input_tensor->device_address());
+    if ((tensor_address != nullptr) && (tensor_address->GetPtr() != nullptr) &&
+        (tensor_address->GetDeviceType() == input_slot.buffer_->GetDeviceType()) &&
+        (tensor_address->format() == input_slot.buffer_->format())) {
+      // Use the device memory of input tensor directly like the data prepare actor.
+      input_ptr = tensor_address->GetMutablePtr();
+    } else if (tensor_address != nullptr) {
+      if (!Copy(input_slot.buffer_.get(), tensor_address.get())) {
+        MS_LOG(EXCEPTION) << "Copy data failed in the replay, input node: " << input_slot.node_->DebugString();
+      }
+    } else if (!input_slot.buffer_->SyncHostToDevice(trans::GetRuntimePaddingShape(input_slot.node_, 0),
+                                                      LongToSize(input_tensor->data().nbytes()),
+                                                      input_tensor->data_type(), input_tensor->data_c(),
+                                                      input_tensor->device_info().host_format_)) {
+      MS_LOG(EXCEPTION) << "SyncHostToDevice failed in the replay, input node: " << input_slot.node_->DebugString();
+    }
+    for (auto &address : input_slot.addresses_) {
+      address->addr = input_ptr;
+    }
+  }
+}
+
+void GraphReplayer::BindOutputs() {
+  for (auto &output_slot : output_slots_) {
+    auto device_tensor = output_slot.device_tensor_;
+    MS_EXCEPTION_IF_NULL(device_tensor);
+    MS_EXCEPTION_IF_NULL(output_slot.device_context_);
+    // The output memory of last step has been taken over by the output tensor.
+    if (device_tensor->GetPtr() == nullptr) {
+      device::DynamicMemAllocatorDebugInfo::SetDebugInfo(actor_set_->name_, device::AllocatorType::kKernelOutput);
+      if (!output_slot.device_context_->device_res_manager_->AllocateMemory(device_tensor)) {
+        MS_LOG(EXCEPTION) << "Device(id:" << output_slot.device_context_->device_context_key().device_id_
+                          << ") memory isn't enough and alloc failed in the replay, alloc size: "
+                          << device_tensor->GetSize() << "B.";
+      }
+    }
+    for (auto &address : output_slot.addresses_) {
+      address->addr = device_tensor->GetMutablePtr();
+    }
+  }
+}
+
+void GraphReplayer::CollectOutputs() {
+  // Fill the output actor as the actors running, then the outputs are fetched by the same way.
+  const auto &output_actor = actor_set_->output_actor_;
+  for (const auto &output_slot : output_slots_) {
+    auto node_with_index = output_slot.device_tensor_->GetNodeIndex();
+    for (auto output_position : output_slot.output_positions_) {
+      output_actor->output_nodes_[output_position] = node_with_index;
+      output_actor->output_device_tensors_[output_position] = output_slot.device_tensor_;
+      auto tensor = output_actor->CreateOutputTensor(node_with_index.first, node_with_index.second, output_position);
+      MS_EXCEPTION_IF_NULL(tensor);
+      tensor->set_need_release_device_mem(true);
+      output_actor->outputs_[output_position] = tensor;
+    }
+  }
+  for (const auto &device_tensor_store_key : output_actor->device_tensor_store_keys_) {
+    auto output_position = device_tensor_store_key.first;
+    output_actor->outputs_[output_position] = output_actor->CreateOutputTensor(device_tensor_store_key.second, 0,
+                                                                               output_position);
+    MS_EXCEPTION_IF_NULL(output_actor->outputs_[output_position]);
+    output_actor->output_nodes_[output_position] = {device_tensor_store_key.second, 0};
+    const auto &device_tensor = AnfAlgo::GetMutableOutputAddr(device_tensor_store_key.second, 0, false);
+    output_actor->output_device_tensors_[output_position] = device_tensor.get();
+  }
+}
+
+void GraphReplayer::Invalidate() {
+  for (auto &static_device_tensor : static_device_tensors_) {
+    MS_EXCEPTION_IF_NULL(static_device_tensor.first);
+    MS_EXCEPTION_IF_NULL(static_device_tensor.second);
+    static_device_tensor.second->device_res_manager_->FreeMemory(static_device_tensor.first);
+  }
+  for (auto &input_slot : input_slots_) {
+    if ((input_slot.buffer_ != nullptr) && (input_slot.buffer_->GetPtr() != nullptr)) {
+      input_slot.device_context_->device_res_manager_->FreeMemory(input_slot.buffer_.get());
+    }
+  }
+  static_device_tensors_.clear();
+  fixed_addresses_.clear();
+  launch_list_.clear();
+  input_slots_.clear();
+  output_slots_.clear();
+  input_slot_by_node_.clear();
+  output_slot_by_device_tensor_.clear();
+  recorded_outputs_.clear();
+  recorded_ = false;
+}
+}  // namespace runtime
+}  // namespace mindspore
@@ -0,0 +1,141 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef MINDSPORE_CCSRC_RUNTIME_FRAMEWORK_GRAPH_REPLAYER_H_
+#define MINDSPORE_CCSRC_RUNTIME_FRAMEWORK_GRAPH_REPLAYER_H_
+
+#include <vector>
+#include <memory>
+#include <string>
+#include <utility>
+#include "utils/hash_map.h"
+#include "utils/hash_set.h"
+#include "runtime/graph_scheduler/actor/actor_set.h"
+#include "runtime/graph_scheduler/graph_compiler.h"
+
+namespace mindspore {
+namespace runtime {
+using mindspore::kernel::AddressPtr;
+
+// The environment variable to enable the graph replay of static cpu graphs.
+constexpr char kGraphReplayEnableEnv[] = "MS_DEV_ENABLE_GRAPH_REPLAY";
+
+// The graph replayer is used to run the fully static cpu graph without the actor messages. After a step runs through
+// the actors successfully, the replayer records the kernels in execution order with the pre-resolved input, output
+// and workspace addresses. The following steps launch the recorded kernels directly in the calling thread and the
+// kernels use the cpu kernel thread pool inside. Only the graph inputs and graph outputs are bound in every step,
+// because the input tensors and the output tensors taking over the output memory change by step.
+// The memory of recorded kernels is held during the replay, so the intermediate memory isn't reused in the step. The
+// replayer is invalidated and falls back to the actor path when the shape or type of input tensors changes, or when
+// the addresses fixed in the recording, such as the weights replaced by the host, change.
+// The replayer is owned by the actor set, and keeps the graphs of graph compiler info which may be released first.
+class GraphReplayer {
+ public:
+  GraphReplayer(ActorSet *actor_set, const GraphCompilerInfo &graph_compiler_info)
+      : actor_set_(actor_set),
+        graphs_(graph_compiler_info.graphs_),
+        device_contexts_(graph_compiler_info.device_contexts_),
+        origin_parameters_order_(graph_compiler_info.origin_parameters_order_) {}
+  ~GraphReplayer() = default;
+
+  // The actor set without control flow, dynamic shape, copy, heterogeneous and debug actors can be replayed.
+  static bool IsReplayable(const ActorSet *actor_set, const GraphCompilerInfo &graph_compiler_info);
+
+  // Record the launch list by the actors state after a successful step running by the actors.
+  void Record(const std::vector<std::vector<TensorPtr>> &input_tensors);
+  // Run one step by the launch list, return false if the step needs to run by the actors.
+  bool Run(const std::vector<std::vector<TensorPtr>> &input_tensors);
+  // Release the memory held by the launch list, which must be done before the actors running.
+  void Invalidate();
+
+  bool recorded() const { return recorded_; }
+
+ private:
+  struct LaunchEntry {
+    CNodePtr kernel_;
+    const DeviceContext *device_context_;
+    KernelLaunchInfo launch_info_;
+  };
+  // The graph input is bound to the input tensor in every step.
+  struct InputSlot {
+    AnfNodePtr node_;
+    size_t graph_index_;
+    size_t input_index_;
+    ShapeVector shape_;
+    TypeId type_id_;
+    // The buffer is used when the data of input tensor can't be used by the kernels directly.
+    DeviceTensorPtr buffer_;
+    const DeviceContext *device_context_;
+    std::vector<AddressPtr> addresses_;
+  };
+  // The graph output memory is taken over by the output tensor, so the new memory is allocated in every step.
+  struct OutputSlot {
+    DeviceTensor *device_tensor_;
+    const DeviceContext *device_context_;
+    std::vector<size_t> output_positions_;
+    std::vector<AddressPtr> addresses_;
+  };
+  // The address resolved in the recording, which must be the same in the replay.
+  struct FixedAddress {
+    DeviceTensor *device_tensor_;
+    void *ptr_;
+    // The weights and value nodes are fetched from the device tensor store, which may be replaced by the host.
+    AnfNodePtr store_key_;
+    DeviceTensorPtr store_device_tensor_;
+  };
+
+  bool RecordInputSlots(const std::vector<std::vector<TensorPtr>> &input_tensors);
+  bool RecordOutputSlots();
+  bool RecordLaunchList();
+  // The store key is the front node when the device tensor is fetched from the device tensor store.
+  bool BindAddress(DeviceTensor *device_tensor, const AddressPtr &address, const AnfNodePtr &store_key = nullptr);
+  void RecordFixedAddress(DeviceTensor *device_tensor, const AnfNodePtr &store_key);
+  bool CheckFixedAddresses() const;
+  // Invalidate the replay for the change of inputs or addresses, and disable it after repeated changes.
+  void InvalidateForChange(const std::string &reason);
+  bool AllocateStaticMemory(DeviceTensor *device_tensor, const DeviceContext *device_context);
+
+  bool PrepareWeights(const std::vector<std::vector<TensorPtr>> &input_tensors);
+  void BindInputs(const std::vector<std::vector<TensorPtr>> &input_tensors);
+  void BindOutputs();
+  void CollectOutputs();
+
+  ActorSet *actor_set_;
+  std::vector<KernelGraphPtr> graphs_;
+  std::vector<DeviceContext *> device_contexts_;
+  std::vector<AnfNodePtr> origin_parameters_order_;
+
+  std::vector<LaunchEntry> launch_list_;
+  std::vector<InputSlot> input_slots_;
+  std::vector<OutputSlot> output_slots_;
+  std::vector<FixedAddress> fixed_addresses_;
+  // The maps from the device tensors to slots and the kernel outputs recorded, only used in the recording.
+  mindspore::HashMap<AnfNodePtr, size_t> input_slot_by_node_;
+  mindspore::HashMap<DeviceTensor *, size_t> output_slot_by_device_tensor_;
+  mindspore::HashSet<DeviceTensor *> recorded_outputs_;
+  // The static memory allocated by replayer, which is released in the invalidation.
+  std::vector<std::pair<DeviceTensor *, const DeviceContext *>> static_device_tensors_;
+
+  bool recorded_{false};
+  // Stop recording when the replay is invalidated too many times or the graph can't be recorded.
+  bool disabled_{false};
+  size_t invalidated_count_{0};
+};
+using GraphReplayerPtr = std::shared_ptr<GraphReplayer>;
+}  // namespace runtime
+}  // namespace mindspore
+
+#endif  // MINDSPORE_CCSRC_RUNTIME_FRAMEWORK_GRAPH_REPLAYER_H_
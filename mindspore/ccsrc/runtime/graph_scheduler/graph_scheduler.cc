@@ -17,6 +17,7 @@
 #include "runtime/graph_scheduler/graph_scheduler.h"
 #include <queue>
 #include "runtime/graph_scheduler/scheduler_helper.h"
+#include "runtime/graph_scheduler/graph_replayer.h"
 #include "runtime/graph_scheduler/actor/memory_manager_actor.h"
 #include "runtime/graph_scheduler/actor/debug_actor.h"
 #include "runtime/graph_scheduler/actor/recorder_actor.h"
@@ -27,6 +28,7 @@
 #include "runtime/hardware/device_context_manager.h"
 #include "mindrt/src/actor/actormgr.h"
 #include "mindrt/include/async/async.h"
+#include "mindrt/include/actor/trace.h"
 #include "backend/common/session/anf_runtime_algorithm.h"
 #include "include/common/utils/anfalgo.h"
 #include "backend/common/optimizer/helper.h"
@@ -79,6 +81,8 @@ using distributed::recovery::RecoveryContext;
 namespace {
 constexpr char kNumaEnableEnv[] = "MS_ENABLE_NUMA";
 constexpr char kNumaEnableEnv2[] = "DATASET_ENABLE_NUMA";
+// The environment variable of the file path to export the actor trace, the trace is disabled if it is empty.
+constexpr char kActorTraceEnv[] = "MS_DEV_ACTOR_TRACE";
 
 // For the transform state synchronization.
 constexpr char kTransformFinishPrefix[] = "TRANSFORM_FINISH_";
@@ -283,6 +287,13 @@ void GraphScheduler::Clear(const ActorInfo &actor_info, const std::vector<Kernel
       return;
     }
     auto actor_set = actors_[actor_info];
+    if (actor_set->graph_replayer_ != nullptr) {
+      actor_set->graph_replayer_->Invalidate();
+    }
+    if ((actor_set->data_prepare_actor_ != nullptr) &&
+        (actor_set->data_prepare_actor_->host_data_source_actor_ != nullptr)) {
+      actor_set->data_prepare_actor_->host_data_source_actor_->ClearStagingData();
+    }
     auto base_actors = SchedulerHelper::CollectActors(actor_set.get());
     for (auto &base_actor : base_actors) {
       MS_EXCEPTION_IF_NULL(base_actor);
@@ -324,6 +335,18 @@ void GraphScheduler::Clear() {
   MS_EXCEPTION_IF_NULL(actor_manager);
   actor_manager->Finalize();
 
+  // Export the actor trace after all actors terminated.
+  if (ActorTrace::enabled()) {
+    const auto &trace_path = common::GetEnv(kActorTraceEnv);
+    if (!ActorTrace::ExportChromeTrace(trace_path)) {
+      MS_LOG(WARNING) << "Export the actor trace to file failed: " << trace_path;
+    } else {
+      MS_LOG(INFO) << "Export the actor trace to file: " << trace_path;
+    }
+    ActorTrace::Disable();
+    ActorTrace::Clear();
+  }
+
   // Clear the member of DeviceTensorStore.
   DeviceTensorStore::GetInstance().Clear();
 
@@ -374,6 +397,10 @@ void GraphScheduler::Initialize() {
   init_ = true;
 
   BindNumaNode();
+  if (!common::GetEnv(kActorTraceEnv).empty()) {
+    MS_LOG(INFO) << "Enable the actor trace, the trace file: " << common::GetEnv(kActorTraceEnv);
+    ActorTrace::Enable();
+  }
   (void)kKernelTypeToLinkFunc.emplace(KernelTransformType::kDeviceDataSourceActor,
                                       &GraphScheduler::LinkDataArrowForBaseActor);
   (void)kKernelTypeToLinkFunc.emplace(KernelTransformType::kHostDataSourceActor,
@@ -509,6 +536,10 @@ ActorSet *GraphScheduler::Transform(const GraphCompilerInfo &graph_compiler_info
   }
 
   Optimize(actor_set);
+  if (GraphReplayer::IsReplayable(actor_set.get(), graph_compiler_info)) {
+    actor_set->graph_replayer_ = std::make_shared<GraphReplayer>(actor_set.get(), graph_compiler_info);
+    MS_LOG(INFO) << "Graph(" << graph_compiler_info.name_ << ") enables the graph replay.";
+  }
   MS_LOG(INFO) << "Graph(" << graph_compiler_info.name_ << ") transforms actor end.";
 
 #ifdef WITH_BACKEND
@@ -586,6 +617,13 @@ void GraphScheduler::Run(ActorSet *const actor_set, const std::vector<DeviceCont
   }
 #endif
 
+  // The recorded static graph is replayed without the actor messages, the actors run again when the replay fails.
+  const auto &graph_replayer = actor_set->graph_replayer_;
+  if ((graph_replayer != nullptr) && (strategy == GraphExecutionStrategy::kPipeline) &&
+      graph_replayer->Run(input_tensors)) {
+    return;
+  }
+
   // Construct OpContext.
   OpContext<DeviceTensor> op_context;
   std::vector<Promise<int>> result(1);
@@ -636,12 +674,22 @@ void GraphScheduler::Run(ActorSet *const actor_set, const std::vector<DeviceCont
   double end_time = GetTime();
   const size_t kSecondsToMilliseconds = 1000;
   SetActorExecutionStrategy(actor_set, strategy, (end_time - start_time) * kSecondsToMilliseconds);
+  if ((graph_replayer != nullptr) && (strategy == GraphExecutionStrategy::kPipeline)) {
+    graph_replayer->Record(input_tensors);
+  }
 
 #ifdef WITH_BACKEND
   DoDisasterRecovery(actor_set->name_);
 #endif
 }
 
+void GraphScheduler::PrefetchInputs(const ActorSet *actor_set,
+                                    const std::vector<std::vector<TensorPtr>> &input_tensors) const {
+  MS_EXCEPTION_IF_NULL(actor_set);
+  MS_EXCEPTION_IF_NULL(actor_set->data_prepare_actor_);
+  actor_set->data_prepare_actor_->StageNextData(input_tensors);
+}
+
 void GraphScheduler::SetActorExecutionStrategy(ActorSet *const actor_set, GraphExecutionStrategy strategy,
                                                double execution_time) const {
   MS_EXCEPTION_IF_NULL(actor_set);
@@ -77,6 +77,10 @@ class BACKEND_EXPORT GraphScheduler {
            const std::vector<TensorPtr> &input_tensors_with_value_node = {},
            GraphExecutionStrategy strategy = GraphExecutionStrategy::kPipeline);
 
+  // Stage the input tensors of the next step into the second device buffers, which can be called during the running
+  // of current step, and the next step running with the same input tensors skips the host to device copy.
+  void PrefetchInputs(const ActorSet *actor_set, const std::vector<std::vector<TensorPtr>> &input_tensors) const;
+
   // Fetch the actor set by actor info.
   ActorSet *Fetch(const ActorInfo &actor_info) const;
 
@@ -19,6 +19,7 @@
 
 #include <utility>
 #include <string>
+#include <cstdint>
 
 #include "actor/aid.h"
 
@@ -85,6 +86,9 @@ class MessageBase {
   size_t size;
 
   Type type;
+
+  // The enqueue time is set only when the actor trace is enabled.
+  int64_t enqueueTime = 0;
 };
 }  // namespace mindspore
 
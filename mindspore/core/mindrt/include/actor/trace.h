@@ -0,0 +1,88 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef MINDSPORE_CORE_MINDRT_INCLUDE_ACTOR_TRACE_H
+#define MINDSPORE_CORE_MINDRT_INCLUDE_ACTOR_TRACE_H
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include "utils/visible.h"
+
+namespace mindspore {
+enum class TraceEventType : uint8_t {
+  kMessageQueue = 0,  // From the message enqueued to the message dequeued by the actor.
+  kActorRun,          // The actor handles one message.
+  kMemoryAlloc,       // The memory manager allocates memory.
+  kMemoryFree,        // The memory manager frees memory.
+  kMemoryWait,        // From the actor sending the memory request to the memory allocated.
+  kKernelLaunch,      // The kernel launches.
+  kThreadIdle,        // The thread of pool has no task to run.
+  kEnd,
+};
+
+// The actor trace records the timeline events of the actor runtime into the ring buffer of every thread, and the
+// buffer is written by the owner thread only, so the recording is lock free. The recording costs one relaxed atomic
+// load when the trace is disabled, which is the default. The events are exported as the chrome trace json, which can
+// be opened by chrome://tracing or perfetto. The old events are overwritten when the ring buffer is full. The event
+// names are kept in full, and every distinct name is stored once per thread.
+class MS_CORE_API ActorTrace {
+ public:
+  static bool enabled() { return enabled_.load(std::memory_order_relaxed); }
+  // The capacity is the event number of ring buffer of every thread, which is used by the threads recording first.
+  static void Enable(size_t capacity = kDefaultCapacity);
+  static void Disable();
+  // Drop all the recorded events.
+  static void Clear();
+
+  static int64_t NowNs() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch())
+      .count();
+  }
+  static void Record(TraceEventType type, const char *name, int64_t start_ns, int64_t end_ns);
+  static void Record(TraceEventType type, const std::string &name, int64_t start_ns, int64_t end_ns);
+
+  // Export the events of all threads, it should be called when the actors are not running to get the complete events.
+  static bool ExportChromeTrace(const std::string &file_path);
+
+  static constexpr size_t kDefaultCapacity = 1 << 16;
+
+ private:
+  static std::atomic<bool> enabled_;
+};
+
+// Record the span of the scope when the trace is enabled at the scope beginning. The name must outlive the scope.
+class TraceScope {
+ public:
+  TraceScope(TraceEventType type, const std::string &name)
+      : type_(type), name_(ActorTrace::enabled() ? &name : nullptr) {
+    start_ = (name_ != nullptr) ? ActorTrace::NowNs() : 0;
+  }
+  ~TraceScope() {
+    if (name_ != nullptr) {
+      ActorTrace::Record(type_, *name_, start_, ActorTrace::NowNs());
+    }
+  }
+
+ private:
+  TraceEventType type_;
+  const std::string *name_;
+  int64_t start_;
+};
+}  // namespace mindspore
+
+#endif  // MINDSPORE_CORE_MINDRT_INCLUDE_ACTOR_TRACE_H
@@ -17,6 +17,7 @@
 #include "actor/actor.h"
 #include "actor/actormgr.h"
 #include "actor/iomgr.h"
+#include "actor/trace.h"
 
 namespace mindspore {
 ActorBase::ActorBase() : mailbox(nullptr), id("", ActorMgr::GetActorMgrRef()->GetUrl()), actionFunctions() {}
@@ -80,6 +81,9 @@ void ActorBase::HandlekMsg(const std::unique_ptr<MessageBase> &msg) {
   }
 }
 int ActorBase::EnqueMessage(std::unique_ptr<MessageBase> msg) const {
+  if (ActorTrace::enabled()) {
+    msg->enqueueTime = ActorTrace::NowNs();
+  }
   int ret = mailbox->EnqueueMessage(std::move(msg));
   return ret;
 }
@@ -93,12 +97,16 @@ void ActorBase::Quit() {
 void ActorBase::Run() {
   auto msgHandler = [this](const std::unique_ptr<MessageBase> &msg) {
     AddMsgRecord(msg->Name());
+    if (msg->enqueueTime != 0 && ActorTrace::enabled()) {
+      ActorTrace::Record(TraceEventType::kMessageQueue, id.Name(), msg->enqueueTime, ActorTrace::NowNs());
+    }
     switch (msg->GetType()) {
       case MessageBase::Type::KMSG:
       case MessageBase::Type::KUDP: {
         if (Filter(msg)) {
           return ERRORCODE_SUCCESS;
         }
+        TraceScope trace_scope(TraceEventType::kActorRun, id.Name());
         this->HandlekMsg(msg);
         return ERRORCODE_SUCCESS;
       }
@@ -107,6 +115,7 @@ void ActorBase::Run() {
         return ERRORCODE_SUCCESS;
       }
       case MessageBase::Type::KASYNC: {
+        TraceScope trace_scope(TraceEventType::kActorRun, id.Name());
         msg->Run(this);
         return ERRORCODE_SUCCESS;
       }
@@ -0,0 +1,173 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "actor/trace.h"
+#include <algorithm>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+namespace mindspore {
+namespace {
+constexpr double kNsToUs = 1000.0;
+const char *kTraceEventCategory[] = {"message_queue", "actor_run",     "memory_alloc", "memory_free",
+                                     "memory_wait",   "kernel_launch", "thread_idle"};
+
+struct TraceEvent {
+  int64_t start_ns;
+  int64_t end_ns;
+  TraceEventType type;
+  // The index of the name in the name table of ring.
+  uint32_t name_id;
+};
+
+struct TraceRing {
+  TraceRing(size_t capacity, size_t thread_id) : events(capacity), thread_id(thread_id) {}
+  // Find or add the full name, only the owner thread calls it.
+  uint32_t NameId(const std::string &name) {
+    auto iter = name_ids.find(name);
+    if (iter != name_ids.end()) {
+      return iter->second;
+    }
+    std::lock_guard<std::mutex> lock(names_mutex);
+    auto name_id = static_cast<uint32_t>(names.size());
+    names.push_back(name);
+    (void)name_ids.emplace(name, name_id);
+    return name_id;
+  }
+
+  std::vector<TraceEvent> events;
+  // The total number of events written, only the owner thread writes it.
+  std::atomic<size_t> head{0};
+  size_t thread_id;
+  // The names of events are interned, so the names aren't truncated and are copied once. The mutex protects the
+  // names read by the export.
+  std::unordered_map<std::string, uint32_t> name_ids;
+  std::vector<std::string> names;
+  std::mutex names_mutex;
+};
+
+struct TraceRegistry {
+  std::mutex mutex;
+  std::vector<std::shared_ptr<TraceRing>> rings;
+  size_t capacity = ActorTrace::kDefaultCapacity;
+};
+
+TraceRegistry &GetTraceRegistry() {
+  static TraceRegistry registry;
+  return registry;
+}
+
+TraceRing *GetThreadTraceRing() {
+  thread_local std::shared_ptr<TraceRing> ring = nullptr;
+  if (ring == nullptr) {
+    auto &registry = GetTraceRegistry();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+    ring = std::make_shared<TraceRing>(std::max(registry.capacity, static_cast<size_t>(1)), registry.rings.size());
+    registry.rings.push_back(ring);
+  }
+  return ring.get();
+}
+
+void WriteJsonString(std::ofstream *ofs, const std::string &str) {
+  *ofs << '"';
+  for (auto c : str) {
+    if (c == '"' || c == '\\') {
+      *ofs << '\\' << c;
+    } else if (static_cast<unsigned char>(c) >= 0x20) {
+      *ofs << c;
+    }
+  }
+  *ofs << '"';
+}
+}  // namespace
+
+std::atomic<bool> ActorTrace::enabled_{false};
+
+void ActorTrace::Enable(size_t capacity) {
+  {
+    auto &registry = GetTraceRegistry();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+    registry.capacity = capacity;
+  }
+  enabled_.store(true, std::memory_order_relaxed);
+}
+
+void ActorTrace::Disable() { enabled_.store(false, std::memory_order_relaxed); }
+
+void ActorTrace::Clear() {
+  auto &registry = GetTraceRegistry();
+  std::lock_guard<std::mutex> lock(registry.mutex);
+  for (auto &ring : registry.rings) {
+    ring->head.store(0, std::memory_order_relaxed);
+  }
+}
+
+void ActorTrace::Record(TraceEventType type, const char *name, int64_t start_ns, int64_t end_ns) {
+  if (!enabled() || name == nullptr) {
+    return;
+  }
+  Record(type, std::string(name), start_ns, end_ns);
+}
+
+void ActorTrace::Record(TraceEventType type, const std::string &name, int64_t start_ns, int64_t end_ns) {
+  if (!enabled()) {
+    return;
+  }
+  auto ring = GetThreadTraceRing();
+  auto head = ring->head.load(std::memory_order_relaxed);
+  auto &event = ring->events[head % ring->events.size()];
+  event.start_ns = start_ns;
+  event.end_ns = end_ns;
+  event.type = type;
+  event.name_id = ring->NameId(name);
+  ring->head.store(head + 1, std::memory_order_release);
+}
+
+bool ActorTrace::ExportChromeTrace(const std::string &file_path) {
+  std::ofstream ofs(file_path);
+  if (!ofs.is_open()) {
+    return false;
+  }
+  auto &registry = GetTraceRegistry();
+  std::lock_guard<std::mutex> lock(registry.mutex);
+  ofs << "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[";
+  bool first = true;
+  for (auto &ring : registry.rings) {
+    std::lock_guard<std::mutex> names_lock(ring->names_mutex);
+    auto head = ring->head.load(std::memory_order_acquire);
+    auto capacity = ring->events.size();
+    auto begin = head > capacity ? head - capacity : 0;
+    for (auto i = begin; i < head; ++i) {
+      const auto &event = ring->events[i % capacity];
+      if ((event.type >= TraceEventType::kEnd) || (event.name_id >= ring->names.size())) {
+        continue;
+      }
+      ofs << (first ? "\n" : ",\n") << "{\"name\":";
+      WriteJsonString(&ofs, ring->names[event.name_id]);
+      ofs << ",\"cat\":\"" << kTraceEventCategory[static_cast<size_t>(event.type)] << "\",\"ph\":\"X\",\"ts\":"
+          << std::fixed << (event.start_ns / kNsToUs) << ",\"dur\":" << ((event.end_ns - event.start_ns) / kNsToUs)
+          << ",\"pid\":0,\"tid\":" << ring->thread_id << "}";
+      first = false;
+    }
+  }
+  ofs << "\n]}\n";
+  ofs.close();
+  return ofs.good();
+}
+}  // namespace mindspore
@@ -57,6 +57,7 @@ bool ActorWorker::RunQueueActorTask() {
     return false;
   }
 
+  TraceIdleEnd();
   actor->Run();
   return true;
 }
@@ -118,6 +118,7 @@ bool Worker::TryRunTask(TaskSplit *task_split) {
   if (task_split == nullptr) {
     return false;
   }
+  TraceIdleEnd();
   auto task = task_split->task_;
   auto task_id = task_split->task_id_;
   task->status |= task->func(task->content, task_id, lhs_scale_, rhs_scale_);
@@ -129,6 +130,7 @@ bool Worker::RunLocalKernelTask() {
   bool res = false;
   Task *task = task_.load(std::memory_order_consume);
   if (task != nullptr) {
+    TraceIdleEnd();
     int task_id = task_id_.load(std::memory_order_consume);
     task->status |= task->func(task->content, task_id, lhs_scale_, rhs_scale_);
     task_.store(nullptr, std::memory_order_relaxed);
@@ -159,7 +161,16 @@ void Worker::RunOtherKernelTask() {
   }
 }
 
+void Worker::TraceIdleEnd() {
+  if (idle_start_ == 0) {
+    return;
+  }
+  ActorTrace::Record(TraceEventType::kThreadIdle, "idle", idle_start_, ActorTrace::NowNs());
+  idle_start_ = 0;
+}
+
 void Worker::YieldAndDeactive() {
+  TraceIdleBegin();
   // deactivate this worker only on the first entry
   if (spin_count_ == 0) {
     status_.store(kThreadIdle);
@@ -37,6 +37,7 @@
 #endif
 #include "utils/visible.h"
 #include "thread/hqueue.h"
+#include "actor/trace.h"
 
 #define USE_HQUEUE
 namespace mindspore {
@@ -121,6 +122,13 @@ class Worker {
   void Run();
   void YieldAndDeactive();
   virtual void WaitUntilActive();
+  // The idle span of thread lasts from failing to fetch a task to the next task fetched, only when trace is enabled.
+  inline void TraceIdleBegin() {
+    if (idle_start_ == 0 && ActorTrace::enabled()) {
+      idle_start_ = ActorTrace::NowNs();
+    }
+  }
+  void TraceIdleEnd();
 
   bool alive_{true};
   std::thread thread_;
@@ -145,6 +153,7 @@ class Worker {
   ThreadPool *pool_{nullptr};
   HQueue<TaskSplit> *local_task_queue_;
   size_t worker_id_{0};
+  int64_t idle_start_{0};
 };
 
 class MS_CORE_API ThreadPool {
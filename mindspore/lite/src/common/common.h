@@ -68,6 +68,14 @@ static const char *const kMSCacheSerializePath = "serialize_path";
 // weight path
 static const char *const kWeight = "weight";
 static const char *const kWeightPath = "weight_path";
+static const char *const kSharedWeightDir = "shared_weight_dir";
+// kernel auto tune
+static const char *const kAutoTune = "auto_tune";
+static const char *const kTuneCacheDir = "tune_cache_dir";
+// activation recompute of train session
+static const char *const kRecompute = "recompute";
+static const char *const kRecomputeKernelNames = "kernel_names";
+static const char *const kRecomputeMemoryBudget = "memory_budget";
 }  // namespace lite
 }  // namespace mindspore
 
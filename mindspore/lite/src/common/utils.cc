@@ -19,6 +19,8 @@
 #include <asm/hwcap.h>
 #endif
 #include "src/common/utils.h"
+#include <cstring>
+#include <fstream>
 #if defined(_MSC_VER) || defined(_WIN32)
 #include <windows.h>
 #undef ERROR
@@ -178,5 +180,53 @@ size_t GetMaxMallocSize() {
 #endif
   return max_malloc_size;
 }
+
+namespace {
+constexpr uint64_t kHashSeed = 0x9E3779B97F4A7C15ULL;
+constexpr uint64_t kHashMul = 0xFF51AFD7ED558CCDULL;
+constexpr int kHashShift = 33;
+
+inline uint64_t HashMix(uint64_t h, uint64_t v) {
+  h ^= v * kHashMul;
+  h ^= h >> kHashShift;
+  return h * kHashSeed;
+}
+}  // namespace
+
+uint64_t HashBuffer(const void *data, size_t size) {
+  auto bytes = static_cast<const uint8_t *>(data);
+  uint64_t h = kHashSeed ^ size;
+  size_t i = 0;
+  for (; i + sizeof(uint64_t) <= size; i += sizeof(uint64_t)) {
+    uint64_t word;
+    memcpy(&word, bytes + i, sizeof(uint64_t));
+    h = HashMix(h, word);
+  }
+  uint64_t tail = 0;
+  if (size > i) {
+    memcpy(&tail, bytes + i, size - i);
+  }
+  return HashMix(h, tail);
+}
+
+std::string GetCpuModelName() {
+#if defined(__linux__) || defined(__ANDROID__)
+  std::ifstream ifs("/proc/cpuinfo");
+  std::string line;
+  while (std::getline(ifs, line)) {
+    // x86 reports "model name", arm reports "Hardware" or only the cpu part
+    if (StartsWithPrefix(line, "model name") || StartsWithPrefix(line, "Hardware") ||
+        StartsWithPrefix(line, "CPU part")) {
+      auto pos = line.find(':');
+      if (pos != std::string::npos) {
+        auto name = line.substr(pos + 1);
+        Trim(&name);
+        return name;
+      }
+    }
+  }
+#endif
+  return "unknown";
+}
 }  // namespace lite
 }  // namespace mindspore
@@ -44,6 +44,12 @@ bool IsSupportSDot();
 
 size_t GetMaxMallocSize();
 
+// a fast non-cryptographic 64-bit hash of a byte buffer, used to key caches by content
+uint64_t HashBuffer(const void *data, size_t size);
+
+// model name of the cpu as reported by the os, "unknown" if it can not be read
+std::string GetCpuModelName();
+
 #ifdef __ANDROID__
 uint32_t getHwCap(int hwcap_type);
 #endif
@@ -16,6 +16,7 @@
 
 #ifndef MINDSPORE_LITE_SRC_RUNTIME_INNER_CONTEXT_H_
 #define MINDSPORE_LITE_SRC_RUNTIME_INNER_CONTEXT_H_
+#include <memory>
 #include <set>
 #include <string>
 #include <unordered_map>
@@ -35,6 +36,8 @@ namespace mindspore::lite {
 #ifdef ENABLE_MINDRT
 constexpr int kDefaultParallelNum = 2;
 #endif
+class KernelTuneCache;
+
 struct InnerContext : public Context {
  public:
   InnerContext() { InitDeviceFp16(); }
@@ -77,6 +80,9 @@ struct InnerContext : public Context {
 
   void ReplaceLinkInfoSenderWithNewOne(void *new_sender, void *old_sender);
 
+  // set when auto tune is configured, kernels with several implementations benchmark them and record the winner.
+  std::shared_ptr<KernelTuneCache> kernel_tune_cache_ = nullptr;
+
  private:
   bool IsAllDeviceTypeValid() const;
 
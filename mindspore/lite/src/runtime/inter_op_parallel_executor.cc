@@ -0,0 +1,273 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "src/runtime/inter_op_parallel_executor.h"
+#include <algorithm>
+#include <queue>
+#include "include/errorcode.h"
+#include "src/common/log_util.h"
+#include "src/common/utils.h"
+
+namespace mindspore::lite {
+namespace {
+// weight of the latest measurement in the moving average of kernel cost
+constexpr float kCostSmoothFactor = 0.2f;
+// set while the thread runs a lane, a lane task reached again from a wait beneath it must not block the thread.
+thread_local bool in_lane = false;
+}  // namespace
+
+int InterOpParallelExecutor::Prepare(const std::vector<kernel::KernelExec *> &kernels,
+                                     const std::vector<Tensor *> &inputs, const std::vector<Tensor *> &outputs,
+                                     lite::InnerContext *ctx) {
+  CHECK_NULL_RETURN(ctx);
+  ctx_ = ctx;
+  lane_num_ = MSMAX(ctx->inter_op_parallel_num_, 1);
+  thread_budget_ = MSMAX(ctx->thread_num_, 1);
+  auto ret = BuildGraph(kernels);
+  if (ret != RET_OK) {
+    MS_LOG(ERROR) << "build inter-op graph failed.";
+    return ret;
+  }
+  UpdateRank();
+  return RET_OK;
+}
+
+int InterOpParallelExecutor::BuildGraph(const std::vector<kernel::KernelExec *> &kernels) {
+  nodes_.clear();
+  topo_order_.clear();
+  max_width_ = 1;
+  std::unordered_map<kernel::KernelExec *, size_t> node_index;
+  for (auto *kernel : kernels) {
+    CHECK_NULL_RETURN(kernel);
+    node_index[kernel] = nodes_.size();
+    KernelNode node;
+    node.kernel = kernel;
+    auto parameter = kernel->op_parameter();
+    if (parameter != nullptr) {
+      node.thread_demand = MSMIN(MSMAX(parameter->thread_num_, 1), thread_budget_);
+    }
+    // before the first measurement, the output size is the best available proxy of kernel cost.
+    float out_elements = 0.0f;
+    for (auto *tensor : kernel->out_tensors()) {
+      out_elements += static_cast<float>(MSMAX(tensor->ElementsNum(), 0));
+    }
+    node.cost = MSMAX(out_elements, 1.0f);
+    nodes_.push_back(node);
+  }
+  for (auto &node : nodes_) {
+    for (auto *out_kernel : node.kernel->out_kernels()) {
+      auto iter = node_index.find(out_kernel);
+      if (iter == node_index.end()) {
+        continue;
+      }
+      node.successors.push_back(iter->second);
+      nodes_[iter->second].predecessor_num++;
+    }
+  }
+
+  // kahn's algorithm, the depth of every node gives a cheap lower bound of the graph width.
+  std::vector<size_t> in_degree(nodes_.size());
+  std::vector<size_t> depth(nodes_.size(), 0);
+  std::queue<size_t> ready;
+  for (size_t i = 0; i < nodes_.size(); i++) {
+    in_degree[i] = nodes_[i].predecessor_num;
+    if (in_degree[i] == 0) {
+      ready.push(i);
+    }
+  }
+  while (!ready.empty()) {
+    auto index = ready.front();
+    ready.pop();
+    topo_order_.push_back(index);
+    for (auto successor : nodes_[index].successors) {
+      depth[successor] = MSMAX(depth[successor], depth[index] + 1);
+      if (--in_degree[successor] == 0) {
+        ready.push(successor);
+      }
+    }
+  }
+  if (topo_order_.size() != nodes_.size()) {
+    MS_LOG(ERROR) << "kernels of subgraph contain a cycle, can not run inter-op parallel.";
+    return RET_ERROR;
+  }
+  std::unordered_map<size_t, size_t> width_by_depth;
+  for (auto d : depth) {
+    max_width_ = MSMAX(max_width_, ++width_by_depth[d]);
+  }
+  return RET_OK;
+}
+
+void InterOpParallelExecutor::UpdateRank() {
+  // upward rank: cost of the node plus the most expensive path to any exit node.
+  for (auto iter = topo_order_.rbegin(); iter != topo_order_.rend(); ++iter) {
+    auto &node = nodes_[*iter];
+    float max_successor_rank = 0.0f;
+    for (auto successor : node.successors) {
+      max_successor_rank = MSMAX(max_successor_rank, nodes_[successor].rank);
+    }
+    node.rank = node.cost + max_successor_rank;
+  }
+}
+
+bool InterOpParallelExecutor::PopReadyNode(size_t *node_index) {
+  std::unique_lock<std::mutex> lock(mutex_);
+  while (true) {
+    if (run_ret_ != RET_OK || finished_num_ == nodes_.size()) {
+      return false;
+    }
+    if (!ready_.empty()) {
+      // ready_ is a max-heap on rank, only the head is dispatched so that the critical path never waits behind
+      // a cheaper kernel that happens to fit into the remaining thread budget.
+      auto &head = nodes_[ready_.front()];
+      if (threads_in_use_ == 0 || threads_in_use_ + head.thread_demand <= thread_budget_) {
+        std::pop_heap(ready_.begin(), ready_.end(),
+                      [this](size_t a, size_t b) { return nodes_[a].rank < nodes_[b].rank; });
+        *node_index = ready_.back();
+        ready_.pop_back();
+        threads_in_use_ += head.thread_demand;
+        return true;
+      }
+    }
+    cond_.wait(lock);
+  }
+}
+
+void InterOpParallelExecutor::FinishNode(size_t node_index, int ret) {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto &node = nodes_[node_index];
+    threads_in_use_ -= node.thread_demand;
+    finished_num_++;
+    if (ret != RET_OK) {
+      run_ret_ = ret;
+    }
+    for (auto successor : node.successors) {
+      if (--pending_predecessor_[successor] == 0) {
+        ready_.push_back(successor);
+        std::push_heap(ready_.begin(), ready_.end(),
+                       [this](size_t a, size_t b) { return nodes_[a].rank < nodes_[b].rank; });
+      }
+    }
+  }
+  cond_.notify_all();
+}
+
+void InterOpParallelExecutor::RunLane() {
+  size_t node_index = 0;
+  while (PopReadyNode(&node_index)) {
+    auto &node = nodes_[node_index];
+    auto start = GetTimeUs();
+    auto ret = node.kernel->Execute(before_, after_);
+    auto cost = static_cast<float>(GetTimeUs() - start);
+    if (ret != RET_OK) {
+      MS_LOG(ERROR) << "run kernel failed, name: " << node.kernel->name();
+    }
+    // only the lane running the node touches its cost, ranks are refreshed after the run.
+    node.cost = node.measured ? (1.0f - kCostSmoothFactor) * node.cost + kCostSmoothFactor * cost : cost;
+    node.measured = true;
+    FinishNode(node_index, ret);
+  }
+}
+
+int InterOpParallelExecutor::RunRemaining() {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (run_ret_ != RET_OK || finished_num_ == nodes_.size()) {
+      return run_ret_;
+    }
+  }
+  // every lane has returned, so no node is in flight and the lane below never waits for another thread.
+  auto was_in_lane = in_lane;
+  in_lane = true;
+  RunLane();
+  in_lane = was_in_lane;
+  return run_ret_;
+}
+
+int InterOpParallelExecutor::LaneFunc(void *cdata, int task_id, float lhs_scale, float rhs_scale) {
+  if (in_lane) {
+    // the thread waits inside a kernel of a running lane, blocking here could wait for that very kernel.
+    return RET_OK;
+  }
+  auto executor = reinterpret_cast<InterOpParallelExecutor *>(cdata);
+  in_lane = true;
+  executor->RunLane();
+  in_lane = false;
+  return RET_OK;
+}
+
+int InterOpParallelExecutor::Run(const std::vector<Tensor *> &in_tensors, const std::vector<Tensor *> &out_tensors,
+                                 const std::vector<kernel::KernelExec *> &kernels, const KernelCallBack &before,
+                                 const KernelCallBack &after) {
+  CHECK_NULL_RETURN(ctx_);
+  bool kernels_changed = kernels.size() != nodes_.size();
+  for (size_t i = 0; !kernels_changed && i < kernels.size(); i++) {
+    kernels_changed = kernels[i] != nodes_[i].kernel;
+  }
+  if (kernels_changed) {
+    // runtime passes may drop or replace nodes after prepare
+    auto ret = BuildGraph(kernels);
+    if (ret != RET_OK) {
+      MS_LOG(ERROR) << "rebuild inter-op graph failed.";
+      return ret;
+    }
+    UpdateRank();
+  }
+  // kernels of different lanes finish concurrently, the user callbacks are serialized here.
+  before_ = nullptr;
+  after_ = nullptr;
+  if (before != nullptr) {
+    before_ = [this, &before](std::vector<Tensor *> inputs, std::vector<Tensor *> outputs,
+                              const MSCallBackParam &op_info) {
+      std::lock_guard<std::mutex> lock(callback_mutex_);
+      return before(inputs, outputs, op_info);
+    };
+  }
+  if (after != nullptr) {
+    after_ = [this, &after](std::vector<Tensor *> inputs, std::vector<Tensor *> outputs,
+                            const MSCallBackParam &op_info) {
+      std::lock_guard<std::mutex> lock(callback_mutex_);
+      return after(inputs, outputs, op_info);
+    };
+  }
+  pending_predecessor_.resize(nodes_.size());
+  ready_.clear();
+  finished_num_ = 0;
+  threads_in_use_ = 0;
+  run_ret_ = RET_OK;
+  for (size_t i = 0; i < nodes_.size(); i++) {
+    pending_predecessor_[i] = nodes_[i].predecessor_num;
+    if (pending_predecessor_[i] == 0) {
+      ready_.push_back(i);
+    }
+  }
+  std::make_heap(ready_.begin(), ready_.end(), [this](size_t a, size_t b) { return nodes_[a].rank < nodes_[b].rank; });
+
+  auto lane_num = static_cast<int>(MSMIN(static_cast<size_t>(lane_num_), max_width_));
+  auto ret = ParallelLaunch(ctx_, LaneFunc, this, lane_num);
+  if (ret == RET_OK) {
+    ret = RunRemaining();
+  }
+  before_ = nullptr;
+  after_ = nullptr;
+  if (ret != RET_OK || run_ret_ != RET_OK) {
+    MS_LOG(ERROR) << "inter-op parallel run failed.";
+    return run_ret_ != RET_OK ? run_ret_ : RET_ERROR;
+  }
+  UpdateRank();
+  return RET_OK;
+}
+}  // namespace mindspore::lite
@@ -0,0 +1,90 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef MINDSPORE_LITE_SRC_RUNTIME_INTER_OP_PARALLEL_EXECUTOR_H_
+#define MINDSPORE_LITE_SRC_RUNTIME_INTER_OP_PARALLEL_EXECUTOR_H_
+
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+#include "src/runtime/executor.h"
+
+namespace mindspore::lite {
+// InterOpParallelExecutor runs the independent kernels of one subgraph concurrently on `inter_op_parallel_num_`
+// lanes of the context thread pool. Ready kernels are dispatched in order of their upward rank (critical path length
+// to the graph exit), where kernel cost is the measured execution time of previous runs. A kernel is only dispatched
+// when the intra-op threads it will launch fit into the remaining thread budget of the context.
+// A lane task picked up by a thread waiting inside a nested ParallelLaunch returns at once, so a lane never blocks
+// beneath a running kernel. The before and after callbacks are called under one lock, they never run concurrently.
+class InterOpParallelExecutor : public Executor {
+ public:
+  InterOpParallelExecutor() = default;
+  ~InterOpParallelExecutor() override = default;
+
+  int Prepare(const std::vector<kernel::KernelExec *> &kernels, const std::vector<Tensor *> &inputs,
+              const std::vector<Tensor *> &outputs, lite::InnerContext *ctx) override;
+
+  int Run(const std::vector<Tensor *> &in_tensors, const std::vector<Tensor *> &out_tensors,
+          const std::vector<kernel::KernelExec *> &kernels, const KernelCallBack &before = nullptr,
+          const KernelCallBack &after = nullptr) override;
+
+  // the widest antichain found while building the graph, a subgraph of width 1 gains nothing from this executor.
+  size_t max_width() const { return max_width_; }
+
+ private:
+  struct KernelNode {
+    kernel::KernelExec *kernel = nullptr;
+    std::vector<size_t> successors;
+    size_t predecessor_num = 0;
+    int thread_demand = 1;
+    float cost = 1.0f;
+    float rank = 0.0f;
+    bool measured = false;
+  };
+
+  int BuildGraph(const std::vector<kernel::KernelExec *> &kernels);
+  void UpdateRank();
+  void RunLane();
+  // runs the nodes left over when every lane task was skipped by a nested wait.
+  int RunRemaining();
+  // blocks until a ready node fits into the thread budget, returns false once the run is over.
+  bool PopReadyNode(size_t *node_index);
+  void FinishNode(size_t node_index, int ret);
+
+  static int LaneFunc(void *cdata, int task_id, float lhs_scale, float rhs_scale);
+
+  std::vector<KernelNode> nodes_;
+  std::vector<size_t> topo_order_;
+  size_t max_width_ = 1;
+  int lane_num_ = 1;
+  int thread_budget_ = 1;
+
+  // per-run state, guarded by mutex_
+  std::mutex mutex_;
+  std::condition_variable cond_;
+  std::vector<size_t> ready_;
+  std::vector<size_t> pending_predecessor_;
+  size_t finished_num_ = 0;
+  int threads_in_use_ = 0;
+  int run_ret_ = RET_OK;
+  KernelCallBack before_ = nullptr;
+  KernelCallBack after_ = nullptr;
+  std::mutex callback_mutex_;
+};
+}  // namespace mindspore::lite
+#endif  // MINDSPORE_LITE_SRC_RUNTIME_INTER_OP_PARALLEL_EXECUTOR_H_
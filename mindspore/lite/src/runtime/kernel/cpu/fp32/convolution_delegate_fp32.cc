@@ -15,7 +15,12 @@
  */
 
 #include "src/runtime/kernel/cpu/fp32/convolution_delegate_fp32.h"
+#include <cfloat>
+#include <cstring>
+#include <sstream>
+#include "src/common/utils.h"
 #include "src/runtime/kernel_registry.h"
+#include "src/runtime/kernel_tune_cache.h"
 #include "src/runtime/kernel/cpu/fp32/convolution_fp32.h"
 #include "src/runtime/kernel/cpu/fp32/convolution_1x1_fp32.h"
 #include "src/runtime/kernel/cpu/fp32/convolution_winograd_fp32.h"
@@ -47,6 +52,10 @@ using mindspore::schema::PrimitiveType_Conv2DFusion;
 namespace mindspore::kernel {
 namespace {
 constexpr int kMaxDwConvSWSize = 32;
+constexpr int kTuneWarmupLoops = 1;
+constexpr int kTuneLoops = 3;
+// values are persisted in the tune cache, do not renumber
+enum ConvFp32Algorithm : int { kConvIm2Col = 0, kConv1x1 = 1, kConvWinograd = 2, kConvSlideWindow = 3 };
 }  // namespace
 
 float *ConvolutionDelegateCPUKernel::CopyData(const lite::Tensor *tensor) {
@@ -247,8 +256,154 @@ kernel::LiteKernel *ConvolutionDelegateCPUKernel::CpuConvFp32NHWCKernelSelect()
   return kernel;
 }
 
+std::string ConvolutionDelegateCPUKernel::TuneKey() const {
+  auto conv_param = reinterpret_cast<ConvParameter *>(op_parameter_);
+  std::ostringstream key;
+  key << "conv2d_fp32_" << conv_param->input_batch_ << "x" << conv_param->input_h_ << "x" << conv_param->input_w_ << "x"
+      << conv_param->input_channel_ << "_" << conv_param->output_channel_ << "_k" << conv_param->kernel_h_ << "x"
+      << conv_param->kernel_w_ << "_s" << conv_param->stride_h_ << "x" << conv_param->stride_w_ << "_d"
+      << conv_param->dilation_h_ << "x" << conv_param->dilation_w_ << "_p" << conv_param->pad_u_ << "x"
+      << conv_param->pad_d_ << "x" << conv_param->pad_l_ << "x" << conv_param->pad_r_ << "_a" << conv_param->act_type_
+      << "_t" << ms_context_->thread_num_;
+  return key.str();
+}
+
+kernel::LiteKernel *ConvolutionDelegateCPUKernel::CreateConvKernel(int algorithm, int out_unit) {
+  auto ctx = static_cast<const lite::InnerContext *>(this->ms_context_);
+  switch (algorithm) {
+    case kConv1x1:
+      return new (std::nothrow)
+        kernel::Convolution1x1CPUKernel(op_parameter_, in_tensors_, out_tensors_, ctx, origin_weight_, origin_bias_);
+    case kConvWinograd:
+      return new (std::nothrow) kernel::ConvolutionWinogradCPUKernel(op_parameter_, in_tensors_, out_tensors_, ctx,
+                                                                     out_unit, origin_weight_, origin_bias_);
+#ifdef ENABLE_AVX
+    case kConvSlideWindow:
+      return new (std::nothrow)
+        kernel::ConvolutionSWCPUKernel(op_parameter_, in_tensors_, out_tensors_, ctx, origin_weight_, origin_bias_);
+#endif
+    case kConvIm2Col:
+      return new (std::nothrow)
+        kernel::ConvolutionCPUKernel(op_parameter_, in_tensors_, out_tensors_, ctx, origin_weight_, origin_bias_);
+    default:
+      MS_LOG(ERROR) << "unknown conv algorithm " << algorithm;
+      return nullptr;
+  }
+}
+
+int ConvolutionDelegateCPUKernel::BenchmarkConvKernel(kernel::LiteKernel *kernel, float *cost_us) {
+  // activations are not allocated while compiling, the candidates run on scratch buffers
+  std::vector<lite::Tensor *> scratch;
+  for (auto tensor : {in_tensors_.at(kInputIndex), out_tensors_.at(kOutputIndex)}) {
+    if (tensor->data() != nullptr) {
+      continue;
+    }
+    auto data = tensor->MutableData();
+    if (data == nullptr) {
+      MS_LOG(ERROR) << "malloc scratch buffer for conv tuning failed.";
+      for (auto scratch_tensor : scratch) {
+        scratch_tensor->FreeData();
+      }
+      return RET_ERROR;
+    }
+    (void)memset(data, 0, tensor->Size());
+    scratch.push_back(tensor);
+  }
+  auto ret = RET_OK;
+  float best_cost = FLT_MAX;
+  for (int i = 0; i < kTuneWarmupLoops + kTuneLoops && ret == RET_OK; i++) {
+    auto start = lite::GetTimeUs();
+    ret = kernel->Run();
+    if (i >= kTuneWarmupLoops) {
+      best_cost = MSMIN(best_cost, static_cast<float>(lite::GetTimeUs() - start));
+    }
+  }
+  for (auto tensor : scratch) {
+    tensor->FreeData();
+  }
+  *cost_us = best_cost;
+  return ret;
+}
+
+kernel::LiteKernel *ConvolutionDelegateCPUKernel::CpuConvFp32AutoTuneSelect() {
+  auto conv_param = reinterpret_cast<ConvParameter *>(op_parameter_);
+  auto &tune_cache = static_cast<const lite::InnerContext *>(this->ms_context_)->kernel_tune_cache_;
+  auto key = TuneKey();
+  int out_unit = 0;
+  bool use_winograd = CheckIfUseWinograd(&out_unit, conv_param);
+  bool is_1x1 = conv_param->kernel_h_ == 1 && conv_param->kernel_w_ == 1;
+
+  lite::KernelTuneResult best;
+  if (!tune_cache->Find(key, &best)) {
+    std::vector<int> algorithms = {kConvIm2Col};
+    if (is_1x1) {
+      algorithms.push_back(kConv1x1);
+    }
+    if (use_winograd) {
+      algorithms.push_back(kConvWinograd);
+    }
+#ifdef ENABLE_AVX
+    // the 1x1 sliding window path does not handle padding and strides
+    if (!is_1x1 || (conv_param->pad_u_ == 0 && conv_param->pad_d_ == 0 && conv_param->pad_l_ == 0 &&
+                    conv_param->pad_r_ == 0 && conv_param->stride_h_ == 1 && conv_param->stride_w_ == 1)) {
+      algorithms.push_back(kConvSlideWindow);
+    }
+#endif
+    // candidates may rewrite derived fields of the shared parameter while preparing
+    auto origin_param = *conv_param;
+    best.algorithm = -1;
+    best.cost_us = FLT_MAX;
+    for (auto algorithm : algorithms) {
+      for (int thread_num = ms_context_->thread_num_; thread_num >= 1; thread_num /= C2NUM) {
+        *conv_param = origin_param;
+        op_parameter_->thread_num_ = thread_num;
+        auto kernel = CreateConvKernel(algorithm, out_unit);
+        if (kernel == nullptr) {
+          continue;
+        }
+        float cost_us = FLT_MAX;
+        if (kernel->Prepare() == RET_OK && BenchmarkConvKernel(kernel, &cost_us) == RET_OK && cost_us < best.cost_us) {
+          best.algorithm = algorithm;
+          best.thread_num = thread_num;
+          best.cost_us = cost_us;
+        }
+        kernel->set_parameter(nullptr);  // op_parameter is owned by the selected kernel
+        delete kernel;
+      }
+    }
+    *conv_param = origin_param;
+    if (best.algorithm < 0) {
+      MS_LOG(WARNING) << "auto tune found no runnable conv kernel for " << name_ << ", use the default selection.";
+      return nullptr;
+    }
+    MS_LOG(INFO) << "auto tune " << name_ << ": algorithm " << best.algorithm << ", thread num " << best.thread_num
+                 << ", cost " << best.cost_us << " us";
+    tune_cache->Update(key, best);
+  }
+  op_parameter_->thread_num_ = best.thread_num;
+  auto kernel = CreateConvKernel(best.algorithm, out_unit);
+  if (kernel == nullptr || kernel->Prepare() != RET_OK) {
+    MS_LOG(WARNING) << "create tuned conv kernel for " << name_ << " failed, use the default selection.";
+    if (kernel != nullptr) {
+      kernel->set_parameter(nullptr);
+      delete kernel;
+    }
+    op_parameter_->thread_num_ = ms_context_->thread_num_;
+    return nullptr;
+  }
+  kernel->set_name("act_" + name_);
+  return kernel;
+}
+
 kernel::LiteKernel *ConvolutionDelegateCPUKernel::CpuConvFp32KernelSelect() {
   kernel::LiteKernel *kernel = nullptr;
+  if (out_tensors().front()->format() != NC4HW4 && !op_parameter_->is_train_session_ &&
+      static_cast<const lite::InnerContext *>(this->ms_context_)->kernel_tune_cache_ != nullptr) {
+    kernel = CpuConvFp32AutoTuneSelect();
+    if (kernel != nullptr) {
+      return kernel;
+    }
+  }
   if (out_tensors().front()->format() == NC4HW4) {
     kernel = CpuConvFp32NC4KernelSelect();
   } else {
@@ -16,6 +16,7 @@
 #ifndef MINDSPORE_LITE_SRC_RUNTIME_KERNEL_CPU_FP32_CONVOLUTION_DELEGATE_FP32_H_
 #define MINDSPORE_LITE_SRC_RUNTIME_KERNEL_CPU_FP32_CONVOLUTION_DELEGATE_FP32_H_
 
+#include <string>
 #include <vector>
 #include "src/runtime/lite_kernel.h"
 #include "nnacl/conv_parameter.h"
@@ -84,6 +85,11 @@ class ConvolutionDelegateCPUKernel : public LiteKernel {
   kernel::LiteKernel *CpuConvFp32KernelSelect();
   kernel::LiteKernel *CpuConvFp32NC4KernelSelect();
   kernel::LiteKernel *CpuConvFp32NHWCKernelSelect();
+  // auto tune: benchmark every valid implementation and thread split once per layer shape
+  kernel::LiteKernel *CpuConvFp32AutoTuneSelect();
+  kernel::LiteKernel *CreateConvKernel(int algorithm, int out_unit);
+  int BenchmarkConvKernel(kernel::LiteKernel *kernel, float *cost_us);
+  std::string TuneKey() const;
   bool CheckAvxUseSWConv(const ConvParameter *conv_param);
   // If inferShape process can't complete in Init part, initialization of weight and bis will be implemented in runtime
   // via Resize() API. However,data of const tensor(weight and bias) doesn't exist anymore in runtime stage.Thus,
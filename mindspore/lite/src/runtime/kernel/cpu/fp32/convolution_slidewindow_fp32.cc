@@ -208,7 +208,8 @@ int ConvolutionSWCPUKernel::MallocWeightBiasData() {
   if (!op_parameter_->is_train_session_) {
     CHECK_LESS_RETURN(MAX_MALLOC_SIZE, pack_weight_size * sizeof(float));
     packed_weight_ = lite::PackWeightManager::GetInstance()->GetPackData(
-      in_tensors_[1]->data(), pack_weight_size * sizeof(float), &weight_is_packed_);
+      in_tensors_[1]->data(), pack_weight_size * sizeof(float), &weight_is_packed_,
+      "ConvolutionSWCPUKernel_" + std::to_string(oc_tile_));
     if (packed_weight_ == nullptr) {
       MS_LOG(ERROR) << "malloc packed weight failed.";
       return RET_NULL_PTR;
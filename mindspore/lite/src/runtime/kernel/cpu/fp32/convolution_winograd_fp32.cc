@@ -227,8 +227,11 @@ int ConvolutionWinogradCPUKernel::MallocWeightBiasData() {
   if (!op_parameter_->is_train_session_) {
     if (packed_weight_ == nullptr) {
       CHECK_LESS_RETURN(MAX_MALLOC_SIZE, trans_matrix_data_size);
+      auto pack_layout = "ConvolutionWinogradCPUKernel_" + std::to_string(input_unit_) + "_" +
+                         std::to_string(output_unit_) + "_" + std::to_string(oc_block_);
       packed_weight_ = lite::PackWeightManager::GetInstance()->GetPackData(in_tensors_[1]->data(),
-                                                                           trans_matrix_data_size, &weight_is_packed_);
+                                                                           trans_matrix_data_size, &weight_is_packed_,
+                                                                           pack_layout);
       if (packed_weight_ == nullptr) {
         MS_LOG(ERROR) << "malloc matrix_buffer failed.";
         return RET_MEMORY_FAILED;
@@ -194,7 +194,8 @@ int DeconvolutionDepthwiseCPUKernel::MallocWeightBiasData() {
   if (!op_parameter_->is_train_session_) {
     CHECK_LESS_RETURN(MAX_MALLOC_SIZE, pack_weight_size * sizeof(float));
     packed_weight_ = lite::PackWeightManager::GetInstance()->GetPackData(
-      in_tensors_[kWeightIndex]->data(), pack_weight_size * sizeof(float), &weight_is_packed_);
+      in_tensors_[kWeightIndex]->data(), pack_weight_size * sizeof(float), &weight_is_packed_,
+      "DeconvolutionDepthwiseCPUKernel");
     if (packed_weight_ == nullptr) {
       MS_LOG(ERROR) << "Malloc buffer failed.";
       return RET_ERROR;
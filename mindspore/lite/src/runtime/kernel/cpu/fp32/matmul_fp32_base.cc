@@ -162,8 +162,11 @@ int MatmulFp32BaseCPUKernel::PackMatrixA() {
     }
   } else {
     bool is_packed = false;
+    auto pack_layout =
+      "MatmulFp32BaseCPUKernel_a_" + std::to_string(row_tile_) + "_" + std::to_string(params_->a_transpose_);
     void *data = lite::PackWeightManager::GetInstance()->GetPackData(
-      in_tensors()[FIRST_INPUT]->data(), static_cast<size_t>(matrix_a_.pack_size) * sizeof(float), &is_packed);
+      in_tensors()[FIRST_INPUT]->data(), static_cast<size_t>(matrix_a_.pack_size) * sizeof(float), &is_packed,
+      pack_layout);
     matrix_a_.pack_ptr = reinterpret_cast<float *>(data);
     if (matrix_a_.pack_ptr == nullptr) {
       MS_LOG(ERROR) << "matrix a pack ptr is nullptr.";
@@ -218,8 +221,11 @@ int MatmulFp32BaseCPUKernel::PackMatrixB() {
     }
   } else {
     bool is_packed = false;
+    auto pack_layout =
+      "MatmulFp32BaseCPUKernel_b_" + std::to_string(col_tile_) + "_" + std::to_string(params_->b_transpose_);
     void *data = lite::PackWeightManager::GetInstance()->GetPackData(
-      in_tensors()[SECOND_INPUT]->data(), static_cast<size_t>(matrix_b_.pack_size) * sizeof(float), &is_packed);
+      in_tensors()[SECOND_INPUT]->data(), static_cast<size_t>(matrix_b_.pack_size) * sizeof(float), &is_packed,
+      pack_layout);
     matrix_b_.pack_ptr = reinterpret_cast<float *>(data);
     if (matrix_b_.pack_ptr == nullptr) {
       MS_LOG(ERROR) << "matrix b pack ptr is nullptr.";
@@ -0,0 +1,135 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "src/runtime/kernel_tune_cache.h"
+#ifdef _WIN32
+#include <process.h>
+#else
+#include <unistd.h>
+#endif
+#include <cstdio>
+#include <fstream>
+#include <iomanip>
+#include <random>
+#include <sstream>
+#include "src/common/log_adapter.h"
+#include "src/common/utils.h"
+
+namespace mindspore::lite {
+namespace {
+// processes loading the same model save the same cache file, each one writes its own temporary file.
+std::string UniqueTmpSuffix() {
+#ifdef _WIN32
+  auto pid = _getpid();
+#else
+  auto pid = getpid();
+#endif
+  std::random_device random_device;
+  std::ostringstream suffix;
+  suffix << ".tmp." << pid << "." << std::hex << random_device();
+  return suffix.str();
+}
+}  // namespace
+
+int KernelTuneCache::Init(const std::string &cache_dir, const void *model_buf, size_t model_size) {
+  if (cache_dir.empty() || model_buf == nullptr || model_size == 0) {
+    MS_LOG(ERROR) << "kernel tune cache needs a cache dir and the model buffer.";
+    return RET_INPUT_PARAM_INVALID;
+  }
+  auto cpu_name = GetCpuModelName();
+  std::ostringstream path;
+  path << cache_dir << "/" << std::hex << std::setfill('0') << std::setw(sizeof(uint64_t) * 2)
+       << HashBuffer(cpu_name.data(), cpu_name.size()) << "_" << std::setw(sizeof(uint64_t) * 2)
+       << HashBuffer(model_buf, model_size) << ".tune";
+  file_path_ = path.str();
+  MS_LOG(INFO) << "kernel tune cache " << file_path_ << " for cpu " << cpu_name;
+  return Load();
+}
+
+int KernelTuneCache::Load() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  results_.clear();
+  dirty_ = false;
+  std::ifstream ifs(file_path_);
+  if (!ifs.is_open()) {
+    MS_LOG(INFO) << "kernel tune cache " << file_path_ << " does not exist, kernels are tuned on first run.";
+    return RET_OK;
+  }
+  // one line per layer: <key> <algorithm> <thread num> <cost us>
+  std::string line;
+  while (std::getline(ifs, line)) {
+    std::istringstream line_stream(line);
+    std::string key;
+    KernelTuneResult result;
+    if (!(line_stream >> key >> result.algorithm >> result.thread_num >> result.cost_us) || result.thread_num <= 0) {
+      MS_LOG(WARNING) << "skip invalid kernel tune cache line: " << line;
+      continue;
+    }
+    results_[key] = result;
+  }
+  MS_LOG(INFO) << "load " << results_.size() << " tuned kernels from " << file_path_;
+  return RET_OK;
+}
+
+bool KernelTuneCache::Find(const std::string &key, KernelTuneResult *result) {
+  MS_ASSERT(result != nullptr);
+  std::lock_guard<std::mutex> lock(mutex_);
+  auto iter = results_.find(key);
+  if (iter == results_.end()) {
+    return false;
+  }
+  *result = iter->second;
+  return true;
+}
+
+void KernelTuneCache::Update(const std::string &key, const KernelTuneResult &result) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  results_[key] = result;
+  dirty_ = true;
+}
+
+int KernelTuneCache::Save() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (!dirty_) {
+    return RET_OK;
+  }
+  // write aside and rename, so that a concurrent load never reads a truncated cache
+  auto tmp_path = file_path_ + UniqueTmpSuffix();
+  {
+    std::ofstream ofs(tmp_path, std::ios::out | std::ios::trunc);
+    if (!ofs.is_open()) {
+      MS_LOG(ERROR) << "open kernel tune cache " << tmp_path << " failed.";
+      return RET_ERROR;
+    }
+    for (auto &item : results_) {
+      ofs << item.first << " " << item.second.algorithm << " " << item.second.thread_num << " "
+          << item.second.cost_us << "\n";
+    }
+    if (!ofs.good()) {
+      MS_LOG(ERROR) << "write kernel tune cache " << tmp_path << " failed.";
+      ofs.close();
+      (void)std::remove(tmp_path.c_str());
+      return RET_ERROR;
+    }
+  }
+  if (std::rename(tmp_path.c_str(), file_path_.c_str()) != 0) {
+    MS_LOG(ERROR) << "save kernel tune cache " << file_path_ << " failed.";
+    (void)std::remove(tmp_path.c_str());
+    return RET_ERROR;
+  }
+  dirty_ = false;
+  return RET_OK;
+}
+}  // namespace mindspore::lite
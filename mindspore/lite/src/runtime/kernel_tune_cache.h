@@ -0,0 +1,57 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef MINDSPORE_LITE_SRC_RUNTIME_KERNEL_TUNE_CACHE_H_
+#define MINDSPORE_LITE_SRC_RUNTIME_KERNEL_TUNE_CACHE_H_
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include "include/errorcode.h"
+
+namespace mindspore::lite {
+struct KernelTuneResult {
+  int algorithm = 0;
+  int thread_num = 1;
+  float cost_us = 0.0f;
+};
+
+// KernelTuneCache keeps the kernel implementation and thread split that won the on-device benchmark for every layer
+// shape. One cache file belongs to one model on one cpu model, so a later load of the same model skips the benchmark.
+class KernelTuneCache {
+ public:
+  KernelTuneCache() = default;
+  ~KernelTuneCache() = default;
+
+  // loads <cache_dir>/<cpu hash>_<model hash>.tune when it exists.
+  int Init(const std::string &cache_dir, const void *model_buf, size_t model_size);
+
+  bool Find(const std::string &key, KernelTuneResult *result);
+
+  void Update(const std::string &key, const KernelTuneResult &result);
+
+  // writes the cache back only if new layers were tuned, including the layers tuned at runtime after a resize.
+  int Save();
+
+ private:
+  int Load();
+
+  std::string file_path_;
+  std::mutex mutex_;
+  std::unordered_map<std::string, KernelTuneResult> results_;
+  bool dirty_ = false;
+};
+}  // namespace mindspore::lite
+#endif  // MINDSPORE_LITE_SRC_RUNTIME_KERNEL_TUNE_CACHE_H_
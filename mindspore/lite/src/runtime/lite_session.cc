@@ -17,6 +17,7 @@
 #include "src/runtime/lite_session.h"
 #include <set>
 #include "src/runtime/pack_weight_manager.h"
+#include "src/runtime/kernel_tune_cache.h"
 #include "src/runtime/runtime_pass.h"
 #if defined(LINUX_RUNTIME)
 #include <malloc.h>
@@ -512,6 +513,61 @@ void LiteSession::FreePackOpWeight(const std::vector<kernel::KernelExec *> &kern
   }
 }
 
+void LiteSession::RegisterSharedWeight(const std::vector<kernel::KernelExec *> &kernels) {
+  for (auto *kernel : kernels) {
+    MS_ASSERT(kernel != nullptr);
+    if (kernel->subgraph_type() != kernel::kNotSubGraph) {
+      RegisterSharedWeight(reinterpret_cast<kernel::SubGraphKernel *>(kernel)->nodes());
+      continue;
+    }
+    if (!IsPackedOp(static_cast<int>(kernel->type()))) {
+      continue;
+    }
+    auto inputs = kernel->in_tensors();
+    for (size_t i = 0; i < inputs.size(); i++) {
+      auto *tensor = inputs[i];
+      if (tensor == nullptr || !tensor->IsConst() || tensor->data() == nullptr) {
+        continue;
+      }
+      // the packed layout depends on the kernel, its data type and the role and shape of the weight. Kernels such as
+      // the conv delegate pick their implementation only when prepared, so the implementation and its packing
+      // parameters are added to the key by the kernel when it asks for the packed buffer.
+      std::string layout = std::to_string(kernel->type()) + "_" + std::to_string(kernel->desc().data_type) + "_" +
+                           std::to_string(i) + "_" + std::to_string(tensor->data_type());
+      for (auto dim : tensor->shape()) {
+        layout += "_" + std::to_string(dim);
+      }
+      PackWeightManager::GetInstance()->RegisterSharedWeight(this, tensor, std::hash<std::string>{}(layout));
+    }
+  }
+}
+
+void LiteSession::InitKernelTuneCache(const Model *model) {
+  if (config_info_ == nullptr || is_train_session_) {
+    return;
+  }
+  auto auto_tune = config_info_->find(kAutoTune);
+  if (auto_tune == config_info_->end() || auto_tune->second.find(kTuneCacheDir) == auto_tune->second.end()) {
+    return;
+  }
+  auto tune_cache = std::make_shared<KernelTuneCache>();
+  if (tune_cache == nullptr) {
+    MS_LOG(WARNING) << "new kernel tune cache failed, auto tune is disabled.";
+    return;
+  }
+  if (tune_cache->Init(auto_tune->second.at(kTuneCacheDir), model->buf, model->buf_size_) != RET_OK) {
+    MS_LOG(WARNING) << "init kernel tune cache failed, auto tune is disabled.";
+    return;
+  }
+  context_->kernel_tune_cache_ = tune_cache;
+}
+
+void LiteSession::SaveKernelTuneCache() {
+  if (context_->kernel_tune_cache_ != nullptr && context_->kernel_tune_cache_->Save() != RET_OK) {
+    MS_LOG(WARNING) << "save kernel tune cache failed, kernels will be tuned again on next load.";
+  }
+}
+
 int LiteSession::CompileGraph(Model *model) {
   auto ret = PreCheck(model);
   if (ret != RET_OK) {
@@ -538,6 +594,7 @@ int LiteSession::CompileGraph(Model *model) {
   }
   InitGraphInputTensors(model);
   InitGraphOutputTensors(model);
+  InitKernelTuneCache(model);
 
   // scheduler kernels
   Scheduler scheduler(context_, ms_context_, model, &tensors_, &inputs_, &outputs_, is_train_session_, &is_infershape_,
@@ -554,12 +611,30 @@ int LiteSession::CompileGraph(Model *model) {
 
   non_tail_call_kernels_ = scheduler.NonTailCallNodes();
 
+  auto shared_weight_dir = ParseSharedWeightDir();
+  if (!shared_weight_dir.empty() && !is_train_session_) {
+    if (PackWeightManager::GetInstance()->InitSharedWeightStore(shared_weight_dir) == RET_OK) {
+      RegisterSharedWeight(kernels_);
+      shared_weight_pending_ = true;
+    } else {
+      MS_LOG(WARNING) << "init shared weight store failed, packed weights of this model are not shared.";
+    }
+  }
+
   ret = PrepareKernels(model);
+  if (shared_weight_pending_) {
+    // origin weights may be freed once packed. The blobs are published after the first successful run, when the
+    // kernels that pack lazily have packed as well.
+    PackWeightManager::GetInstance()->ReleaseSharedWeightOrigins(this);
+  }
   if (ret != RET_OK) {
     MS_LOG(ERROR) << "Prepare kernels failed: " << ret;
+    PackWeightManager::GetInstance()->DiscardSharedWeight(this);
+    shared_weight_pending_ = false;
     is_running_.store(false);
     return ret;
   }
+  SaveKernelTuneCache();
 
   if (is_train_session_) {
     is_running_.store(false);
@@ -729,6 +804,13 @@ int LiteSession::RunGraph(const KernelCallBack &before, const KernelCallBack &af
   ret = executor_->Run(this->inputs_, this->outputs_, this->kernels_, before, after);
   if (ret != RET_OK) {
     MS_LOG(ERROR) << "RunGraph failed : " << ret;
+  } else {
+    if (shared_weight_pending_) {
+      (void)PackWeightManager::GetInstance()->CommitSharedWeight(this);
+      shared_weight_pending_ = false;
+    }
+    // kernels whose shapes are only known at runtime are tuned in their first run
+    SaveKernelTuneCache();
   }
   is_running_.store(false);
   return ret;
@@ -925,6 +1007,9 @@ LiteSession::~LiteSession() {
     MS_LOG(ERROR) << "Not support multi-threading";
     return;
   }
+  if (shared_weight_pending_) {
+    PackWeightManager::GetInstance()->DiscardSharedWeight(this);
+  }
   for (auto *kernel : kernels_) {
     delete kernel;
     kernel = nullptr;
@@ -1214,6 +1299,7 @@ int LiteSession::Resize(const std::vector<mindspore::lite::Tensor *> &inputs,
     MS_LOG(ERROR) << "GraphOptimizePass failed.";
     return RET_ERROR;
   }
+  SaveKernelTuneCache();
 
   is_running_.store(false);
 #if defined(LINUX_RUNTIME)
@@ -1685,6 +1771,20 @@ const char *lite::LiteSession::LoadModelByPath(const std::string &file, mindspor
   return lite_buf;
 }
 
+std::string lite::LiteSession::ParseSharedWeightDir() {
+  std::string shared_weight_dir = "";
+  if (config_info_ != nullptr) {
+    auto ms_weight = config_info_->find(kWeight);
+    if (ms_weight != config_info_->end()) {
+      auto ms_weight_iter = ms_weight->second;
+      if (ms_weight_iter.find(kSharedWeightDir) != ms_weight_iter.end()) {
+        shared_weight_dir = ms_weight_iter[kSharedWeightDir];
+      }
+    }
+  }
+  return shared_weight_dir;
+}
+
 int lite::LiteSession::LoadModelAndCompileByBuf(const char *model_buf, mindspore::ModelType model_type,
                                                 const size_t &buf_size) {
   size_t lite_buf_size = 0;
@@ -142,6 +142,10 @@ class LiteSession {
     const std::unordered_map<Tensor *, Tensor *> &isolate_input_map = std::unordered_map<Tensor *, Tensor *>());
   static void FreePackOpWeight(const std::vector<kernel::KernelExec *> &kernels);
   std::string ParseWeightPath();
+  std::string ParseSharedWeightDir();
+  void InitKernelTuneCache(const Model *model);
+  void SaveKernelTuneCache();
+  void RegisterSharedWeight(const std::vector<kernel::KernelExec *> &kernels);
 
  private:
   int PreCheck(Model *model);
@@ -209,6 +213,8 @@ class LiteSession {
   std::map<std::string, TypeId> *execution_plan_ = nullptr;
   const std::map<std::string, std::map<std::string, std::string>> *config_info_ = nullptr;
   std::vector<kernel::KernelExec *> non_tail_call_kernels_;
+  // packed weights of this session are in the shared weight store but not yet published
+  bool shared_weight_pending_ = false;
 };
 }  // namespace lite
 }  // namespace mindspore
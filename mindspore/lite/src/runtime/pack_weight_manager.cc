@@ -16,6 +16,7 @@
 #include "src/runtime/pack_weight_manager.h"
 #include <vector>
 #include "src/common/graph_util.h"
+#include "nnacl/op_base.h"
 namespace mindspore::lite {
 namespace {
 #ifndef __ANDROID__
@@ -146,7 +147,51 @@ void *PackWeightManager::MallocData(size_t size) {
   return data;
 }
 
-void *PackWeightManager::GetPackData(const void *tensor_data, const size_t size, bool *is_packed) {
+STATUS PackWeightManager::InitSharedWeightStore(const std::string &store_dir) {
+  MS_CHECK_TRUE_MSG(shared_weight_store_ != nullptr, RET_ERROR, "shared weight store is nullptr.");
+  auto ret = shared_weight_store_->Init(store_dir);
+  if (ret == RET_OK) {
+    shared_weight_enabled_ = true;
+  }
+  return ret;
+}
+
+void PackWeightManager::RegisterSharedWeight(const void *owner, const Tensor *origin_tensor, uint64_t layout_key) {
+  if (!shared_weight_enabled_ || origin_tensor == nullptr) {
+    return;
+  }
+  shared_weight_store_->RegisterOriginData(owner, origin_tensor->data(), origin_tensor->Size(), layout_key);
+}
+
+void PackWeightManager::ReleaseSharedWeightOrigins(const void *owner) {
+  if (!shared_weight_enabled_) {
+    return;
+  }
+  shared_weight_store_->ReleaseOrigins(owner);
+}
+
+STATUS PackWeightManager::CommitSharedWeight(const void *owner) {
+  if (!shared_weight_enabled_) {
+    return RET_OK;
+  }
+  return shared_weight_store_->Commit(owner);
+}
+
+void PackWeightManager::DiscardSharedWeight(const void *owner) {
+  if (!shared_weight_enabled_) {
+    return;
+  }
+  shared_weight_store_->Discard(owner);
+}
+
+void *PackWeightManager::GetPackData(const void *tensor_data, const size_t size, bool *is_packed,
+                                     const std::string &pack_layout) {
+  if (shared_weight_enabled_) {
+    auto data = shared_weight_store_->GetPackData(tensor_data, size, pack_layout, is_packed);
+    if (data != nullptr) {
+      return data;
+    }
+  }
 #ifdef SHARING_MODEL_WEIGHT
   if (pack_weight_ == nullptr) {
     void *data = MallocData(size);
@@ -172,6 +217,9 @@ void PackWeightManager::FreeData(void *tensor_data) {
 }
 
 void PackWeightManager::Free(void *tensor_data) {
+  if (shared_weight_enabled_ && shared_weight_store_->Free(tensor_data)) {
+    return;
+  }
 #ifdef SHARING_MODEL_WEIGHT
   if (pack_weight_ == nullptr) {
     FreeData(tensor_data);
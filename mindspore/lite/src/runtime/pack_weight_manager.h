@@ -16,11 +16,14 @@
 
 #ifndef MINDSPORE_LITE_SRC_RUNTIME_PACK_WEIGHT_MANAGER_H_
 #define MINDSPORE_LITE_SRC_RUNTIME_PACK_WEIGHT_MANAGER_H_
+#include <atomic>
 #include <memory>
+#include <string>
 #include <vector>
 #include "include/model.h"
 #include "include/errorcode.h"
 #include "src/tensor.h"
+#include "src/runtime/shared_weight_store.h"
 #ifdef SHARING_MODEL_WEIGHT
 #include "src/runtime/pack_weight.h"
 #endif
@@ -33,16 +36,26 @@ class PackWeightManager {
   STATUS InitPackWeightByBuf(const char *model_buf, size_t model_size);
   char *GetNumaModelBuf(const char *model_buf, int numa_id);
   STATUS StoreOriginTensorData(Model *model, std::vector<Tensor *> *all_tensors);
-  void *GetPackData(const void *tensor_data, const size_t size, bool *is_packed);
+  // pack_layout names the kernel implementation and its packing parameters, see SharedWeightStore::GetPackData.
+  void *GetPackData(const void *tensor_data, const size_t size, bool *is_packed, const std::string &pack_layout);
   void Free(void *tensor_data);
   bool IsCopyTensor(int op_type);
   void *ReplaceFp16Data(void *origin_fp16_data, size_t size, bool *replace);
+  STATUS InitSharedWeightStore(const std::string &store_dir);
+  void RegisterSharedWeight(const void *owner, const Tensor *origin_tensor, uint64_t layout_key);
+  void ReleaseSharedWeightOrigins(const void *owner);
+  STATUS CommitSharedWeight(const void *owner);
+  void DiscardSharedWeight(const void *owner);
 
  private:
   void *MallocData(size_t size);
   void FreeData(void *tensor_data);
   PackWeightManager() = default;
   bool is_parallel_ = false;
+  // the store is created with the manager, so sessions compiled concurrently never race on creating it. It is only
+  // used after the first successful InitSharedWeightStore.
+  const std::unique_ptr<SharedWeightStore> shared_weight_store_ = std::make_unique<SharedWeightStore>();
+  std::atomic<bool> shared_weight_enabled_{false};
 #ifdef SHARING_MODEL_WEIGHT
   std::shared_ptr<PackWeight> pack_weight_ = nullptr;
 #endif
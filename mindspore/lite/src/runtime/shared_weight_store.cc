@@ -0,0 +1,277 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "src/runtime/shared_weight_store.h"
+#ifndef _WIN32
+#include <dirent.h>
+#include <fcntl.h>
+#include <signal.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+#include <cerrno>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <functional>
+#include <iomanip>
+#include <iterator>
+#include <sstream>
+#include "src/common/log_adapter.h"
+#include "src/common/utils.h"
+
+namespace mindspore::lite {
+namespace {
+// packed layouts differ by instruction set, so blobs of different builds must never be mixed.
+#if defined(ENABLE_AVX512)
+constexpr const char *kPackLayoutTag = "avx512";
+#elif defined(ENABLE_AVX)
+constexpr const char *kPackLayoutTag = "avx";
+#elif defined(ENABLE_SSE)
+constexpr const char *kPackLayoutTag = "sse";
+#elif defined(ENABLE_ARM64)
+constexpr const char *kPackLayoutTag = "arm64";
+#elif defined(ENABLE_ARM32)
+constexpr const char *kPackLayoutTag = "arm32";
+#else
+constexpr const char *kPackLayoutTag = "generic";
+#endif
+
+// the packed data follows the header at an offset that keeps the alignment the kernels get from malloc.
+constexpr size_t kBlobHeaderSize = 64;
+constexpr uint64_t kBlobMagic = 0x31424C4257535053ULL;  // "SPSWBLB1"
+constexpr const char *kTmpBlobTag = ".tmp.";
+constexpr uint64_t kLayoutMul = 0x9E3779B97F4A7C15ULL;
+}  // namespace
+
+SharedWeightStore::~SharedWeightStore() {
+#ifndef _WIN32
+  std::lock_guard<std::mutex> lock(mutex_);
+  for (auto &pending : pending_) {
+    (void)unlink(pending.tmp_path.c_str());
+  }
+  for (auto &item : mapped_size_) {
+    (void)munmap(static_cast<char *>(item.first) - kBlobHeaderSize, item.second);
+  }
+#endif
+  mapped_size_.clear();
+}
+
+int SharedWeightStore::Init(const std::string &store_dir) {
+#ifdef _WIN32
+  MS_LOG(ERROR) << "shared weight store is not supported on windows.";
+  return RET_NOT_SUPPORT;
+#else
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (store_dir_ == store_dir) {
+    return RET_OK;
+  }
+  if (!store_dir_.empty()) {
+    MS_LOG(ERROR) << "shared weight store already uses " << store_dir_ << ", can not switch to " << store_dir;
+    return RET_ERROR;
+  }
+  struct stat dir_stat;
+  if (stat(store_dir.c_str(), &dir_stat) != 0 || !S_ISDIR(dir_stat.st_mode)) {
+    MS_LOG(ERROR) << "shared weight dir " << store_dir << " is not an existing directory.";
+    return RET_ERROR;
+  }
+  store_dir_ = store_dir;
+  RemoveStaleBlobs();
+  return RET_OK;
+#endif
+}
+
+void SharedWeightStore::RemoveStaleBlobs() {
+#ifndef _WIN32
+  auto dir = opendir(store_dir_.c_str());
+  if (dir == nullptr) {
+    return;
+  }
+  for (auto entry = readdir(dir); entry != nullptr; entry = readdir(dir)) {
+    std::string name = entry->d_name;
+    // temporary blobs are named <blob>.tmp.<pid>.<index>, and are stale once the process that packs them is gone.
+    auto pos = name.rfind(kTmpBlobTag);
+    if (pos == std::string::npos) {
+      continue;
+    }
+    char *end = nullptr;
+    auto pid = strtol(name.c_str() + pos + strlen(kTmpBlobTag), &end, 10);
+    if (end == nullptr || *end != '.' || pid <= 0) {
+      continue;
+    }
+    if (kill(static_cast<pid_t>(pid), 0) != 0 && errno == ESRCH) {
+      MS_LOG(INFO) << "remove stale shared packed weight " << name;
+      (void)unlink((store_dir_ + "/" + name).c_str());
+    }
+  }
+  (void)closedir(dir);
+#endif
+}
+
+void SharedWeightStore::RegisterOriginData(const void *owner, const void *origin_data, size_t origin_size,
+                                           uint64_t layout_key) {
+  if (origin_data == nullptr || origin_size == 0) {
+    return;
+  }
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (store_dir_.empty()) {
+    return;
+  }
+  origins_[origin_data] = {owner, origin_size, layout_key};
+}
+
+std::string SharedWeightStore::BlobPath(const BlobHeader &header) const {
+  std::ostringstream path;
+  path << store_dir_ << "/" << kPackLayoutTag << "_" << std::hex << std::setfill('0')
+       << std::setw(sizeof(uint64_t) * 2) << header.origin_hash << "_" << std::setw(sizeof(uint64_t) * 2)
+       << header.layout_key << std::dec << "_" << header.origin_size << "_" << header.packed_size << ".bin";
+  return path.str();
+}
+
+void *SharedWeightStore::MapBlob(const std::string &path, const BlobHeader &header, bool create) {
+#ifdef _WIN32
+  return nullptr;
+#else
+  int fd = create ? open(path.c_str(), O_RDWR | O_CREAT | O_EXCL, S_IRUSR | S_IWUSR) : open(path.c_str(), O_RDONLY);
+  if (fd < 0) {
+    return nullptr;
+  }
+  size_t size = kBlobHeaderSize + header.packed_size;
+  struct stat file_stat;
+  if (create ? ftruncate(fd, static_cast<off_t>(size)) != 0
+             : fstat(fd, &file_stat) != 0 || static_cast<size_t>(file_stat.st_size) != size) {
+    (void)close(fd);
+    return nullptr;
+  }
+  // a committed blob is mapped copy-on-write, so pages stay shared unless a kernel repacks in place.
+  auto base = create ? mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0)
+                     : mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+  (void)close(fd);
+  if (base == MAP_FAILED) {
+    return nullptr;
+  }
+  if (create) {
+    memcpy(base, &header, sizeof(BlobHeader));
+  } else {
+    BlobHeader stored;
+    memcpy(&stored, base, sizeof(BlobHeader));
+    if (stored.magic != header.magic || stored.origin_hash != header.origin_hash ||
+        stored.origin_size != header.origin_size || stored.layout_key != header.layout_key ||
+        stored.packed_size != header.packed_size) {
+      // the blob is repacked and replaced by the commit of this model.
+      MS_LOG(WARNING) << "shared packed weight " << path << " does not match its weight, it is packed again.";
+      (void)munmap(base, size);
+      return nullptr;
+    }
+  }
+  auto data = static_cast<char *>(base) + kBlobHeaderSize;
+  mapped_size_[data] = size;
+  return data;
+#endif
+}
+
+void *SharedWeightStore::GetPackData(const void *origin_data, size_t packed_size, const std::string &pack_layout,
+                                     bool *is_packed) {
+  MS_ASSERT(is_packed != nullptr);
+  std::lock_guard<std::mutex> lock(mutex_);
+  *is_packed = false;
+  if (store_dir_.empty() || origin_data == nullptr || packed_size == 0) {
+    return nullptr;
+  }
+  auto iter = origins_.find(origin_data);
+  if (iter == origins_.end()) {
+    return nullptr;
+  }
+  static_assert(sizeof(BlobHeader) <= kBlobHeaderSize, "blob header does not fit in its slot.");
+  BlobHeader header;
+  header.magic = kBlobMagic;
+  header.origin_hash = HashBuffer(origin_data, iter->second.size);
+  header.origin_size = iter->second.size;
+  header.layout_key = iter->second.layout_key ^ (std::hash<std::string>{}(pack_layout) * kLayoutMul);
+  header.packed_size = packed_size;
+  auto final_path = BlobPath(header);
+  auto data = MapBlob(final_path, header, false);
+  if (data != nullptr) {
+    MS_LOG(DEBUG) << "reuse shared packed weight " << final_path;
+    *is_packed = true;
+    return data;
+  }
+  auto tmp_path = final_path + kTmpBlobTag + std::to_string(getpid()) + "." + std::to_string(tmp_index_++);
+  data = MapBlob(tmp_path, header, true);
+  if (data == nullptr) {
+    MS_LOG(WARNING) << "create shared packed weight " << tmp_path << " failed, pack in private memory.";
+    return nullptr;
+  }
+  pending_.push_back({iter->second.owner, tmp_path, final_path});
+  return data;
+}
+
+void SharedWeightStore::ReleaseOrigins(const void *owner) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  auto iter = origins_.begin();
+  while (iter != origins_.end()) {
+    iter = iter->second.owner == owner ? origins_.erase(iter) : std::next(iter);
+  }
+}
+
+int SharedWeightStore::Commit(const void *owner) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  auto iter = pending_.begin();
+  while (iter != pending_.end()) {
+    if (iter->owner != owner) {
+      ++iter;
+      continue;
+    }
+#ifndef _WIN32
+    // another process may have committed the same blob meanwhile, the content is identical so the last rename wins.
+    if (rename(iter->tmp_path.c_str(), iter->final_path.c_str()) != 0) {
+      MS_LOG(WARNING) << "publish shared packed weight " << iter->final_path << " failed.";
+      (void)unlink(iter->tmp_path.c_str());
+    }
+#endif
+    iter = pending_.erase(iter);
+  }
+  return RET_OK;
+}
+
+void SharedWeightStore::Discard(const void *owner) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  auto iter = pending_.begin();
+  while (iter != pending_.end()) {
+    if (iter->owner != owner) {
+      ++iter;
+      continue;
+    }
+#ifndef _WIN32
+    (void)unlink(iter->tmp_path.c_str());
+#endif
+    iter = pending_.erase(iter);
+  }
+}
+
+bool SharedWeightStore::Free(void *data) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  auto iter = mapped_size_.find(data);
+  if (iter == mapped_size_.end()) {
+    return false;
+  }
+#ifndef _WIN32
+  (void)munmap(static_cast<char *>(iter->first) - kBlobHeaderSize, iter->second);
+#endif
+  mapped_size_.erase(iter);
+  return true;
+}
+}  // namespace mindspore::lite
@@ -0,0 +1,98 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef MINDSPORE_LITE_SRC_RUNTIME_SHARED_WEIGHT_STORE_H_
+#define MINDSPORE_LITE_SRC_RUNTIME_SHARED_WEIGHT_STORE_H_
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+#include "include/errorcode.h"
+
+namespace mindspore::lite {
+// SharedWeightStore keeps packed weights as files in a directory (a tmpfs such as /dev/shm for best effect), keyed
+// by the content hash of the origin weight and the packed size. Every model and every process that packs an identical
+// weight maps the same file, so the physical pages are shared instead of being packed once per model.
+//
+// A missing blob is created as a private temporary file that the kernel packs into. The blobs of a model are renamed
+// into place by Commit() only after the model ran once, so that kernels packing lazily are done as well, and readers
+// never observe a half-packed blob. Every registration and blob belongs to an owner, the session of the model.
+//
+// Every blob starts with a header recording the weight and layout it was packed for, which is checked before a blob
+// is reused. Blobs are only readable by the owner user, and temporary blobs left by dead processes are removed by
+// Init().
+class SharedWeightStore {
+ public:
+  SharedWeightStore() = default;
+  ~SharedWeightStore();
+
+  int Init(const std::string &store_dir);
+
+  // record a const origin weight of owner, only registered weights are served from the store. layout_key tells apart
+  // kernels that pack identical bytes into different layouts of the same size.
+  void RegisterOriginData(const void *owner, const void *origin_data, size_t origin_size, uint64_t layout_key);
+
+  // returns nullptr when the weight is not registered or the store is not usable, caller falls back to malloc.
+  // pack_layout names the kernel implementation and its packing parameters, e.g. the tile sizes, since the kernel is
+  // only chosen when it is prepared, after the weight is registered.
+  void *GetPackData(const void *origin_data, size_t packed_size, const std::string &pack_layout, bool *is_packed);
+
+  // forget the origins of owner, which may be freed after packing. Later requests for them fall back to malloc.
+  void ReleaseOrigins(const void *owner);
+
+  // publish the blobs packed for owner, call it once every kernel of owner has packed its weights.
+  int Commit(const void *owner);
+
+  // remove the blobs of owner that were never published, the mapped data stays valid until freed.
+  void Discard(const void *owner);
+
+  // returns false if data was not handed out by the store.
+  bool Free(void *data);
+
+ private:
+  struct OriginInfo {
+    const void *owner = nullptr;
+    size_t size = 0;
+    uint64_t layout_key = 0;
+  };
+  struct PendingBlob {
+    const void *owner = nullptr;
+    std::string tmp_path;
+    std::string final_path;
+  };
+  struct BlobHeader {
+    uint64_t magic = 0;
+    uint64_t origin_hash = 0;
+    uint64_t origin_size = 0;
+    uint64_t layout_key = 0;
+    uint64_t packed_size = 0;
+  };
+
+  std::string BlobPath(const BlobHeader &header) const;
+  void *MapBlob(const std::string &path, const BlobHeader &header, bool create);
+  void RemoveStaleBlobs();
+
+  std::string store_dir_;
+  std::mutex mutex_;
+  std::unordered_map<const void *, OriginInfo> origins_;
+  std::unordered_map<void *, size_t> mapped_size_;
+  std::vector<PendingBlob> pending_;
+  size_t tmp_index_ = 0;
+};
+}  // namespace mindspore::lite
+#endif  // MINDSPORE_LITE_SRC_RUNTIME_SHARED_WEIGHT_STORE_H_
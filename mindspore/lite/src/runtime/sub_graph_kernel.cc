@@ -26,8 +26,12 @@
 #include "src/runtime/infer_manager.h"
 #include "src/common/tensor_util.h"
 #include "src/common/utils.h"
+#include "src/common/log_util.h"
 #include "src/common/prim_inner.h"
 #include "src/runtime/kernel_exec_util.h"
+#ifdef ENABLE_MINDRT
+#include "src/runtime/inter_op_parallel_executor.h"
+#endif
 
 namespace mindspore::kernel {
 using mindspore::lite::RET_ERROR;
@@ -409,11 +413,31 @@ int CpuSubGraph::Prepare() {
       out->set_allocator(this->Context()->allocator);
     }
   }
+#ifdef ENABLE_MINDRT
+  // the parallel thread pool only exists in inter-op parallel mode, see InnerContext::CreateThreadPool.
+  delete this->executor_;
+  this->executor_ = nullptr;
+  if (!this->Context()->enable_parallel_ && this->Context()->inter_op_parallel_num_ > 1 && nodes_.size() > 1) {
+    auto executor = new (std::nothrow) lite::InterOpParallelExecutor();
+    MS_CHECK_TRUE_MSG(executor != nullptr, RET_NULL_PTR, "new InterOpParallelExecutor failed.");
+    ret = executor->Prepare(nodes_, this->in_tensors(), this->out_tensors(),
+                            const_cast<lite::InnerContext *>(this->Context()));
+    if (ret != RET_OK || executor->max_width() <= 1) {
+      MS_LOG(DEBUG) << this->name() << " runs sequentially, inter-op executor prepare ret: " << ret;
+      delete executor;
+      return RET_OK;
+    }
+    this->executor_ = executor;
+  }
+#endif
   return RET_OK;
 }
 
 int CpuSubGraph::Execute(const KernelCallBack &before, const KernelCallBack &after) {
   MS_ASSERT(this->Context()->allocator.get() != nullptr);
+  if (this->executor_ != nullptr) {
+    return this->executor_->Run(this->in_tensors(), this->out_tensors(), nodes_, before, after);
+  }
 
   for (auto *kernel : nodes_) {
     MS_ASSERT(kernel != nullptr);
@@ -17,6 +17,7 @@
 #include "src/train/train_session.h"
 #include <sys/stat.h>
 #include <algorithm>
+#include <cstdlib>
 #include <utility>
 #include <vector>
 #include <iostream>
@@ -30,6 +31,7 @@
 #include "src/runtime/kernel_exec_util.h"
 #include "src/tensor.h"
 #include "src/runtime/kernel_registry.h"
+#include "src/common/common.h"
 #include "src/common/prim_util.h"
 #include "src/common/tensor_util.h"
 #include "src/common/utils.h"
@@ -45,6 +47,7 @@ namespace mindspore {
 namespace lite {
 const char *kGradName = "Gradients";
 const char *kOptimizerName = "optimizer";
+constexpr int kDecimalBase = 10;
 
 TrainSession::TrainSession() {
   is_train_session_ = true;
@@ -252,43 +255,96 @@ int TrainSession::UpdateWeights(std::vector<lite::Tensor *> modify_tensors) {
   return ret;
 }
 
-int TrainSession::AllocTensors(const std::vector<kernel::KernelExec *> &kernels) {
-  if (!IS_STATIC_ALLOCATOR(allocator_)) return RET_OK;
+std::vector<std::vector<int>> TrainSession::LifetimeRefCount(const std::vector<kernel::KernelExec *> &kernels) const {
+  std::unordered_set<kernel::KernelExec *> unique_kernels(kernels.begin(), kernels.end());
+  if (unique_kernels.size() == kernels.size()) {
+    return {};
+  }
+  // uses of every tensor in the graph, the remainder of init_ref_count are persistent graph outputs
+  std::unordered_map<lite::Tensor *, int> total_uses;
+  for (auto kernel : unique_kernels) {
+    for (auto tensor : kernel->in_tensors()) {
+      total_uses[tensor]++;
+    }
+  }
+  // walk the schedule backwards, a production closes the uses seen after it into one lifetime
+  std::vector<std::vector<int>> lifetime_ref(kernels.size());
+  std::unordered_map<lite::Tensor *, int> pending_uses;
+  std::unordered_set<lite::Tensor *> last_produced;
+  for (size_t step = kernels.size(); step > 0; step--) {
+    auto kernel = kernels[step - 1];
+    for (auto tensor : kernel->out_tensors()) {
+      int persistent = 0;
+      if (last_produced.insert(tensor).second) {
+        persistent = std::max(tensor->init_ref_count() - total_uses[tensor], 0);
+      }
+      lifetime_ref[step - 1].push_back(pending_uses[tensor] + persistent);
+      pending_uses[tensor] = 0;
+    }
+    for (auto tensor : kernel->in_tensors()) {
+      pending_uses[tensor]++;
+    }
+  }
+  return lifetime_ref;
+}
+
+size_t TrainSession::PlanTensors(const std::vector<kernel::KernelExec *> &kernels,
+                                 std::unordered_map<lite::Tensor *, size_t> *offset_map,
+                                 std::vector<std::vector<std::pair<lite::Tensor *, size_t>>> *step_offsets) {
   OptAllocator allocator;
   std::unordered_map<lite::Tensor *, int> ref_count;
-  std::unordered_map<lite::Tensor *, size_t> offset_map;
+  // empty unless a recomputed kernel makes some tensors live more than once
+  auto lifetime_ref = LifetimeRefCount(kernels);
+  step_offsets->assign(kernels.size(), {});
   int counter = 0;
   uint32_t input_idx = 0;
-  for (auto &kernel : kernels) {
+  for (size_t step = 0; step < kernels.size(); step++) {
+    auto kernel = kernels[step];
     for (size_t i = 0; i < kernel->out_tensors().size(); i++) {
       auto tensor = kernel->out_tensors().at(i);
       bool in_place = false;
       if (counter != 0) {
         in_place = IsInPlaceTensor(kernel, i, ref_count, &input_idx);
+        // an input still needed by a later recomputation must not be overwritten
+        if (in_place && !lifetime_ref.empty() && ref_count.at(kernel->in_tensors().at(input_idx)) != 1) {
+          in_place = false;
+        }
       }
       counter++;
       size_t offset;
       if (in_place) {
-        offset = GetInplaceTensorOffset(kernel, offset_map, &ref_count, input_idx);
+        offset = GetInplaceTensorOffset(kernel, *offset_map, &ref_count, input_idx);
       } else {
         size_t size = tensor->Size();
         offset = allocator.Malloc(size);
       }
-      offset_map[tensor] = offset;
-      ref_count[tensor] = tensor->init_ref_count();
+      (*offset_map)[tensor] = offset;
+      if (lifetime_ref.empty()) {
+        ref_count[tensor] = tensor->init_ref_count();
+      } else {
+        ref_count[tensor] = lifetime_ref[step][i];
+        step_offsets->at(step).emplace_back(tensor, offset);
+      }
     }
     for (auto tensor : kernel->in_tensors()) {
       if (tensor->category() == lite::Category::VAR) {
         int count = ref_count[tensor] - 1;
         ref_count[tensor] = count;
         if (count == 0) {
-          allocator.Free(offset_map[tensor]);
+          allocator.Free((*offset_map)[tensor]);
         }
       }
     }
   }
+  return allocator.total_size();
+}
+
+int TrainSession::AllocTensors(const std::vector<kernel::KernelExec *> &kernels) {
+  if (!IS_STATIC_ALLOCATOR(allocator_)) return RET_OK;
+  std::unordered_map<lite::Tensor *, size_t> offset_map;
+  std::vector<std::vector<std::pair<lite::Tensor *, size_t>>> step_offsets;
+  auto size = PlanTensors(kernels, &offset_map, &step_offsets);
   // Set Tensor data
-  auto size = allocator.total_size();
   if (size > tensors_data_size_) {
     free(tensors_data_);
     tensors_data_ = nullptr;
@@ -312,9 +368,195 @@ int TrainSession::AllocTensors(const std::vector<kernel::KernelExec *> &kernels)
       }
     }
   }
+  // only the tensors produced more than once need their data bound again while running
+  recompute_bind_.clear();
+  recompute_forward_bind_.clear();
+  recompute_bind_kernels_ = &kernels;
+  std::unordered_map<lite::Tensor *, int> production_num;
+  std::unordered_set<lite::Tensor *> forward_bound;
+  for (auto &offsets : step_offsets) {
+    for (auto &item : offsets) {
+      production_num[item.first]++;
+    }
+  }
+  for (size_t step = 0; step < step_offsets.size(); step++) {
+    for (auto &item : step_offsets[step]) {
+      if (production_num[item.first] < C2NUM) {
+        continue;
+      }
+      recompute_bind_.resize(kernels.size());
+      auto data = reinterpret_cast<void *>(reinterpret_cast<char *>(tensors_data_) + item.second);
+      recompute_bind_[step].emplace_back(item.first, data);
+      // the first production of a tensor is its forward one
+      if (forward_bound.insert(item.first).second) {
+        recompute_forward_bind_.emplace_back(item.first, data);
+      }
+    }
+  }
   return RET_OK;
 }
 
+bool TrainSession::IsRecomputeCandidate(kernel::KernelExec *kernel) {
+  // only deterministic forward kernels without side effects can be executed twice
+  if (IsGradKernel(kernel) || IsLossKernel(kernel) || IsMaskOutput(kernel) || IsBN(kernel) ||
+      kernel->type() == schema::PrimitiveType_Dropout || IsInPlaceKernel(kernel)) {
+    return false;
+  }
+  // worth recomputing only if the activation is read in forward and kept alive until backward
+  bool used_by_grad = false;
+  bool used_by_forward = false;
+  for (auto out_kernel : kernel->out_kernels()) {
+    bool is_backward = IsGradKernel(out_kernel) || IsOptimizer(out_kernel);
+    used_by_grad = used_by_grad || is_backward;
+    used_by_forward = used_by_forward || !is_backward;
+  }
+  if (!used_by_grad || !used_by_forward) {
+    return false;
+  }
+  for (auto tensor : kernel->out_tensors()) {
+    if (tensor->category() != lite::Category::VAR || tensor->IsGraphOutput()) {
+      return false;
+    }
+  }
+  return true;
+}
+
+void TrainSession::RecomputeKernelRecursive(kernel::KernelExec *kernel,
+                                            const std::unordered_map<lite::Tensor *, kernel::KernelExec *> &producer,
+                                            std::unordered_set<kernel::KernelExec *> *recomputed,
+                                            std::vector<kernel::KernelExec *> *schedule) const {
+  MS_ASSERT(recomputed != nullptr);
+  MS_ASSERT(schedule != nullptr);
+  if (!recomputed->insert(kernel).second) {
+    return;
+  }
+  // recomputed inputs are rebuilt first, the other inputs are checkpoints kept alive from forward
+  for (auto tensor : kernel->in_tensors()) {
+    auto iter = producer.find(tensor);
+    if (iter != producer.end()) {
+      RecomputeKernelRecursive(iter->second, producer, recomputed, schedule);
+    }
+  }
+  schedule->push_back(kernel);
+}
+
+std::vector<kernel::KernelExec *> TrainSession::BuildTrainSchedule(
+  const std::unordered_set<kernel::KernelExec *> &recompute) const {
+  if (recompute.empty()) {
+    return train_kernels_;
+  }
+  std::unordered_map<lite::Tensor *, kernel::KernelExec *> producer;
+  for (auto kernel : recompute) {
+    for (auto tensor : kernel->out_tensors()) {
+      producer[tensor] = kernel;
+    }
+  }
+  std::unordered_set<kernel::KernelExec *> recomputed;
+  std::vector<kernel::KernelExec *> schedule;
+  for (auto kernel : train_kernels_) {
+    if (IsGradKernel(kernel) || IsOptimizer(kernel)) {
+      for (auto tensor : kernel->in_tensors()) {
+        auto iter = producer.find(tensor);
+        if (iter != producer.end()) {
+          RecomputeKernelRecursive(iter->second, producer, &recomputed, &schedule);
+        }
+      }
+    }
+    schedule.push_back(kernel);
+  }
+  return schedule;
+}
+
+void TrainSession::ParseRecomputeConfig() {
+  recompute_kernel_names_.clear();
+  recompute_memory_budget_ = 0;
+  if (config_info_ == nullptr) {
+    return;
+  }
+  auto section = config_info_->find(kRecompute);
+  if (section == config_info_->end()) {
+    return;
+  }
+  auto names = section->second.find(kRecomputeKernelNames);
+  if (names != section->second.end()) {
+    for (auto &name : StrSplit(names->second, ",")) {
+      if (!name.empty()) {
+        recompute_kernel_names_.push_back(name);
+      }
+    }
+  }
+  auto budget = section->second.find(kRecomputeMemoryBudget);
+  if (budget != section->second.end()) {
+    char *end = nullptr;
+    auto value = std::strtoull(budget->second.c_str(), &end, kDecimalBase);
+    if (end == budget->second.c_str() || *end != '\0') {
+      MS_LOG(WARNING) << "invalid recompute memory budget " << budget->second << ", automatic recompute is disabled.";
+    } else {
+      recompute_memory_budget_ = static_cast<size_t>(value);
+    }
+  }
+}
+
+void TrainSession::CompileRecompute() {
+  train_schedule_ = train_kernels_;
+  ParseRecomputeConfig();
+  if (recompute_kernel_names_.empty() && recompute_memory_budget_ == 0) {
+    return;
+  }
+  if (!IS_STATIC_ALLOCATOR(allocator_) || context_->IsCpuFloat16Enabled()) {
+    MS_LOG(WARNING) << "recompute needs the static train allocator and fp32 training, it is disabled.";
+    return;
+  }
+  std::vector<kernel::KernelExec *> candidates;
+  std::unordered_set<kernel::KernelExec *> recompute;
+  for (auto kernel : train_kernels_) {
+    if (!IsRecomputeCandidate(kernel)) {
+      continue;
+    }
+    candidates.push_back(kernel);
+    for (auto &name : recompute_kernel_names_) {
+      if (kernel->name().find(name) != std::string::npos) {
+        recompute.insert(kernel);
+        break;
+      }
+    }
+  }
+  std::unordered_map<lite::Tensor *, size_t> offset_map;
+  std::vector<std::vector<std::pair<lite::Tensor *, size_t>>> step_offsets;
+  auto size = PlanTensors(BuildTrainSchedule(recompute), &offset_map, &step_offsets);
+  if (recompute_memory_budget_ > 0) {
+    // greedy: drop the largest activations first, keep a choice only if the planned peak does not grow
+    std::stable_sort(candidates.begin(), candidates.end(), [](kernel::KernelExec *a, kernel::KernelExec *b) {
+      size_t a_size = 0;
+      size_t b_size = 0;
+      for (auto tensor : a->out_tensors()) a_size += tensor->Size();
+      for (auto tensor : b->out_tensors()) b_size += tensor->Size();
+      return a_size > b_size;
+    });
+    for (auto kernel : candidates) {
+      if (size <= recompute_memory_budget_) {
+        break;
+      }
+      if (!recompute.insert(kernel).second) {
+        continue;
+      }
+      offset_map.clear();
+      auto new_size = PlanTensors(BuildTrainSchedule(recompute), &offset_map, &step_offsets);
+      if (new_size > size) {
+        recompute.erase(kernel);
+        continue;
+      }
+      size = new_size;
+    }
+    if (size > recompute_memory_budget_) {
+      MS_LOG(WARNING) << "activation memory " << size << " still exceeds recompute budget "
+                      << recompute_memory_budget_;
+    }
+  }
+  train_schedule_ = BuildTrainSchedule(recompute);
+  MS_LOG(INFO) << "recompute " << recompute.size() << " kernels, planned activation memory " << size;
+}
+
 int TrainSession::CompileGraph(lite::Model *model) { return lite::RET_ERROR; }
 
 int TrainSession::CompileTrainGraph(std::shared_ptr<Model> model) {
@@ -349,12 +591,13 @@ int TrainSession::CompileTrainGraph(std::shared_ptr<Model> model) {
     MS_LOG(ERROR) << "CompileInferenceKernels failed.";
     return RET_ERROR;
   }
+  CompileRecompute();  // Prepare the train schedule with recomputed kernels
   ret = AllocWorkSpace();
   if (ret != RET_OK) {
     MS_LOG(ERROR) << "failed to allocate space";
     return RET_ERROR;
   }
-  ret = AllocTensors(train_kernels_);
+  ret = AllocTensors(train_schedule_);
   if (ret != RET_OK) {
     MS_LOG(ERROR) << "failed to allocate space";
     return RET_ERROR;
@@ -372,8 +615,21 @@ TrainSession::~TrainSession() {
 
 int TrainSession::ExecKernels(const KernelCallBack &before, const KernelCallBack &after,
                               const std::vector<kernel::KernelExec *> &run_kernels) {
-  for (auto *kernel : run_kernels) {
+  if (&run_kernels != recompute_bind_kernels_) {
+    // the plan was made for the train schedule, e.g. eval runs before Eval() replans. A recomputed activation may
+    // still be bound to its backward buffer, which forward tensors reuse.
+    for (auto &bind : recompute_forward_bind_) {
+      bind.first->set_data(bind.second);
+    }
+  }
+  for (size_t step = 0; step < run_kernels.size(); step++) {
+    auto *kernel = run_kernels[step];
     MS_ASSERT(kernel != nullptr);
+    if (&run_kernels == recompute_bind_kernels_ && step < recompute_bind_.size()) {
+      for (auto &bind : recompute_bind_[step]) {
+        bind.first->set_data(bind.second);
+      }
+    }
     auto ret = kernel->Execute(before, after);
     if (RET_OK != ret) {
       MS_LOG(ERROR) << "Execute kernel failed, name: " << kernel->name();
@@ -555,7 +811,7 @@ int TrainSession::RunGraph(const KernelCallBack &before, const KernelCallBack &a
     MS_LOG(ERROR) << "context is null";
     return lite::RET_NULL_PTR;
   }
-  auto &run_kernels = (train_mode_) ? train_kernels_ : inference_kernels_;
+  auto &run_kernels = (train_mode_) ? train_schedule_ : inference_kernels_;
   if (context_->IsCpuFloat16Enabled()) {
     ret = MixPrecisionExecKernels(before, after, run_kernels);
   } else {
@@ -604,7 +860,7 @@ int TrainSession::Train() {
     }
   }
   // allocate tensors
-  auto ret = AllocTensors(train_kernels_);
+  auto ret = AllocTensors(train_schedule_);
   if (ret != RET_OK) {
     MS_LOG(ERROR) << "failed to allocate tensor space";
     return RET_ERROR;
@@ -1073,12 +1329,13 @@ int TrainSession::Resize(const std::vector<lite::Tensor *> &inputs, const std::v
     MS_LOG(ERROR) << "train resize input failed.";
     return RET_ERROR;
   }
+  CompileRecompute();  // Prepare the train schedule with recomputed kernels
   ret = AllocWorkSpace();
   if (ret != RET_OK) {
     MS_LOG(ERROR) << "failed to allocate space";
     return RET_ERROR;
   }
-  ret = AllocTensors(train_kernels_);
+  ret = AllocTensors(train_schedule_);
   if (ret != RET_OK) {
     MS_LOG(ERROR) << "train alloc failed after resize.";
     return RET_ERROR;
@@ -19,6 +19,8 @@
 #include <string>
 #include <tuple>
 #include <unordered_map>
+#include <unordered_set>
+#include <utility>
 #include <memory>
 #include <map>
 #include "include/train/train_cfg.h"
@@ -98,6 +100,10 @@ class TrainSession : virtual public lite::LiteSession {
              std::vector<std::string> out_put_tensor_name = {}) override;
 
   std::vector<lite::Tensor *> GetFeatureMaps() const override;
+  // number of forward kernels the train schedule runs a second time before their gradient consumers
+  size_t GetRecomputeKernelNum() const { return train_schedule_.size() - train_kernels_.size(); }
+  // size of the static buffer all activations are planned in, it only grows over the session lifetime
+  size_t GetTensorsDataSize() const { return tensors_data_size_; }
 
   int UpdateFeatureMaps(const std::vector<lite::Tensor *> &features_map) override;
   int FindUseInTensorKernel(std::vector<kernel::KernelExec *> *use_in_tensor_kernels,
@@ -164,6 +170,18 @@ class TrainSession : virtual public lite::LiteSession {
   size_t GetInplaceTensorOffset(kernel::KernelExec *kernel,
                                 const std::unordered_map<lite::Tensor *, size_t> &offset_map,
                                 std::unordered_map<lite::Tensor *, int> *ref_count, uint32_t input_idx);
+  size_t PlanTensors(const std::vector<kernel::KernelExec *> &kernels,
+                     std::unordered_map<lite::Tensor *, size_t> *offset_map,
+                     std::vector<std::vector<std::pair<lite::Tensor *, size_t>>> *step_offsets);
+  std::vector<std::vector<int>> LifetimeRefCount(const std::vector<kernel::KernelExec *> &kernels) const;
+  bool IsRecomputeCandidate(kernel::KernelExec *kernel);
+  void RecomputeKernelRecursive(kernel::KernelExec *kernel,
+                                const std::unordered_map<lite::Tensor *, kernel::KernelExec *> &producer,
+                                std::unordered_set<kernel::KernelExec *> *recomputed,
+                                std::vector<kernel::KernelExec *> *schedule) const;
+  std::vector<kernel::KernelExec *> BuildTrainSchedule(const std::unordered_set<kernel::KernelExec *> &recompute) const;
+  void ParseRecomputeConfig();
+  void CompileRecompute();
 
   std::map<Tensor *, Tensor *> restored_origin_tensors_;
   int virtual_batch_idx_ = 0;
@@ -175,6 +193,18 @@ class TrainSession : virtual public lite::LiteSession {
   void *tensors_data_ = nullptr;
   size_t tensors_data_size_ = 0;
   std::shared_ptr<Allocator> allocator_;
+  // kernel name parts from the [recompute] config section, outputs of the matched forward kernels are recomputed
+  std::vector<std::string> recompute_kernel_names_;
+  // activation memory budget in bytes from the [recompute] config section, 0 disables automatic recompute
+  size_t recompute_memory_budget_ = 0;
+  // train_kernels_ with the recomputed forward kernels inserted again before their first gradient consumer
+  std::vector<kernel::KernelExec *> train_schedule_;
+  // data of the tensors produced more than once, bound again at every schedule step that produces them
+  std::vector<std::vector<std::pair<lite::Tensor *, void *>>> recompute_bind_;
+  // forward data of the tensors produced more than once, bound before running kernels other than the planned ones
+  std::vector<std::pair<lite::Tensor *, void *>> recompute_forward_bind_;
+  // the kernels recompute_bind_ is planned for, it only applies while running them
+  const std::vector<kernel::KernelExec *> *recompute_bind_kernels_ = nullptr;
 };
 
 }  // namespace lite
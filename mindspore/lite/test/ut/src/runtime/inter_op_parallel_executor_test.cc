@@ -0,0 +1,160 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include "common/common_test.h"
+#include "src/runtime/inner_context.h"
+#include "src/runtime/inter_op_parallel_executor.h"
+#include "src/runtime/kernel_exec.h"
+#include "src/runtime/lite_kernel.h"
+
+namespace mindspore {
+namespace {
+constexpr int kNestedTaskNum = 4;
+constexpr int kBranchNum = 4;
+constexpr int kRunTimes = 3;
+
+// a kernel that launches intra-op tasks of its own, so the lane running it waits inside a nested ParallelLaunch.
+class NestedLaunchKernel : public kernel::LiteKernel {
+ public:
+  NestedLaunchKernel(OpParameter *parameter, const std::vector<lite::Tensor *> &inputs,
+                     const std::vector<lite::Tensor *> &outputs, const lite::InnerContext *ctx, int id,
+                     std::vector<int> *order, std::mutex *order_mutex)
+      : LiteKernel(parameter, inputs, outputs, ctx), id_(id), order_(order), order_mutex_(order_mutex) {}
+  ~NestedLaunchKernel() override = default;
+
+  int ReSize() override { return lite::RET_OK; }
+  int PreProcess() override { return lite::RET_OK; }
+  int PostProcess() override { return lite::RET_OK; }
+  int Run() override {
+    task_done_ = 0;
+    auto ret = lite::ParallelLaunch(ms_context_, TaskFunc, this, kNestedTaskNum);
+    if (ret != lite::RET_OK || task_done_ != kNestedTaskNum) {
+      return lite::RET_ERROR;
+    }
+    std::lock_guard<std::mutex> lock(*order_mutex_);
+    order_->push_back(id_);
+    return lite::RET_OK;
+  }
+
+ private:
+  static int TaskFunc(void *cdata, int task_id, float lhs_scale, float rhs_scale) {
+    auto kernel = reinterpret_cast<NestedLaunchKernel *>(cdata);
+    std::this_thread::sleep_for(std::chrono::microseconds(500));
+    kernel->task_done_++;
+    return lite::RET_OK;
+  }
+
+  int id_;
+  std::vector<int> *order_;
+  std::mutex *order_mutex_;
+  std::atomic<int> task_done_{0};
+};
+}  // namespace
+
+class InterOpParallelExecutorTest : public mindspore::CommonTest {
+ public:
+  InterOpParallelExecutorTest() = default;
+
+  void SetUp() override {
+    ctx_.thread_num_ = 4;
+    ctx_.inter_op_parallel_num_ = 2;
+    ASSERT_EQ(ctx_.Init(), lite::RET_OK);
+  }
+
+  void TearDown() override {
+    for (auto *kernel : kernels_) {
+      delete kernel;
+    }
+    for (auto *tensor : tensors_) {
+      delete tensor;
+    }
+  }
+
+  kernel::KernelExec *AddKernel(const std::vector<kernel::KernelExec *> &in_kernels) {
+    auto parameter = reinterpret_cast<OpParameter *>(calloc(1, sizeof(OpParameter)));
+    parameter->thread_num_ = 1;
+    std::vector<lite::Tensor *> inputs;
+    for (auto *in_kernel : in_kernels) {
+      inputs.push_back(in_kernel->out_tensors().front());
+    }
+    auto output = new lite::Tensor(kNumberTypeFloat32, {1}, NHWC);
+    tensors_.push_back(output);
+    auto id = static_cast<int>(kernels_.size());
+    auto lite_kernel = std::make_shared<NestedLaunchKernel>(parameter, inputs, std::vector<lite::Tensor *>{output},
+                                                            &ctx_, id, &order_, &order_mutex_);
+    auto kernel = new kernel::KernelExec(lite_kernel);
+    kernel->set_name("kernel_" + std::to_string(id));
+    kernel->set_in_kernels(in_kernels);
+    for (auto *in_kernel : in_kernels) {
+      in_kernel->AddOutKernel(kernel);
+    }
+    kernels_.push_back(kernel);
+    return kernel;
+  }
+
+ protected:
+  lite::InnerContext ctx_;
+  std::vector<kernel::KernelExec *> kernels_;
+  std::vector<lite::Tensor *> tensors_;
+  std::vector<int> order_;
+  std::mutex order_mutex_;
+};
+
+/// Feature: InterOpParallelExecutor
+/// Description: run a fork-join graph whose kernels call ParallelLaunch while they run on a lane
+/// Expectation: the run finishes without deadlock, kernels respect their dependencies and callbacks never overlap
+TEST_F(InterOpParallelExecutorTest, NestedParallelLaunch) {
+  auto source = AddKernel({});
+  std::vector<kernel::KernelExec *> branches;
+  for (int i = 0; i < kBranchNum; i++) {
+    branches.push_back(AddKernel({source}));
+  }
+  (void)AddKernel(branches);
+
+  lite::InterOpParallelExecutor executor;
+  ASSERT_EQ(executor.Prepare(kernels_, {}, {}, &ctx_), lite::RET_OK);
+  ASSERT_EQ(executor.max_width(), static_cast<size_t>(kBranchNum));
+
+  std::atomic<int> in_callback{0};
+  std::atomic<int> callback_num{0};
+  std::atomic<bool> overlapped{false};
+  lite::KernelCallBack callback = [&](std::vector<lite::Tensor *> inputs, std::vector<lite::Tensor *> outputs,
+                                      const MSCallBackParam &op_info) {
+    if (++in_callback > 1) {
+      overlapped = true;
+    }
+    std::this_thread::sleep_for(std::chrono::microseconds(100));
+    in_callback--;
+    callback_num++;
+    return true;
+  };
+  for (int run = 0; run < kRunTimes; run++) {
+    order_.clear();
+    callback_num = 0;
+    ASSERT_EQ(executor.Run({}, {}, kernels_, callback, callback), lite::RET_OK);
+    ASSERT_EQ(order_.size(), kernels_.size());
+    EXPECT_EQ(order_.front(), 0);
+    EXPECT_EQ(order_.back(), static_cast<int>(kernels_.size()) - 1);
+    EXPECT_EQ(callback_num, static_cast<int>(kernels_.size()) * 2);
+  }
+  EXPECT_FALSE(overlapped);
+}
+}  // namespace mindspore
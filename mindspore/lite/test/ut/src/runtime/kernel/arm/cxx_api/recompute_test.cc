@@ -0,0 +1,229 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <cstring>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+#include "common/common_test.h"
+#include "include/api/model.h"
+#include "include/api/context.h"
+#include "include/api/serialization.h"
+#include "include/context.h"
+#include "include/errorcode.h"
+#include "include/model.h"
+#include "include/train/train_cfg.h"
+#include "src/runtime/inner_context.h"
+#include "src/train/static_allocator.h"
+#include "src/train/train_session.h"
+
+namespace mindspore {
+namespace {
+constexpr int32_t kNumThreads = 2;
+constexpr int kTrainSteps = 2;
+constexpr float kTolerance = 1e-5;
+using ConfigInfo = std::map<std::string, std::map<std::string, std::string>>;
+}  // namespace
+class TestRecompute : public mindspore::CommonTest {
+ public:
+  TestRecompute() = default;
+
+  // the smallest budget recomputes every activation the greedy policy can drop
+  void BuildModel(Model *model, bool recompute) {
+    Graph graph;
+    auto context = std::make_shared<Context>();
+    context->SetThreadNum(kNumThreads);
+    context->MutableDeviceInfo().push_back(std::make_shared<mindspore::CPUDeviceInfo>());
+    if (recompute) {
+      ASSERT_EQ(model->UpdateConfig("recompute", {"memory_budget", "1"}), kSuccess);
+    }
+    ASSERT_EQ(Serialization::Load("./nets/conv_train_model.ms", ModelType::kMindIR, &graph), kSuccess);
+    ASSERT_EQ(model->Build(GraphCell(graph), context, std::make_shared<TrainCfg>()), kSuccess);
+  }
+
+  void FillInputs(Model *model) {
+    for (auto &input : model->GetInputs()) {
+      if (input.DataType() != DataType::kNumberTypeFloat32) {
+        memset(input.MutableData(), 0, input.DataSize());
+        continue;
+      }
+      auto data = reinterpret_cast<float *>(input.MutableData());
+      for (int64_t i = 0; i < input.ElementNum(); i++) {
+        data[i] = static_cast<float>(i % 7) / 7.0f;
+      }
+    }
+  }
+
+  std::vector<float> Outputs(Model *model) {
+    std::vector<float> result;
+    for (auto &output : model->GetOutputs()) {
+      if (output.DataType() != DataType::kNumberTypeFloat32) {
+        continue;
+      }
+      auto data = reinterpret_cast<const float *>(output.MutableData());
+      result.insert(result.end(), data, data + output.ElementNum());
+    }
+    return result;
+  }
+
+  // eval before training, a few train steps, then eval again
+  std::vector<std::vector<float>> TrainEval(Model *model) {
+    std::vector<std::vector<float>> results;
+    FillInputs(model);
+    EXPECT_EQ(model->RunStep(), kSuccess);
+    results.push_back(Outputs(model));
+    EXPECT_EQ(model->SetTrainMode(true), kSuccess);
+    for (int step = 0; step < kTrainSteps; step++) {
+      FillInputs(model);
+      EXPECT_EQ(model->RunStep(), kSuccess);
+      results.push_back(Outputs(model));
+    }
+    EXPECT_EQ(model->SetTrainMode(false), kSuccess);
+    FillInputs(model);
+    EXPECT_EQ(model->RunStep(), kSuccess);
+    results.push_back(Outputs(model));
+    return results;
+  }
+
+  // same sequence as the cxx api, config_info must outlive the session
+  std::unique_ptr<lite::TrainSession> CreateSession(const ConfigInfo *config_info) {
+    lite::Context context;
+    context.device_list_[0].device_info_.cpu_device_info_.cpu_bind_mode_ = lite::NO_BIND;
+    context.thread_num_ = 1;
+    context.allocator = std::make_shared<StaticAllocator>();
+    auto session = std::make_unique<lite::TrainSession>();
+    session->SetConfigInfo(config_info);
+    lite::TrainCfg cfg;
+    if (session->TrainInit(new lite::InnerContext(&context), &cfg) != lite::RET_OK) {
+      return nullptr;
+    }
+    auto model = std::shared_ptr<lite::Model>(lite::Model::Import("./nets/lenet_train.ms"));
+    if (model == nullptr || session->CompileTrainGraph(model) != lite::RET_OK) {
+      return nullptr;
+    }
+    return session;
+  }
+
+  // one train step on a fixed input, returns the loss
+  std::vector<float> TrainStep(lite::TrainSession *session) {
+    EXPECT_EQ(session->Train(), lite::RET_OK);
+    for (auto input : session->GetInputs()) {
+      auto data = reinterpret_cast<float *>(input->MutableData());
+      for (int64_t i = 0; i < input->ElementsNum(); i++) {
+        data[i] = static_cast<float>(i % 7) / 7.0f;
+      }
+    }
+    EXPECT_EQ(session->RunGraph(), lite::RET_OK);
+    std::vector<float> result;
+    for (auto &output : session->GetOutputs()) {
+      auto data = reinterpret_cast<const float *>(output.second->MutableData());
+      result.insert(result.end(), data, data + output.second->ElementsNum());
+    }
+    return result;
+  }
+};
+
+/// Feature: activation recompute of TrainSession
+/// Description: compile lenet without recompute config
+/// Expectation: nothing is recomputed
+TEST_F(TestRecompute, NoRecomputeByDefault) {
+  auto session = CreateSession(nullptr);
+  ASSERT_NE(session, nullptr);
+  EXPECT_EQ(session->GetRecomputeKernelNum(), 0);
+  EXPECT_GT(session->GetTensorsDataSize(), 0);
+}
+
+/// Feature: activation recompute of TrainSession
+/// Description: mark the max pool kernels of lenet for recompute by name
+/// Expectation: only marked kernels are recomputed and the loss equals the one without recompute
+TEST_F(TestRecompute, RecomputeNamedKernels) {
+  auto baseline = CreateSession(nullptr);
+  ASSERT_NE(baseline, nullptr);
+  ConfigInfo config = {{"recompute", {{"kernel_names", "max_pool2d-MaxPool2d/MaxPool"}}}};
+  auto session = CreateSession(&config);
+  ASSERT_NE(session, nullptr);
+  // each of the two pooling layers is kept in forward and read by its gradient
+  EXPECT_GE(session->GetRecomputeKernelNum(), 1);
+  EXPECT_LE(session->GetRecomputeKernelNum(), 4);
+  auto expected = TrainStep(baseline.get());
+  auto actual = TrainStep(session.get());
+  ASSERT_FALSE(expected.empty());
+  ASSERT_EQ(expected.size(), actual.size());
+  for (size_t i = 0; i < expected.size(); i++) {
+    EXPECT_NEAR(expected[i], actual[i], kTolerance);
+  }
+}
+
+/// Feature: activation recompute of TrainSession
+/// Description: compile lenet with a memory budget below the baseline activation memory
+/// Expectation: some kernels are recomputed, the planned activation memory shrinks and the loss is unchanged
+TEST_F(TestRecompute, RecomputeLowersActivationMemory) {
+  auto baseline = CreateSession(nullptr);
+  ASSERT_NE(baseline, nullptr);
+  ConfigInfo config = {{"recompute", {{"memory_budget", "1"}}}};
+  auto session = CreateSession(&config);
+  ASSERT_NE(session, nullptr);
+  EXPECT_GT(session->GetRecomputeKernelNum(), 0);
+  EXPECT_LT(session->GetTensorsDataSize(), baseline->GetTensorsDataSize());
+  auto expected = TrainStep(baseline.get());
+  auto actual = TrainStep(session.get());
+  ASSERT_FALSE(expected.empty());
+  ASSERT_EQ(expected.size(), actual.size());
+  for (size_t i = 0; i < expected.size(); i++) {
+    EXPECT_NEAR(expected[i], actual[i], kTolerance);
+  }
+}
+
+/// Feature: activation recompute of TrainSession
+/// Description: run eval, train steps and eval again with every droppable activation recomputed
+/// Expectation: every output equals the one of the same model trained without recompute
+TEST_F(TestRecompute, TrainEvalSameAsBaseline) {
+  Model baseline;
+  BuildModel(&baseline, false);
+  Model recompute;
+  BuildModel(&recompute, true);
+  auto expected = TrainEval(&baseline);
+  auto actual = TrainEval(&recompute);
+  ASSERT_EQ(expected.size(), actual.size());
+  for (size_t i = 0; i < expected.size(); i++) {
+    ASSERT_FALSE(expected[i].empty());
+    ASSERT_EQ(expected[i].size(), actual[i].size());
+    for (size_t j = 0; j < expected[i].size(); j++) {
+      EXPECT_NEAR(expected[i][j], actual[i][j], kTolerance) << "result " << i << " element " << j;
+    }
+  }
+}
+
+/// Feature: activation recompute of TrainSession
+/// Description: switch between train and eval twice with recompute on
+/// Expectation: eval outputs before and after a train round trip without weight update stay the same
+TEST_F(TestRecompute, EvalAfterTrainSwitch) {
+  Model model;
+  BuildModel(&model, true);
+  FillInputs(&model);
+  ASSERT_EQ(model.RunStep(), kSuccess);
+  auto before = Outputs(&model);
+  ASSERT_EQ(model.SetTrainMode(true), kSuccess);
+  ASSERT_EQ(model.SetTrainMode(false), kSuccess);
+  FillInputs(&model);
+  ASSERT_EQ(model.RunStep(), kSuccess);
+  auto after = Outputs(&model);
+  ASSERT_EQ(before.size(), after.size());
+  for (size_t i = 0; i < before.size(); i++) {
+    EXPECT_NEAR(before[i], after[i], kTolerance);
+  }
+}
+}  // namespace mindspore
@@ -0,0 +1,133 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <dirent.h>
+#include <unistd.h>
+#include <string>
+#include <thread>
+#include <vector>
+#include "common/common_test.h"
+#include "src/runtime/kernel_tune_cache.h"
+
+namespace mindspore {
+namespace {
+constexpr int kSaveThreads = 4;
+constexpr int kSaveRounds = 20;
+}  // namespace
+
+class KernelTuneCacheTest : public mindspore::CommonTest {
+ public:
+  KernelTuneCacheTest() = default;
+
+  void SetUp() override {
+    char dir_template[] = "./kernel_tune_XXXXXX";
+    ASSERT_NE(mkdtemp(dir_template), nullptr);
+    cache_dir_ = dir_template;
+  }
+
+  void TearDown() override {
+    for (auto &name : ListDir()) {
+      (void)unlink((cache_dir_ + "/" + name).c_str());
+    }
+    (void)rmdir(cache_dir_.c_str());
+  }
+
+  std::vector<std::string> ListDir() {
+    std::vector<std::string> names;
+    auto dir = opendir(cache_dir_.c_str());
+    if (dir == nullptr) {
+      return names;
+    }
+    for (auto entry = readdir(dir); entry != nullptr; entry = readdir(dir)) {
+      std::string name = entry->d_name;
+      if (name != "." && name != "..") {
+        names.push_back(name);
+      }
+    }
+    (void)closedir(dir);
+    return names;
+  }
+
+ protected:
+  std::string cache_dir_;
+  std::string model_ = "model buffer of the test";
+};
+
+/// Feature: KernelTuneCache
+/// Description: save a tuned layer, then tune another layer after a resize and save again
+/// Expectation: both layers are loaded by the next cache of the model, no temporary file is left
+TEST_F(KernelTuneCacheTest, SaveRuntimeTunedLayers) {
+  lite::KernelTuneCache cache;
+  ASSERT_EQ(cache.Init(cache_dir_, model_.data(), model_.size()), lite::RET_OK);
+  ASSERT_EQ(cache.Save(), lite::RET_OK);
+  EXPECT_TRUE(ListDir().empty());
+
+  cache.Update("conv_1x3x224x224", {1, 2, 10.0f});
+  ASSERT_EQ(cache.Save(), lite::RET_OK);
+  // a layer of a dynamic shape model is tuned when the input is resized
+  cache.Update("conv_1x3x320x320", {2, 4, 20.0f});
+  ASSERT_EQ(cache.Save(), lite::RET_OK);
+  EXPECT_EQ(ListDir().size(), 1u);
+
+  lite::KernelTuneCache reload;
+  ASSERT_EQ(reload.Init(cache_dir_, model_.data(), model_.size()), lite::RET_OK);
+  lite::KernelTuneResult result;
+  ASSERT_TRUE(reload.Find("conv_1x3x224x224", &result));
+  EXPECT_EQ(result.algorithm, 1);
+  EXPECT_EQ(result.thread_num, 2);
+  ASSERT_TRUE(reload.Find("conv_1x3x320x320", &result));
+  EXPECT_EQ(result.algorithm, 2);
+  EXPECT_EQ(result.thread_num, 4);
+}
+
+/// Feature: KernelTuneCache
+/// Description: several caches of the same model save the same file concurrently
+/// Expectation: every save succeeds, the file stays loadable and no temporary file is left
+TEST_F(KernelTuneCacheTest, ConcurrentSave) {
+  std::vector<std::thread> threads;
+  std::vector<int> save_ret(kSaveThreads, lite::RET_OK);
+  for (int i = 0; i < kSaveThreads; i++) {
+    threads.emplace_back([this, i, &save_ret]() {
+      lite::KernelTuneCache cache;
+      if (cache.Init(cache_dir_, model_.data(), model_.size()) != lite::RET_OK) {
+        save_ret[i] = lite::RET_ERROR;
+        return;
+      }
+      for (int round = 0; round < kSaveRounds; round++) {
+        cache.Update("conv_" + std::to_string(i), {i, 1, static_cast<float>(round)});
+        if (cache.Save() != lite::RET_OK) {
+          save_ret[i] = lite::RET_ERROR;
+        }
+      }
+    });
+  }
+  for (auto &thread : threads) {
+    thread.join();
+  }
+  for (auto ret : save_ret) {
+    EXPECT_EQ(ret, lite::RET_OK);
+  }
+  EXPECT_EQ(ListDir().size(), 1u);
+  lite::KernelTuneCache reload;
+  ASSERT_EQ(reload.Init(cache_dir_, model_.data(), model_.size()), lite::RET_OK);
+  // the last rename wins, it holds the layer of one of the writers
+  lite::KernelTuneResult result;
+  int found = 0;
+  for (int i = 0; i < kSaveThreads; i++) {
+    found += reload.Find("conv_" + std::to_string(i), &result) ? 1 : 0;
+  }
+  EXPECT_GE(found, 1);
+}
+}  // namespace mindspore
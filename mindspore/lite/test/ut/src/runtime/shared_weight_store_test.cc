@@ -0,0 +1,280 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <dirent.h>
+#include <sys/stat.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#include <cstring>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <vector>
+#include "common/common_test.h"
+#include "include/api/context.h"
+#include "include/api/model.h"
+#include "src/runtime/shared_weight_store.h"
+
+namespace mindspore {
+namespace {
+constexpr size_t kWeightSize = 1024;
+constexpr size_t kPackedSize = 2048;
+constexpr uint64_t kLayoutKey = 7;
+constexpr const char *kPackLayout = "ConvolutionCPUKernel_8";
+}  // namespace
+
+class SharedWeightStoreTest : public mindspore::CommonTest {
+ public:
+  SharedWeightStoreTest() = default;
+
+  void SetUp() override {
+    char dir_template[] = "./shared_weight_XXXXXX";
+    ASSERT_NE(mkdtemp(dir_template), nullptr);
+    store_dir_ = dir_template;
+  }
+
+  void TearDown() override {
+    for (auto &name : ListDir()) {
+      (void)unlink((store_dir_ + "/" + name).c_str());
+    }
+    (void)rmdir(store_dir_.c_str());
+  }
+
+  std::vector<std::string> ListDir(const std::string &suffix = "") {
+    std::vector<std::string> names;
+    auto dir = opendir(store_dir_.c_str());
+    if (dir == nullptr) {
+      return names;
+    }
+    for (auto entry = readdir(dir); entry != nullptr; entry = readdir(dir)) {
+      std::string name = entry->d_name;
+      if (name == "." || name == "..") {
+        continue;
+      }
+      if (name.size() >= suffix.size() && name.compare(name.size() - suffix.size(), suffix.size(), suffix) == 0) {
+        names.push_back(name);
+      }
+    }
+    (void)closedir(dir);
+    return names;
+  }
+
+ protected:
+  std::string store_dir_;
+};
+
+/// Feature: SharedWeightStore
+/// Description: pack one weight for two models, publish it after the first model ran and load it for a third model
+/// Expectation: the blob is invisible until committed, then it is served with the packed bytes
+TEST_F(SharedWeightStoreTest, LoadTwice) {
+  lite::SharedWeightStore store;
+  ASSERT_EQ(store.Init(store_dir_), lite::RET_OK);
+  std::vector<char> weight(kWeightSize, 3);
+  std::vector<char> weight_copy(weight);
+  int first_model = 0;
+  int second_model = 0;
+  int third_model = 0;
+
+  store.RegisterOriginData(&first_model, weight.data(), weight.size(), kLayoutKey);
+  bool is_packed = true;
+  auto first = reinterpret_cast<char *>(store.GetPackData(weight.data(), kPackedSize, kPackLayout, &is_packed));
+  ASSERT_NE(first, nullptr);
+  EXPECT_FALSE(is_packed);
+  store.ReleaseOrigins(&first_model);
+  // the weight is packed only after prepare, e.g. in the first run of a kernel that packs lazily.
+  memset(first, 5, kPackedSize);
+  EXPECT_TRUE(ListDir(".bin").empty());
+
+  store.RegisterOriginData(&second_model, weight_copy.data(), weight_copy.size(), kLayoutKey);
+  auto second = store.GetPackData(weight_copy.data(), kPackedSize, kPackLayout, &is_packed);
+  ASSERT_NE(second, nullptr);
+  EXPECT_FALSE(is_packed);
+  store.ReleaseOrigins(&second_model);
+
+  ASSERT_EQ(store.Commit(&first_model), lite::RET_OK);
+  EXPECT_EQ(ListDir(".bin").size(), 1u);
+  store.Discard(&second_model);
+  EXPECT_EQ(ListDir().size(), 1u);
+
+  store.RegisterOriginData(&third_model, weight_copy.data(), weight_copy.size(), kLayoutKey);
+  auto third = reinterpret_cast<char *>(store.GetPackData(weight_copy.data(), kPackedSize, kPackLayout, &is_packed));
+  ASSERT_NE(third, nullptr);
+  EXPECT_TRUE(is_packed);
+  EXPECT_EQ(memcmp(first, third, kPackedSize), 0);
+  store.ReleaseOrigins(&third_model);
+  EXPECT_TRUE(store.Free(first));
+  EXPECT_TRUE(store.Free(second));
+  EXPECT_TRUE(store.Free(third));
+}
+
+/// Feature: SharedWeightStore
+/// Description: discard the blobs of a model whose kernels failed to prepare
+/// Expectation: no file is left in the store and the released origin is not served any more
+TEST_F(SharedWeightStoreTest, DiscardOnFailure) {
+  lite::SharedWeightStore store;
+  ASSERT_EQ(store.Init(store_dir_), lite::RET_OK);
+  std::vector<char> weight(kWeightSize, 1);
+  int model = 0;
+  store.RegisterOriginData(&model, weight.data(), weight.size(), kLayoutKey);
+  bool is_packed = false;
+  auto data = store.GetPackData(weight.data(), kPackedSize, kPackLayout, &is_packed);
+  ASSERT_NE(data, nullptr);
+  EXPECT_EQ(ListDir().size(), 1u);
+  store.ReleaseOrigins(&model);
+  store.Discard(&model);
+  EXPECT_TRUE(ListDir().empty());
+  EXPECT_EQ(store.GetPackData(weight.data(), kPackedSize, kPackLayout, &is_packed), nullptr);
+  EXPECT_TRUE(store.Free(data));
+}
+
+/// Feature: SharedWeightStore
+/// Description: pack one weight for two kernels with packed buffers of the same size but different pack layouts
+/// Expectation: every layout gets its own blob, and a blob is only served to the layout it was packed for
+TEST_F(SharedWeightStoreTest, SeparatePackLayouts) {
+  lite::SharedWeightStore store;
+  ASSERT_EQ(store.Init(store_dir_), lite::RET_OK);
+  std::vector<char> weight(kWeightSize, 2);
+  int model = 0;
+  store.RegisterOriginData(&model, weight.data(), weight.size(), kLayoutKey);
+  bool is_packed = true;
+  auto im2col = reinterpret_cast<char *>(store.GetPackData(weight.data(), kPackedSize, kPackLayout, &is_packed));
+  ASSERT_NE(im2col, nullptr);
+  EXPECT_FALSE(is_packed);
+  memset(im2col, 1, kPackedSize);
+  auto sliding = reinterpret_cast<char *>(
+    store.GetPackData(weight.data(), kPackedSize, "ConvolutionSWCPUKernel_8", &is_packed));
+  ASSERT_NE(sliding, nullptr);
+  EXPECT_FALSE(is_packed);
+  memset(sliding, 2, kPackedSize);
+  ASSERT_EQ(store.Commit(&model), lite::RET_OK);
+  EXPECT_EQ(ListDir(".bin").size(), 2u);
+
+  auto reused = reinterpret_cast<char *>(
+    store.GetPackData(weight.data(), kPackedSize, "ConvolutionSWCPUKernel_8", &is_packed));
+  ASSERT_NE(reused, nullptr);
+  EXPECT_TRUE(is_packed);
+  EXPECT_EQ(memcmp(reused, sliding, kPackedSize), 0);
+  store.ReleaseOrigins(&model);
+  EXPECT_TRUE(store.Free(im2col));
+  EXPECT_TRUE(store.Free(sliding));
+  EXPECT_TRUE(store.Free(reused));
+}
+
+/// Feature: SharedWeightStore
+/// Description: overwrite the header of a published blob, then load the weight again
+/// Expectation: the blob is owner-only, the damaged blob is not served, and the repacked blob replaces it on commit
+TEST_F(SharedWeightStoreTest, RejectDamagedBlob) {
+  lite::SharedWeightStore store;
+  ASSERT_EQ(store.Init(store_dir_), lite::RET_OK);
+  std::vector<char> weight(kWeightSize, 4);
+  int first_model = 0;
+  int second_model = 0;
+  store.RegisterOriginData(&first_model, weight.data(), weight.size(), kLayoutKey);
+  bool is_packed = true;
+  auto first = store.GetPackData(weight.data(), kPackedSize, kPackLayout, &is_packed);
+  ASSERT_NE(first, nullptr);
+  memset(first, 6, kPackedSize);
+  ASSERT_EQ(store.Commit(&first_model), lite::RET_OK);
+  store.ReleaseOrigins(&first_model);
+  auto blobs = ListDir(".bin");
+  ASSERT_EQ(blobs.size(), 1u);
+  auto blob_path = store_dir_ + "/" + blobs[0];
+  struct stat blob_stat;
+  ASSERT_EQ(stat(blob_path.c_str(), &blob_stat), 0);
+  EXPECT_EQ(blob_stat.st_mode & (S_IRWXU | S_IRWXG | S_IRWXO), static_cast<mode_t>(S_IRUSR | S_IWUSR));
+  {
+    std::fstream blob(blob_path, std::ios::in | std::ios::out | std::ios::binary);
+    ASSERT_TRUE(blob.is_open());
+    blob.seekp(sizeof(uint64_t));
+    uint64_t bad_hash = 0;
+    blob.write(reinterpret_cast<const char *>(&bad_hash), sizeof(bad_hash));
+  }
+
+  store.RegisterOriginData(&second_model, weight.data(), weight.size(), kLayoutKey);
+  auto second = store.GetPackData(weight.data(), kPackedSize, kPackLayout, &is_packed);
+  ASSERT_NE(second, nullptr);
+  EXPECT_FALSE(is_packed);
+  memset(second, 6, kPackedSize);
+  ASSERT_EQ(store.Commit(&second_model), lite::RET_OK);
+  auto third = store.GetPackData(weight.data(), kPackedSize, kPackLayout, &is_packed);
+  ASSERT_NE(third, nullptr);
+  EXPECT_TRUE(is_packed);
+  store.ReleaseOrigins(&second_model);
+  EXPECT_TRUE(store.Free(first));
+  EXPECT_TRUE(store.Free(second));
+  EXPECT_TRUE(store.Free(third));
+}
+
+/// Feature: SharedWeightStore
+/// Description: init a store whose directory holds temporary blobs of a dead process and of this process
+/// Expectation: only the temporary blob of the dead process is removed
+TEST_F(SharedWeightStoreTest, RemoveStaleBlobs) {
+  // a child that exited and was reaped gives a pid that no process uses for a while.
+  auto child = fork();
+  ASSERT_GE(child, 0);
+  if (child == 0) {
+    _exit(0);
+  }
+  int status = 0;
+  ASSERT_EQ(waitpid(child, &status, 0), child);
+  auto stale_name = "generic_0_0_1_1.bin.tmp." + std::to_string(child) + ".0";
+  auto live_name = "generic_0_0_1_1.bin.tmp." + std::to_string(getpid()) + ".0";
+  std::ofstream(store_dir_ + "/" + stale_name).put('0');
+  std::ofstream(store_dir_ + "/" + live_name).put('0');
+
+  lite::SharedWeightStore store;
+  ASSERT_EQ(store.Init(store_dir_), lite::RET_OK);
+  auto names = ListDir();
+  ASSERT_EQ(names.size(), 1u);
+  EXPECT_EQ(names[0], live_name);
+}
+
+/// Feature: shared_weight_dir config
+/// Description: build the same model twice through the shared weight store and predict with both
+/// Expectation: the packed weights are published after the first predict and both models give the same outputs
+TEST_F(SharedWeightStoreTest, BuildModelTwice) {
+  auto predict = [this](bool expect_published) {
+    auto context = std::make_shared<Context>();
+    context->MutableDeviceInfo().push_back(std::make_shared<CPUDeviceInfo>());
+    Model model;
+    EXPECT_EQ(model.UpdateConfig("weight", {"shared_weight_dir", store_dir_}), kSuccess);
+    EXPECT_EQ(model.Build("./nets/lenet_tod_infer.ms", kMindIR, context), kSuccess);
+    EXPECT_EQ(ListDir(".bin").empty(), !expect_published);
+    auto inputs = model.GetInputs();
+    for (auto &input : inputs) {
+      auto data = reinterpret_cast<float *>(input.MutableData());
+      for (int64_t i = 0; i < input.ElementNum(); i++) {
+        data[i] = static_cast<float>(i % 7) / 7.0f;
+      }
+    }
+    std::vector<MSTensor> outputs;
+    EXPECT_EQ(model.Predict(inputs, &outputs), kSuccess);
+    EXPECT_FALSE(ListDir(".bin").empty());
+    std::vector<float> result;
+    for (auto &output : outputs) {
+      auto data = reinterpret_cast<const float *>(output.Data().get());
+      result.insert(result.end(), data, data + output.ElementNum());
+    }
+    return result;
+  };
+  auto first = predict(false);
+  auto second = predict(true);
+  ASSERT_FALSE(first.empty());
+  ASSERT_EQ(first.size(), second.size());
+  for (size_t i = 0; i < first.size(); i++) {
+    EXPECT_NEAR(first[i], second[i], 1e-5);
+  }
+}
+}  // namespace mindspore
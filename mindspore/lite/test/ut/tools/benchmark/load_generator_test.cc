@@ -0,0 +1,192 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <unistd.h>
+#include <fstream>
+#include <string>
+#include <vector>
+#include "common/common_test.h"
+#include "include/errorcode.h"
+#include "tools/benchmark/load_generator.h"
+
+namespace mindspore {
+namespace lite {
+namespace {
+constexpr double kQps = 200.0;
+constexpr size_t kRequestNum = 20000;
+constexpr uint32_t kSeed = 7;
+}  // namespace
+
+class LoadGeneratorTest : public mindspore::CommonTest {
+ public:
+  LoadGeneratorTest() = default;
+
+  void TearDown() override { (void)unlink(mix_file_.c_str()); }
+
+  int ParseMix(const std::string &content, std::vector<ShapeMixItem> *items) {
+    std::ofstream ofs(mix_file_);
+    ofs << content;
+    ofs.close();
+    return ParseShapeMixFile(mix_file_, items);
+  }
+
+ protected:
+  std::string mix_file_ = "./load_generator_shape_mix.txt";
+};
+
+/// Feature: shape mix file of the open loop benchmark
+/// Description: parse weights and multi-input shapes, skipping comments and blank lines
+/// Expectation: every entry keeps its weight and dims in file order
+TEST_F(LoadGeneratorTest, ParseShapeMixFile) {
+  std::vector<ShapeMixItem> items;
+  ASSERT_EQ(ParseMix("# weight shapes\n\n3 1,224,224,3:1,10\n0.5 4,112,112,3:4,10\n", &items), RET_OK);
+  ASSERT_EQ(items.size(), 2);
+  EXPECT_FLOAT_EQ(items[0].weight, 3.0f);
+  EXPECT_EQ(items[0].dims, (std::vector<std::vector<int64_t>>{{1, 224, 224, 3}, {1, 10}}));
+  EXPECT_FLOAT_EQ(items[1].weight, 0.5f);
+  EXPECT_EQ(items[1].dims, (std::vector<std::vector<int64_t>>{{4, 112, 112, 3}, {4, 10}}));
+}
+
+/// Feature: shape mix file of the open loop benchmark
+/// Description: parse files with a missing shape, a bad weight, bad dims, a changing input count or no entry
+/// Expectation: every malformed file is rejected
+TEST_F(LoadGeneratorTest, ParseMalformedShapeMixFile) {
+  std::vector<std::string> malformed = {
+    "1\n",                  // no shapes
+    "abc 1,2\n",            // weight is not a number
+    "0 1,2\n",              // weight is not positive
+    "-1 1,2\n",             // weight is not positive
+    "1 1,x\n",              // dim is not a number
+    "1 1,0\n",              // dim is not positive
+    "1 1,-2\n",             // dim is not positive
+    "1 1,2,\n",             // empty dim
+    "1 1,2:3,4\n1 1,2\n",   // input count changes
+    "# only a comment\n\n"  // no entry
+  };
+  for (const auto &content : malformed) {
+    std::vector<ShapeMixItem> items;
+    EXPECT_NE(ParseMix(content, &items), RET_OK) << content;
+  }
+  std::vector<ShapeMixItem> items;
+  EXPECT_NE(ParseShapeMixFile("./load_generator_no_such_file.txt", &items), RET_OK);
+}
+
+/// Feature: latency percentiles of the open loop benchmark
+/// Description: take percentiles of empty values, a single value and 1..100 at the bounds and in between
+/// Expectation: nearest-rank results, 0 for empty values, the min at p=0 and the max at p=100
+TEST_F(LoadGeneratorTest, PercentileOf) {
+  EXPECT_EQ(PercentileOf({}, 0.0), 0);
+  EXPECT_EQ(PercentileOf({}, 0.5), 0);
+  EXPECT_EQ(PercentileOf({}, 1.0), 0);
+  EXPECT_EQ(PercentileOf({42}, 0.0), 42);
+  EXPECT_EQ(PercentileOf({42}, 1.0), 42);
+  std::vector<uint64_t> sorted;
+  for (uint64_t i = 1; i <= 100; i++) {
+    sorted.push_back(i);
+  }
+  EXPECT_EQ(PercentileOf(sorted, 0.0), 1);
+  EXPECT_EQ(PercentileOf(sorted, 0.001), 1);
+  EXPECT_EQ(PercentileOf(sorted, 0.5), 50);
+  EXPECT_EQ(PercentileOf(sorted, 0.505), 51);
+  EXPECT_EQ(PercentileOf(sorted, 0.99), 99);
+  EXPECT_EQ(PercentileOf(sorted, 1.0), 100);
+}
+
+/// Feature: latency summary of the open loop benchmark
+/// Description: summarize no latency and the unsorted latencies 1..1000 us
+/// Expectation: an all zero summary for no latency, otherwise the mean, percentiles and max in ms
+TEST_F(LoadGeneratorTest, SummarizeLatency) {
+  auto empty = SummarizeLatency({});
+  EXPECT_EQ(empty.count, 0);
+  EXPECT_FLOAT_EQ(empty.mean_ms, 0.0f);
+  EXPECT_FLOAT_EQ(empty.p50_ms, 0.0f);
+  EXPECT_FLOAT_EQ(empty.max_ms, 0.0f);
+
+  std::vector<uint64_t> latencies;
+  for (uint64_t i = 1000; i >= 1; i--) {
+    latencies.push_back(i);
+  }
+  auto summary = SummarizeLatency(latencies);
+  EXPECT_EQ(summary.count, 1000);
+  EXPECT_FLOAT_EQ(summary.mean_ms, 0.5005f);
+  EXPECT_FLOAT_EQ(summary.p50_ms, 0.5f);
+  EXPECT_FLOAT_EQ(summary.p90_ms, 0.9f);
+  EXPECT_FLOAT_EQ(summary.p99_ms, 0.99f);
+  EXPECT_FLOAT_EQ(summary.p999_ms, 0.999f);
+  EXPECT_FLOAT_EQ(summary.max_ms, 1.0f);
+}
+
+/// Feature: request schedule of the open loop benchmark
+/// Description: generate fixed rate arrivals for a single shape
+/// Expectation: requests arrive exactly every 1 / qps second and all use the only shape
+TEST_F(LoadGeneratorTest, GenerateFixedSchedule) {
+  LoadGenerator generator(kQps, kArrivalFixed, kSeed);
+  std::vector<uint64_t> arrival_us;
+  std::vector<size_t> mix_index;
+  ASSERT_EQ(generator.GenerateSchedule(10, {ShapeMixItem()}, &arrival_us, &mix_index), RET_OK);
+  ASSERT_EQ(arrival_us.size(), 10);
+  ASSERT_EQ(mix_index.size(), 10);
+  for (size_t i = 0; i < arrival_us.size(); i++) {
+    EXPECT_EQ(arrival_us[i], i * 5000);
+    EXPECT_EQ(mix_index[i], 0);
+  }
+}
+
+/// Feature: request schedule of the open loop benchmark
+/// Description: generate poisson arrivals over a 3:1 shape mix twice with the same seed
+/// Expectation: arrivals never go back, the mean rate and mix ratio match the config, the seed fixes the schedule
+TEST_F(LoadGeneratorTest, GeneratePoissonSchedule) {
+  ShapeMixItem large;
+  large.weight = 3.0f;
+  ShapeMixItem small;
+  small.weight = 1.0f;
+  std::vector<ShapeMixItem> mix = {large, small};
+  LoadGenerator generator(kQps, kArrivalPoisson, kSeed);
+  std::vector<uint64_t> arrival_us;
+  std::vector<size_t> mix_index;
+  ASSERT_EQ(generator.GenerateSchedule(kRequestNum, mix, &arrival_us, &mix_index), RET_OK);
+  ASSERT_EQ(arrival_us.size(), kRequestNum);
+  size_t large_num = 0;
+  for (size_t i = 0; i < kRequestNum; i++) {
+    if (i > 0) {
+      EXPECT_GE(arrival_us[i], arrival_us[i - 1]);
+    }
+    large_num += mix_index[i] == 0 ? 1 : 0;
+  }
+  auto rate = kRequestNum * 1000000.0 / arrival_us.back();
+  EXPECT_NEAR(rate, kQps, kQps * 0.05);
+  EXPECT_NEAR(static_cast<double>(large_num) / kRequestNum, 0.75, 0.02);
+
+  LoadGenerator same_seed(kQps, kArrivalPoisson, kSeed);
+  std::vector<uint64_t> same_arrival_us;
+  std::vector<size_t> same_mix_index;
+  ASSERT_EQ(same_seed.GenerateSchedule(kRequestNum, mix, &same_arrival_us, &same_mix_index), RET_OK);
+  EXPECT_EQ(same_arrival_us, arrival_us);
+  EXPECT_EQ(same_mix_index, mix_index);
+}
+
+/// Feature: request schedule of the open loop benchmark
+/// Description: generate a schedule without a positive qps or without a shape mix
+/// Expectation: the schedule is rejected as an invalid parameter
+TEST_F(LoadGeneratorTest, GenerateInvalidSchedule) {
+  std::vector<uint64_t> arrival_us;
+  std::vector<size_t> mix_index;
+  LoadGenerator zero_qps(0.0, kArrivalFixed);
+  EXPECT_EQ(zero_qps.GenerateSchedule(10, {ShapeMixItem()}, &arrival_us, &mix_index), RET_INPUT_PARAM_INVALID);
+  LoadGenerator no_mix(kQps, kArrivalPoisson);
+  EXPECT_EQ(no_mix.GenerateSchedule(10, {}, &arrival_us, &mix_index), RET_INPUT_PARAM_INVALID);
+}
+}  // namespace lite
+}  // namespace mindspore
@@ -155,6 +155,17 @@ class MS_API BenchmarkFlags : public virtual FlagParser {
     AddFlag(&BenchmarkFlags::inter_op_parallel_num_, "interOpParallelNum", "parallel number of operators in predict",
             1);
     AddFlag(&BenchmarkFlags::enable_gl_texture_, "enableGLTexture", "Enable GlTexture2D", false);
+    // open loop load generation, only valid with enableParallelPredict
+    AddFlag(&BenchmarkFlags::open_loop_qps_, "openLoopQps",
+            "Target request rate of open loop parallel predict, 0 means closed loop", 0.0);
+    AddFlag(&BenchmarkFlags::arrival_mode_, "arrivalMode", "Request arrival of open loop: poisson | fixed", "poisson");
+    AddFlag(&BenchmarkFlags::open_loop_request_num_, "openLoopRequestNum", "Request number of open loop", 1000);
+    AddFlag(&BenchmarkFlags::open_loop_client_num_, "openLoopClientNum",
+            "Max requests in flight of open loop. Arrivals beyond it wait for a free client and are reported as "
+            "client delay, so it should be large enough not to throttle arrivals under overload",
+            64);
+    AddFlag(&BenchmarkFlags::shape_mix_file_, "shapeMixFile",
+            "Shape mix of open loop, one \"<weight> <inputShapes>\" per line, e.g. 3 1,224,224,3", "");
   }
 
   ~BenchmarkFlags() override = default;
@@ -172,6 +183,11 @@ class MS_API BenchmarkFlags : public virtual FlagParser {
   int parallel_task_num_ = 2;
   int inter_op_parallel_num_ = 1;
   int workers_num_ = 2;
+  double open_loop_qps_ = 0.0;
+  std::string arrival_mode_ = "poisson";
+  int open_loop_request_num_ = 1000;
+  int open_loop_client_num_ = 64;
+  std::string shape_mix_file_;
   std::string model_file_;
   std::string in_data_file_;
   std::string config_file_;
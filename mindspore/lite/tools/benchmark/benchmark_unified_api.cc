@@ -40,6 +40,7 @@
 #include "include/mpi_vb.h"
 #endif
 #ifdef PARALLEL_INFERENCE
+#include <chrono>
 #include <thread>
 #endif
 namespace mindspore {
@@ -970,6 +971,163 @@ int BenchmarkUnifiedApi::AddConfigInfo(const std::shared_ptr<RunnerConfig> &runn
   return RET_OK;
 }
 
+int BenchmarkUnifiedApi::InitModelParallelRunner(const std::shared_ptr<mindspore::Context> &context) {
+  auto runner_config = std::make_shared<RunnerConfig>();
+  runner_config->SetContext(context);
+  runner_config->SetWorkersNum(flags_->workers_num_);
+  auto status = AddConfigInfo(runner_config);
+  MS_CHECK_FALSE_MSG(status != kSuccess, RET_ERROR, "add config info for parallel predict failed.");
+  auto ret = model_runner_.Init(flags_->model_file_, runner_config);
+  MS_CHECK_FALSE_MSG(ret != kSuccess, RET_ERROR, "model pool init failed.");
+  ms_inputs_for_api_ = model_runner_.GetInputs();
+  MS_CHECK_FALSE_MSG(ms_inputs_for_api_.empty(), RET_ERROR, "model pool input is empty.");
+  return RET_OK;
+}
+
+int BenchmarkUnifiedApi::GenerateShapeMixInputData(const ShapeMixItem &item, std::vector<void *> *inputs) {
+  MS_ASSERT(inputs != nullptr);
+  if (item.dims.size() != ms_inputs_for_api_.size()) {
+    MS_LOG(ERROR) << "shape mix has " << item.dims.size() << " inputs, but model has " << ms_inputs_for_api_.size();
+    return RET_ERROR;
+  }
+  for (size_t i = 0; i < ms_inputs_for_api_.size(); i++) {
+    size_t size;
+    if (ms_inputs_for_api_[i].DataType() == static_cast<enum DataType>(kNumberTypeFloat32)) {
+      size = sizeof(float);
+    } else if (ms_inputs_for_api_[i].DataType() == static_cast<enum DataType>(kNumberTypeInt32)) {
+      size = sizeof(int32_t);
+    } else {
+      MS_LOG(ERROR) << "not support in model pool.";
+      return RET_ERROR;
+    }
+    for (auto dim : item.dims[i]) {
+      size *= static_cast<size_t>(dim);
+    }
+    void *input_data = malloc(size);
+    MS_CHECK_FALSE_MSG(input_data == nullptr, RET_ERROR, "malloc input data failed.");
+    inputs->push_back(input_data);
+    int status = GenerateRandomData(size, input_data, static_cast<int>(ms_inputs_for_api_[i].DataType()));
+    if (status != RET_OK) {
+      MS_LOG(ERROR) << "GenerateRandomData for inTensor failed:" << status;
+      return status;
+    }
+  }
+  return RET_OK;
+}
+
+void BenchmarkUnifiedApi::OpenLoopClientRun(std::vector<RequestRecord> *records, const std::vector<size_t> &mix_index) {
+  while (true) {
+    auto request_idx = next_request_.fetch_add(1);
+    if (request_idx >= records->size()) {
+      return;
+    }
+    auto &record = records->at(request_idx);
+    // arrival times are scheduled in advance, so a late issue is counted as queueing delay rather than dropped
+    auto now = GetTimeUs();
+    if (now < record.arrival_us) {
+      std::this_thread::sleep_for(std::chrono::microseconds(record.arrival_us - now));
+    }
+    record.mix_index = mix_index[request_idx];
+    auto &mix_item = shape_mix_[record.mix_index];
+    auto in = model_runner_.GetInputs();
+    for (size_t i = 0; i < in.size(); i++) {
+      in[i].SetData(shape_mix_inputs_data_[record.mix_index][i]);
+      in[i].SetShape(mix_item.dims[i]);
+    }
+    MSKernelCallBack before = [&record](const std::vector<mindspore::MSTensor> &,
+                                        const std::vector<mindspore::MSTensor> &, const MSCallBackParam &) {
+      uint64_t expected = 0;
+      auto now_us = GetTimeUs();
+      if (record.compute_start_us.compare_exchange_strong(expected, now_us)) {
+        record.exec_thread = std::this_thread::get_id();
+      }
+      return true;
+    };
+    std::vector<MSTensor> output;
+    record.issue_us = GetTimeUs();
+    auto ret = model_runner_.Predict(in, &output, before, nullptr);
+    record.finish_us = GetTimeUs();
+    for (auto &tensor : in) {
+      tensor.SetData(nullptr);
+    }
+    record.success = (ret == kSuccess);
+    if (!record.success) {
+      model_parallel_runner_ret_failed_ = true;
+      MS_LOG(ERROR) << "model pool predict failed, request index: " << request_idx;
+    }
+  }
+}
+
+int BenchmarkUnifiedApi::OpenLoopInference(const std::shared_ptr<mindspore::Context> &context) {
+  ArrivalMode arrival_mode;
+  auto status = ParseArrivalMode(flags_->arrival_mode_, &arrival_mode);
+  MS_CHECK_FALSE_MSG(status != RET_OK, status, "parse arrival mode failed.");
+  MS_CHECK_FALSE_MSG(flags_->open_loop_request_num_ <= 0 || flags_->open_loop_client_num_ <= 0,
+                     RET_INPUT_PARAM_INVALID, "openLoopRequestNum and openLoopClientNum should be greater than 0.");
+  if (!flags_->shape_mix_file_.empty()) {
+    status = ParseShapeMixFile(flags_->shape_mix_file_, &shape_mix_);
+    MS_CHECK_FALSE_MSG(status != RET_OK, status, "parse shape mix file failed.");
+  } else {
+    ShapeMixItem item;
+    (void)std::transform(flags_->resize_dims_.begin(), flags_->resize_dims_.end(), std::back_inserter(item.dims),
+                         [&](auto &shapes) { return this->ConverterToInt64Vector<int>(shapes); });
+    shape_mix_.push_back(item);
+  }
+
+  auto model_init_start = GetTimeUs();
+  status = InitModelParallelRunner(context);
+  MS_CHECK_FALSE_MSG(status != RET_OK, status, "init model parallel runner failed.");
+  auto model_init_end = GetTimeUs();
+  for (auto &item : shape_mix_) {
+    std::vector<void *> inputs;
+    status = GenerateShapeMixInputData(item, &inputs);
+    shape_mix_inputs_data_.push_back(inputs);
+    MS_CHECK_FALSE_MSG(status != RET_OK, status, "generate shape mix input data failed.");
+  }
+
+  // warm up every shape of the mix on the pool before the timed run
+  for (int i = 0; i < flags_->warm_up_loop_count_; i++) {
+    for (size_t mix_idx = 0; mix_idx < shape_mix_.size(); mix_idx++) {
+      auto in = model_runner_.GetInputs();
+      for (size_t j = 0; j < in.size(); j++) {
+        in[j].SetData(shape_mix_inputs_data_[mix_idx][j]);
+        in[j].SetShape(shape_mix_[mix_idx].dims[j]);
+      }
+      std::vector<MSTensor> output;
+      auto ret = model_runner_.Predict(in, &output);
+      for (auto &tensor : in) {
+        tensor.SetData(nullptr);
+      }
+      MS_CHECK_FALSE_MSG(ret != kSuccess, RET_ERROR, "model pool warm up failed.");
+    }
+  }
+  std::cout << "=============== end warm up ===============\n";
+
+  std::vector<uint64_t> arrival_us;
+  std::vector<size_t> mix_index;
+  LoadGenerator generator(flags_->open_loop_qps_, arrival_mode, static_cast<uint32_t>(random_engine_()));
+  status = generator.GenerateSchedule(static_cast<size_t>(flags_->open_loop_request_num_), shape_mix_, &arrival_us,
+                                      &mix_index);
+  MS_CHECK_FALSE_MSG(status != RET_OK, status, "generate open loop schedule failed.");
+  std::vector<RequestRecord> records(arrival_us.size());
+  open_loop_start_us_ = GetTimeUs();
+  for (size_t i = 0; i < records.size(); i++) {
+    records[i].arrival_us = open_loop_start_us_ + arrival_us[i];
+  }
+  next_request_ = 0;
+  std::vector<std::thread> client_threads;
+  for (int i = 0; i < flags_->open_loop_client_num_; i++) {
+    client_threads.push_back(
+      std::thread(&BenchmarkUnifiedApi::OpenLoopClientRun, this, &records, std::cref(mix_index)));
+  }
+  for (auto &client_thread : client_threads) {
+    client_thread.join();
+  }
+  std::cout << "parallel predict init time: " << (model_init_end - model_init_start) / kFloatMSEC << " ms\n";
+  PrintOpenLoopReport(records, flags_->open_loop_qps_, static_cast<size_t>(flags_->open_loop_client_num_));
+  return model_parallel_runner_ret_failed_ ? RET_ERROR : RET_OK;
+}
+
 int BenchmarkUnifiedApi::ParallelInference(std::shared_ptr<mindspore::Context> context) {
   if (flags_->warm_up_loop_count_ > kMaxRequestNum || flags_->parallel_num_ > kMaxRequestNum) {
     MS_LOG(WARNING) << "in parallel predict warm up loop count should less than" << kMaxRequestNum;
@@ -979,19 +1137,10 @@ int BenchmarkUnifiedApi::ParallelInference(std::shared_ptr<mindspore::Context> c
                        [&](auto &shapes) { return this->ConverterToInt64Vector<int>(shapes); });
 
   // model runner init
-  auto runner_config = std::make_shared<RunnerConfig>();
-  runner_config->SetContext(context);
-  runner_config->SetWorkersNum(flags_->workers_num_);
-  auto status = AddConfigInfo(runner_config);
-  MS_CHECK_FALSE_MSG(status != kSuccess, RET_ERROR, "add config info for parallel predict failed.");
   auto model_init_start = GetTimeUs();
-  auto ret = model_runner_.Init(flags_->model_file_, runner_config);
-  MS_CHECK_FALSE_MSG(ret != kSuccess, RET_ERROR, "model pool init failed.");
+  auto status = InitModelParallelRunner(context);
+  MS_CHECK_FALSE_MSG(status != RET_OK, status, "init model parallel runner failed.");
   auto model_init_end = GetTimeUs();
-
-  // load data
-  ms_inputs_for_api_ = model_runner_.GetInputs();
-  MS_CHECK_FALSE_MSG(ms_inputs_for_api_.empty(), RET_ERROR, "model pool input is empty.");
   for (int i = 0; i < flags_->parallel_num_ + flags_->warm_up_loop_count_; i++) {
     status = LoadInput();
     MS_CHECK_FALSE_MSG(status != RET_OK, status, "Generate input data error");
@@ -1114,6 +1263,13 @@ int BenchmarkUnifiedApi::RunBenchmark() {
   UpdateConfigInfo();
 #ifdef PARALLEL_INFERENCE
   if (flags_->enable_parallel_predict_) {
+    if (flags_->open_loop_qps_ > 0) {
+      MS_CHECK_FALSE_MSG(flags_->resize_dims_.empty() && flags_->shape_mix_file_.empty(), RET_ERROR,
+                         "use open loop parallel predict, inputShapes and shapeMixFile can not both be empty.");
+      status = OpenLoopInference(context);
+      MS_CHECK_FALSE_MSG(status != RET_OK, RET_ERROR, "run model pool in open loop failed.");
+      return RET_OK;
+    }
     MS_CHECK_FALSE_MSG(flags_->resize_dims_.empty(), RET_ERROR, "use parallel predict, inputShapes can not use empty.");
     status = ParallelInference(context);
     MS_CHECK_FALSE_MSG(status != RET_OK, RET_ERROR, "run model pool failed.");
@@ -1525,6 +1681,12 @@ int BenchmarkUnifiedApi::InitDumpTensorDataCallbackParameter() {
 
 BenchmarkUnifiedApi::~BenchmarkUnifiedApi() {
 #ifdef PARALLEL_INFERENCE
+  for (auto &input : shape_mix_inputs_data_) {
+    for (auto &data : input) {
+      free(data);
+      data = nullptr;
+    }
+  }
   for (auto &input : all_inputs_data_) {
     for (auto &data : input) {
       if (data != nullptr) {
@@ -34,6 +34,7 @@
 #include <nlohmann/json.hpp>
 #endif
 #include "tools/benchmark/benchmark_base.h"
+#include "tools/benchmark/load_generator.h"
 #include "tools/common/flag_parser.h"
 #include "src/common/file_utils.h"
 #include "src/common/utils.h"
@@ -101,6 +102,10 @@ class MS_API BenchmarkUnifiedApi : public BenchmarkBase {
   void ModelParallelRunnerRun(int task_num, int parallel_idx);
   int ParallelInference(std::shared_ptr<mindspore::Context> context);
   int AddConfigInfo(const std::shared_ptr<RunnerConfig> &runner_config);
+  int InitModelParallelRunner(const std::shared_ptr<mindspore::Context> &context);
+  int GenerateShapeMixInputData(const ShapeMixItem &item, std::vector<void *> *inputs);
+  void OpenLoopClientRun(std::vector<RequestRecord> *records, const std::vector<size_t> &mix_index);
+  int OpenLoopInference(const std::shared_ptr<mindspore::Context> &context);
 #endif
 
   template <typename T>
@@ -135,6 +140,11 @@ class MS_API BenchmarkUnifiedApi : public BenchmarkBase {
   std::vector<std::vector<mindspore::MSTensor>> all_outputs_;
   std::atomic<bool> model_parallel_runner_ret_failed_{false};
   std::atomic<bool> runner_run_start_ = false;
+  // open loop
+  std::vector<ShapeMixItem> shape_mix_;
+  std::vector<std::vector<void *>> shape_mix_inputs_data_;
+  std::atomic<size_t> next_request_{0};
+  uint64_t open_loop_start_us_ = 0;
   mindspore::ModelParallelRunner model_runner_;
 #endif
 };
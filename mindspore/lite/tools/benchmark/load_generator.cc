@@ -0,0 +1,242 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "tools/benchmark/load_generator.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <limits>
+#include <sstream>
+#include <unordered_map>
+#include "src/common/file_utils.h"
+#include "src/common/log_adapter.h"
+#include "src/common/utils.h"
+#include "include/errorcode.h"
+
+namespace mindspore::lite {
+namespace {
+constexpr double kUsPerSecond = 1000000.0;
+constexpr float kUsPerMs = 1000.0f;
+constexpr double kP50 = 0.5;
+constexpr double kP90 = 0.9;
+constexpr double kP99 = 0.99;
+constexpr double kP999 = 0.999;
+constexpr float kPercent = 100.0f;
+
+int ParseShapes(const std::string &shapes_str, std::vector<std::vector<int64_t>> *dims) {
+  for (const auto &shape_str : StrSplit(shapes_str, ":")) {
+    std::vector<int64_t> shape;
+    for (const auto &dim_str : StrSplit(shape_str, ",")) {
+      char *end = nullptr;
+      auto dim = std::strtoll(dim_str.c_str(), &end, 10);
+      if (end == dim_str.c_str() || *end != '\0' || dim <= 0) {
+        MS_LOG(ERROR) << "Invalid dim " << dim_str << " in shape " << shapes_str;
+        return RET_ERROR;
+      }
+      shape.push_back(dim);
+    }
+    dims->push_back(shape);
+  }
+  return dims->empty() ? RET_ERROR : RET_OK;
+}
+}  // namespace
+
+uint64_t PercentileOf(const std::vector<uint64_t> &sorted, double percentile) {
+  if (sorted.empty()) {
+    return 0;
+  }
+  // nearest-rank percentile
+  auto rank = static_cast<size_t>(std::ceil(percentile * sorted.size()));
+  rank = std::max<size_t>(rank, 1);
+  return sorted[std::min(rank, sorted.size()) - 1];
+}
+
+int ParseArrivalMode(const std::string &mode_str, ArrivalMode *mode) {
+  MS_ASSERT(mode != nullptr);
+  if (mode_str == "poisson") {
+    *mode = kArrivalPoisson;
+  } else if (mode_str == "fixed") {
+    *mode = kArrivalFixed;
+  } else {
+    MS_LOG(ERROR) << "arrivalMode should be poisson | fixed, but got " << mode_str;
+    return RET_INPUT_PARAM_INVALID;
+  }
+  return RET_OK;
+}
+
+int ParseShapeMixFile(const std::string &file_path, std::vector<ShapeMixItem> *items) {
+  MS_ASSERT(items != nullptr);
+  auto real_path = RealPath(file_path.c_str());
+  std::ifstream ifs(real_path);
+  if (!ifs.is_open()) {
+    MS_LOG(ERROR) << "open shape mix file failed: " << file_path;
+    return RET_ERROR;
+  }
+  std::string line;
+  size_t line_num = 0;
+  while (std::getline(ifs, line)) {
+    line_num++;
+    if (line.empty() || line[0] == '#') {
+      continue;
+    }
+    std::istringstream line_stream(line);
+    ShapeMixItem item;
+    std::string shapes_str;
+    if (!(line_stream >> item.weight >> shapes_str) || item.weight <= 0.0f) {
+      MS_LOG(ERROR) << "shape mix file line " << line_num << " should be \"<weight> <shapes>\": " << line;
+      return RET_ERROR;
+    }
+    if (ParseShapes(shapes_str, &item.dims) != RET_OK) {
+      MS_LOG(ERROR) << "shape mix file line " << line_num << " has invalid shapes: " << shapes_str;
+      return RET_ERROR;
+    }
+    if (!items->empty() && items->front().dims.size() != item.dims.size()) {
+      MS_LOG(ERROR) << "shape mix file line " << line_num << " has " << item.dims.size() << " inputs, expect "
+                    << items->front().dims.size();
+      return RET_ERROR;
+    }
+    items->push_back(item);
+  }
+  if (items->empty()) {
+    MS_LOG(ERROR) << "shape mix file is empty: " << file_path;
+    return RET_ERROR;
+  }
+  return RET_OK;
+}
+
+int LoadGenerator::GenerateSchedule(size_t request_num, const std::vector<ShapeMixItem> &mix,
+                                    std::vector<uint64_t> *arrival_us, std::vector<size_t> *mix_index) {
+  MS_ASSERT(arrival_us != nullptr && mix_index != nullptr);
+  if (qps_ <= 0.0 || mix.empty()) {
+    MS_LOG(ERROR) << "open loop qps should be greater than 0 and shape mix should not be empty.";
+    return RET_INPUT_PARAM_INVALID;
+  }
+  std::vector<float> weights;
+  (void)std::transform(mix.begin(), mix.end(), std::back_inserter(weights),
+                       [](const ShapeMixItem &item) { return item.weight; });
+  std::discrete_distribution<size_t> mix_distribution(weights.begin(), weights.end());
+  std::exponential_distribution<double> interval_distribution(qps_);
+  arrival_us->resize(request_num);
+  mix_index->resize(request_num);
+  double now_second = 0.0;
+  for (size_t i = 0; i < request_num; i++) {
+    if (mode_ == kArrivalPoisson) {
+      now_second += interval_distribution(random_engine_);
+    } else {
+      now_second = static_cast<double>(i) / qps_;
+    }
+    arrival_us->at(i) = static_cast<uint64_t>(now_second * kUsPerSecond);
+    mix_index->at(i) = mix_distribution(random_engine_);
+  }
+  return RET_OK;
+}
+
+LatencySummary SummarizeLatency(std::vector<uint64_t> latencies_us) {
+  LatencySummary summary;
+  if (latencies_us.empty()) {
+    return summary;
+  }
+  std::sort(latencies_us.begin(), latencies_us.end());
+  double total = 0.0;
+  for (auto latency : latencies_us) {
+    total += static_cast<double>(latency);
+  }
+  summary.count = latencies_us.size();
+  summary.mean_ms = static_cast<float>(total / latencies_us.size()) / kUsPerMs;
+  summary.p50_ms = PercentileOf(latencies_us, kP50) / kUsPerMs;
+  summary.p90_ms = PercentileOf(latencies_us, kP90) / kUsPerMs;
+  summary.p99_ms = PercentileOf(latencies_us, kP99) / kUsPerMs;
+  summary.p999_ms = PercentileOf(latencies_us, kP999) / kUsPerMs;
+  summary.max_ms = latencies_us.back() / kUsPerMs;
+  return summary;
+}
+
+void PrintLatencySummary(const std::string &title, const LatencySummary &summary) {
+  std::cout << std::left << std::setw(16) << title << std::right << std::fixed << std::setprecision(3)
+            << " mean: " << summary.mean_ms << " ms | p50: " << summary.p50_ms << " ms | p90: " << summary.p90_ms
+            << " ms | p99: " << summary.p99_ms << " ms | p999: " << summary.p999_ms << " ms | max: " << summary.max_ms
+            << " ms" << std::endl;
+}
+
+void PrintOpenLoopReport(const std::vector<RequestRecord> &records, double target_qps, size_t client_num) {
+  std::vector<uint64_t> latency;
+  std::vector<uint64_t> client_delay;
+  std::vector<uint64_t> queue_delay;
+  std::vector<uint64_t> compute;
+  std::unordered_map<std::thread::id, uint64_t> busy_by_thread;
+  std::map<size_t, std::vector<uint64_t>> latency_by_mix;
+  uint64_t first_arrival = std::numeric_limits<uint64_t>::max();
+  uint64_t last_finish = 0;
+  size_t failed = 0;
+  size_t unattributed = 0;
+  for (const auto &record : records) {
+    if (!record.success) {
+      failed++;
+      continue;
+    }
+    // requests whose kernels never reported back are treated as queued until issue time
+    auto start_reported = record.compute_start_us.load();
+    auto compute_start = start_reported == 0 ? record.issue_us : start_reported;
+    compute_start = std::min(std::max(compute_start, record.arrival_us), record.finish_us);
+    latency.push_back(record.finish_us - record.arrival_us);
+    client_delay.push_back(std::max(record.issue_us, record.arrival_us) - record.arrival_us);
+    queue_delay.push_back(compute_start - record.arrival_us);
+    compute.push_back(record.finish_us - compute_start);
+    // the worker thread of such a request is unknown, so it is left out of the per worker utilization
+    if (start_reported == 0) {
+      unattributed++;
+    } else {
+      busy_by_thread[record.exec_thread] += record.finish_us - compute_start;
+    }
+    latency_by_mix[record.mix_index].push_back(record.finish_us - record.arrival_us);
+    first_arrival = std::min(first_arrival, record.arrival_us);
+    last_finish = std::max(last_finish, record.finish_us);
+  }
+  std::cout << "=============== open loop report ===============" << std::endl;
+  std::cout << "target qps: " << target_qps << " | requests: " << records.size() << " | failed: " << failed
+            << std::endl;
+  if (latency.empty()) {
+    return;
+  }
+  auto wall_us = static_cast<double>(last_finish - first_arrival);
+  auto achieved_qps = wall_us > 0 ? latency.size() * kUsPerSecond / wall_us : 0.0;
+  std::cout << "achieved throughput: " << achieved_qps << " qps | wall time: " << wall_us / kUsPerMs << " ms"
+            << std::endl;
+  PrintLatencySummary("latency", SummarizeLatency(latency));
+  // at most client_num requests are in flight, so the arrivals beyond it wait for a free client before being issued
+  std::cout << "client bound: " << client_num << " requests in flight" << std::endl;
+  PrintLatencySummary("client delay", SummarizeLatency(client_delay));
+  PrintLatencySummary("queueing delay", SummarizeLatency(queue_delay));
+  PrintLatencySummary("compute time", SummarizeLatency(compute));
+  if (latency_by_mix.size() > 1) {
+    for (auto &iter : latency_by_mix) {
+      PrintLatencySummary("shape mix " + std::to_string(iter.first), SummarizeLatency(iter.second));
+    }
+  }
+  size_t worker_idx = 0;
+  for (auto &iter : busy_by_thread) {
+    auto utilization = wall_us > 0 ? iter.second * kPercent / wall_us : 0.0;
+    std::cout << "worker " << worker_idx++ << " utilization: " << utilization << "%" << std::endl;
+  }
+  if (unattributed > 0) {
+    std::cout << "requests without worker info (not in worker utilization): " << unattributed << std::endl;
+  }
+  std::cout << "=================================================" << std::endl;
+}
+}  // namespace mindspore::lite
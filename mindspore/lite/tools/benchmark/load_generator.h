@@ -0,0 +1,89 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef MINDSPORE_LITE_TOOLS_BENCHMARK_LOAD_GENERATOR_H_
+#define MINDSPORE_LITE_TOOLS_BENCHMARK_LOAD_GENERATOR_H_
+
+#include <atomic>
+#include <map>
+#include <mutex>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+#include "include/api/types.h"
+
+namespace mindspore::lite {
+enum MS_API ArrivalMode { kArrivalPoisson = 0, kArrivalFixed = 1 };
+
+// One entry of the shape mix file: "<weight> <shape>:<shape>...", shapes use the same syntax as inputShapes.
+struct MS_API ShapeMixItem {
+  float weight = 1.0f;
+  std::vector<std::vector<int64_t>> dims;
+};
+
+// Timestamps of one open-loop request, all taken from the monotonic GetTimeUs clock.
+struct MS_API RequestRecord {
+  uint64_t arrival_us = 0;
+  uint64_t issue_us = 0;
+  std::atomic<uint64_t> compute_start_us{0};
+  uint64_t finish_us = 0;
+  std::thread::id exec_thread;
+  size_t mix_index = 0;
+  bool success = false;
+};
+
+struct MS_API LatencySummary {
+  size_t count = 0;
+  float mean_ms = 0.0f;
+  float p50_ms = 0.0f;
+  float p90_ms = 0.0f;
+  float p99_ms = 0.0f;
+  float p999_ms = 0.0f;
+  float max_ms = 0.0f;
+};
+
+int ParseArrivalMode(const std::string &mode_str, ArrivalMode *mode);
+
+int ParseShapeMixFile(const std::string &file_path, std::vector<ShapeMixItem> *items);
+
+class MS_API LoadGenerator {
+ public:
+  LoadGenerator(double qps, ArrivalMode mode, uint32_t seed = 0) : qps_(qps), mode_(mode), random_engine_(seed) {}
+  ~LoadGenerator() = default;
+
+  // Build the arrival offset (relative to the start of the run) and shape mix index of every request.
+  int GenerateSchedule(size_t request_num, const std::vector<ShapeMixItem> &mix, std::vector<uint64_t> *arrival_us,
+                       std::vector<size_t> *mix_index);
+
+ private:
+  double qps_;
+  ArrivalMode mode_;
+  std::mt19937 random_engine_;
+};
+
+// Nearest-rank percentile of the ascending sorted values, percentile is in [0, 1]. 0 is returned for empty values.
+uint64_t PercentileOf(const std::vector<uint64_t> &sorted, double percentile);
+
+LatencySummary SummarizeLatency(std::vector<uint64_t> latencies_us);
+
+void PrintLatencySummary(const std::string &title, const LatencySummary &summary);
+
+// client_num is the max requests in flight. An arrival finding all the clients busy is issued late, and the delay is
+// reported as client delay, so the run is open loop only while the client delay stays near zero.
+void PrintOpenLoopReport(const std::vector<RequestRecord> &records, double target_qps, size_t client_num);
+}  // namespace mindspore::lite
+#endif  // MINDSPORE_LITE_TOOLS_BENCHMARK_LOAD_GENERATOR_H_
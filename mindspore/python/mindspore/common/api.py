@@ -1194,6 +1194,22 @@ class _CellGraphExecutor:
             return self._exec_pip(obj, *args, phase=phase_real)
         raise KeyError('{} graph is not exist.'.format(phase_real))
 
+    def prefetch_inputs(self, obj, *args, phase='predict'):
+        """
+        Stage the inputs of the next step while the current step of the specific graph is running.
+
+        The host data of inputs is copied to the device in the background, and the next run with the same input
+        tensors skips the copy. The input tensors must not be modified in place after the prefetch.
+
+        Args:
+            obj (Cell): The cell whose graph has been compiled.
+            args (tuple): The inputs of the next step.
+            phase (str): The phase name. Default: 'predict'.
+        """
+        phase_real = phase + '.' + str(obj.create_time) + '.' + str(id(obj)) + '.' + obj.arguments_key
+        if self.has_compiled(phase_real):
+            self._graph_executor.prefetch_inputs(args, phase_real)
+
     def del_net_res(self, net_id):
         self._graph_executor.del_net_res(net_id)
 
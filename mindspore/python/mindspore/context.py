@@ -1009,6 +1009,19 @@ def set_ps_context(**kwargs):
         enable_ssl (bool): Set PS SSL mode enabled or disabled. Default: False.
         client_password (str): Password to decrypt the secret key stored in the client certificate. Default: ''.
         server_password (str): Password to decrypt the secret key stored in the server certificate. Default: ''.
+        staleness_bound (int): The maximum number of steps that a worker can run ahead of the slowest worker. The
+                               workers push and pull without waiting for each other within the bound. 0 means the
+                               fully synchronous training. Default: 0.
+        push_compress_type (str): The compression of gradients pushed by workers, which can be "NO_COMPRESS",
+                                  "FP16", "BF16", "INT8" or "TOP_K". Default: "NO_COMPRESS".
+        push_topk_ratio (float): The ratio of gradient elements pushed by the "TOP_K" compression, which is in the
+                                 range (0, 1]. Default: 0.01.
+        embedding_storage_path (str): The directory where the servers store the embedding tables in block files, and
+                                      only the hot rows are kept in memory. Default: ''.
+        embedding_cache_size (int): The memory size in MB of the rows of one embedding table kept in memory when
+                                    embedding_storage_path is set. Default: 1024.
+        incremental_checkpoint (bool): Whether the servers persist only the changed rows of the embedding tables in
+                                       the disaster recovery mode. Default: False.
 
     Raises:
         ValueError: If input key is not the attribute in parameter server training mode context.
@@ -43,10 +43,18 @@ __all__ = ['set_sending_batches', 'load', '_init_device_info',
            'set_autotune_interval', 'get_autotune_interval',
            'set_auto_offload', 'get_auto_offload',
            'set_enable_watchdog', 'get_enable_watchdog',
-           'set_multiprocessing_timeout_interval', 'get_multiprocessing_timeout_interval']
+           'set_multiprocessing_timeout_interval', 'get_multiprocessing_timeout_interval',
+           'set_shuffle_memory_limit', 'get_shuffle_memory_limit',
+           'set_generator_zero_copy', 'get_generator_zero_copy',
+           'set_enable_generator_shm_ring', 'get_enable_generator_shm_ring',
+           'set_enable_tfrecord_crc_check', 'get_enable_tfrecord_crc_check',
+           'set_file_readahead_depth', 'get_file_readahead_depth',
+           'set_enable_tensor_memory_pool', 'get_enable_tensor_memory_pool',
+           'set_tensor_memory_pool_limit', 'get_tensor_memory_pool_limit']
 
 INT32_MAX = 2147483647
 UINT32_MAX = 4294967295
+INT64_MAX = 9223372036854775807
 
 _config = cde.GlobalContext.config_manager()
 
@@ -767,6 +775,303 @@ def get_multiprocessing_timeout_interval():
     return _config.get_multiprocessing_timeout_interval()
 
 
+def set_shuffle_memory_limit(memory_limit):
+    """
+    Set the memory limit (in bytes) of the shuffle buffer of `shuffle` operation.
+
+    The default setting is 0, which means the shuffle buffer holds `buffer_size` rows in memory.
+    Otherwise, the rows of the shuffle buffer are held in memory up to `memory_limit` bytes, and the
+    rest rows are spilled to a scratch file in the directory given by the environment variable TMPDIR
+    (TEMP on Windows, default: /tmp) and read back when they are randomly selected. A large `buffer_size`
+    with a memory limit gives near-global shuffle quality for the datasets which can not be fully held in memory.
+    The memory usage and the spilled rows of the shuffle buffer are saved in the dataset profiling data.
+
+    Args:
+        memory_limit (int): The memory limit (in bytes) of the shuffle buffer.
+
+    Raises:
+        TypeError: If `memory_limit` is not of type int.
+        ValueError: If `memory_limit` < 0 or `memory_limit` > INT64_MAX(9223372036854775807).
+
+    Examples:
+        >>> # Hold at most 1GB rows in memory, and spill the rest of the 1000000 rows to disk.
+        >>> ds.config.set_shuffle_memory_limit(1024 * 1024 * 1024)
+        >>> dataset = dataset.shuffle(buffer_size=1000000)
+    """
+    if not isinstance(memory_limit, int) or isinstance(memory_limit, bool):
+        raise TypeError("memory_limit must be of type int.")
+    if memory_limit < 0 or memory_limit > INT64_MAX:
+        raise ValueError(
+            "Memory limit given is not within the required range [0, INT64_MAX(9223372036854775807)].")
+    _config.set_shuffle_memory_limit(memory_limit)
+
+
+def get_shuffle_memory_limit():
+    """
+    Get the memory limit (in bytes) of the shuffle buffer of `shuffle` operation.
+
+    Returns:
+        int, the memory limit (in bytes) of the shuffle buffer, 0 means no limit.
+
+    Examples:
+        >>> # Get the global configuration of the memory limit of the shuffle buffer.
+        >>> # If set_shuffle_memory_limit() is never called before, the default value(0) will be returned.
+        >>> shuffle_memory_limit = ds.config.get_shuffle_memory_limit()
+    """
+    return _config.get_shuffle_memory_limit()
+
+
+def set_generator_zero_copy(zero_copy):
+    """
+    Set whether the numpy arrays returned by the source of `GeneratorDataset` are shared by the dataset tensors
+    instead of being copied.
+
+    The default setting is False, which means every array returned by the source is copied into a new tensor.
+    When it is set to True, the numeric arrays which are C-contiguous and aligned are referenced by the tensors without
+    copying, and the arrays of other kinds are still copied. The arrays are shared until the tensors are released,
+    so the source must return a new array for every row, and the returned arrays must not be modified or reused
+    by the source afterwards. The tensors fetched by `create_tuple_iterator` or `create_dict_iterator` with
+    `output_numpy=True` share the memory with the tensors of the pipeline as well, so a pipeline without
+    transforms hands the arrays from the source to the iterator without any copy.
+
+    Args:
+        zero_copy (bool): Whether to share the arrays returned by the source of `GeneratorDataset`.
+
+    Raises:
+        TypeError: If `zero_copy` is not a boolean data type.
+
+    Examples:
+        >>> # The source returns a new array for every row, so the arrays could be shared without copying.
+        >>> ds.config.set_generator_zero_copy(True)
+        >>> dataset = ds.GeneratorDataset(lambda: ((np.ones((224, 224, 3), np.uint8),) for _ in range(10)), ["data"])
+    """
+    if not isinstance(zero_copy, bool):
+        raise TypeError("zero_copy must be a boolean dtype.")
+    _config.set_generator_zero_copy(zero_copy)
+
+
+def get_generator_zero_copy():
+    """
+    Get whether the numpy arrays returned by the source of `GeneratorDataset` are shared without copying.
+
+    Returns:
+        bool, whether the arrays returned by the source of `GeneratorDataset` are shared without copying.
+
+    Examples:
+        >>> # Get the global configuration of sharing the arrays returned by the source of GeneratorDataset.
+        >>> # If set_generator_zero_copy() is never called before, the default value(False) will be returned.
+        >>> zero_copy = ds.config.get_generator_zero_copy()
+    """
+    return _config.get_generator_zero_copy()
+
+
+def set_enable_generator_shm_ring(enable):
+    """
+    Set whether the worker processes of `GeneratorDataset` transfer the rows through shared memory rings.
+
+    The default setting is False, which means the rows generated by the worker processes of `GeneratorDataset`
+    with `python_multiprocessing=True` are returned through Python queues, and then converted to tensors under the
+    Python GIL. When it is set to True, the samples are split into one shard for each worker process, and each worker
+    process writes the rows of its shard into its own ring of a shared memory segment owned by the pipeline, from which
+    the pipeline builds the rows without pickling and without the Python GIL. It only applies to the random
+    accessible sources with `num_parallel_workers` > 1, and is not supported on Windows. The size of each slot of the
+    rings is `max_rowsize` of `GeneratorDataset`.
+
+    Args:
+        enable (bool): Whether to transfer the rows of the worker processes through shared memory rings.
+
+    Raises:
+        TypeError: If `enable` is not a boolean data type.
+
+    Examples:
+        >>> # Set a new global configuration value to transfer the rows of the workers through shared memory rings.
+        >>> ds.config.set_enable_generator_shm_ring(True)
+    """
+    if not isinstance(enable, bool):
+        raise TypeError("enable must be a boolean dtype.")
+    _config.set_enable_generator_shm_ring(enable)
+
+
+def get_enable_generator_shm_ring():
+    """
+    Get whether the worker processes of `GeneratorDataset` transfer the rows through shared memory rings.
+
+    Returns:
+        bool, whether the worker processes of `GeneratorDataset` transfer the rows through shared memory rings.
+
+    Examples:
+        >>> # Get the global configuration of transferring the rows of the GeneratorDataset workers.
+        >>> # If set_enable_generator_shm_ring() is never called before, the default value(False) will be returned.
+        >>> shm_ring = ds.config.get_enable_generator_shm_ring()
+    """
+    return _config.get_enable_generator_shm_ring()
+
+
+def set_enable_tfrecord_crc_check(enable):
+    """
+    Set whether `TFRecordDataset` verifies the CRC of each record it reads.
+
+    The default setting is False, which means the masked CRC32C of the length and the data of each record are not
+    read, and the records out of the shard of the reader are skipped without reading their data. When it is set to
+    True, the CRCs of every record are verified, and an error is raised if a record is damaged.
+
+    Args:
+        enable (bool): Whether to verify the CRC of each record of the TFRecord files.
+
+    Raises:
+        TypeError: If `enable` is not a boolean data type.
+
+    Examples:
+        >>> # Set a new global configuration value to verify the CRC of each record of the TFRecord files.
+        >>> ds.config.set_enable_tfrecord_crc_check(True)
+    """
+    if not isinstance(enable, bool):
+        raise TypeError("enable must be a boolean dtype.")
+    _config.set_enable_tfrecord_crc_check(enable)
+
+
+def get_enable_tfrecord_crc_check():
+    """
+    Get whether `TFRecordDataset` verifies the CRC of each record it reads.
+
+    Returns:
+        bool, whether `TFRecordDataset` verifies the CRC of each record it reads.
+
+    Examples:
+        >>> # Get the global configuration of verifying the CRC of the TFRecord files.
+        >>> # If set_enable_tfrecord_crc_check() is never called before, the default value(False) will be returned.
+        >>> crc_check = ds.config.get_enable_tfrecord_crc_check()
+    """
+    return _config.get_enable_tfrecord_crc_check()
+
+
+def set_file_readahead_depth(depth):
+    """
+    Set the max number of image files each file based dataset reads ahead.
+
+    The default setting is 0, which means each image file is read by the worker thread loading its row. When it is set
+    to a positive number, `ImageFolderDataset`, `CocoDataset`, `VOCDataset` and `ManifestDataset` read the files of the
+    rows to load next in a pool of I/O threads shared by all the pipelines, so the files are already in memory when the
+    rows are loaded, which helps on network file systems and hard disks. At most `depth` files are read ahead and not
+    loaded yet by each dataset, which is also the number of reads in flight at the same time. The files to decrypt by
+    `decrypt` are not read ahead. The readahead metrics of each dataset are saved by the dataset profiler.
+
+    Args:
+        depth (int): The max number of files each dataset reads ahead, 0 means no readahead.
+
+    Raises:
+        TypeError: If `depth` is not of type int.
+        ValueError: If `depth` < 0 or `depth` > INT32_MAX(2147483647).
+
+    Examples:
+        >>> # Set a new global configuration value to read 64 files ahead.
+        >>> ds.config.set_file_readahead_depth(64)
+    """
+    if not isinstance(depth, int) or isinstance(depth, bool):
+        raise TypeError("depth isn't of type int.")
+    if depth < 0 or depth > INT32_MAX:
+        raise ValueError("depth is not within the required range [0, INT32_MAX(2147483647)].")
+    _config.set_file_readahead_depth(depth)
+
+
+def get_file_readahead_depth():
+    """
+    Get the max number of image files each file based dataset reads ahead.
+
+    Returns:
+        int, the max number of files each dataset reads ahead, 0 means no readahead.
+
+    Examples:
+        >>> # Get the global configuration of the file readahead depth.
+        >>> # If set_file_readahead_depth() is never called before, the default value(0) will be returned.
+        >>> depth = ds.config.get_file_readahead_depth()
+    """
+    return _config.get_file_readahead_depth()
+
+
+def set_enable_tensor_memory_pool(enable):
+    """
+    Set whether the data of the tensors in the dataset pipelines is allocated from a memory pool.
+
+    The default setting is False, which means the data of each tensor is allocated by the system allocator. When it is
+    set to True, the data of the tensors created afterwards is allocated from a memory pool shared by all the pipelines
+    of the process. The pool rounds each allocation up to one of its size classes and keeps the freed memory for the
+    following allocations, with a small cache for each thread, which reduces the allocator traffic and the memory
+    fragmentation of the map workers. The statistics of the pool are saved in the dataset profiling data.
+
+    Args:
+        enable (bool): Whether to allocate the data of the tensors from the memory pool.
+
+    Raises:
+        TypeError: If `enable` is not a boolean data type.
+
+    Examples:
+        >>> # Allocate the data of the tensors from the memory pool.
+        >>> ds.config.set_enable_tensor_memory_pool(True)
+    """
+    if not isinstance(enable, bool):
+        raise TypeError("enable must be a boolean dtype.")
+    _config.set_enable_tensor_memory_pool(enable)
+
+
+def get_enable_tensor_memory_pool():
+    """
+    Get whether the data of the tensors in the dataset pipelines is allocated from a memory pool.
+
+    Returns:
+        bool, whether the data of the tensors is allocated from the memory pool.
+
+    Examples:
+        >>> # Get the global configuration of the tensor memory pool.
+        >>> # If set_enable_tensor_memory_pool() is never called before, the default value(False) will be returned.
+        >>> enable = ds.config.get_enable_tensor_memory_pool()
+    """
+    return _config.get_enable_tensor_memory_pool()
+
+
+def set_tensor_memory_pool_limit(memory_limit):
+    """
+    Set the memory limit (in bytes) of the tensor memory pool enabled by `set_enable_tensor_memory_pool` .
+
+    The default setting is 0, which means no limit. Otherwise, the bytes allocated from the pool and not freed yet
+    never exceed `memory_limit`, and an out of memory error is raised by the allocation beyond it. The freed memory
+    kept by the pool is returned to the system before the memory held by the pool grows beyond the limit.
+
+    Args:
+        memory_limit (int): The memory limit (in bytes) of the tensor memory pool.
+
+    Raises:
+        TypeError: If `memory_limit` is not of type int.
+        ValueError: If `memory_limit` < 0 or `memory_limit` > INT64_MAX(9223372036854775807).
+
+    Examples:
+        >>> # Allocate at most 8GB from the tensor memory pool at the same time.
+        >>> ds.config.set_enable_tensor_memory_pool(True)
+        >>> ds.config.set_tensor_memory_pool_limit(8 * 1024 * 1024 * 1024)
+    """
+    if not isinstance(memory_limit, int) or isinstance(memory_limit, bool):
+        raise TypeError("memory_limit must be of type int.")
+    if memory_limit < 0 or memory_limit > INT64_MAX:
+        raise ValueError(
+            "Memory limit given is not within the required range [0, INT64_MAX(9223372036854775807)].")
+    _config.set_tensor_memory_pool_limit(memory_limit)
+
+
+def get_tensor_memory_pool_limit():
+    """
+    Get the memory limit (in bytes) of the tensor memory pool.
+
+    Returns:
+        int, the memory limit (in bytes) of the tensor memory pool, 0 means no limit.
+
+    Examples:
+        >>> # Get the global configuration of the memory limit of the tensor memory pool.
+        >>> # If set_tensor_memory_pool_limit() is never called before, the default value(0) will be returned.
+        >>> memory_limit = ds.config.get_tensor_memory_pool_limit()
+    """
+    return _config.get_tensor_memory_pool_limit()
+
+
 def set_dynamic_shape(is_dynamic):
     """
     Set the dynamic shape flag of the dataset.
@@ -46,11 +46,14 @@ from . import samplers
 from .queue import _SharedQueue
 from .validators import check_generatordataset, check_numpyslicesdataset, check_paddeddataset
 from ..core.config import get_enable_shared_mem, get_prefetch_size, get_multiprocessing_timeout_interval, \
-    get_enable_watchdog
+    get_enable_watchdog, get_enable_generator_shm_ring, get_generator_zero_copy
 from ..core.datatypes import mstypelist_to_detypelist
 from ..core.py_util_helpers import ExceptionHandler
 
 
+_SHM_RING_TIMEOUT_MS = 1000
+
+
 def _iter_fn(dataset, num_samples):
     """
     Generator function wrapper for iterable dataset.
@@ -115,6 +118,19 @@ def _cpp_sampler_fn_mp(sample_ids, sample_fn):
     return sample_fn.process(sample_ids)
 
 
+def _cpp_sampler_fn_shm(sample_ids, shm_id, sample_fn):
+    """
+    Multiprocessing generator function wrapper for mappable dataset with cpp sampler, the worker processes write the
+    rows into the shared memory rings instead of returning them.
+    """
+    if not isinstance(sample_ids, np.ndarray):
+        raise RuntimeError("Sample IDs are not in a numpy array.")
+    if sample_ids.size == 0:
+        raise RuntimeError("Sampler passed an empty sample IDs list.")
+
+    sample_fn.dispatch(sample_ids, shm_id)
+
+
 def _fill_worker_indices(workers, indices, idx):
     """
     Worker index queue filler, fill worker index queue in round robin order.
@@ -177,10 +193,11 @@ class SamplerFn:
     Multiprocessing or multithread generator function wrapper master process.
     """
 
-    def __init__(self, dataset, num_worker, multi_process, max_rowsize):
+    def __init__(self, dataset, num_worker, multi_process, max_rowsize, shm_ring=False):
         self.workers = []
         self.num_worker = num_worker
         self.multi_process = multi_process
+        self.shm_ring = shm_ring
         self.need_join = False
         self.ppid = os.getpid()
         self.pids = []
@@ -203,13 +220,16 @@ class SamplerFn:
         queue_size = min(queue_size, queue_size * 4 // num_worker)
         queue_size = max(2, queue_size)
 
-        if multi_process and get_enable_shared_mem():
+        if multi_process and (get_enable_shared_mem() or shm_ring):
             _check_shm_usage(num_worker, queue_size, max_rowsize)
         count = multiprocessing.Value('i', 0)
-        for _ in range(num_worker):
+        for worker_id in range(num_worker):
             if multi_process is True:
                 try:
-                    worker = _GeneratorWorkerMp(dataset, self.eof, max_rowsize, queue_size, self.ppid, count)
+                    if shm_ring:
+                        worker = _GeneratorWorkerShm(dataset, self.eof, worker_id, self.ppid)
+                    else:
+                        worker = _GeneratorWorkerMp(dataset, self.eof, max_rowsize, queue_size, self.ppid, count)
                 except Exception:
                     raise RuntimeError("Init multiprocessing.Queue() failed, This might be caused by insufficient shm, "
                                        "and the recommended shm size is at least 5 GB.")
@@ -284,6 +304,17 @@ class SamplerFn:
                 idx_cursor = _fill_worker_indices(self.workers, indices, idx_cursor)
             yield _convert_row(result)
 
+    def dispatch(self, indices, shm_id):
+        """
+        Split the indices into one shard for each worker process in turn, the worker processes write the rows of their
+        shards into their own rings of the shared memory in order.
+        """
+        for i, w in enumerate(self.workers):
+            if not w.is_alive():
+                self._stop_subprocess()
+                raise RuntimeError("The worker process {} of GeneratorDataset has exited.".format(i))
+            w.put((shm_id, indices[i::self.num_worker]))
+
     def _launch_cleanup_worker(self, multi_process):
         """
         We need a extra thread and process if main process or subprocess was killed.
@@ -415,6 +446,72 @@ def _generator_worker_loop(dataset, idx_queue, result_queue, eof, is_multiproces
         del result, idx
 
 
+def _shm_worker_should_exit(eof, idx_queue, ppid):
+    """
+    Judge whether the shared memory worker should exit.
+    """
+    if eof.is_set() or not _PythonMultiprocessing.is_process_alive(ppid):
+        idx_queue.cancel_join_thread()
+        return True
+    return False
+
+
+def _write_shm_row(ring, worker_id, result, eof, idx_queue, ppid):
+    """
+    Write a row or the exception raised by the row into the ring of the worker. Return False if the worker should exit.
+    """
+    err_msg = None
+    if isinstance(result, ExceptionHandler):
+        err_msg = "Caught {} {}.\nOriginal {}".format(result.except_type.__name__, result.where, result.except_msg)
+    while True:
+        if err_msg is None:
+            try:
+                written = ring.write(worker_id, result, _SHM_RING_TIMEOUT_MS)
+            except RuntimeError as e:
+                # The row can not be written, e.g. it is larger than max_rowsize, so the error is passed to the reader.
+                err_msg = str(e)
+                continue
+        else:
+            written = ring.write_error(worker_id, err_msg, _SHM_RING_TIMEOUT_MS)
+        if written:
+            return True
+        if _shm_worker_should_exit(eof, idx_queue, ppid):
+            return False
+
+
+def _generator_shm_worker_loop(dataset, idx_queue, eof, worker_id, ppid):
+    """
+    Multiprocess generator worker loop, which writes the rows of the dispatched shards into the shared memory ring.
+    """
+    signal.signal(signal.SIGTERM, partial(_subprocess_handle, eof))
+    ring = None
+    ring_shm_id = None
+    while True:
+        _ignore_sigint(is_multiprocessing=True)
+
+        # Fetch the shard of an epoch, block
+        try:
+            shm_id, indices = idx_queue.get(timeout=1)
+        except queue.Empty:
+            if _shm_worker_should_exit(eof, idx_queue, ppid):
+                return
+            continue
+        if eof.is_set():
+            idx_queue.cancel_join_thread()
+            return
+        if ring_shm_id != shm_id:
+            ring = cde.SharedRowRing(shm_id)
+            ring_shm_id = shm_id
+        for idx in indices:
+            try:
+                result = _convert_row(dataset[idx])
+            except Exception:  # pylint: disable=broad-except
+                result = ExceptionHandler(where="in GeneratorDataset worker process")
+            if not _write_shm_row(ring, worker_id, result, eof, idx_queue, ppid):
+                return
+            del result
+
+
 class _GeneratorWorkerMt(threading.Thread):
     """
     Worker process for multi-thread Generator.
@@ -455,7 +552,10 @@ class _GeneratorWorkerMp(multiprocessing.Process):
     def __init__(self, dataset, eof, max_rowsize, queue_size, ppid, count):
         self.idx_queue = multiprocessing.Queue(queue_size)
         if get_enable_shared_mem():
-            self.res_queue = _SharedQueue(queue_size, count, max_rowsize=max_rowsize)
+            # The arrays got from the shared memory are overwritten by the later rows, so they are copied out when
+            # the dataset shares the arrays with its tensors instead of copying them.
+            self.res_queue = _SharedQueue(queue_size, count, copy_out=get_generator_zero_copy(),
+                                          max_rowsize=max_rowsize)
         else:
             self.res_queue = multiprocessing.Queue(queue_size)
         self.idx_queue._joincancelled = True  # pylint: disable=W0212
@@ -491,6 +591,32 @@ class _GeneratorWorkerMp(multiprocessing.Process):
         del self.res_queue
 
 
+class _GeneratorWorkerShm(multiprocessing.Process):
+    """
+    Worker process for multiprocess Generator, which writes the rows into its ring of the shared memory.
+    """
+
+    def __init__(self, dataset, eof, worker_id, ppid):
+        self.idx_queue = multiprocessing.Queue(2)
+        self.idx_queue._joincancelled = True  # pylint: disable=W0212
+        super().__init__(target=_generator_shm_worker_loop, args=(dataset, self.idx_queue, eof, worker_id, ppid))
+
+    def put(self, item):
+        """
+        Put function for worker index queue. Block with timeout.
+        """
+        self.idx_queue.put(item, timeout=30)
+
+    def queue_empty(self):
+        if not self.idx_queue.empty():
+            logger.warning("idx_queue is not empty.")
+            return False
+        return True
+
+    def __del__(self):
+        del self.idx_queue
+
+
 class GeneratorDataset(MappableDataset, UnionBaseDataset):
     """
     A source dataset that generates data from Python by invoking Python data source each epoch.
@@ -671,6 +797,7 @@ class GeneratorDataset(MappableDataset, UnionBaseDataset):
 
         self.max_rowsize = max_rowsize
         self.sample_fn = None
+        self.shm_row_size = 0  # Max size in bytes of a row in the shared memory rings, 0 means the rings are not used
 
     def __deepcopy__(self, memodict):
         if id(self) in memodict:
@@ -687,9 +814,16 @@ class GeneratorDataset(MappableDataset, UnionBaseDataset):
                 if new_op.num_parallel_workers > 1:
                     self.__validate_memory_usage()
 
+                    shm_ring = self.python_multiprocessing and get_enable_generator_shm_ring() and \
+                        platform.system().lower() != 'windows'
                     sample_fn = SamplerFn(self.source, new_op.num_parallel_workers, self.python_multiprocessing,
-                                          self.max_rowsize)
-                    new_op.prepared_source = (lambda sample_ids: _cpp_sampler_fn_mp(sample_ids, sample_fn))
+                                          self.max_rowsize, shm_ring)
+                    if shm_ring:
+                        new_op.shm_row_size = self.max_rowsize * 1024 * 1024
+                        new_op.prepared_source = (lambda sample_ids, shm_id:
+                                                  _cpp_sampler_fn_shm(sample_ids, shm_id, sample_fn))
+                    else:
+                        new_op.prepared_source = (lambda sample_ids: _cpp_sampler_fn_mp(sample_ids, sample_fn))
                 else:
                     new_op.prepared_source = (lambda sample_ids: _cpp_sampler_fn(sample_ids, self.source))
                 new_op.sample_fn = sample_fn
@@ -725,12 +859,12 @@ class GeneratorDataset(MappableDataset, UnionBaseDataset):
     def parse(self, children=None):
         if self.schema is None:
             return cde.GeneratorNode(self.prepared_source, self.column_names, self.column_types, self.source_len,
-                                     self.sampler, self.num_parallel_workers)
+                                     self.sampler, self.num_parallel_workers, self.shm_row_size)
         schema = self.schema
         if isinstance(schema, Schema):
             schema = self.schema.cpp_schema
         return cde.GeneratorNode(self.prepared_source, schema, self.source_len, self.sampler,
-                                 self.num_parallel_workers)
+                                 self.num_parallel_workers, self.shm_row_size)
 
     def __validate_memory_usage(self):
         """
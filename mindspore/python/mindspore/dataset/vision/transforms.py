@@ -66,9 +66,9 @@ from .validators import check_adjust_gamma, check_alpha, check_auto_augment, che
     check_mix_up, check_mix_up_batch_c, check_normalize, check_normalizepad, check_num_channels, check_pad, \
     check_pad_to_size, check_positive_degrees, check_posterize, check_prob, check_random_adjust_sharpness, \
     check_random_affine, check_random_auto_contrast, check_random_color_adjust, check_random_crop, \
-    check_random_erasing, check_random_perspective, check_random_resize_crop, check_random_rotation, \
-    check_random_select_subpolicy_op, check_random_solarize, check_range, check_rescale, check_resize, \
-    check_resize_interpolation, check_rgb_to_hsv, check_rotate, check_slice_patches, check_ten_crop, \
+    check_random_crop_decode_resize, check_random_erasing, check_random_perspective, check_random_resize_crop, \
+    check_random_rotation, check_random_select_subpolicy_op, check_random_solarize, check_range, check_rescale, \
+    check_resize, check_resize_interpolation, check_rgb_to_hsv, check_rotate, check_slice_patches, check_ten_crop, \
     check_uniform_augment, check_to_tensor, FLOAT_MAX_INTEGER
 from ..core.datatypes import mstype_to_detype, nptype_to_detype
 from ..transforms.py_transforms_util import Implementation
@@ -635,6 +635,70 @@ class Decode(ImageTensorOperation, PyTensorOperation):
         return cde.DecodeOperation(True)
 
 
+class DecodeResize(ImageTensorOperation):
+    """
+    A combination of `Decode` and `Resize`. It will get better performance for JPEG images. This operator will decode
+    the input image in RGB mode and resize the decoded image. A JPEG image is decoded at a reduced scale of 1/2, 1/4
+    or 1/8 when the reduced image is not smaller than the output size, so that less pixels are decoded and resized.
+
+    Args:
+        size (Union[int, Sequence[int]]): The output size of the resized image. The size value(s) must be positive.
+            If size is an integer, the smaller edge of the image will be resized to this value with
+            the same image aspect ratio.
+            If size is a sequence of length 2, it should be (height, width).
+        interpolation (Inter, optional): Image interpolation mode for resize operator(default=Inter.BILINEAR).
+            It can be any of [Inter.BILINEAR, Inter.NEAREST, Inter.BICUBIC, Inter.AREA, Inter.PILCUBIC].
+
+            - Inter.BILINEAR, means interpolation method is bilinear interpolation.
+
+            - Inter.NEAREST, means interpolation method is nearest-neighbor interpolation.
+
+            - Inter.BICUBIC, means interpolation method is bicubic interpolation.
+
+            - Inter.AREA, means interpolation method is pixel area interpolation.
+
+            - Inter.PILCUBIC, means interpolation method is bicubic interpolation like implemented in pillow, input
+              should be in 3 channels format.
+
+    Raises:
+        TypeError: If `size` is not of type int or Sequence[int].
+        TypeError: If `interpolation` is not of type :class:`mindspore.dataset.vision.Inter`.
+        ValueError: If `size` is not positive.
+        RuntimeError: If given tensor is not a 1D sequence.
+
+    Supported Platforms:
+        ``CPU``
+
+    Examples:
+        >>> from mindspore.dataset.vision import Inter
+        >>> decode_resize_op = vision.DecodeResize(size=(50, 75), interpolation=Inter.NEAREST)
+        >>> transforms_list = [decode_resize_op]
+        >>> image_folder_dataset = image_folder_dataset.map(operations=transforms_list,
+        ...                                                 input_columns=["image"])
+    """
+
+    @check_resize_interpolation
+    def __init__(self, size, interpolation=Inter.BILINEAR):
+        super().__init__()
+        if isinstance(size, int):
+            size = (size,)
+        self.size = size
+        self.interpolation = interpolation
+        self.implementation = Implementation.C
+
+    def __call__(self, img):
+        if not isinstance(img, np.ndarray):
+            raise TypeError(
+                "Input should be an encoded image in 1-D NumPy format, got {}.".format(type(img)))
+        if img.ndim != 1 or img.dtype.type is not np.uint8:
+            raise TypeError("Input should be an encoded image with uint8 type in 1-D NumPy format, " +
+                            "got format:{}, dtype:{}.".format(type(img), img.dtype.type))
+        return super().__call__(img)
+
+    def parse(self):
+        return cde.DecodeResizeOperation(self.size, Inter.to_c_type(self.interpolation))
+
+
 class Equalize(ImageTensorOperation, PyTensorOperation):
     """
     Apply histogram equalization on input image.
@@ -1844,6 +1908,9 @@ class RandomCropDecodeResize(ImageTensorOperation):
 
         max_attempts (int, optional): The maximum number of attempts to propose a valid crop_area (default=10).
             If exceeded, fall back to use center_crop instead. The max_attempts value must be positive.
+        scaled_decode (bool, optional): Whether to decode a JPEG image at the smallest DCT scale (1/2, 1/4 or 1/8)
+            which still covers the output size (default=False). It is faster, but the output is no longer the same
+            as that of decoding at full scale.
 
     Raises:
         TypeError: If `size` is not of type int or Sequence[int].
@@ -1851,6 +1918,7 @@ class RandomCropDecodeResize(ImageTensorOperation):
         TypeError: If `ratio` is not of type tuple.
         TypeError: If `interpolation` is not of type :class:`mindspore.dataset.vision.Inter`.
         TypeError: If `max_attempts` is not of type integer.
+        TypeError: If `scaled_decode` is not of type bool.
         ValueError: If `size` is not positive.
         ValueError: If `scale` is negative.
         ValueError: If `ratio` is negative.
@@ -1871,9 +1939,9 @@ class RandomCropDecodeResize(ImageTensorOperation):
         ...                                                 input_columns=["image"])
     """
 
-    @check_random_resize_crop
+    @check_random_crop_decode_resize
     def __init__(self, size, scale=(0.08, 1.0), ratio=(3. / 4., 4. / 3.),
-                 interpolation=Inter.BILINEAR, max_attempts=10):
+                 interpolation=Inter.BILINEAR, max_attempts=10, scaled_decode=False):
         super().__init__()
         if isinstance(size, int):
             size = (size, size)
@@ -1882,6 +1950,7 @@ class RandomCropDecodeResize(ImageTensorOperation):
         self.ratio = ratio
         self.interpolation = interpolation
         self.max_attempts = max_attempts
+        self.scaled_decode = scaled_decode
         self.implementation = Implementation.C
 
     def __call__(self, img):
@@ -1896,7 +1965,7 @@ class RandomCropDecodeResize(ImageTensorOperation):
     def parse(self):
         return cde.RandomCropDecodeResizeOperation(self.size, self.scale, self.ratio,
                                                    Inter.to_c_type(self.interpolation),
-                                                   self.max_attempts)
+                                                   self.max_attempts, self.scaled_decode)
 
 
 class RandomCropWithBBox(ImageTensorOperation):
@@ -339,6 +339,22 @@ def check_random_resize_crop(method):
     return new_method
 
 
+def check_random_crop_decode_resize(method):
+    """A wrapper that wraps a parameter checker around the original function(random crop decode resize operation)."""
+
+    @wraps(method)
+    def new_method(self, *args, **kwargs):
+        [size, scale, ratio, interpolation, max_attempts, scaled_decode], _ = parse_user_args(method, *args, **kwargs)
+        if interpolation is not None:
+            type_check(interpolation, (Inter,), "interpolation")
+        check_size_scale_ration_max_attempts_paras(size, scale, ratio, max_attempts)
+        type_check(scaled_decode, (bool,), "scaled_decode")
+
+        return method(self, *args, **kwargs)
+
+    return new_method
+
+
 def check_random_auto_contrast(method):
     """Wrapper method to check the parameters of Python RandomAutoContrast op."""
 
@@ -955,7 +955,52 @@ class Cell(Cell_):
         """
         self._auto_parallel_compile_and_run = True
         self.compile(*inputs)
+        new_inputs = self._get_run_inputs(inputs)
 
+        if self._auto_parallel_mode:
+            if new_inputs and isinstance(new_inputs[0], Tensor) and inputs[0].virtual_flag:
+                # get parallel inputs in sink mode, parallel inputs set in _cell_graph_executor.compile
+                parallel_inputs_run = self._parallel_inputs_run
+            else:
+                parallel_inputs_run = new_inputs
+            return _cell_graph_executor(self, *parallel_inputs_run, phase=self.phase)
+        return _cell_graph_executor(self, *new_inputs, phase=self.phase)
+
+    def prefetch_inputs(self, *inputs):
+        """
+        Copy the inputs of a later step to the device in the background, while the current step is running.
+
+        In graph mode, the host data of `inputs` is staged by the runtime, and the later run of the Cell with the same
+        input tensors uses the staged data instead of copying them again. The inputs of at most two steps are staged at
+        the same time. The prefetch is ignored in PyNative mode or before the Cell is compiled.
+
+        Note:
+            The input tensors must not be modified in place after the prefetch. The data replaced by
+            `Tensor.assign_value` is detected and copied in the step.
+
+        Args:
+            inputs (tuple): Inputs of the Cell object in the later step.
+
+        Examples:
+            >>> import numpy as np
+            >>> import mindspore as ms
+            >>> from mindspore import nn, Tensor
+            >>>
+            >>> ms.set_context(mode=ms.GRAPH_MODE)
+            >>> net = nn.ReLU()
+            >>> inputs = [Tensor(np.random.random([3, 10]), dtype=ms.float32) for _ in range(3)]
+            >>> net.prefetch_inputs(inputs[0])
+            >>> for step, x in enumerate(inputs):
+            ...     if step + 1 < len(inputs):
+            ...         net.prefetch_inputs(inputs[step + 1])
+            ...     output = net(x)
+        """
+        if context._get_mode() == context.PYNATIVE_MODE:
+            return
+        _cell_graph_executor.prefetch_inputs(self, *self._get_run_inputs(inputs), phase=self.phase)
+
+    def _get_run_inputs(self, inputs):
+        """Get the inputs which are passed to the compiled graph."""
         new_inputs = []
         for i in inputs:
             if isinstance(i, Tensor):
@@ -969,15 +1014,7 @@ class Cell(Cell_):
             elif hasattr(self, "enable_tuple_broaden") and self.enable_tuple_broaden and isinstance(i, tuple) and \
                     _check_all_tensor(i):
                 new_inputs.append(i)
-
-        if self._auto_parallel_mode:
-            if new_inputs and isinstance(new_inputs[0], Tensor) and inputs[0].virtual_flag:
-                # get parallel inputs in sink mode, parallel inputs set in _cell_graph_executor.compile
-                parallel_inputs_run = self._parallel_inputs_run
-            else:
-                parallel_inputs_run = new_inputs
-            return _cell_graph_executor(self, *parallel_inputs_run, phase=self.phase)
-        return _cell_graph_executor(self, *new_inputs, phase=self.phase)
+        return new_inputs
 
     def auto_parallel_compile_and_run(self):
         """
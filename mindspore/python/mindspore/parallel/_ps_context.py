@@ -107,6 +107,12 @@ _set_ps_context_func_map = {
     "instance_name": ps_context().set_instance_name,
     "participation_time_level": ps_context().set_participation_time_level,
     "continuous_failure_times": ps_context().set_continuous_failure_times,
+    "staleness_bound": ps_context().set_staleness_bound,
+    "push_compress_type": ps_context().set_push_compress_type,
+    "push_topk_ratio": ps_context().set_push_topk_ratio,
+    "embedding_storage_path": ps_context().set_embedding_storage_path,
+    "embedding_cache_size": ps_context().set_embedding_cache_size,
+    "incremental_checkpoint": ps_context().set_incremental_checkpoint,
 }
 
 _get_ps_context_func_map = {
@@ -161,14 +167,20 @@ _get_ps_context_func_map = {
     "instance_name": ps_context().instance_name,
     "participation_time_level": ps_context().participation_time_level,
     "continuous_failure_times": ps_context().continuous_failure_times,
+    "staleness_bound": ps_context().staleness_bound,
+    "push_compress_type": ps_context().push_compress_type,
+    "push_topk_ratio": ps_context().push_topk_ratio,
+    "embedding_storage_path": ps_context().embedding_storage_path,
+    "embedding_cache_size": ps_context().embedding_cache_size,
+    "incremental_checkpoint": ps_context().incremental_checkpoint,
 }
 
 _check_positive_int_keys = ["server_num", "scheduler_port", "fl_server_port",
                             "start_fl_job_threshold", "start_fl_job_time_window", "update_model_time_window",
                             "fl_iteration_num", "client_epoch_num", "client_batch_size", "cipher_time_window",
-                            "reconstruct_secrets_threshold"]
+                            "reconstruct_secrets_threshold", "embedding_cache_size"]
 
-_check_non_negative_int_keys = ["worker_num"]
+_check_non_negative_int_keys = ["worker_num", "staleness_bound"]
 
 _check_positive_float_keys = ["update_model_ratio", "client_learning_rate"]
 
@@ -177,10 +189,12 @@ _check_port_keys = ["scheduler_port", "fl_server_port"]
 _check_string_keys = {
     "upload_compress_type": ["NO_COMPRESS", "DIFF_SPARSE_QUANT"],
     "download_compress_type": ["NO_COMPRESS", "QUANT"],
+    "push_compress_type": ["NO_COMPRESS", "FP16", "BF16", "INT8", "TOP_K"],
 }
 
 _check_float_range_keys = {
     "upload_sparse_rate": {"lower_limit": 0.0, "upper_limit": 1.0, "rel": Rel.INC_RIGHT},
+    "push_topk_ratio": {"lower_limit": 0.0, "upper_limit": 1.0, "rel": Rel.INC_RIGHT},
 }
 
 def _get_ps_mode_rank():
@@ -219,6 +233,24 @@ def _set_ps_context(**kwargs):
         enable_ssl (bool): Set PS SSL mode enabled or disabled. Default: False.
         client_password (str): Password to decrypt the secret key stored in the client certificate. Default: ''.
         server_password (str): Password to decrypt the secret key stored in the server certificate. Default: ''.
+        staleness_bound (int): The maximum number of steps that a worker can run ahead of the slowest worker. The
+                               workers push and pull without waiting for each other within the bound. 0 means the
+                               fully synchronous training. Default: 0.
+        push_compress_type (str): The compression of gradients pushed by workers, which can be "NO_COMPRESS",
+                                  "FP16", "BF16", "INT8" or "TOP_K". The "TOP_K" sends the gradient elements of the
+                                  largest magnitude and keeps the rest in the worker for the next push, and it is
+                                  only used by the dense gradients. Default: "NO_COMPRESS".
+        push_topk_ratio (float): The ratio of gradient elements pushed by the "TOP_K" compression, which is in the
+                                 range (0, 1]. Default: 0.01.
+        embedding_storage_path (str): The directory where the servers store the embedding tables in block files. Only
+                                      the hot rows are kept in memory, so a server can host the tables larger than
+                                      its memory. Empty means keeping the tables in memory. Default: ''.
+        embedding_cache_size (int): The memory size in MB of the rows of one embedding table kept in memory when
+                                    embedding_storage_path is set. Default: 1024.
+        incremental_checkpoint (bool): Whether the servers persist the embedding tables incrementally in the disaster
+                                       recovery mode. Only the changed rows are appended to the delta logs in
+                                       background, and the delta logs are compacted into the base file periodically.
+                                       Default: False.
 
     Raises:
         ValueError: If input key is not the attribute in parameter server training mode context.
@@ -0,0 +1,283 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <cstring>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include "common/common.h"
+#include "gtest/gtest.h"
+#include "minddata/dataset/core/tensor.h"
+#include "minddata/dataset/engine/datasetops/batch_slots.h"
+#include "minddata/dataset/include/dataset/datasets.h"
+#include "minddata/dataset/include/dataset/transforms.h"
+#include "minddata/dataset/kernels/data/data_utils.h"
+
+using namespace mindspore::dataset;
+
+class MindDataTestBatchSlots : public UT::Common {
+ public:
+  MindDataTestBatchSlots() = default;
+
+ protected:
+  TensorRow MakeRow(int32_t value, const TensorShape &shape) {
+    std::shared_ptr<Tensor> image;
+    std::shared_ptr<Tensor> label;
+    std::shared_ptr<Tensor> text;
+    (void)Tensor::CreateFromVector(std::vector<int32_t>(shape.NumOfElements(), value), shape, &image);
+    (void)Tensor::CreateScalar<int64_t>(value, &label);
+    (void)Tensor::CreateScalar<std::string>("text", &text);
+    return TensorRow(0, {image, label, text});
+  }
+};
+
+/// Feature: BatchSlots
+/// Description: Write the rows of a batch out of order and take the batch tensors
+/// Expectation: Numeric columns are written into the slots of the rows and string columns are kept in the rows
+TEST_F(MindDataTestBatchSlots, TestWriteAndTake) {
+  constexpr int32_t kBatchSize = 3;
+  BatchSlots slots(kBatchSize);
+  std::vector<TensorRow> rows;
+  for (int32_t i = 0; i < kBatchSize; i++) {
+    rows.push_back(MakeRow(i, TensorShape({2, 2})));
+  }
+  // Rows of the next epoch use different batch tensors.
+  TensorRow next_epoch_row = MakeRow(kBatchSize, TensorShape({2, 2}));
+  ASSERT_OK(slots.Write(1, 0, &next_epoch_row));
+  for (int32_t i = kBatchSize - 1; i >= 0; i--) {
+    ASSERT_OK(slots.Write(0, i, &rows[i]));
+  }
+
+  TensorRow columns;
+  slots.Take(0, 0, &columns);
+  ASSERT_EQ(columns.size(), 3);
+  ASSERT_NE(columns[0], nullptr);
+  ASSERT_NE(columns[1], nullptr);
+  ASSERT_EQ(columns[2], nullptr);
+  EXPECT_EQ(columns[0]->shape(), TensorShape({kBatchSize, 2, 2}));
+  EXPECT_EQ(columns[1]->shape(), TensorShape({kBatchSize}));
+  for (int32_t i = 0; i < kBatchSize; i++) {
+    EXPECT_EQ(rows[i][0], columns[0]);
+    EXPECT_EQ(rows[i][1], columns[1]);
+    EXPECT_NE(rows[i][2], nullptr);
+    int32_t image_value = 0;
+    int64_t label_value = 0;
+    ASSERT_OK(columns[0]->GetItemAt<int32_t>(&image_value, {i, 1, 1}));
+    ASSERT_OK(columns[1]->GetItemAt<int64_t>(&label_value, {i}));
+    EXPECT_EQ(image_value, i);
+    EXPECT_EQ(label_value, i);
+  }
+
+  // The batch is taken only once.
+  slots.Take(0, 0, &columns);
+  EXPECT_TRUE(columns.empty());
+  slots.Discard(1, 0);
+  slots.Take(1, 0, &columns);
+  EXPECT_TRUE(columns.empty());
+}
+
+/// Feature: BatchSlots
+/// Description: Write a row whose shape differs from the first row of the batch and restore a row from its slot
+/// Expectation: The row with a different shape is kept and the restored row equals the written row
+TEST_F(MindDataTestBatchSlots, TestInconsistentShapeAndRestore) {
+  constexpr int32_t kBatchSize = 2;
+  BatchSlots slots(kBatchSize);
+  TensorRow first_row = MakeRow(7, TensorShape({4}));
+  TensorRow second_row = MakeRow(8, TensorShape({5}));
+  std::shared_ptr<Tensor> second_image = second_row[0];
+  ASSERT_OK(slots.Write(0, 0, &first_row));
+  ASSERT_OK(slots.Write(0, 1, &second_row));
+
+  TensorRow columns;
+  slots.Take(0, 0, &columns);
+  ASSERT_EQ(columns.size(), 3);
+  EXPECT_EQ(first_row[0], columns[0]);
+  EXPECT_EQ(second_row[0], second_image);
+  EXPECT_EQ(second_row[1], columns[1]);
+
+  std::shared_ptr<Tensor> restored;
+  ASSERT_OK(BatchSlots::RestoreRow(columns[0], 0, &restored));
+  EXPECT_EQ(restored->shape(), TensorShape({4}));
+  for (auto itr = restored->begin<int32_t>(); itr != restored->end<int32_t>(); ++itr) {
+    EXPECT_EQ(*itr, 7);
+  }
+  EXPECT_TRUE(BatchSlots::RestoreRow(columns[0], kBatchSize, &restored).IsError());
+}
+
+/// Feature: BatchSlots
+/// Description: Create the output tensors of a row with the placement prepared for its slots
+/// Expectation: The tensors are created in the slots and written without copying, the duplicate slots are not offered
+TEST_F(MindDataTestBatchSlots, TestPlaceOutputInSlots) {
+  constexpr int32_t kBatchSize = 2;
+  BatchSlots slots(kBatchSize);
+  auto make_input = [](int32_t value, std::shared_ptr<Tensor> *out) {
+    return Tensor::CreateFromVector(std::vector<int32_t>(4, value), TensorShape({2, 2}), out);
+  };
+  const DataType float_type(DataType::DE_FLOAT32);
+  std::shared_ptr<Tensor> input;
+  std::shared_ptr<Tensor> first_image;
+  std::shared_ptr<Tensor> first_label;
+  ASSERT_OK(make_input(1, &input));
+  ASSERT_OK(TypeCast(input, &first_image, float_type));
+  ASSERT_OK(Tensor::CreateScalar<int64_t>(1, &first_label));
+  TensorRow first_row(0, {first_image, first_label});
+  ASSERT_OK(slots.Write(0, 0, &first_row));
+
+  // The output of the last op is created in the slot of the second row.
+  SlotPlacement placement;
+  slots.Prepare(0, 1, &placement);
+  std::shared_ptr<Tensor> second_image;
+  ASSERT_OK(make_input(2, &input));
+  {
+    Tensor::PlacementGuard guard(&placement);
+    ASSERT_OK(TypeCast(input, &second_image, float_type));
+  }
+  std::shared_ptr<Tensor> slot_view;
+  ASSERT_OK(BatchSlots::RestoreRow(first_row[0], 1, &slot_view));
+  EXPECT_EQ(second_image->GetBuffer(), slot_view->GetBuffer());
+  std::shared_ptr<Tensor> second_label;
+  ASSERT_OK(Tensor::CreateScalar<int64_t>(2, &second_label));
+  TensorRow second_row(0, {second_image, second_label});
+  ASSERT_OK(slots.Write(0, 1, &second_row));
+
+  TensorRow columns;
+  slots.Take(0, 0, &columns);
+  ASSERT_EQ(columns.size(), 2);
+  for (int32_t i = 0; i < kBatchSize; i++) {
+    float image_value = 0;
+    int64_t label_value = 0;
+    ASSERT_OK(columns[0]->GetItemAt<float>(&image_value, {i, 1, 0}));
+    ASSERT_OK(columns[1]->GetItemAt<int64_t>(&label_value, {i}));
+    EXPECT_EQ(image_value, static_cast<float>(i + 1));
+    EXPECT_EQ(label_value, i + 1);
+  }
+
+  // Two columns of the same shape and type aren't placed, which can't tell the slot of the output.
+  TensorRow same_row(0, {first_image, first_image});
+  ASSERT_OK(Tensor::CreateFromTensor(first_image, &same_row[1]));
+  ASSERT_OK(slots.Write(1, 0, &same_row));
+  slots.Prepare(1, 1, &placement);
+  std::shared_ptr<Tensor> not_placed;
+  {
+    Tensor::PlacementGuard guard(&placement);
+    ASSERT_OK(TypeCast(input, &not_placed, float_type));
+  }
+  for (size_t i = 0; i < same_row.size(); i++) {
+    ASSERT_OK(BatchSlots::RestoreRow(same_row[i], 1, &slot_view));
+    EXPECT_NE(not_placed->GetBuffer(), slot_view->GetBuffer());
+  }
+  slots.Discard(1, 0);
+}
+
+/// Feature: BatchSlots
+/// Description: Slice the first rows of a batch tensor and restore a row from its slot
+/// Expectation: The sliced batch and the restored row share the memory of the batch tensor
+TEST_F(MindDataTestBatchSlots, TestSliceRowsWithoutCopy) {
+  constexpr int32_t kBatchSize = 3;
+  BatchSlots slots(kBatchSize);
+  std::vector<TensorRow> rows;
+  for (int32_t i = 0; i < kBatchSize - 1; i++) {
+    rows.push_back(MakeRow(i, TensorShape({2})));
+    ASSERT_OK(slots.Write(0, i, &rows.back()));
+  }
+  TensorRow columns;
+  slots.Take(0, 0, &columns);
+  ASSERT_EQ(columns.size(), 3);
+
+  std::shared_ptr<Tensor> remainder;
+  ASSERT_OK(BatchSlots::SliceRows(columns[0], kBatchSize - 1, &remainder));
+  EXPECT_EQ(remainder->shape(), TensorShape({kBatchSize - 1, 2}));
+  EXPECT_EQ(remainder->GetBuffer(), columns[0]->GetBuffer());
+  for (int32_t i = 0; i < kBatchSize - 1; i++) {
+    int32_t value = -1;
+    ASSERT_OK(remainder->GetItemAt<int32_t>(&value, {i, 1}));
+    EXPECT_EQ(value, i);
+  }
+  std::shared_ptr<Tensor> restored;
+  ASSERT_OK(BatchSlots::RestoreRow(columns[0], 1, &restored));
+  EXPECT_EQ(restored->GetBuffer(), columns[0]->GetBuffer() + 2 * sizeof(int32_t));
+  EXPECT_TRUE(BatchSlots::SliceRows(columns[0], kBatchSize + 1, &remainder).IsError());
+  EXPECT_TRUE(BatchSlots::SliceRows(columns[0], 0, &remainder).IsError());
+}
+
+class MindDataTestMapBatchFusion : public UT::DatasetOpTesting {
+ protected:
+  // Get the batches of the images and labels of all epochs. The project after the map stops the map from fusing with
+  // the batch, which gives the reference batches.
+  std::vector<std::vector<float>> GetBatches(bool fused, bool drop_remainder, int32_t num_epochs,
+                                             std::vector<size_t> *batch_rows) {
+    std::string folder_path = datasets_root_path_ + "/testMnistData/";
+    std::shared_ptr<Dataset> ds = Mnist(folder_path, "all", std::make_shared<SequentialSampler>(0, kNumRows));
+    EXPECT_NE(ds, nullptr);
+    auto type_cast = std::make_shared<transforms::TypeCast>(mindspore::DataType::kNumberTypeFloat32);
+    std::vector<std::string> project_columns;
+    if (!fused) {
+      project_columns = {"image", "label"};
+    }
+    ds = ds->Map({type_cast}, {"image"}, {}, project_columns);
+    EXPECT_NE(ds, nullptr);
+    ds = ds->Batch(kBatchSize, drop_remainder);
+    EXPECT_NE(ds, nullptr);
+    std::shared_ptr<Iterator> iter = ds->CreateIterator({}, num_epochs);
+    EXPECT_NE(iter, nullptr);
+
+    std::vector<std::vector<float>> batches;
+    for (int32_t epoch = 0; epoch < num_epochs; epoch++) {
+      std::unordered_map<std::string, mindspore::MSTensor> row;
+      EXPECT_OK(iter->GetNextRow(&row));
+      while (row.size() != 0) {
+        auto image = row["image"];
+        auto label = row["label"];
+        EXPECT_EQ(image.Shape().size(), 4);
+        batch_rows->push_back(static_cast<size_t>(image.Shape()[0]));
+        EXPECT_EQ(label.Shape()[0], image.Shape()[0]);
+        std::vector<float> batch(image.DataSize() / sizeof(float));
+        (void)memcpy(batch.data(), image.Data().get(), image.DataSize());
+        auto labels = static_cast<const uint32_t *>(label.Data().get());
+        for (int64_t i = 0; i < label.Shape()[0]; i++) {
+          batch.push_back(static_cast<float>(labels[i]));
+        }
+        batches.push_back(std::move(batch));
+        EXPECT_OK(iter->GetNextRow(&row));
+      }
+    }
+    iter->Stop();
+    return batches;
+  }
+
+  static constexpr int32_t kNumRows = 10;
+  static constexpr int32_t kBatchSize = 3;
+};
+
+/// Feature: Fused MapOp and BatchOp
+/// Description: Batch the rows of map with and without the remainder in multiple epochs
+/// Expectation: The fused batches are the same as the batches of the pipeline which isn't fused
+TEST_F(MindDataTestMapBatchFusion, TestFusedBatchesInEpochs) {
+  constexpr int32_t kNumEpochs = 2;
+  for (bool drop_remainder : {false, true}) {
+    std::vector<size_t> fused_rows;
+    std::vector<size_t> reference_rows;
+    auto fused = GetBatches(true, drop_remainder, kNumEpochs, &fused_rows);
+    auto reference = GetBatches(false, drop_remainder, kNumEpochs, &reference_rows);
+    size_t batches_per_epoch = drop_remainder ? kNumRows / kBatchSize : (kNumRows + kBatchSize - 1) / kBatchSize;
+    ASSERT_EQ(fused.size(), batches_per_epoch * kNumEpochs);
+    EXPECT_EQ(fused_rows, reference_rows);
+    EXPECT_EQ(fused, reference);
+    if (!drop_remainder) {
+      EXPECT_EQ(fused_rows[batches_per_epoch - 1], kNumRows % kBatchSize);
+    }
+  }
+}
@@ -14,7 +14,11 @@
  * limitations under the License.
  */
 
+#include <fstream>
+#include <map>
+
 #include "common/common.h"
+#include "minddata/dataset/core/global_context.h"
 #include "minddata/dataset/include/dataset/config.h"
 #include "minddata/dataset/include/dataset/datasets.h"
 
@@ -248,3 +252,62 @@ TEST_F(MindDataTestPipeline, TestCallShuffleTwice) {
   config::set_seed(original_seed);
   config::set_num_parallel_workers(original_num_parallel_workers);
 }
+
+/// Feature: Config
+/// Description: Test shuffle with the memory limit of the shuffle buffer, which spills most of the rows to disk, for
+///     two epochs so that the shuffle op resets its buffer and spill file in between
+/// Expectation: Every row comes out exactly once in each epoch
+TEST_F(MindDataTestPipeline, TestShuffleWithMemoryLimit) {
+  MS_LOG(INFO) << "Doing MindDataTestPipeline-TestShuffleWithMemoryLimit.";
+  // Save and set the configuration, the limit holds only a few lines in memory
+  auto config_manager = GlobalContext::config_manager();
+  int64_t original_memory_limit = config_manager->shuffle_memory_limit();
+  uint32_t original_seed = config::get_seed();
+  config_manager->set_shuffle_memory_limit(256);
+  config::set_seed(654);
+
+  // Create a TextFile Dataset whose lines are all different
+  std::string text_file = datasets_root_path_ + "/test_sentencepiece/vocab.txt";
+  std::map<std::string, int32_t> expected_count;
+  std::ifstream in(text_file);
+  std::string line;
+  while (std::getline(in, line)) {
+    if (!line.empty()) {
+      expected_count[line]++;
+    }
+  }
+  ASSERT_GT(expected_count.size(), 30);
+
+  std::shared_ptr<Dataset> ds = TextFile({text_file}, 0, ShuffleMode::kFalse);
+  EXPECT_NE(ds, nullptr);
+
+  // Shuffle the dataset with a buffer smaller than the dataset, so rows are taken while others are still spilled
+  ds = ds->Shuffle(30);
+  EXPECT_NE(ds, nullptr);
+
+  std::shared_ptr<Iterator> iter = ds->CreateIterator();
+  EXPECT_NE(iter, nullptr);
+
+  constexpr int32_t kNumEpochs = 2;
+  for (int32_t epoch = 0; epoch < kNumEpochs; epoch++) {
+    std::map<std::string, int32_t> count;
+    std::unordered_map<std::string, mindspore::MSTensor> row;
+    ASSERT_OK(iter->GetNextRow(&row));
+    while (row.size() != 0) {
+      std::shared_ptr<Tensor> de_text;
+      ASSERT_OK(Tensor::CreateFromMSTensor(row["text"], &de_text));
+      std::string_view sv;
+      ASSERT_OK(de_text->GetItemAt(&sv, {}));
+      count[std::string(sv)]++;
+      ASSERT_OK(iter->GetNextRow(&row));
+    }
+    EXPECT_EQ(count, expected_count);
+  }
+
+  // Manually terminate the pipeline
+  iter->Stop();
+
+  // Restore configuration
+  config_manager->set_shuffle_memory_limit(original_memory_limit);
+  config::set_seed(original_seed);
+}
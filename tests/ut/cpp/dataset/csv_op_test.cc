@@ -13,8 +13,11 @@
  * See the License for the specific language governing permissions and
  * limitations under the License.
  */
+#include <fstream>
 #include <iostream>
 #include <memory>
+#include <string>
+#include <utility>
 #include <vector>
 
 #include "minddata/dataset/core/client.h"
@@ -34,6 +37,39 @@ class MindDataTestCSVOp : public UT::DatasetOpTesting {
 
 };
 
+namespace {
+// Exposes the row counting and the file loading of CsvOp.
+class CsvOpForTest : public CsvOp {
+ public:
+  using CsvOp::CsvOp;
+  using CsvOp::CalculateNumRowsPerShard;
+  using CsvOp::LoadFile;
+
+  int64_t NumRows() const { return num_rows_; }
+
+  const std::vector<std::pair<int64_t, int64_t>> &RowStarts(const std::string &file) { return row_starts_[file]; }
+
+  size_t PendingRows() const { return jagged_rows_connector_->size(); }
+
+  Status PopRows(int64_t num_rows, std::vector<TensorRow> *rows) {
+    for (int64_t i = 0; i < num_rows; ++i) {
+      TensorRow row;
+      RETURN_IF_NOT_OK(jagged_rows_connector_->Pop(0, &row));
+      rows->push_back(std::move(row));
+    }
+    return Status::OK();
+  }
+};
+}  // namespace
+
+class MindDataTestCSVOpChunks : public UT::DatasetOpTesting {
+ protected:
+  void SetUp() override {
+    DatasetOpTesting::SetUp();
+    GlobalInit();
+  }
+};
+
 /// Feature: CountAllFileRows in CsvOp
 /// Description: Test CountAllFileRows in CsvOp on CSV files
 /// Expectation: Output is equal to the expected output
@@ -58,3 +94,90 @@ TEST_F(MindDataTestCSVOp, TestTotalRows) {
   ASSERT_EQ(total_rows, 8);
   files.clear();
 }
+
+/// Feature: LoadFile in CsvOp
+/// Description: Test parsing a csv file, whose quoted fields hold line breaks, delimiters and quotes, in chunks of
+///     various sizes with one and several threads
+/// Expectation: Every row start found at the chunk boundaries is a real row start, and the loaded rows are the same as
+///     the rows written in order
+TEST_F(MindDataTestCSVOpChunks, TestLoadFileInChunks) {
+  const std::string file = "csv_op_test_chunks.csv";
+  constexpr int64_t kNumRows = 100;
+  constexpr int32_t kPeriod = 3;
+  std::string data;
+  std::vector<int64_t> row_offsets;
+  std::vector<std::string> texts;
+  for (int64_t i = 0; i < kNumRows; ++i) {
+    row_offsets.push_back(static_cast<int64_t>(data.size()));
+    // The line breaks in the quoted field must not be taken as the ends of the rows.
+    std::string text = "text " + std::to_string(i) + ", line 1" + (i % 2 == 0 ? "\r\n" : "\n") + "line 2 \"q\"";
+    texts.push_back(text);
+    std::string quoted = "\"";
+    for (char c : text) {
+      quoted += c == '"' ? "\"\"" : std::string(1, c);
+    }
+    quoted += "\"";
+    data += std::to_string(i) + "," + quoted + "," + std::to_string(i) + ".5" + (i % kPeriod == 0 ? "\r\n" : "\n");
+  }
+  {
+    std::ofstream ofs(file, std::ios::binary | std::ios::trunc);
+    ofs << data;
+  }
+
+  std::vector<std::shared_ptr<CsvOp::BaseRecord>> column_default = {
+    std::make_shared<CsvOp::Record<int>>(CsvOp::INT, 0),
+    std::make_shared<CsvOp::Record<std::string>>(CsvOp::STRING, ""),
+    std::make_shared<CsvOp::Record<float>>(CsvOp::FLOAT, 0.0)};
+  std::vector<std::string> column_names = {"id", "text", "value"};
+  constexpr int32_t kOpConnectorSize = 16;
+  // Chunks shorter than a row, chunks of a few rows and a single chunk.
+  for (int64_t chunk_size : {static_cast<int64_t>(17), static_cast<int64_t>(64), CSV_CHUNK_SIZE}) {
+    for (int32_t num_workers : {1, 4}) {
+      for (auto range : std::vector<std::pair<int64_t, int64_t>>{{0, kNumRows}, {23, 71}}) {
+        CsvOpForTest op({file}, ',', column_default, column_names, num_workers, 0, kNumRows + 1, kOpConnectorSize,
+                        false, 1, 0);
+        op.SetChunkSize(chunk_size);
+        ASSERT_OK(op.Init());
+        ASSERT_OK(op.CalculateNumRowsPerShard());
+        ASSERT_EQ(op.NumRows(), kNumRows);
+
+        const auto &row_starts = op.RowStarts(file);
+        if (chunk_size < static_cast<int64_t>(data.size())) {
+          ASSERT_GT(row_starts.size(), 1);
+        }
+        for (const auto &row_start : row_starts) {
+          // A row start may be at the '\n' of the "\r\n" ending the row before, or at the end of the data after the
+          // last row.
+          int64_t row = row_start.first;
+          ASSERT_LE(row, kNumRows);
+          size_t next_char = data.find_first_not_of("\r\n", row_start.second);
+          if (row == kNumRows) {
+            ASSERT_EQ(next_char, std::string::npos);
+            continue;
+          }
+          ASSERT_LE(row_start.second, row_offsets[row]);
+          ASSERT_EQ(static_cast<int64_t>(next_char), row_offsets[row]);
+        }
+
+        ASSERT_OK(op.LoadFile(file, range.first, range.second, 0));
+        std::vector<TensorRow> rows;
+        ASSERT_OK(op.PopRows(range.second - range.first, &rows));
+        ASSERT_EQ(op.PendingRows(), 0);
+        for (int64_t i = range.first; i < range.second; ++i) {
+          const TensorRow &row = rows[i - range.first];
+          ASSERT_EQ(row.size(), column_names.size());
+          int32_t id = 0;
+          std::string_view text;
+          float value = 0;
+          ASSERT_OK(row[0]->GetItemAt(&id, {}));
+          ASSERT_OK(row[1]->GetItemAt(&text, {}));
+          ASSERT_OK(row[2]->GetItemAt(&value, {}));
+          EXPECT_EQ(id, i);
+          EXPECT_EQ(std::string(text), texts[i]);
+          EXPECT_EQ(value, static_cast<float>(i) + 0.5f);
+        }
+      }
+    }
+  }
+  EXPECT_EQ(remove(file.c_str()), 0);
+}
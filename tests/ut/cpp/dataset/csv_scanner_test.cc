@@ -0,0 +1,124 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <algorithm>
+#include <string>
+#include <utility>
+#include <vector>
+#include "common/common.h"
+#include "gtest/gtest.h"
+#include "minddata/dataset/engine/datasetops/source/csv_scanner.h"
+
+using namespace mindspore::dataset;
+
+class MindDataTestCsvScanner : public UT::Common {
+ public:
+  MindDataTestCsvScanner() = default;
+
+ protected:
+  // Count the rows ended before each offset of the data one character at a time.
+  std::vector<int64_t> CountRowsByChar(const std::string &data) {
+    std::vector<int64_t> rows_before(data.size() + 1, 0);
+    int64_t rows = 0;
+    bool quoted = false;
+    bool pending = false;
+    for (size_t i = 0; i < data.size(); ++i) {
+      rows_before[i] = rows;
+      char c = data[i];
+      if (c == '"') {
+        quoted = !quoted;
+        pending = true;
+      } else if ((c == '\r' || c == '\n') && !quoted) {
+        if (pending) {
+          rows++;
+        }
+        pending = false;
+      } else {
+        pending = true;
+      }
+    }
+    rows_before[data.size()] = rows + (!quoted && pending ? 1 : 0);
+    return rows_before;
+  }
+
+  int64_t CountRowsByChunk(const std::string &data, int64_t chunk_size,
+                           std::vector<std::pair<int64_t, int64_t>> *row_starts) {
+    std::vector<int64_t> offsets;
+    std::vector<CsvChunkRows> chunks;
+    for (int64_t offset = 0; offset < static_cast<int64_t>(data.size()); offset += chunk_size) {
+      int64_t end = std::min(offset + chunk_size, static_cast<int64_t>(data.size()));
+      bool row_pending = offset > 0 && data[offset - 1] != '\r' && data[offset - 1] != '\n';
+      offsets.push_back(offset);
+      chunks.push_back(CsvScanner::ScanRows(data.data() + offset, data.data() + end, row_pending));
+    }
+    return CsvScanner::ResolveRows(chunks, offsets, row_starts);
+  }
+};
+
+/// Feature: CsvScanner
+/// Description: Find the special characters in data longer than the SIMD blocks
+/// Expectation: The first delimiter, quote or line break is found at any position
+TEST_F(MindDataTestCsvScanner, TestFindSpecialChar) {
+  CsvScanner scanner('|');
+  const std::string specials = "|\"\r\n";
+  for (char special : specials) {
+    for (size_t pos = 0; pos < 70; ++pos) {
+      std::string data(70, 'a');
+      data[pos] = special;
+      const char *found = scanner.FindSpecialChar(data.data(), data.data() + data.size());
+      EXPECT_EQ(found - data.data(), pos);
+      if (special == '"') {
+        EXPECT_EQ(CsvScanner::FindQuote(data.data(), data.data() + data.size()) - data.data(), pos);
+      }
+    }
+  }
+  std::string data(70, ',');
+  EXPECT_EQ(scanner.FindSpecialChar(data.data(), data.data() + data.size()), data.data() + data.size());
+  EXPECT_EQ(CsvScanner::FindQuote(data.data(), data.data() + data.size()), data.data() + data.size());
+}
+
+/// Feature: CsvScanner
+/// Description: Count the rows of data with quoted line breaks, CRLF and blank lines in chunks of different sizes
+/// Expectation: The row count and the row starts agree with counting the rows one character at a time
+TEST_F(MindDataTestCsvScanner, TestScanRowsInChunks) {
+  std::string data;
+  for (int i = 0; i < 20; ++i) {
+    data += "1,\"a\nb\",\"c\"\"\r\nd\"\r\n";
+    data += "\n\n\"\"\"\n\",x,y\n";
+    data += "2,plain,text\r\n";
+  }
+  data += "3,\"last\"";
+  std::vector<int64_t> rows_before = CountRowsByChar(data);
+  int64_t expected = rows_before.back();
+  EXPECT_EQ(expected, 61);
+  for (int64_t chunk_size : {1, 2, 3, 7, 16, 64, 1000}) {
+    std::vector<std::pair<int64_t, int64_t>> row_starts;
+    EXPECT_EQ(CountRowsByChunk(data, chunk_size, &row_starts), expected);
+    ASSERT_FALSE(row_starts.empty());
+    EXPECT_EQ(row_starts[0].first, 0);
+    for (auto &row_start : row_starts) {
+      // A row start follows the line break which ends a row.
+      EXPECT_EQ(row_start.first, rows_before[row_start.second]);
+      if (row_start.second > 0) {
+        char prev = data[row_start.second - 1];
+        EXPECT_TRUE(prev == '\r' || prev == '\n');
+      }
+    }
+  }
+
+  // The row inside an unclosed quoted field is not counted.
+  EXPECT_EQ(CountRowsByChunk("a,b\n\"c\nd", 3, nullptr), 1);
+  EXPECT_EQ(CountRowsByChunk("", 3, nullptr), 0);
+}
@@ -0,0 +1,93 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "common/common.h"
+#include "common/cvop_common.h"
+#include "minddata/dataset/kernels/image/decode_op.h"
+#include "minddata/dataset/kernels/image/decode_resize_op.h"
+#include "minddata/dataset/kernels/image/resize_op.h"
+#include "utils/log_adapter.h"
+
+using namespace mindspore::dataset;
+constexpr double kMeanDiffThreshold = 8.0;
+
+class MindDataTestDecodeResizeOp : public UT::CVOP::CVOpCommon {
+ public:
+  MindDataTestDecodeResizeOp() : CVOpCommon() {}
+
+ protected:
+  // Compare the output of DecodeResizeOp with the output of DecodeOp followed by ResizeOp.
+  void CompareWithDecodeAndResize(int32_t size1, int32_t size2) {
+    std::shared_ptr<Tensor> fused_output;
+    std::shared_ptr<Tensor> decoded;
+    std::shared_ptr<Tensor> resized;
+    DecodeResizeOp decode_resize_op(size1, size2);
+    DecodeOp decode_op(true);
+    ResizeOp resize_op(size1, size2);
+    ASSERT_OK(decode_resize_op.Compute(raw_input_tensor_, &fused_output));
+    ASSERT_OK(decode_op.Compute(raw_input_tensor_, &decoded));
+    ASSERT_OK(resize_op.Compute(decoded, &resized));
+    ASSERT_EQ(fused_output->shape(), resized->shape());
+    int32_t height = static_cast<int32_t>(resized->shape()[0]);
+    int32_t width = static_cast<int32_t>(resized->shape()[1]);
+    if (size2 != 0) {
+      ASSERT_EQ(height, size1);
+      ASSERT_EQ(width, size2);
+    }
+
+    cv::Mat output1 = CVTensor::AsCVTensor(fused_output)->mat();
+    cv::Mat output2 = CVTensor::AsCVTensor(resized)->mat();
+    int64_t diff_sum = 0;
+    for (int i = 0; i < height; i++) {
+      for (int j = 0; j < width; j++) {
+        for (int c = 0; c < 3; c++) {
+          diff_sum += std::abs(static_cast<int>(output1.at<cv::Vec3b>(i, j)[c]) -
+                               static_cast<int>(output2.at<cv::Vec3b>(i, j)[c]));
+        }
+      }
+    }
+    double mean_diff = static_cast<double>(diff_sum) / (height * width * 3);
+    MS_LOG(INFO) << "mean diff: " << mean_diff;
+    EXPECT_LT(mean_diff, kMeanDiffThreshold);
+  }
+};
+
+/// Feature: DecodeResize op
+/// Description: Test DecodeResizeOp with a size which a JPEG image can be decoded at a reduced scale for
+/// Expectation: Output has the given size and is close to the output of Decode op and Resize op
+TEST_F(MindDataTestDecodeResizeOp, TestOpScaled) {
+  MS_LOG(INFO) << "Doing MindDataTestDecodeResizeOp-TestOpScaled.";
+  constexpr int32_t kHeight = 200;
+  constexpr int32_t kWidth = 160;
+  CompareWithDecodeAndResize(kHeight, kWidth);
+}
+
+/// Feature: DecodeResize op
+/// Description: Test DecodeResizeOp with a single size and with a size larger than the image
+/// Expectation: Output keeps the aspect ratio or is upscaled, and is close to the output of Decode op and Resize op
+TEST_F(MindDataTestDecodeResizeOp, TestOpSingleSizeAndUpscale) {
+  MS_LOG(INFO) << "Doing MindDataTestDecodeResizeOp-TestOpSingleSizeAndUpscale.";
+  std::shared_ptr<Tensor> decoded;
+  DecodeOp decode_op(true);
+  ASSERT_OK(decode_op.Compute(raw_input_tensor_, &decoded));
+  int32_t height = static_cast<int32_t>(decoded->shape()[0]);
+  int32_t width = static_cast<int32_t>(decoded->shape()[1]);
+
+  // The shorter edge is resized to the size with the aspect ratio kept.
+  constexpr int32_t kShortEdge = 100;
+  CompareWithDecodeAndResize(kShortEdge, 0);
+
+  CompareWithDecodeAndResize(height + 1, width + 1);
+}
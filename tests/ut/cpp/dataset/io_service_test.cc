@@ -0,0 +1,90 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <cstring>
+#include <memory>
+#include <string>
+#include <thread>
+#include "common/common.h"
+#include "gtest/gtest.h"
+#include "minddata/dataset/core/tensor.h"
+#include "minddata/dataset/util/io_service.h"
+
+using namespace mindspore::dataset;
+
+class MindDataTestIOService : public UT::DatasetOpTesting {
+ protected:
+  std::string ImagePath(int32_t index) {
+    return datasets_root_path_ + "/testPK/data/class1/" + std::to_string(index) + ".jpg";
+  }
+
+  void ExpectSameBytes(const std::shared_ptr<Tensor> &tensor, const std::string &path) {
+    std::shared_ptr<Tensor> expected;
+    ASSERT_OK(Tensor::CreateFromFile(path, &expected));
+    ASSERT_NE(tensor, nullptr);
+    EXPECT_EQ(tensor->shape(), expected->shape());
+    EXPECT_EQ(tensor->type(), DataType(DataType::DE_UINT8));
+    ASSERT_EQ(tensor->SizeInBytes(), expected->SizeInBytes());
+    EXPECT_EQ(memcmp(tensor->GetBuffer(), expected->GetBuffer(), tensor->SizeInBytes()), 0);
+  }
+};
+
+/// Feature: FileReadahead
+/// Description: Read the files ahead beyond the depth and take them in order
+/// Expectation: The files within the depth are hits, the others are dropped and read as misses with the same bytes
+TEST_F(MindDataTestIOService, TestReadahead) {
+  constexpr int32_t kDepth = 2;
+  constexpr int32_t kNumFiles = 3;
+  FileReadahead readahead(kDepth);
+  for (int32_t i = 0; i < kNumFiles; i++) {
+    readahead.Prefetch(ImagePath(i));
+  }
+  // The file being read ahead is not read again.
+  readahead.Prefetch(ImagePath(0));
+  for (int32_t i = 0; i < kNumFiles; i++) {
+    std::shared_ptr<Tensor> tensor;
+    ASSERT_OK(readahead.Read(ImagePath(i), &tensor));
+    ExpectSameBytes(tensor, ImagePath(i));
+  }
+  auto metrics = readahead.GetMetrics();
+  EXPECT_EQ(metrics["readahead_depth"], kDepth);
+  EXPECT_EQ(metrics["readahead_hits"], kDepth);
+  EXPECT_EQ(metrics["readahead_misses"], kNumFiles - kDepth);
+  EXPECT_EQ(metrics["readahead_dropped"], kNumFiles - kDepth);
+  EXPECT_GT(metrics["readahead_bytes"], 0);
+}
+
+/// Feature: FileReadahead
+/// Description: Read a missing file ahead, and read a file read ahead by two rows concurrently
+/// Expectation: The error of the read is returned when the file is taken, and both rows get the bytes of the file
+TEST_F(MindDataTestIOService, TestReadaheadErrorAndSameFile) {
+  FileReadahead readahead(1);
+  std::string missing = datasets_root_path_ + "/testPK/data/class1/not_exist.jpg";
+  readahead.Prefetch(missing);
+  std::shared_ptr<Tensor> tensor;
+  EXPECT_ERROR(readahead.Read(missing, &tensor));
+
+  std::string path = ImagePath(0);
+  readahead.Prefetch(path);
+  std::shared_ptr<Tensor> other_tensor;
+  std::thread other_read([&readahead, &other_tensor, &path]() { EXPECT_OK(readahead.Read(path, &other_tensor)); });
+  EXPECT_OK(readahead.Read(path, &tensor));
+  other_read.join();
+  ExpectSameBytes(tensor, path);
+  ExpectSameBytes(other_tensor, path);
+  auto metrics = readahead.GetMetrics();
+  EXPECT_EQ(metrics["readahead_hits"], 2);
+  EXPECT_EQ(metrics["readahead_misses"], 1);
+}
@@ -0,0 +1,119 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <memory>
+#include <string>
+#include <vector>
+#include "common/common.h"
+#include "minddata/dataset/engine/datasetops/batch_op.h"
+#include "minddata/dataset/engine/datasetops/map_op/map_op.h"
+#include "minddata/dataset/engine/execution_tree.h"
+#include "minddata/dataset/engine/ir/datasetops/dataset_node.h"
+#include "minddata/dataset/engine/tree_adapter.h"
+#include "minddata/dataset/include/dataset/datasets.h"
+#include "minddata/dataset/include/dataset/transforms.h"
+#include "minddata/dataset/include/dataset/vision.h"
+#include "minddata/dataset/kernels/tensor_op.h"
+
+using namespace mindspore::dataset;
+
+class MindDataTestBatchTensorOpPass : public UT::DatasetOpTesting {
+ public:
+  MindDataTestBatchTensorOpPass() = default;
+
+ protected:
+  std::shared_ptr<Dataset> CreateDataset() {
+    std::string folder_path = datasets_root_path_ + "/testPK/data/";
+    std::shared_ptr<Dataset> ds = ImageFolder(folder_path, false, std::make_shared<SequentialSampler>(0, 8));
+    auto decode = std::make_shared<vision::Decode>();
+    auto resize = std::make_shared<vision::Resize>(std::vector<int32_t>{32, 32});
+    auto normalize = std::make_shared<vision::Normalize>(std::vector<float>{121.0, 115.0, 100.0},
+                                                         std::vector<float>{70.0, 68.0, 71.0});
+    auto hwc2chw = std::make_shared<vision::HWC2CHW>();
+    ds = ds->Map({decode, resize, normalize, hwc2chw}, {"image"});
+    return ds->Batch(4);
+  }
+};
+
+/// Feature: MindData Batch Tensor Op Pass Support
+/// Description: Test the ops after Resize are moved past the batch with IR optimization pass
+/// Expectation: The map below the batch keeps Decode and Resize, and the map above the batch runs the batched ops
+TEST_F(MindDataTestBatchTensorOpPass, MoveOpsPastBatch) {
+  MS_LOG(INFO) << "Doing MindDataTestBatchTensorOpPass-MoveOpsPastBatch";
+
+  auto ir_tree = std::make_shared<TreeAdapter>();
+  // Enable IR optimization pass
+  ir_tree->SetOptimize(true);
+  ASSERT_OK(ir_tree->Compile(CreateDataset()->IRNode(), 1));
+
+  // The ops are visited in post-order: the leaf first and the root last.
+  auto tree = std::make_shared<ExecutionTree>();
+  auto it = tree->begin(static_cast<std::shared_ptr<DatasetOp>>(ir_tree->GetRoot()));
+  std::vector<std::vector<std::string>> map_op_names;
+  bool batch_found = false;
+  for (size_t i = 0; i < it.NumNodes(); ++i, ++it) {
+    if (dynamic_cast<BatchOp *>(&(*it)) != nullptr) {
+      EXPECT_EQ(map_op_names.size(), 1);
+      batch_found = true;
+    }
+    auto *map_op = dynamic_cast<MapOp *>(&(*it));
+    if (map_op == nullptr) {
+      continue;
+    }
+    std::vector<std::string> names;
+    for (const auto &tfunc : map_op->TFuncs()) {
+      names.push_back(tfunc->Name());
+    }
+    map_op_names.push_back(names);
+  }
+  EXPECT_TRUE(batch_found);
+  ASSERT_EQ(map_op_names.size(), 2);
+  EXPECT_EQ(map_op_names[0], std::vector<std::string>({kDecodeOp, kResizeOp}));
+  EXPECT_EQ(map_op_names[1], std::vector<std::string>({kBatchedTensorOp, kBatchedTensorOp}));
+}
+
+/// Feature: MindData Batch Tensor Op Pass Support
+/// Description: Test the batches are the same with and without IR optimization pass
+/// Expectation: The batched ops produce the same batches as the ops running on the rows
+TEST_F(MindDataTestBatchTensorOpPass, SameOutputAsRows) {
+  MS_LOG(INFO) << "Doing MindDataTestBatchTensorOpPass-SameOutputAsRows";
+
+  auto row_tree = std::make_shared<TreeAdapter>();
+  row_tree->SetOptimize(false);
+  ASSERT_OK(row_tree->Compile(CreateDataset()->IRNode(), 1));
+  auto batch_tree = std::make_shared<TreeAdapter>();
+  batch_tree->SetOptimize(true);
+  ASSERT_OK(batch_tree->Compile(CreateDataset()->IRNode(), 1));
+
+  TensorRow expected;
+  TensorRow row;
+  uint64_t num_batches = 0;
+  ASSERT_OK(row_tree->GetNext(&expected));
+  ASSERT_OK(batch_tree->GetNext(&row));
+  while (!expected.empty()) {
+    ASSERT_EQ(row.size(), expected.size());
+    EXPECT_EQ(row[0]->shape(), TensorShape({4, 3, 32, 32}));
+    EXPECT_EQ(row[0]->type(), DataType(DataType::DE_FLOAT32));
+    for (size_t i = 0; i < row.size(); i++) {
+      EXPECT_TRUE(*row[i] == *expected[i]);
+    }
+    num_batches++;
+    ASSERT_OK(row_tree->GetNext(&expected));
+    ASSERT_OK(batch_tree->GetNext(&row));
+  }
+  EXPECT_TRUE(row.empty());
+  EXPECT_EQ(num_batches, 2);
+}
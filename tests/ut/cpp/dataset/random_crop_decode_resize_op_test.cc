@@ -161,3 +161,52 @@ TEST_F(MindDataTestRandomCropDecodeResizeOp, TestOp1) {
   }
   MS_LOG(INFO) << "RandomCropDecodeResizeOp test 2 finished";
 }
+
+/// Feature: RandomCropDecodeResize op
+/// Description: Test RandomCropDecodeResizeOp with scaled_decode, which decodes the crop at a reduced DCT scale
+/// Expectation: Output has the target size and is close to the output of the op decoding at full scale
+TEST_F(MindDataTestRandomCropDecodeResizeOp, TestOpScaledDecode) {
+  MS_LOG(INFO) << "starting RandomCropDecodeResizeOp test 3";
+  constexpr int target_height = 96;
+  constexpr int target_width = 80;
+  constexpr double kMeanDiffThreshold = 8.0;
+  constexpr float scale_lb = 0.08;
+  constexpr float scale_ub = 1.0;
+  constexpr float aspect_lb = 0.75;
+  constexpr float aspect_ub = 1.333333;
+  const InterpolationMode interpolation = InterpolationMode::kLinear;
+  constexpr int32_t max_iter = 10;
+
+  // Both ops are seeded the same, so they propose the same crops.
+  GlobalContext::config_manager()->set_seed(42);
+  auto full_scale = RandomCropDecodeResizeOp(target_height, target_width, scale_lb, scale_ub, aspect_lb, aspect_ub,
+                                             interpolation, max_iter, false);
+  auto reduced_scale = RandomCropDecodeResizeOp(target_height, target_width, scale_lb, scale_ub, aspect_lb, aspect_ub,
+                                                interpolation, max_iter, true);
+  TensorRow input_row;
+  input_row.push_back(raw_input_tensor_);
+  for (int k = 0; k < 10; k++) {
+    TensorRow full_scale_row;
+    TensorRow reduced_scale_row;
+    ASSERT_OK(full_scale.Compute(input_row, &full_scale_row));
+    ASSERT_OK(reduced_scale.Compute(input_row, &reduced_scale_row));
+    ASSERT_EQ(reduced_scale_row[0]->shape(), TensorShape({target_height, target_width, 3}));
+    ASSERT_EQ(reduced_scale_row[0]->shape(), full_scale_row[0]->shape());
+
+    cv::Mat output1 = CVTensor::AsCVTensor(full_scale_row[0])->mat();
+    cv::Mat output2 = CVTensor::AsCVTensor(reduced_scale_row[0])->mat();
+    int64_t diff_sum = 0;
+    for (int i = 0; i < target_height; i++) {
+      for (int j = 0; j < target_width; j++) {
+        for (int c = 0; c < 3; c++) {
+          diff_sum += std::abs(static_cast<int>(output1.at<cv::Vec3b>(i, j)[c]) -
+                               static_cast<int>(output2.at<cv::Vec3b>(i, j)[c]));
+        }
+      }
+    }
+    double mean_diff = static_cast<double>(diff_sum) / (target_height * target_width * 3);
+    MS_LOG(INFO) << "mean diff: " << mean_diff;
+    EXPECT_LT(mean_diff, kMeanDiffThreshold);
+  }
+  MS_LOG(INFO) << "RandomCropDecodeResizeOp test 3 finished";
+}
@@ -0,0 +1,106 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <memory>
+#include <string>
+#include <vector>
+#include "common/common.h"
+#include "gtest/gtest.h"
+#include "minddata/dataset/core/tensor.h"
+#include "minddata/dataset/engine/datasetops/row_spill_file.h"
+
+using namespace mindspore::dataset;
+
+class MindDataTestRowSpillFile : public UT::Common {
+ public:
+  MindDataTestRowSpillFile() = default;
+
+ protected:
+  TensorRow MakeRow(int32_t value, int64_t num_elements) {
+    std::shared_ptr<Tensor> image;
+    std::shared_ptr<Tensor> text;
+    std::shared_ptr<Tensor> empty;
+    (void)Tensor::CreateFromVector(std::vector<int32_t>(num_elements, value), TensorShape({num_elements}), &image);
+    (void)Tensor::CreateFromVector(std::vector<std::string>{"row", std::to_string(value)}, &text);
+    (void)Tensor::CreateEmpty(TensorShape({0, 2}), DataType(DataType::DE_FLOAT32), &empty);
+    TensorRow row(value, {image, text, empty});
+    row.setPath({"path_" + std::to_string(value)});
+    return row;
+  }
+
+  void ExpectRow(const TensorRow &row, int32_t value, int64_t num_elements) {
+    ASSERT_EQ(row.size(), 3);
+    EXPECT_EQ(row.getId(), value);
+    EXPECT_EQ(row.getPath(), std::vector<std::string>{"path_" + std::to_string(value)});
+    EXPECT_EQ(row[0]->shape(), TensorShape({num_elements}));
+    EXPECT_EQ(row[0]->type(), DataType(DataType::DE_INT32));
+    for (auto itr = row[0]->begin<int32_t>(); itr != row[0]->end<int32_t>(); ++itr) {
+      EXPECT_EQ(*itr, value);
+    }
+    std::string_view text;
+    ASSERT_OK(row[1]->GetItemAt(&text, {1}));
+    EXPECT_EQ(std::string(text), std::to_string(value));
+    EXPECT_EQ(row[2]->shape(), TensorShape({0, 2}));
+    EXPECT_EQ(row[2]->type(), DataType(DataType::DE_FLOAT32));
+  }
+};
+
+/// Feature: RowSpillFile
+/// Description: Write rows into the spill file and read them back out of order
+/// Expectation: The rows read back equal the written rows and the space of the read rows is reused
+TEST_F(MindDataTestRowSpillFile, TestWriteAndRead) {
+  constexpr int32_t kNumRows = 4;
+  constexpr int64_t kNumElements = 100;
+  RowSpillFile spill_file(".");
+  std::vector<RowSpillFile::Extent> extents(kNumRows);
+  for (int32_t i = 0; i < kNumRows; i++) {
+    TensorRow row = MakeRow(i, kNumElements);
+    ASSERT_TRUE(RowSpillFile::Spillable(row));
+    ASSERT_OK(spill_file.Write(row, &extents[i]));
+    ASSERT_TRUE(extents[i].Valid());
+  }
+  int64_t used_size = spill_file.UsedSize();
+  EXPECT_EQ(used_size, extents[0].length * kNumRows);
+
+  TensorRow row;
+  ASSERT_OK(spill_file.Read(&extents[1], &row));
+  EXPECT_FALSE(extents[1].Valid());
+  ExpectRow(row, 1, kNumElements);
+  EXPECT_TRUE(spill_file.Read(&extents[1], &row).IsError());
+
+  // A smaller row reuses the space freed by the row read.
+  RowSpillFile::Extent extent;
+  ASSERT_OK(spill_file.Write(MakeRow(kNumRows, kNumElements / 2), &extent));
+  EXPECT_EQ(spill_file.UsedSize(), used_size);
+  ASSERT_OK(spill_file.Read(&extent, &row));
+  ExpectRow(row, kNumRows, kNumElements / 2);
+
+  for (int32_t i : {3, 0, 2}) {
+    ASSERT_OK(spill_file.Read(&extents[i], &row));
+    ExpectRow(row, i, kNumElements);
+  }
+  spill_file.Reset();
+  EXPECT_EQ(spill_file.UsedSize(), 0);
+}
+
+/// Feature: RowSpillFile
+/// Description: Check whether the rows with a null tensor or a tensor of unknown shape can be spilled
+/// Expectation: Only the rows whose tensors all have a known shape can be spilled
+TEST_F(MindDataTestRowSpillFile, TestSpillable) {
+  TensorRow row = MakeRow(0, 1);
+  EXPECT_TRUE(RowSpillFile::Spillable(row));
+  row.push_back(nullptr);
+  EXPECT_FALSE(RowSpillFile::Spillable(row));
+}
@@ -0,0 +1,101 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <memory>
+#include <string>
+#include <vector>
+#include "common/common.h"
+#include "gtest/gtest.h"
+#include "minddata/dataset/core/tensor.h"
+#include "minddata/dataset/engine/datasetops/source/shared_row_ring.h"
+
+using namespace mindspore::dataset;
+
+class MindDataTestSharedRowRing : public UT::Common {
+ public:
+  MindDataTestSharedRowRing() = default;
+
+ protected:
+  TensorRow MakeRow(int32_t value) {
+    std::shared_ptr<Tensor> image;
+    std::shared_ptr<Tensor> text;
+    std::shared_ptr<Tensor> empty;
+    (void)Tensor::CreateFromVector(std::vector<int32_t>(6, value), TensorShape({2, 3}), &image);
+    (void)Tensor::CreateFromVector(std::vector<std::string>{"row", std::to_string(value)}, &text);
+    (void)Tensor::CreateEmpty(TensorShape({0, 2}), DataType(DataType::DE_FLOAT32), &empty);
+    return TensorRow(0, {image, text, empty});
+  }
+};
+
+/// Feature: SharedRowRing
+/// Description: Write rows into the rings through an attached segment and read them back in order
+/// Expectation: The rows read are equal to the written rows, and a full ring rejects the write until a row is read
+TEST_F(MindDataTestSharedRowRing, TestWriteAndRead) {
+  constexpr int32_t kNumRings = 2;
+  constexpr int32_t kNumSlots = 2;
+  std::unique_ptr<SharedRowRing> reader;
+  ASSERT_OK(SharedRowRing::Create(kNumRings, kNumSlots, 1024, &reader));
+  std::unique_ptr<SharedRowRing> writer;
+  ASSERT_OK(SharedRowRing::Attach(reader->ShmId(), &writer));
+  ASSERT_EQ(writer->NumRings(), kNumRings);
+
+  bool written = false;
+  for (int32_t i = 0; i < kNumSlots; i++) {
+    ASSERT_OK(writer->Write(1, MakeRow(i), 0, &written));
+    ASSERT_TRUE(written);
+  }
+  ASSERT_OK(writer->Write(1, MakeRow(kNumSlots), 0, &written));
+  ASSERT_FALSE(written);
+
+  TensorRow row;
+  bool ready = false;
+  ASSERT_OK(reader->Read(0, 0, &row, &ready));
+  ASSERT_FALSE(ready);
+  for (int32_t i = 0; i <= kNumSlots; i++) {
+    ASSERT_OK(reader->Read(1, 0, &row, &ready));
+    ASSERT_TRUE(ready);
+    TensorRow expected = MakeRow(i);
+    ASSERT_EQ(row.size(), expected.size());
+    for (size_t j = 0; j < row.size(); j++) {
+      EXPECT_EQ(*row[j], *expected[j]);
+    }
+    if (i == 0) {
+      // The slot read is reused by the next row.
+      ASSERT_OK(writer->Write(1, MakeRow(kNumSlots), 0, &written));
+      ASSERT_TRUE(written);
+    }
+  }
+}
+
+/// Feature: SharedRowRing
+/// Description: Write an error and a row larger than the slot
+/// Expectation: The reader returns the error written, and the large row is rejected by the writer
+TEST_F(MindDataTestSharedRowRing, TestErrorAndLargeRow) {
+  std::unique_ptr<SharedRowRing> ring;
+  ASSERT_OK(SharedRowRing::Create(1, 1, 64, &ring));
+  bool written = false;
+  std::shared_ptr<Tensor> large;
+  ASSERT_OK(Tensor::CreateFromVector(std::vector<int64_t>(16, 0), &large));
+  EXPECT_TRUE(ring->Write(0, TensorRow(0, {large}), 0, &written).IsError());
+
+  ASSERT_OK(ring->WriteError(0, "worker failed", 0, &written));
+  ASSERT_TRUE(written);
+  TensorRow row;
+  bool ready = false;
+  Status rc = ring->Read(0, 0, &row, &ready);
+  ASSERT_TRUE(ready);
+  EXPECT_EQ(rc.StatusCode(), StatusCode::kMDPyFuncException);
+  EXPECT_NE(rc.ToString().find("worker failed"), std::string::npos);
+}
@@ -0,0 +1,297 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <unistd.h>
+#include <chrono>
+#include <cstdlib>
+#include <fstream>
+#include <memory>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+#include "common/common.h"
+#include "gtest/gtest.h"
+#include "minddata/dataset/core/global_context.h"
+#include "minddata/dataset/util/size_class_pool.h"
+#include "minddata/dataset/util/system_pool.h"
+#include "utils/log_adapter.h"
+
+using namespace mindspore::dataset;
+
+class MindDataTestSizeClassPool : public UT::Common {
+ protected:
+  // Allocate and free image like buffers in the threads, each thread keeps a window of the latest buffers alive.
+  // @return the allocations per second
+  static double RunAllocFreeLoop(const std::shared_ptr<MemoryPool> &pool, int32_t num_threads, int32_t iterations) {
+    constexpr size_t kWindow = 64;
+    constexpr size_t kMinSize = 16 * 1024;
+    constexpr size_t kMaxSize = 640 * 1024;
+    auto start = std::chrono::steady_clock::now();
+    std::vector<std::thread> threads;
+    for (int32_t t = 0; t < num_threads; t++) {
+      threads.emplace_back([&pool, iterations, t]() {
+        std::mt19937 gen(t);
+        std::uniform_int_distribution<size_t> dist(kMinSize, kMaxSize);
+        std::vector<void *> window(kWindow, nullptr);
+        for (int32_t i = 0; i < iterations; i++) {
+          void *&slot = window[static_cast<size_t>(i) % kWindow];
+          pool->Deallocate(slot);
+          slot = nullptr;
+          size_t size = dist(gen);
+          if (pool->Allocate(size, &slot).IsOk()) {
+            // Touch the pages like a decoded image.
+            static_cast<char *>(slot)[0] = 1;
+            static_cast<char *>(slot)[size - 1] = 1;
+          }
+        }
+        for (void *p : window) {
+          pool->Deallocate(p);
+        }
+      });
+    }
+    for (auto &thread : threads) {
+      thread.join();
+    }
+    std::chrono::duration<double> seconds = std::chrono::steady_clock::now() - start;
+    return static_cast<double>(iterations) * num_threads / seconds.count();
+  }
+
+  // @return the resident set size of the process in bytes
+  static int64_t GetRss() {
+    std::ifstream statm("/proc/self/statm");
+    int64_t pages = 0;
+    int64_t resident = 0;
+    statm >> pages >> resident;
+    return resident * sysconf(_SC_PAGESIZE);
+  }
+};
+
+/// Feature: SizeClassPool
+/// Description: Get the size classes of the requests
+/// Expectation: The block of each class holds the request and the header, with less than 25% of rounding
+TEST_F(MindDataTestSizeClassPool, TestSizeClass) {
+  EXPECT_EQ(SizeClassPool::SizeClass(0), 0);
+  EXPECT_EQ(SizeClassPool::ClassBlockSize(0), SizeClassPool::kMinBlockSize);
+  int32_t last_class = 0;
+  for (size_t n = 1; n <= SizeClassPool::kMaxBlockSize - SizeClassPool::kHeaderSize; n = n * 5 / 4 + 1) {
+    int32_t size_class = SizeClassPool::SizeClass(n);
+    size_t block_size = SizeClassPool::ClassBlockSize(size_class);
+    ASSERT_GE(size_class, last_class);
+    ASSERT_GE(block_size, n + SizeClassPool::kHeaderSize);
+    if (size_class > 0) {
+      ASSERT_LT(SizeClassPool::ClassBlockSize(size_class - 1), n + SizeClassPool::kHeaderSize);
+      ASSERT_LE(block_size, (n + SizeClassPool::kHeaderSize) * 5 / 4 + 1);
+    }
+    last_class = size_class;
+  }
+  EXPECT_EQ(SizeClassPool::ClassBlockSize(SizeClassPool::SizeClass(SizeClassPool::kMaxBlockSize -
+                                                                     SizeClassPool::kHeaderSize)),
+            SizeClassPool::kMaxBlockSize);
+  EXPECT_EQ(SizeClassPool::SizeClass(SizeClassPool::kMaxBlockSize), -1);
+}
+
+/// Feature: SizeClassPool
+/// Description: Allocate, reallocate and free blocks, including a block larger than the largest class
+/// Expectation: The freed block is reused by the next allocation of its class, and the statistics are counted
+TEST_F(MindDataTestSizeClassPool, TestReuseAndStatistics) {
+  SizeClassPool pool;
+  void *p = nullptr;
+  ASSERT_OK(pool.Allocate(1000, &p));
+  void *first = p;
+  pool.Deallocate(p);
+  ASSERT_OK(pool.Allocate(1010, &p));
+  EXPECT_EQ(p, first);
+
+  // The block is kept if the new size fits it, otherwise the data is moved to a larger block.
+  memset(p, 'a', 1010);
+  ASSERT_OK(pool.Reallocate(&p, 1010, 1020));
+  EXPECT_EQ(p, first);
+  ASSERT_OK(pool.Reallocate(&p, 1010, 4096));
+  EXPECT_NE(p, first);
+  EXPECT_EQ(static_cast<char *>(p)[1009], 'a');
+
+  void *large = nullptr;
+  ASSERT_OK(pool.Allocate(SizeClassPool::kMaxBlockSize, &large));
+  auto stats = pool.GetStatistics();
+  EXPECT_EQ(stats["allocations"], 4);
+  EXPECT_EQ(stats["thread_cache_hits"], 1);
+  EXPECT_EQ(stats["system_allocations"], 3);
+  EXPECT_EQ(stats["in_use_bytes"], SizeClassPool::ClassBlockSize(SizeClassPool::SizeClass(4096)) +
+                                     SizeClassPool::kMaxBlockSize + SizeClassPool::kHeaderSize);
+  EXPECT_EQ(stats["cached_bytes"], SizeClassPool::ClassBlockSize(SizeClassPool::SizeClass(1000)));
+
+  pool.Deallocate(p);
+  pool.Deallocate(large);
+  stats = pool.GetStatistics();
+  EXPECT_EQ(stats["in_use_bytes"], 0);
+  EXPECT_EQ(stats["system_frees"], 1);
+  pool.Trim();
+  stats = pool.GetStatistics();
+  EXPECT_EQ(stats["cached_bytes"], 0);
+  EXPECT_EQ(stats["system_frees"], 3);
+}
+
+/// Feature: SizeClassPool
+/// Description: Allocate beyond the limit of the pool
+/// Expectation: The allocation beyond the limit fails, and the cached blocks are returned to keep within the limit
+TEST_F(MindDataTestSizeClassPool, TestLimit) {
+  constexpr int64_t kLimit = 1024 * 1024;
+  SizeClassPool pool(kLimit);
+  EXPECT_EQ(pool.get_max_size(), static_cast<uint64_t>(kLimit));
+  void *p = nullptr;
+  void *q = nullptr;
+  ASSERT_OK(pool.Allocate(600 * 1024, &p));
+  EXPECT_LT(pool.PercentFree(), 50);
+  Status rc = pool.Allocate(600 * 1024, &q);
+  EXPECT_EQ(rc.StatusCode(), StatusCode::kMDOutOfMemory);
+  pool.Deallocate(p);
+
+  // The block of another class is allocated after the cached block is returned to the system.
+  ASSERT_OK(pool.Allocate(800 * 1024, &q));
+  auto stats = pool.GetStatistics();
+  EXPECT_EQ(stats["failed_allocations"], 1);
+  EXPECT_EQ(stats["cached_bytes"], 0);
+  EXPECT_LE(stats["in_use_bytes"], kLimit);
+  pool.Deallocate(q);
+  EXPECT_EQ(pool.PercentFree(), 100);
+}
+
+/// Feature: SizeClassPool
+/// Description: Set the tensor memory pool limit in the config of the global context
+/// Expectation: The limit is applied to the global tensor memory pool when it is set
+TEST_F(MindDataTestSizeClassPool, TestConfigLimit) {
+  constexpr int64_t kLimit = 1024 * 1024;
+  auto config = GlobalContext::config_manager();
+  int64_t original_limit = config->tensor_memory_pool_limit();
+  config->set_tensor_memory_pool_limit(kLimit);
+  EXPECT_EQ(GlobalContext::Instance()->size_class_pool()->get_max_size(), static_cast<uint64_t>(kLimit));
+
+  // The limit of another config is not applied to the global pool.
+  ConfigManager other_config;
+  other_config.set_tensor_memory_pool_limit(kLimit * 2);
+  EXPECT_EQ(GlobalContext::Instance()->size_class_pool()->get_max_size(), static_cast<uint64_t>(kLimit));
+
+  config->set_tensor_memory_pool_limit(original_limit);
+  EXPECT_EQ(GlobalContext::Instance()->size_class_pool()->get_max_size(),
+            SizeClassPool(original_limit).get_max_size());
+}
+
+/// Feature: SizeClassPool
+/// Description: Allocate and free in many threads, and free the blocks allocated by the other threads
+/// Expectation: All the blocks are freed and reused by the other threads
+TEST_F(MindDataTestSizeClassPool, TestMultiThread) {
+  constexpr int32_t kNumThreads = 4;
+  constexpr int32_t kNumBlocks = 1000;
+  auto pool = std::make_shared<SizeClassPool>();
+  std::vector<std::vector<void *>> blocks(kNumThreads);
+  std::vector<std::thread> threads;
+  for (int32_t t = 0; t < kNumThreads; t++) {
+    threads.emplace_back([&pool, &blocks, t]() {
+      for (int32_t i = 0; i < kNumBlocks; i++) {
+        void *p = nullptr;
+        if (pool->Allocate(static_cast<size_t>(i % 16 + 1) * 1024, &p).IsOk()) {
+          blocks[t].push_back(p);
+        }
+      }
+    });
+  }
+  for (auto &thread : threads) {
+    thread.join();
+  }
+  threads.clear();
+  for (int32_t t = 0; t < kNumThreads; t++) {
+    threads.emplace_back([&pool, &blocks, t]() {
+      for (void *p : blocks[(t + 1) % kNumThreads]) {
+        pool->Deallocate(p);
+      }
+    });
+  }
+  for (auto &thread : threads) {
+    thread.join();
+  }
+  auto stats = pool->GetStatistics();
+  EXPECT_EQ(stats["allocations"], kNumThreads * kNumBlocks);
+  EXPECT_EQ(stats["in_use_bytes"], 0);
+  EXPECT_GT(stats["cached_bytes"], 0);
+
+  // The blocks cached by the exited threads are in the shared free lists.
+  void *p = nullptr;
+  ASSERT_OK(pool->Allocate(1024, &p));
+  EXPECT_EQ(pool->GetStatistics()["free_list_hits"], 1);
+  pool->Deallocate(p);
+}
+
+/// Feature: SizeClassPool
+/// Description: Run the image like workload in several threads for some rounds
+/// Expectation: The blocks are reused after the first round, so the memory held by the pool does not grow
+TEST_F(MindDataTestSizeClassPool, TestReuseAcrossRounds) {
+  constexpr int32_t kNumThreads = 4;
+  constexpr int32_t kIterations = 2000;
+  constexpr int32_t kRounds = 3;
+  auto pool = std::make_shared<SizeClassPool>();
+  (void)RunAllocFreeLoop(pool, kNumThreads, kIterations);
+  auto stats = pool->GetStatistics();
+  int64_t first_round_held = stats["cached_bytes"];
+  EXPECT_GT(first_round_held, 0);
+  for (int32_t round = 0; round < kRounds; round++) {
+    int64_t last_system_allocations = stats["system_allocations"];
+    int64_t last_allocations = stats["allocations"];
+    (void)RunAllocFreeLoop(pool, kNumThreads, kIterations);
+    stats = pool->GetStatistics();
+    EXPECT_EQ(stats["in_use_bytes"], 0);
+    EXPECT_LT((stats["system_allocations"] - last_system_allocations) * 10, stats["allocations"] - last_allocations);
+    EXPECT_LE(stats["cached_bytes"], first_round_held * 2);
+  }
+}
+
+/// Feature: SizeClassPool
+/// Description: Benchmark the allocation throughput of SystemPool and SizeClassPool, then run the image like workload
+///     in rounds for the seconds given by MD_TENSOR_POOL_BENCH_SECONDS and log the RSS, which is skipped unless
+///     MD_TENSOR_POOL_BENCH_SECONDS is set
+/// Expectation: The memory held by the pool does not grow over the rounds
+TEST_F(MindDataTestSizeClassPool, TestAllocThroughputAndRss) {
+  const char *env = std::getenv("MD_TENSOR_POOL_BENCH_SECONDS");
+  if (env == nullptr) {
+    MS_LOG(INFO) << "Skip the benchmark, set MD_TENSOR_POOL_BENCH_SECONDS to run it.";
+    return;
+  }
+  int64_t bench_seconds = std::strtoll(env, nullptr, 0);
+  constexpr int32_t kIterations = 20000;
+  for (int32_t num_threads : {1, 2, 4, 8}) {
+    double system_throughput = RunAllocFreeLoop(std::make_shared<SystemPool>(), num_threads, kIterations);
+    double pool_throughput = RunAllocFreeLoop(std::make_shared<SizeClassPool>(), num_threads, kIterations);
+    MS_LOG(WARNING) << "Thread num: " << num_threads << ", allocations per second of SystemPool: "
+                    << system_throughput << ", of SizeClassPool: " << pool_throughput;
+  }
+
+  constexpr int32_t kNumThreads = 4;
+  auto pool = std::make_shared<SizeClassPool>();
+  (void)RunAllocFreeLoop(pool, kNumThreads, kIterations);
+  auto stats = pool->GetStatistics();
+  int64_t first_round_held = stats["cached_bytes"];
+  int64_t last_system_allocations = stats["system_allocations"];
+  auto start = std::chrono::steady_clock::now();
+  int32_t round = 0;
+  do {
+    double throughput = RunAllocFreeLoop(pool, kNumThreads, kIterations);
+    stats = pool->GetStatistics();
+    MS_LOG(WARNING) << "Round: " << ++round << ", allocations per second: " << throughput
+                    << ", system allocations: " << stats["system_allocations"] - last_system_allocations
+                    << ", held bytes: " << stats["cached_bytes"] << ", RSS: " << GetRss();
+    ASSERT_LE(stats["cached_bytes"], first_round_held * 2);
+    last_system_allocations = stats["system_allocations"];
+  } while (std::chrono::steady_clock::now() - start < std::chrono::seconds(bench_seconds));
+}
@@ -587,3 +587,28 @@ TEST_F(MindDataTestTensorDE, TensorEmpty) {
   t2->Invalidate();
   ASSERT_TRUE(!t2->HasData());
 }
+
+/// Feature: Tensor
+/// Description: Create a tensor which shares an external buffer and release the tensor
+/// Expectation: The tensor reads the external buffer without copying it, and the owner is released with the tensor
+TEST_F(MindDataTestTensorDE, TensorExternalMemory) {
+  auto values = std::make_shared<std::vector<float>>(std::vector<float>{1.0, 2.0, 3.0, 4.0, 5.0, 6.0});
+  std::weak_ptr<std::vector<float>> weak_values = values;
+  auto *data = reinterpret_cast<uchar *>(values->data());
+  std::shared_ptr<Tensor> t;
+  ASSERT_OK(Tensor::CreateFromExternalMemory(TensorShape({2, 3}), DataType(DataType::DE_FLOAT32), data,
+                                             std::move(values), &t));
+  ASSERT_EQ(t->GetBuffer(), data);
+  ASSERT_EQ(t->SizeInBytes(), 6 * sizeof(float));
+  float value = 0;
+  ASSERT_OK(t->GetItemAt<float>(&value, {1, 2}));
+  ASSERT_EQ(value, 6.0);
+  ASSERT_FALSE(weak_values.expired());
+  t = nullptr;
+  ASSERT_TRUE(weak_values.expired());
+
+  std::shared_ptr<Tensor> t2;
+  ASSERT_TRUE(Tensor::CreateFromExternalMemory(TensorShape({1}), DataType(DataType::DE_STRING), data,
+                                               std::make_shared<int>(0), &t2)
+                .IsError());
+}
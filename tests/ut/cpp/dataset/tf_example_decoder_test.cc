@@ -0,0 +1,154 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <cstring>
+#include <string>
+#include <string_view>
+#include <vector>
+#include "common/common.h"
+#include "gtest/gtest.h"
+#include "minddata/dataset/engine/datasetops/source/tf_example_decoder.h"
+
+using namespace mindspore::dataset;
+using FeatureView = TFExampleDecoder::FeatureView;
+
+class MindDataTestTFExampleDecoder : public UT::Common {
+ public:
+  MindDataTestTFExampleDecoder() = default;
+
+ protected:
+  static std::string Varint(uint64_t value) {
+    std::string out;
+    while (value >= 0x80) {
+      out.push_back(static_cast<char>((value & 0x7F) | 0x80));
+      value >>= 7;
+    }
+    out.push_back(static_cast<char>(value));
+    return out;
+  }
+
+  static std::string LengthDelimited(uint32_t field, const std::string &data) {
+    return Varint((field << 3) | 2) + Varint(data.size()) + data;
+  }
+
+  static std::string Fixed32(float value) {
+    std::string out(sizeof(float), '\0');
+    (void)memcpy(&out[0], &value, sizeof(float));
+    return out;
+  }
+
+  static std::string Entry(const std::string &key, const std::string &feature) {
+    return LengthDelimited(1, LengthDelimited(1, key) + LengthDelimited(2, feature));
+  }
+
+  static std::string Example(const std::string &entries) { return LengthDelimited(1, entries); }
+
+  static Status Decode(const TFExampleDecoder &decoder, const std::string &example, std::vector<FeatureView> *features,
+                       bool *supported) {
+    return decoder.Decode(reinterpret_cast<const uint8_t *>(example.data()), example.size(), features, supported);
+  }
+};
+
+/// Feature: TFExampleDecoder
+/// Description: Decode an Example with the packed and unpacked lists of all the kinds and an unrequested feature
+/// Expectation: The requested features are found with their values and the unrequested feature is skipped
+TEST_F(MindDataTestTFExampleDecoder, TestDecodeLists) {
+  std::string bytes_feature = LengthDelimited(1, LengthDelimited(1, "abc") + LengthDelimited(1, "") +
+                                                   LengthDelimited(1, "de"));
+  std::string packed_floats = LengthDelimited(2, LengthDelimited(1, Fixed32(1.5f) + Fixed32(-2.0f)));
+  std::string unpacked_floats = LengthDelimited(2, Varint((1 << 3) | 5) + Fixed32(3.0f) + Varint((1 << 3) | 5) +
+                                                     Fixed32(4.0f));
+  std::string packed_ints = LengthDelimited(3, LengthDelimited(1, Varint(1) + Varint(300) + Varint(-7LL)));
+  std::string unpacked_ints = LengthDelimited(3, Varint(1 << 3) + Varint(5) + Varint(1 << 3) + Varint(6));
+  std::string example = Example(Entry("bytes", bytes_feature) + Entry("skipped", packed_ints) +
+                                Entry("packed_floats", packed_floats) + Entry("unpacked_floats", unpacked_floats) +
+                                Entry("packed_ints", packed_ints) + Entry("unpacked_ints", unpacked_ints));
+  TFExampleDecoder decoder({"packed_ints", "unpacked_ints", "packed_floats", "unpacked_floats", "bytes", "missing"});
+  std::vector<FeatureView> features;
+  bool supported = false;
+  ASSERT_OK(Decode(decoder, example, &features, &supported));
+  ASSERT_TRUE(supported);
+  ASSERT_EQ(features.size(), 6);
+  EXPECT_FALSE(features[5].present);
+
+  std::vector<std::string_view> bytes;
+  ASSERT_EQ(features[4].kind, TFExampleDecoder::kBytesList);
+  ASSERT_OK(TFExampleDecoder::GetBytesList(features[4], &bytes));
+  EXPECT_EQ(bytes, std::vector<std::string_view>({"abc", "", "de"}));
+
+  for (size_t col : {2, 3}) {
+    ASSERT_EQ(features[col].kind, TFExampleDecoder::kFloatList);
+    int64_t count = 0;
+    ASSERT_OK(TFExampleDecoder::CountFloatList(features[col], &count));
+    ASSERT_EQ(count, 2);
+    std::vector<float> values(count);
+    ASSERT_OK(TFExampleDecoder::ReadFloatList(features[col], values.data(), count));
+    EXPECT_EQ(values, col == 2 ? std::vector<float>({1.5f, -2.0f}) : std::vector<float>({3.0f, 4.0f}));
+  }
+
+  int64_t count = 0;
+  ASSERT_EQ(features[0].kind, TFExampleDecoder::kInt64List);
+  ASSERT_OK(TFExampleDecoder::CountInt64List(features[0], &count));
+  ASSERT_EQ(count, 3);
+  std::vector<int64_t> int64_values(count);
+  ASSERT_OK(TFExampleDecoder::ReadInt64List(features[0], int64_values.data(), count));
+  EXPECT_EQ(int64_values, std::vector<int64_t>({1, 300, -7}));
+  // The values are cast to the type of the column and the extra values are not written.
+  std::vector<uint8_t> uint8_values(2);
+  ASSERT_OK(TFExampleDecoder::ReadInt64List(features[0], uint8_values.data(), 2));
+  EXPECT_EQ(uint8_values, std::vector<uint8_t>({1, 44}));
+
+  ASSERT_OK(TFExampleDecoder::CountInt64List(features[1], &count));
+  ASSERT_EQ(count, 2);
+  std::vector<int32_t> int32_values(count);
+  ASSERT_OK(TFExampleDecoder::ReadInt64List(features[1], int32_values.data(), count));
+  EXPECT_EQ(int32_values, std::vector<int32_t>({5, 6}));
+}
+
+/// Feature: TFExampleDecoder
+/// Description: Decode the Examples which need merging by protobuf or are malformed
+/// Expectation: The Examples are reported as unsupported, and the last entry of a key wins
+TEST_F(MindDataTestTFExampleDecoder, TestUnsupportedExample) {
+  TFExampleDecoder decoder({"label"});
+  std::vector<FeatureView> features;
+  bool supported = true;
+  std::string first = LengthDelimited(3, LengthDelimited(1, Varint(1)));
+  std::string second = LengthDelimited(3, LengthDelimited(1, Varint(2)));
+
+  // The last entry of the same key replaces the former ones.
+  ASSERT_OK(Decode(decoder, Example(Entry("label", first) + Entry("label", second)), &features, &supported));
+  ASSERT_TRUE(supported);
+  int64_t value = 0;
+  ASSERT_OK(TFExampleDecoder::ReadInt64List(features[0], &value, 1));
+  EXPECT_EQ(value, 2);
+
+  // The int64 list split into two fields of a Feature should be merged.
+  std::string split = first + second;
+  ASSERT_OK(Decode(decoder, Example(Entry("label", split)), &features, &supported));
+  EXPECT_FALSE(supported);
+
+  // The Example truncated in the middle of a map entry.
+  std::string truncated = Example(Entry("label", first));
+  truncated.pop_back();
+  ASSERT_OK(Decode(decoder, truncated, &features, &supported));
+  EXPECT_FALSE(supported);
+
+  // The packed floats whose size is not a multiple of 4.
+  std::string bad_floats = LengthDelimited(2, LengthDelimited(1, std::string(3, '\0')));
+  ASSERT_OK(Decode(decoder, Example(Entry("label", bad_floats)), &features, &supported));
+  ASSERT_TRUE(supported);
+  int64_t count = 0;
+  EXPECT_TRUE(TFExampleDecoder::CountFloatList(features[0], &count).IsError());
+}
@@ -0,0 +1,282 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <chrono>
+#include <cstdlib>
+#include <future>
+#include <thread>
+#include <vector>
+#include "common/common_test.h"
+#include "common/mem_reuse/mem_dynamic_allocator.h"
+#include "utils/log_adapter.h"
+
+namespace mindspore::device {
+constexpr size_t kPoolUnitSize = 64 << 20;
+constexpr size_t kPoolDeviceMemSize = kPoolUnitSize;
+
+class HostMemPoolStub : public DynamicMemPoolBestFit {
+ public:
+  explicit HostMemPoolStub(size_t device_mem_size = kPoolDeviceMemSize) : device_mem_size_(device_mem_size) {
+    SetMemAllocUintSize(kPoolUnitSize, kPoolUnitSize);
+  }
+  ~HostMemPoolStub() override { ReleaseDeviceRes(); }
+
+  size_t AllocDeviceMem(size_t size, DeviceMemPtr *addr) override {
+    if (used_size_ + size > device_mem_size_) {
+      return 0;
+    }
+    *addr = malloc(size);
+    if (*addr == nullptr) {
+      return 0;
+    }
+    used_size_ += size;
+    return size;
+  }
+  bool FreeDeviceMem(const DeviceMemPtr &addr) override {
+    free(addr);
+    return true;
+  }
+  size_t free_mem_size() override { return device_mem_size_ - used_size_; }
+
+ private:
+  size_t device_mem_size_;
+  size_t used_size_{0};
+};
+
+class TestMemDynamicAllocator : public UT::Common {
+ public:
+  TestMemDynamicAllocator() {}
+
+ protected:
+  // Every thread allocates and frees the memory of several sizes repeatedly, return the allocation number per second.
+  double RunAllocFreeLoop(bool thread_cache_enable, size_t thread_num) {
+    constexpr size_t kLoopCount = 20000;
+    const std::vector<size_t> sizes = {512, 4096, 65536, 262144};
+    HostMemPoolStub pool;
+    pool.set_thread_cache_enable(thread_cache_enable);
+    auto start = std::chrono::steady_clock::now();
+    std::vector<std::thread> threads;
+    for (size_t i = 0; i < thread_num; ++i) {
+      threads.emplace_back([&pool, &sizes]() {
+        std::vector<DeviceMemPtr> addrs(sizes.size(), nullptr);
+        for (size_t loop = 0; loop < kLoopCount; ++loop) {
+          for (size_t j = 0; j < sizes.size(); ++j) {
+            addrs[j] = pool.AllocTensorMem(sizes[j]);
+          }
+          for (auto &addr : addrs) {
+            pool.FreeTensorMem(addr);
+          }
+        }
+      });
+    }
+    for (auto &thread : threads) {
+      thread.join();
+    }
+    auto cost = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    EXPECT_EQ(pool.ThreadCacheHitCount() > 0, thread_cache_enable);
+    return static_cast<double>(kLoopCount * sizes.size() * thread_num) / cost;
+  }
+};
+
+/// Feature: Thread memory cache of the dynamic memory pool.
+/// Description: Free the memory and allocate the memory of the same size in one thread.
+/// Expectation: The freed memory is reused from the thread memory cache and is still used in the pool.
+TEST_F(TestMemDynamicAllocator, test_thread_cache_reuse) {
+  HostMemPoolStub pool;
+  pool.set_thread_cache_enable(true);
+  auto addr = pool.AllocTensorMem(1000);
+  ASSERT_NE(addr, nullptr);
+  ASSERT_EQ(pool.ThreadCacheHitCount(), 0);
+  auto used_size = pool.TotalUsedMemStatistics();
+  pool.FreeTensorMem(addr);
+  ASSERT_EQ(pool.TotalUsedMemStatistics(), used_size);
+  auto new_addr = pool.AllocTensorMem(1000);
+  ASSERT_EQ(new_addr, addr);
+  ASSERT_EQ(pool.ThreadCacheHitCount(), 1);
+  pool.FreeTensorMem(new_addr);
+  // The memory of another size isn't served by the cache.
+  auto other_addr = pool.AllocTensorMem(5000);
+  ASSERT_NE(other_addr, nullptr);
+  ASSERT_EQ(pool.ThreadCacheHitCount(), 1);
+  pool.FreeTensorMem(other_addr);
+
+  // The persistent memory and the large memory aren't cached.
+  auto persistent_addr = pool.AllocTensorMem(1000, true);
+  ASSERT_NE(persistent_addr, nullptr);
+  auto large_addr = pool.AllocTensorMem(kThreadCacheMaxMemSize * 2);
+  ASSERT_NE(large_addr, nullptr);
+  used_size = pool.TotalUsedMemStatistics();
+  pool.FreeTensorMem(large_addr);
+  ASSERT_LT(pool.TotalUsedMemStatistics(), used_size);
+  pool.FreeTensorMem(persistent_addr);
+  ASSERT_EQ(pool.ThreadCacheHitCount(), 1);
+  ASSERT_EQ(pool.ThreadCacheFlushCount(), 0);
+}
+
+/// Feature: Thread memory cache of the dynamic memory pool.
+/// Description: Allocate the memory larger than the rest of pool when the small memory is cached.
+/// Expectation: The cached memory is returned to the pool and the allocation succeeds.
+TEST_F(TestMemDynamicAllocator, test_thread_cache_flush) {
+  HostMemPoolStub pool;
+  pool.set_thread_cache_enable(true);
+  std::vector<DeviceMemPtr> addrs;
+  for (size_t i = 0; i < kThreadCacheMaxBufNum; ++i) {
+    addrs.push_back(pool.AllocTensorMem(kThreadCacheMaxMemSize));
+    ASSERT_NE(addrs.back(), nullptr);
+  }
+  for (auto &addr : addrs) {
+    pool.FreeTensorMem(addr);
+  }
+  // All the device memory is taken by the first block, and the cached memory must be returned to combine the block.
+  ASSERT_EQ(pool.ThreadCacheFlushCount(), 0);
+  auto whole_addr = pool.AllocTensorMem(kPoolUnitSize - kThreadCacheMaxMemSize);
+  ASSERT_NE(whole_addr, nullptr);
+  ASSERT_EQ(pool.ThreadCacheFlushCount(), kThreadCacheMaxBufNum);
+  pool.FreeTensorMem(whole_addr);
+}
+
+/// Feature: Thread memory cache of the dynamic memory pool.
+/// Description: Free the memory in the pool with the default setting.
+/// Expectation: The thread memory cache is disabled and the freed memory is returned to the pool at once.
+TEST_F(TestMemDynamicAllocator, test_thread_cache_disabled_by_default) {
+  HostMemPoolStub pool;
+  ASSERT_FALSE(pool.thread_cache_enable());
+  auto addr = pool.AllocTensorMem(1000);
+  ASSERT_NE(addr, nullptr);
+  ASSERT_GT(pool.TotalUsedMemStatistics(), 0);
+  pool.FreeTensorMem(addr);
+  ASSERT_EQ(pool.TotalUsedMemStatistics(), 0);
+}
+
+/// Feature: Thread memory cache of the dynamic memory pool.
+/// Description: Several threads cache the adjacent memory bufs, then allocate the memory of the whole block.
+/// Expectation: The cached memory bufs of all threads are returned and merged, and no memory is in used at last.
+TEST_F(TestMemDynamicAllocator, test_thread_cache_merge) {
+  constexpr size_t kThreadNum = 4;
+  constexpr size_t kBufNumPerThread = kThreadCacheMaxBufNum / kThreadNum;
+  HostMemPoolStub pool;
+  pool.set_thread_cache_enable(true);
+  std::vector<std::vector<DeviceMemPtr>> thread_addrs(kThreadNum);
+  for (size_t i = 0; i < kBufNumPerThread; ++i) {
+    for (size_t j = 0; j < kThreadNum; ++j) {
+      thread_addrs[j].push_back(pool.AllocTensorMem(kThreadCacheMaxMemSize));
+      ASSERT_NE(thread_addrs[j].back(), nullptr);
+    }
+  }
+  // The interleaved bufs are freed to the different thread memory caches, so they can only be merged after flush.
+  std::vector<std::thread> threads;
+  for (size_t j = 0; j < kThreadNum; ++j) {
+    threads.emplace_back([&pool, &thread_addrs, j]() {
+      for (auto &addr : thread_addrs[j]) {
+        pool.FreeTensorMem(addr);
+      }
+    });
+  }
+  for (auto &thread : threads) {
+    thread.join();
+  }
+  ASSERT_EQ(pool.TotalUsedMemStatistics(), kThreadNum * kBufNumPerThread * kThreadCacheMaxMemSize);
+
+  auto whole_addr = pool.AllocTensorMem(kPoolUnitSize);
+  ASSERT_NE(whole_addr, nullptr);
+  ASSERT_EQ(whole_addr, thread_addrs[0][0]);
+  ASSERT_EQ(pool.ThreadCacheFlushCount(), kThreadNum * kBufNumPerThread);
+  pool.FreeTensorMem(whole_addr);
+  ASSERT_EQ(pool.TotalUsedMemStatistics(), 0);
+}
+
+/// Feature: Thread memory cache of the dynamic memory pool.
+/// Description: Cache the memory bufs in a thread which exits, then allocate in another thread.
+/// Expectation: The cache of the exited thread is trimmed at the next allocation of the pool.
+TEST_F(TestMemDynamicAllocator, test_thread_cache_trim_exited) {
+  constexpr size_t kBufNum = 4;
+  HostMemPoolStub pool;
+  pool.set_thread_cache_enable(true);
+  std::thread thread([&pool]() {
+    std::vector<DeviceMemPtr> addrs;
+    for (size_t i = 0; i < kBufNum; ++i) {
+      addrs.push_back(pool.AllocTensorMem(kThreadCacheMaxMemSize));
+    }
+    for (auto &addr : addrs) {
+      pool.FreeTensorMem(addr);
+    }
+  });
+  thread.join();
+  ASSERT_EQ(pool.TotalUsedMemStatistics(), kBufNum * kThreadCacheMaxMemSize);
+  ASSERT_EQ(pool.ThreadCacheFlushCount(), 0);
+
+  auto addr = pool.AllocTensorMem(kThreadCacheMaxMemSize);
+  ASSERT_NE(addr, nullptr);
+  ASSERT_EQ(pool.ThreadCacheHitCount(), 0);
+  ASSERT_EQ(pool.ThreadCacheFlushCount(), kBufNum);
+  ASSERT_EQ(pool.TotalUsedMemStatistics(), kThreadCacheMaxMemSize);
+  pool.FreeTensorMem(addr);
+}
+
+/// Feature: Thread memory cache of the dynamic memory pool.
+/// Description: Cache the memory bufs in a thread which stays alive but idle, while the pool has to grow twice.
+/// Expectation: The cache of the idle thread is kept at the first growth and trimmed before the second growth.
+TEST_F(TestMemDynamicAllocator, test_thread_cache_trim_idle) {
+  constexpr size_t kBufNum = 4;
+  constexpr size_t kLargeSize = kPoolUnitSize - kThreadCacheMaxMemSize;
+  HostMemPoolStub pool(kPoolUnitSize * 2);
+  pool.set_thread_cache_enable(true);
+  std::promise<void> cached;
+  std::promise<void> done;
+  DeviceMemPtr first_addr = nullptr;
+  std::thread thread([&pool, &cached, &done, &first_addr]() {
+    std::vector<DeviceMemPtr> addrs;
+    for (size_t i = 0; i < kBufNum; ++i) {
+      addrs.push_back(pool.AllocTensorMem(kThreadCacheMaxMemSize));
+    }
+    first_addr = addrs[0];
+    for (auto &addr : addrs) {
+      pool.FreeTensorMem(addr);
+    }
+    cached.set_value();
+    done.get_future().wait();
+  });
+  cached.get_future().wait();
+
+  // The thread used its cache since the last trim, so the pool grows a new block.
+  auto large_addr = pool.AllocTensorMem(kLargeSize);
+  ASSERT_NE(large_addr, nullptr);
+  ASSERT_EQ(pool.ThreadCacheFlushCount(), 0);
+  ASSERT_EQ(pool.TotalMemStatistics(), kPoolUnitSize * 2);
+  // The thread is idle now, its cached memory is returned and merged instead of growing the pool beyond the limit.
+  auto another_large_addr = pool.AllocTensorMem(kLargeSize);
+  ASSERT_NE(another_large_addr, nullptr);
+  ASSERT_EQ(another_large_addr, first_addr);
+  ASSERT_EQ(pool.ThreadCacheFlushCount(), kBufNum);
+  pool.FreeTensorMem(large_addr);
+  pool.FreeTensorMem(another_large_addr);
+  done.set_value();
+  thread.join();
+}
+
+/// Feature: Thread memory cache of the dynamic memory pool.
+/// Description: The microbenchmark of allocation throughput versus the thread number, which is disabled by default
+/// and run with --gtest_also_run_disabled_tests.
+/// Expectation: The allocations are served by the thread memory caches only when they are enabled.
+TEST_F(TestMemDynamicAllocator, DISABLED_test_alloc_throughput) {
+  for (size_t thread_num : {1, 2, 4, 8}) {
+    auto pool_throughput = RunAllocFreeLoop(false, thread_num);
+    auto cache_throughput = RunAllocFreeLoop(true, thread_num);
+    MS_LOG(WARNING) << "Thread num: " << thread_num << ", allocations per second without thread cache: "
+                    << pool_throughput << ", with thread cache: " << cache_throughput;
+  }
+}
+}  // namespace mindspore::device
@@ -16,12 +16,18 @@
 
 #include "common/common_test.h"
 
+#include <dirent.h>
+#include <unistd.h>
+#include <cstdio>
+#include <chrono>
+#include <thread>
 #include <memory>
 #include <map>
 #include <vector>
 #include <string>
 
 #include "distributed/persistent/data.h"
+#include "distributed/persistent/storage/incremental_file.h"
 #include "utils/file_utils.h"
 
 namespace mindspore {
@@ -33,7 +39,25 @@ class TestPersistStorage : public UT::Common {
   virtual ~TestPersistStorage() = default;
 
   void SetUp() override {}
-  void TearDown() override {}
+  void TearDown() override { RemoveDir(kIncrementalStoragePath); }
+
+ protected:
+  void RemoveDir(const std::string &dir_path) {
+    DIR *dir = opendir(dir_path.c_str());
+    if (dir == nullptr) {
+      return;
+    }
+    for (auto entry = readdir(dir); entry != nullptr; entry = readdir(dir)) {
+      std::string name = entry->d_name;
+      if (name != "." && name != "..") {
+        (void)std::remove((dir_path + "/" + name).c_str());
+      }
+    }
+    (void)closedir(dir);
+    (void)rmdir(dir_path.c_str());
+  }
+
+  const std::string kIncrementalStoragePath = "./incremental_storage";
 };
 
 /// Feature: test parameter persistent storage and resotre.
@@ -98,6 +122,89 @@ TEST_F(TestPersistStorage, test_embedding_storage) {
     EXPECT_EQ(data[i], embdding_table_data->at(i));
   }
 }
+
+/// Feature: test incremental persistent storage and restore.
+/// Description: Persist the dirty rows of the embedding table several times, compact them into the base file, and
+/// read it from the file again after the storage is reopened.
+/// Expectation: The content after persistent recovery is consistent with expectations.
+TEST_F(TestPersistStorage, test_incremental_storage) {
+  constexpr int kVocab = 1000;
+  constexpr int kEmbDim = 16;
+  constexpr size_t kRowLength = kEmbDim * sizeof(float);
+  std::vector<int> shape = {kVocab, kEmbDim};
+  std::vector<float> data(kVocab * kEmbDim, 1.0f);
+
+  std::string storage_file_path = kIncrementalStoragePath;
+  if (!distributed::storage::FileIOUtils::IsFileOrDirExist(storage_file_path)) {
+    distributed::storage::FileIOUtils::CreateDir(storage_file_path);
+  }
+  std::map<std::string, std::string> config_map;
+  config_map[distributed::storage::kFileStoragePath] = storage_file_path;
+  // Each delta log file holds a few records, so some of them are compacted.
+  config_map[distributed::storage::kMaxDeltaLength] = std::to_string(kRowLength * 20);
+
+  {
+    distributed::storage::IncrementalFile storage(config_map);
+    auto input = std::make_tuple(shape, data.data(), data.size() * sizeof(float));
+    EXPECT_NO_THROW(storage.Write(input, distributed::storage::DirtyInfo()));
+    for (int step = 0; step < 10; step++) {
+      distributed::storage::DirtyInfo dirty_info;
+      for (int row = step; row < kVocab; row += 97) {
+        for (int i = 0; i < kEmbDim; i++) {
+          data[row * kEmbDim + i] = static_cast<float>(step * kEmbDim + i);
+        }
+        dirty_info.push_back(row);
+      }
+      EXPECT_NO_THROW(storage.Write(input, dirty_info));
+    }
+    storage.Flush();
+  }
+
+  distributed::storage::IncrementalFile storage(config_map);
+  std::vector<float> restored(data.size(), 0.0f);
+  EXPECT_NO_THROW(storage.Read(std::make_pair(restored.data(), restored.size() * sizeof(float))));
+  EXPECT_EQ(data, restored);
+}
+
+/// Feature: test incremental persistent storage and restore.
+/// Description: Append the dirty rows when the delta log file can't be opened, and open it again later.
+/// Expectation: The records failed to append are appended again, and the rows are restored.
+TEST_F(TestPersistStorage, test_incremental_storage_append_retry) {
+  constexpr int kVocab = 100;
+  constexpr int kEmbDim = 8;
+  std::vector<int> shape = {kVocab, kEmbDim};
+  std::vector<float> data(kVocab * kEmbDim, 1.0f);
+  distributed::storage::FileIOUtils::CreateDir(kIncrementalStoragePath);
+  std::map<std::string, std::string> config_map;
+  config_map[distributed::storage::kFileStoragePath] = kIncrementalStoragePath;
+
+  {
+    distributed::storage::IncrementalFile storage(config_map);
+    auto input = std::make_tuple(shape, data.data(), data.size() * sizeof(float));
+    EXPECT_NO_THROW(storage.Write(input, distributed::storage::DirtyInfo()));
+    // The directory of the same name makes the delta log file fail to open.
+    std::string delta_file_name = kIncrementalStoragePath + "/" + distributed::storage::kIncrementalDeltaFilePrefix +
+                                  std::string(19, '0') + "1";
+    distributed::storage::FileIOUtils::CreateDir(delta_file_name);
+    for (int step = 0; step < 3; step++) {
+      distributed::storage::DirtyInfo dirty_info = {step, step + kEmbDim};
+      for (int row : dirty_info) {
+        for (int i = 0; i < kEmbDim; i++) {
+          data[row * kEmbDim + i] = static_cast<float>(step + i);
+        }
+      }
+      EXPECT_NO_THROW(storage.Write(input, dirty_info));
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    ASSERT_EQ(rmdir(delta_file_name.c_str()), 0);
+    storage.Flush();
+  }
+
+  distributed::storage::IncrementalFile storage(config_map);
+  std::vector<float> restored(data.size(), 0.0f);
+  EXPECT_NO_THROW(storage.Read(std::make_pair(restored.data(), restored.size() * sizeof(float))));
+  EXPECT_EQ(data, restored);
+}
 }  // namespace persistent
 }  // namespace distributed
 }  // namespace mindspore
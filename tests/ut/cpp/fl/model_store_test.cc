@@ -0,0 +1,133 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+#include "common/common_test.h"
+#include "fl/server/model_store.h"
+
+namespace mindspore {
+namespace fl {
+namespace server {
+class TestModelStore : public UT::Common {
+ public:
+  TestModelStore() = default;
+  virtual ~TestModelStore() = default;
+
+  void SetUp() override {}
+  void TearDown() override {}
+
+ protected:
+  // Only the leader server saves checkpoints, the other ranks don't need the python serializer.
+  static constexpr uint32_t kFollowerRank = 1;
+  static constexpr uint32_t kMaxModelCount = 2;
+  static constexpr size_t kWeightSize = 8;
+
+  // A model whose only weight is filled with the given value, like the model of Executor after an iteration.
+  std::map<std::string, AddressPtr> MakeModel(std::vector<float> *weight, float value) {
+    weight->assign(kWeightSize, value);
+    return {{"w", std::make_shared<Address>(weight->data(), weight->size() * sizeof(float))}};
+  }
+
+  std::vector<float> WeightOf(const std::map<std::string, AddressPtr> &model) {
+    auto data = reinterpret_cast<const float *>(model.at("w")->addr);
+    return std::vector<float>(data, data + model.at("w")->size / sizeof(float));
+  }
+};
+
+/// Feature: copy-on-write model versions of the federated learning server.
+/// Description: keep the model of an iteration while the following iterations evict it from the store.
+/// Expectation: the reader still sees its version, and the memory of an evicted model is reused only when unread.
+TEST_F(TestModelStore, test_reader_keeps_snapshot_during_update) {
+  auto &store = ModelStore::GetInstance();
+  std::vector<float> weight;
+  store.Initialize(kFollowerRank, kMaxModelCount, MakeModel(&weight, 0));
+  store.StoreModelByIterNum(1, MakeModel(&weight, 1));
+  auto snapshot = store.GetModelByIterNum(1);
+  ASSERT_EQ(snapshot.size(), 1);
+  void *snapshot_addr = snapshot.at("w")->addr;
+
+  // Iteration 3 evicts the model of iteration 1 while it is read, so new memory is assigned.
+  store.StoreModelByIterNum(2, MakeModel(&weight, 2));
+  store.StoreModelByIterNum(3, MakeModel(&weight, 3));
+  EXPECT_EQ(store.iteration_to_model().count(1), 0);
+  EXPECT_EQ(WeightOf(snapshot), std::vector<float>(kWeightSize, 1));
+  EXPECT_NE(store.GetModelByIterNum(3).at("w")->addr, snapshot_addr);
+  EXPECT_EQ(WeightOf(store.GetModelByIterNum(3)), std::vector<float>(kWeightSize, 3));
+
+  // Once the model of iteration 2 is not read anymore, its memory is reused for iteration 4.
+  void *unread_addr = store.GetModelByIterNum(2).at("w")->addr;
+  store.StoreModelByIterNum(4, MakeModel(&weight, 4));
+  EXPECT_EQ(store.GetModelByIterNum(4).at("w")->addr, unread_addr);
+  EXPECT_EQ(WeightOf(store.GetModelByIterNum(4)), std::vector<float>(kWeightSize, 4));
+  EXPECT_EQ(WeightOf(snapshot), std::vector<float>(kWeightSize, 1));
+}
+
+/// Feature: copy-on-write model versions of the federated learning server.
+/// Description: store the latest stored model again for an invalid iteration, like Iteration does.
+/// Expectation: the iteration shares the memory of the latest model and its compress models instead of copying them.
+TEST_F(TestModelStore, test_store_stored_model_without_copy) {
+  auto &store = ModelStore::GetInstance();
+  std::vector<float> weight;
+  store.Initialize(kFollowerRank, kMaxModelCount, MakeModel(&weight, 0));
+  store.StoreModelByIterNum(1, MakeModel(&weight, 1));
+  store.StoreCompressModelByIterNum(1, MakeModel(&weight, 1));
+
+  auto latest = store.GetModelByIterNum(1);
+  auto compress_model = store.GetCompressModelByIterNum(1, schema::CompressType_QUANT);
+  ASSERT_FALSE(compress_model.empty());
+  store.StoreModelByIterNum(2, latest);
+  store.StoreCompressModelByIterNum(2, latest);
+  EXPECT_EQ(store.GetModelByIterNum(2).at("w")->addr, latest.at("w")->addr);
+  auto shared_compress_model = store.GetCompressModelByIterNum(2, schema::CompressType_QUANT);
+  ASSERT_EQ(shared_compress_model.size(), compress_model.size());
+  for (const auto &weight_item : compress_model) {
+    EXPECT_EQ(shared_compress_model.at(weight_item.first)->addr, weight_item.second->addr);
+  }
+
+  // The shared model is still used by iteration 2, so evicting iteration 1 must not overwrite it.
+  store.StoreModelByIterNum(3, MakeModel(&weight, 3));
+  EXPECT_EQ(WeightOf(store.GetModelByIterNum(2)), std::vector<float>(kWeightSize, 1));
+  EXPECT_EQ(WeightOf(store.GetModelByIterNum(3)), std::vector<float>(kWeightSize, 3));
+}
+
+/// Feature: copy-on-write model versions of the federated learning server.
+/// Description: keep the compress model of an iteration while the following iterations evict it from the store.
+/// Expectation: the compress model read before the update is unchanged.
+TEST_F(TestModelStore, test_compress_reader_keeps_snapshot_during_update) {
+  auto &store = ModelStore::GetInstance();
+  std::vector<float> weight;
+  store.Initialize(kFollowerRank, kMaxModelCount, MakeModel(&weight, 0));
+  auto model = MakeModel(&weight, 1);
+  weight[0] = -1;
+  store.StoreCompressModelByIterNum(1, model);
+  auto snapshot = store.GetCompressModelByIterNum(1, schema::CompressType_QUANT);
+  ASSERT_EQ(snapshot.count("w"), 1);
+  auto data = reinterpret_cast<const int8_t *>(snapshot.at("w")->addr);
+  std::vector<int8_t> expected(data, data + snapshot.at("w")->size);
+
+  for (size_t iteration = 2; iteration <= kMaxModelCount + 1; ++iteration) {
+    store.StoreCompressModelByIterNum(iteration, MakeModel(&weight, static_cast<float>(iteration)));
+  }
+  EXPECT_EQ(store.iteration_to_compress_model().count(1), 0);
+  data = reinterpret_cast<const int8_t *>(snapshot.at("w")->addr);
+  EXPECT_EQ(std::vector<int8_t>(data, data + snapshot.at("w")->size), expected);
+}
+}  // namespace server
+}  // namespace fl
+}  // namespace mindspore
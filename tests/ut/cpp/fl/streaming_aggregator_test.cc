@@ -0,0 +1,174 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <algorithm>
+#include <memory>
+#include <thread>
+#include <vector>
+#include "common/common_test.h"
+#include "fl/server/kernel/streaming_aggregator.h"
+#include "fl/server/kernel/fed_avg_kernel.h"
+
+namespace mindspore {
+namespace fl {
+namespace server {
+namespace kernel {
+class TestStreamingAggregator : public UT::Common {
+ public:
+  TestStreamingAggregator() = default;
+  virtual ~TestStreamingAggregator() = default;
+
+  void SetUp() override {}
+  void TearDown() override {}
+
+ protected:
+  static constexpr size_t kUploadNum = 16;
+  static constexpr size_t kThreadNum = 4;
+
+  // The uploaded weights are integers, so the sum doesn't depend on the accumulation order.
+  std::vector<std::vector<float>> GenerateUploads(size_t size) {
+    std::vector<std::vector<float>> uploads(kUploadNum, std::vector<float>(size));
+    for (size_t i = 0; i < kUploadNum; ++i) {
+      for (size_t j = 0; j < size; ++j) {
+        uploads[i][j] = static_cast<float>((i * 7 + j) % 13);
+      }
+    }
+    return uploads;
+  }
+
+  // Sum the uploads one by one like the batch aggregation.
+  std::vector<float> BatchSum(const std::vector<std::vector<float>> &uploads, size_t size) {
+    std::vector<float> sum(size, 0);
+    for (const auto &upload : uploads) {
+      for (size_t j = 0; j < size; ++j) {
+        sum[j] += upload[j];
+      }
+    }
+    return sum;
+  }
+
+  // Accumulate the uploads by several threads concurrently, each thread taking its share of the uploads.
+  template <typename Func>
+  void ConcurrentAccumulate(const std::vector<std::vector<float>> &uploads, const Func &accumulate) {
+    std::vector<std::thread> threads;
+    for (size_t t = 0; t < kThreadNum; ++t) {
+      threads.emplace_back([&uploads, &accumulate, t]() {
+        for (size_t i = t; i < uploads.size(); i += kThreadNum) {
+          EXPECT_TRUE(accumulate(uploads[i]));
+        }
+      });
+    }
+    for (auto &thread : threads) {
+      thread.join();
+    }
+  }
+};
+
+/// Feature: streaming aggregation of the federated learning server.
+/// Description: accumulate the uploads concurrently by the streaming aggregator, for the weights fitting in few chunks
+/// and the weights accumulated by the thread pool, then divide them.
+/// Expectation: the result equals to the batch aggregation of the uploads.
+TEST_F(TestStreamingAggregator, test_streaming_equals_batch) {
+  std::vector<size_t> sizes = {1, 100, kAggregationChunkSize + 1,
+                               kAggregationChunkSize * kParallelAggregationChunkNum + 100};
+  for (auto size : sizes) {
+    auto uploads = GenerateUploads(size);
+    auto expected = BatchSum(uploads, size);
+
+    std::vector<float> weight(size, 0);
+    StreamingAggregator aggregator;
+    aggregator.Init(weight.data(), size);
+    ConcurrentAccumulate(uploads, [&aggregator, size](const std::vector<float> &upload) {
+      return aggregator.Accumulate(upload.data(), size);
+    });
+    EXPECT_EQ(weight, expected);
+
+    aggregator.Divide(static_cast<float>(kUploadNum));
+    for (size_t j = 0; j < size; ++j) {
+      EXPECT_FLOAT_EQ(weight[j], expected[j] / kUploadNum);
+    }
+  }
+}
+
+/// Feature: streaming aggregation of the federated learning server.
+/// Description: accumulate an upload whose size differs from the aggregated weight.
+/// Expectation: the accumulation fails and the weight is unchanged.
+TEST_F(TestStreamingAggregator, test_size_mismatch) {
+  std::vector<float> weight(10, 1);
+  std::vector<float> upload(11, 1);
+  StreamingAggregator aggregator;
+  aggregator.Init(weight.data(), weight.size());
+  EXPECT_FALSE(aggregator.Accumulate(upload.data(), upload.size()));
+  EXPECT_EQ(weight, std::vector<float>(10, 1));
+}
+
+/// Feature: streaming aggregation of the federated average kernel.
+/// Description: accumulate the uploads through the streaming path of one FedAvgKernel concurrently, and launch another
+/// FedAvgKernel with the same uploads one by one like the batch path.
+/// Expectation: both kernels get the same weight and data size, and the reset clears them.
+TEST_F(TestStreamingAggregator, test_fed_avg_streaming_equals_batch) {
+  constexpr size_t kSize = kAggregationChunkSize * kParallelAggregationChunkNum + 100;
+  constexpr size_t kDataSize = 3;
+  auto uploads = GenerateUploads(kSize);
+
+  std::vector<float> stream_weight(kSize, 0);
+  std::vector<float> batch_weight(kSize, 0);
+  size_t stream_data_size = 0;
+  size_t batch_data_size = 0;
+  std::vector<float> new_weight(kSize, 0);
+  size_t new_data_size = 0;
+  auto make_inputs = [&new_weight, &new_data_size](std::vector<float> *weight, size_t *data_size) {
+    return std::vector<AddressPtr>{
+      std::make_shared<Address>(weight->data(), weight->size() * sizeof(float)),
+      std::make_shared<Address>(data_size, sizeof(size_t)),
+      std::make_shared<Address>(new_weight.data(), new_weight.size() * sizeof(float)),
+      std::make_shared<Address>(&new_data_size, sizeof(size_t))};
+  };
+  auto stream_inputs = make_inputs(&stream_weight, &stream_data_size);
+  auto batch_inputs = make_inputs(&batch_weight, &batch_data_size);
+
+  FedAvgKernel<float, size_t> stream_kernel;
+  FedAvgKernel<float, size_t> batch_kernel;
+  stream_kernel.SetParameterAddress(stream_inputs, {}, {});
+  batch_kernel.SetParameterAddress(batch_inputs, {}, {});
+  ASSERT_TRUE(stream_kernel.SupportStreaming());
+
+  ConcurrentAccumulate(uploads, [&stream_kernel, kDataSize](const std::vector<float> &upload) {
+    size_t data_size = kDataSize;
+    UploadData upload_data = {
+      {kNewWeight, {const_cast<float *>(upload.data()), upload.size() * sizeof(float)}},
+      {kNewDataSize, {&data_size, sizeof(size_t)}}};
+    return stream_kernel.Accumulate(upload_data);
+  });
+  for (const auto &upload : uploads) {
+    std::copy(upload.begin(), upload.end(), new_weight.begin());
+    new_data_size = kDataSize;
+    ASSERT_TRUE(batch_kernel.Launch(batch_inputs, {}, {}));
+  }
+
+  EXPECT_EQ(stream_weight, batch_weight);
+  EXPECT_EQ(stream_weight, BatchSum(uploads, kSize));
+  EXPECT_EQ(stream_data_size, kUploadNum * kDataSize);
+  EXPECT_EQ(batch_data_size, kUploadNum * kDataSize);
+
+  stream_kernel.Reset();
+  EXPECT_EQ(stream_weight, std::vector<float>(kSize, 0));
+  EXPECT_EQ(stream_data_size, static_cast<size_t>(0));
+}
+}  // namespace kernel
+}  // namespace server
+}  // namespace fl
+}  // namespace mindspore
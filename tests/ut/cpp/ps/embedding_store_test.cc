@@ -0,0 +1,129 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <dirent.h>
+#include <cstdio>
+#include <string>
+#include <vector>
+#include "common/common_test.h"
+#include "ps/embedding_store.h"
+
+namespace mindspore {
+namespace ps {
+class TestEmbeddingStore : public UT::Common {
+ public:
+  TestEmbeddingStore() = default;
+  virtual ~TestEmbeddingStore() = default;
+
+  void SetUp() override {}
+  void TearDown() override { (void)std::remove(kStoragePath.c_str()); }
+
+ protected:
+  const std::string kStoragePath = "./embedding_store_test";
+  // One block holds 64 rows of 1024 floats.
+  static constexpr size_t kRowSize = 1024;
+  static constexpr size_t kRowNum = 1024;
+  static constexpr size_t kRowsPerBlock = kEmbeddingBlockSize / (kRowSize * sizeof(float));
+
+  size_t BlockFileNum() const {
+    size_t file_num = 0;
+    DIR *dir = opendir(kStoragePath.c_str());
+    if (dir == nullptr) {
+      return 0;
+    }
+    for (auto entry = readdir(dir); entry != nullptr; entry = readdir(dir)) {
+      if (std::string(entry->d_name).find(".bin") != std::string::npos) {
+        ++file_num;
+      }
+    }
+    (void)closedir(dir);
+    return file_num;
+  }
+};
+
+/// Feature: Embedding table stored on disk for parameter server.
+/// Description: Write the rows of the table and the optimizer state, prefetch more blocks than the cache size.
+/// Expectation: The cached blocks are bounded by the cache size and the rows are kept after dropped from memory.
+TEST_F(TestEmbeddingStore, test_prefetch_and_evict) {
+  constexpr size_t kCacheBlockNum = 4;
+  auto store = std::make_shared<EmbeddingStore>(kStoragePath, 0, kRowNum, kRowSize,
+                                                kCacheBlockNum * kEmbeddingBlockSize * 2);
+  TieredWeight weight(store, kRowNum * kRowSize);
+  float *table = weight.data();
+  float *state = store->AllocSlot();
+  ASSERT_NE(table, nullptr);
+  ASSERT_NE(state, nullptr);
+  EXPECT_EQ(weight.size(), kRowNum * kRowSize);
+  EXPECT_EQ(state[kRowNum * kRowSize - 1], 0);
+
+  for (size_t i = 0; i < kRowNum * kRowSize; ++i) {
+    table[i] = static_cast<float>(i);
+    state[i] = static_cast<float>(i) * 2;
+  }
+  store->Release();
+  EXPECT_EQ(store->cached_block_num(), 0);
+
+  // Look up one row of every block, and the ids out of range are ignored.
+  std::vector<int> ids;
+  for (size_t row = 0; row < kRowNum; row += kRowsPerBlock) {
+    ids.push_back(static_cast<int>(row));
+    store->Prefetch(ids.data() + ids.size() - 1, 1);
+    EXPECT_LE(store->cached_block_num(), kCacheBlockNum);
+  }
+  ids.push_back(-1);
+  ids.push_back(static_cast<int>(kRowNum));
+  // The blocks of one batch are kept even if they exceed the cache size.
+  store->Prefetch(ids.data(), ids.size());
+  EXPECT_EQ(store->cached_block_num(), kRowNum / kRowsPerBlock);
+  store->Prefetch(ids.data(), 1);
+  EXPECT_EQ(store->cached_block_num(), kCacheBlockNum);
+
+  for (size_t i = 0; i < kRowNum * kRowSize; i += kRowSize + 1) {
+    EXPECT_EQ(table[i], static_cast<float>(i));
+    EXPECT_EQ(state[i], static_cast<float>(i) * 2);
+  }
+}
+
+/// Feature: Embedding table stored on disk for parameter server.
+/// Description: Two stores of the same key share one storage directory, and one of them is destroyed.
+/// Expectation: The stores use their own block files, and the files of the other store are kept.
+TEST_F(TestEmbeddingStore, test_stores_share_directory) {
+  constexpr size_t kSmallRowNum = 16;
+  auto first_store = std::make_shared<EmbeddingStore>(kStoragePath, 0, kSmallRowNum, kRowSize, kEmbeddingBlockSize);
+  auto second_store = std::make_shared<EmbeddingStore>(kStoragePath, 0, kSmallRowNum, kRowSize, kEmbeddingBlockSize);
+  float *first_table = first_store->AllocSlot();
+  float *second_table = second_store->AllocSlot();
+  ASSERT_NE(first_table, nullptr);
+  ASSERT_NE(second_table, nullptr);
+  EXPECT_EQ(BlockFileNum(), 2);
+  for (size_t i = 0; i < kSmallRowNum * kRowSize; ++i) {
+    first_table[i] = 1;
+    second_table[i] = 2;
+  }
+  second_store->Release();
+
+  first_store = nullptr;
+  EXPECT_EQ(BlockFileNum(), 1);
+  std::vector<int> ids = {0, static_cast<int>(kSmallRowNum - 1)};
+  second_store->Prefetch(ids.data(), ids.size());
+  for (size_t i = 0; i < kSmallRowNum * kRowSize; ++i) {
+    ASSERT_EQ(second_table[i], 2);
+  }
+  second_store = nullptr;
+  EXPECT_EQ(BlockFileNum(), 0);
+}
+}  // namespace ps
+}  // namespace mindspore
@@ -0,0 +1,119 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include "common/common_test.h"
+#include "ps/parameter_server.h"
+#include "ps/weight_clock.h"
+
+namespace mindspore {
+namespace ps {
+class TestParameterServerPull : public UT::Common {
+ public:
+  TestParameterServerPull() = default;
+  virtual ~TestParameterServerPull() = default;
+
+  void SetUp() override {}
+  void TearDown() override {}
+};
+
+/// Feature: Pull of parameter server.
+/// Description: Workers push and pull one key concurrently in the bounded staleness mode, while the update thread
+/// applies the gradients to the weight in the key mutex as soon as they arrive.
+/// Expectation: Every pulled weight is the weight of one whole update, and includes the gradients of the worker.
+TEST_F(TestParameterServerPull, test_concurrent_push_pull_copy) {
+  constexpr Key kKey = 0;
+  constexpr size_t kWorkerNum = 4;
+  constexpr size_t kRoundNum = 100;
+  constexpr size_t kWeightSize = 4096;
+  constexpr uint64_t kStalenessBound = 2;
+  WeightClock clock(kWorkerNum, kStalenessBound);
+  clock.AddWeight(kKey);
+  std::mutex key_mutex;
+  auto weight = std::make_shared<Weight>(std::make_shared<std::vector<float>>(kWeightSize, 0.0f));
+
+  // Every element of the weight is the number of gradients applied, which is written element by element like the
+  // optimizer does.
+  std::thread update_thread([&]() {
+    while (clock.WaitForUpdate()) {
+      {
+        std::unique_lock<std::mutex> key_lock(key_mutex);
+        size_t grad_num = clock.GradNumToApply(kKey);
+        if (grad_num > 0) {
+          float *data = weight->data();
+          for (size_t i = 0; i < kWeightSize; ++i) {
+            data[i] += static_cast<float>(grad_num);
+            if (i == kWeightSize / 2) {
+              std::this_thread::yield();
+            }
+          }
+          clock.Applied(kKey, true);
+        }
+      }
+      clock.FinishUpdate();
+    }
+  });
+
+  std::atomic<size_t> inconsistent_num{0};
+  std::atomic<size_t> stale_num{0};
+  std::vector<std::thread> workers;
+  for (uint32_t rank_id = 0; rank_id < kWorkerNum; ++rank_id) {
+    workers.emplace_back([&, rank_id]() {
+      for (size_t round = 0; round < kRoundNum; ++round) {
+        while (!clock.ReadyForPush(kKey, rank_id)) {
+          std::this_thread::yield();
+        }
+        {
+          // The gradients are accumulated in the key mutex.
+          std::unique_lock<std::mutex> key_lock(key_mutex);
+          clock.Push(kKey, rank_id, true);
+        }
+        while (!clock.ReadyForPull(kKey, rank_id)) {
+          std::this_thread::yield();
+        }
+        KVMessage res;
+        ParameterServer::CopyWeight(weight, &key_mutex, &res);
+        clock.Pull(kKey);
+        ASSERT_EQ(static_cast<size_t>(res.values_size()), kWeightSize);
+        float first = res.values(0);
+        for (int i = 1; i < res.values_size(); ++i) {
+          if (res.values(i) != first) {
+            ++inconsistent_num;
+            break;
+          }
+        }
+        if (first < static_cast<float>(round + 1)) {
+          ++stale_num;
+        }
+      }
+    });
+  }
+  for (auto &worker : workers) {
+    worker.join();
+  }
+  clock.Stop();
+  update_thread.join();
+  EXPECT_EQ(inconsistent_num.load(), 0u);
+  EXPECT_EQ(stale_num.load(), 0u);
+  EXPECT_EQ(weight->data()[0], static_cast<float>(kWorkerNum * kRoundNum));
+  EXPECT_EQ(weight->data()[kWeightSize - 1], static_cast<float>(kWorkerNum * kRoundNum));
+}
+}  // namespace ps
+}  // namespace mindspore
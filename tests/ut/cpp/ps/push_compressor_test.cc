@@ -0,0 +1,137 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cmath>
+#include <vector>
+#include "common/common_test.h"
+#include "ps/push_compressor.h"
+
+namespace mindspore {
+namespace ps {
+class TestPushCompressor : public UT::Common {
+ public:
+  TestPushCompressor() = default;
+  virtual ~TestPushCompressor() = default;
+
+  void SetUp() override {}
+  void TearDown() override {}
+
+ protected:
+  // The message of one key with the learning rate segment and the gradient segment.
+  KVMessage BuildMessage(const std::vector<float> &grad) {
+    KVMessage message;
+    message.add_keys(kKey);
+    message.add_keys(kKey);
+    message.add_values(kLearningRate);
+    for (auto value : grad) {
+      message.add_values(value);
+    }
+    message.add_len(1);
+    message.add_len(grad.size());
+    return message;
+  }
+
+  std::vector<float> BuildGrad(size_t size) {
+    std::vector<float> grad(size);
+    for (size_t i = 0; i < size; ++i) {
+      grad[i] = std::sin(static_cast<float>(i)) * (i % 7 + 1);
+    }
+    return grad;
+  }
+
+  static constexpr Key kKey = 3;
+  static constexpr float kLearningRate = 0.01;
+  static constexpr size_t kGradSize = 4096;
+};
+
+/// Feature: Gradient compression of parameter server push.
+/// Description: Compress the dense gradient by fp16, bf16 and int8, then decompress it.
+/// Expectation: The small segment isn't compressed, the bytes on wire are reduced and the error is bounded.
+TEST_F(TestPushCompressor, test_cast_compress) {
+  auto grad = BuildGrad(kGradSize);
+  const std::vector<std::pair<PushCompressType, float>> types = {
+    {PUSH_FP16, 1e-2}, {PUSH_BF16, 5e-2}, {PUSH_INT8, 5e-2}};
+  for (const auto &type : types) {
+    PushCompressor compressor(type.first, 0);
+    auto message = BuildMessage(grad);
+    compressor.Compress(kCompressAllSegments, &message);
+    ASSERT_EQ(message.compressed_segments_size(), 1);
+    ASSERT_EQ(message.values_size(), 1);
+
+    Values values;
+    ASSERT_TRUE(PushCompressor::Decompress(message, &values));
+    ASSERT_EQ(values.size(), kGradSize + 1);
+    EXPECT_EQ(values[0], kLearningRate);
+    for (size_t i = 0; i < kGradSize; ++i) {
+      EXPECT_NEAR(values[i + 1], grad[i], std::fabs(grad[i]) * type.second + 5e-2);
+    }
+    auto traffic = compressor.traffic()[kKey];
+    EXPECT_EQ(traffic.push_count, 1);
+    EXPECT_LT(traffic.wire_bytes * 3, traffic.raw_bytes * 2);
+  }
+}
+
+/// Feature: Gradient compression of parameter server push.
+/// Description: Compress the dense gradient by top-k in two pushes.
+/// Expectation: The elements not sent in the first push are sent by the error feedback in the second push.
+TEST_F(TestPushCompressor, test_topk_compress) {
+  constexpr float kRatio = 0.5;
+  PushCompressor compressor(PUSH_TOP_K, kRatio);
+  auto grad = BuildGrad(kGradSize);
+  auto message = BuildMessage(grad);
+  compressor.Compress(kCompressAllSegments, &message);
+  Values first;
+  ASSERT_TRUE(PushCompressor::Decompress(message, &first));
+
+  std::vector<float> zero_grad(kGradSize, 0.0f);
+  message = BuildMessage(zero_grad);
+  compressor.Compress(kCompressAllSegments, &message);
+  Values second;
+  ASSERT_TRUE(PushCompressor::Decompress(message, &second));
+
+  size_t sent_num = 0;
+  for (size_t i = 0; i < kGradSize; ++i) {
+    sent_num += first[i + 1] != 0 ? 1 : 0;
+    EXPECT_FLOAT_EQ(first[i + 1] + second[i + 1], grad[i]);
+  }
+  EXPECT_EQ(sent_num, static_cast<size_t>(kGradSize * kRatio));
+}
+
+/// Feature: Gradient compression of parameter server push.
+/// Description: Compress the sparse gradient by top-k type.
+/// Expectation: Only the gradient segment is compressed by fp16 and the indices segment is kept.
+TEST_F(TestPushCompressor, test_sparse_compress) {
+  PushCompressor compressor(PUSH_TOP_K, 0.1);
+  auto grad = BuildGrad(kGradSize);
+  auto message = BuildMessage(grad);
+  for (size_t i = 0; i < kGradSize; ++i) {
+    message.add_values(static_cast<float>(i));
+  }
+  message.add_keys(kKey);
+  message.add_len(kGradSize);
+  compressor.Compress(1, &message);
+  ASSERT_EQ(message.compressed_segments_size(), 1);
+  EXPECT_EQ(message.compressed_segments(0).type(), PUSH_FP16);
+
+  Values values;
+  ASSERT_TRUE(PushCompressor::Decompress(message, &values));
+  ASSERT_EQ(values.size(), kGradSize * 2 + 1);
+  for (size_t i = 0; i < kGradSize; ++i) {
+    EXPECT_EQ(values[kGradSize + 1 + i], static_cast<float>(i));
+  }
+}
+}  // namespace ps
+}  // namespace mindspore
@@ -0,0 +1,239 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+#include "common/common_test.h"
+#include "ps/weight_clock.h"
+
+namespace mindspore {
+namespace ps {
+class TestWeightClock : public UT::Common {
+ public:
+  TestWeightClock() = default;
+  virtual ~TestWeightClock() = default;
+
+  void SetUp() override {}
+  void TearDown() override {}
+
+ protected:
+  static constexpr size_t kWorkerNum = 4;
+  static constexpr size_t kRoundNum = 50;
+
+  // Every worker pushes the gradients of the keys and pulls the weights in every round like the synchronous worker,
+  // and the update thread applies the gradients. Return the number of updates.
+  size_t RunSyncRounds(WeightClock *clock, const std::vector<Key> &keys) {
+    for (const auto &key : keys) {
+      clock->AddWeight(key);
+      clock->AddGrad(key);
+    }
+    std::atomic<size_t> pushed_num{0};
+    std::atomic<size_t> pulled_num{0};
+    size_t update_num = 0;
+    std::thread update_thread([&]() {
+      while (clock->WaitForUpdate()) {
+        // All the gradients of the round are pushed and no weight is pulled before the update.
+        EXPECT_EQ(pushed_num.load(), (update_num + 1) * kWorkerNum * keys.size());
+        EXPECT_EQ(pulled_num.load(), update_num * kWorkerNum * keys.size());
+        for (const auto &key : keys) {
+          EXPECT_EQ(clock->GradNumToApply(key), kWorkerNum);
+          clock->Applied(key, true);
+        }
+        clock->FinishUpdate();
+        ++update_num;
+      }
+    });
+
+    std::vector<std::thread> workers;
+    for (uint32_t rank_id = 0; rank_id < kWorkerNum; ++rank_id) {
+      workers.emplace_back([&, rank_id]() {
+        for (size_t round = 0; round < kRoundNum; ++round) {
+          for (const auto &key : keys) {
+            while (!clock->ReadyForPush(key, rank_id)) {
+              std::this_thread::yield();
+            }
+            ++pushed_num;
+            clock->Push(key, rank_id, true);
+          }
+          for (const auto &key : keys) {
+            while (!clock->ReadyForPull(key, rank_id)) {
+              std::this_thread::yield();
+            }
+            ++pulled_num;
+            clock->Pull(key);
+          }
+        }
+      });
+    }
+    for (auto &worker : workers) {
+      worker.join();
+    }
+    clock->Stop();
+    update_thread.join();
+    EXPECT_EQ(pushed_num.load(), kRoundNum * kWorkerNum * keys.size());
+    EXPECT_EQ(pulled_num.load(), kRoundNum * kWorkerNum * keys.size());
+    return update_num;
+  }
+};
+
+/// Feature: Weight clock of parameter server.
+/// Description: Several workers push and pull the same key concurrently in the synchronous mode.
+/// Expectation: Every update applies the gradients of all workers, and every worker pulls each updated weight once.
+TEST_F(TestWeightClock, test_sync_push_pull_same_key) {
+  WeightClock clock(kWorkerNum, 0);
+  EXPECT_EQ(RunSyncRounds(&clock, {0}), kRoundNum);
+}
+
+/// Feature: Weight clock of parameter server.
+/// Description: Several workers push and pull different keys concurrently in the synchronous mode.
+/// Expectation: The weights are updated once per round after the gradients of all keys arrive.
+TEST_F(TestWeightClock, test_sync_push_pull_different_keys) {
+  WeightClock clock(kWorkerNum, 0);
+  EXPECT_EQ(RunSyncRounds(&clock, {0, 1, 2}), kRoundNum);
+}
+
+/// Feature: Weight clock of parameter server.
+/// Description: Pull the weight before the gradients are applied in the synchronous mode.
+/// Expectation: The pull waits for the update, and the next push waits for the pulls of all workers.
+TEST_F(TestWeightClock, test_sync_pull_after_update) {
+  constexpr Key kKey = 0;
+  WeightClock clock(2, 0);
+  clock.AddWeight(kKey);
+  clock.AddGrad(kKey);
+  EXPECT_TRUE(clock.ReadyForPush(kKey, 0));
+  clock.Push(kKey, 0, true);
+  EXPECT_FALSE(clock.ReadyForPull(kKey, 0));
+  clock.Push(kKey, 1, true);
+  ASSERT_TRUE(clock.WaitForUpdate());
+  EXPECT_FALSE(clock.ReadyForPush(kKey, 0));
+  clock.Applied(kKey, true);
+  clock.FinishUpdate();
+  EXPECT_TRUE(clock.ReadyForPull(kKey, 0));
+  clock.Pull(kKey);
+  EXPECT_FALSE(clock.ReadyForPush(kKey, 0));
+  clock.Pull(kKey);
+  EXPECT_FALSE(clock.ReadyForPull(kKey, 1));
+  EXPECT_TRUE(clock.ReadyForPush(kKey, 0));
+}
+
+/// Feature: Bounded staleness of parameter server.
+/// Description: The fast worker pushes the gradients of one key while the slow worker doesn't push.
+/// Expectation: The fast worker is blocked at the push of staleness bound + 1, and released after the slow worker
+/// pushes.
+TEST_F(TestWeightClock, test_staleness_push_gating) {
+  constexpr Key kKey = 0;
+  constexpr uint32_t kFastRank = 0;
+  constexpr uint32_t kSlowRank = 1;
+  constexpr uint64_t kStalenessBound = 2;
+  WeightClock clock(2, kStalenessBound);
+  ASSERT_TRUE(clock.EnableBoundedStaleness());
+  clock.AddWeight(kKey);
+  for (uint64_t i = 0; i < kStalenessBound; ++i) {
+    ASSERT_TRUE(clock.ReadyForPush(kKey, kFastRank));
+    clock.Push(kKey, kFastRank, true);
+    // The gradient is pulled back only after it is applied.
+    EXPECT_FALSE(clock.ReadyForPull(kKey, kFastRank));
+    ASSERT_TRUE(clock.WaitForUpdate());
+    EXPECT_EQ(clock.GradNumToApply(kKey), 1);
+    clock.Applied(kKey, true);
+    EXPECT_TRUE(clock.ReadyForPull(kKey, kFastRank));
+  }
+  EXPECT_FALSE(clock.ReadyForPush(kKey, kFastRank));
+  EXPECT_TRUE(clock.ReadyForPush(kKey, kSlowRank));
+
+  clock.Push(kKey, kSlowRank, true);
+  EXPECT_FALSE(clock.ReadyForPull(kKey, kSlowRank));
+  // The fast worker is released once the slow worker pushes, without waiting for the update.
+  EXPECT_TRUE(clock.ReadyForPush(kKey, kFastRank));
+  ASSERT_TRUE(clock.WaitForUpdate());
+  clock.Applied(kKey, true);
+  EXPECT_TRUE(clock.ReadyForPull(kKey, kSlowRank));
+  EXPECT_EQ(clock.GradNumToApply(kKey), 0);
+}
+
+/// Feature: Bounded staleness of parameter server.
+/// Description: The workers push the gradients of one key without the update.
+/// Expectation: The pushes are blocked when the pending gradients fill the gradient buffers of all workers.
+TEST_F(TestWeightClock, test_staleness_pending_grad_limit) {
+  constexpr Key kKey = 0;
+  constexpr size_t kWorkers = 2;
+  WeightClock clock(kWorkers, kRoundNum);
+  clock.AddWeight(kKey);
+  for (uint32_t rank_id = 0; rank_id < kWorkers; ++rank_id) {
+    ASSERT_TRUE(clock.ReadyForPush(kKey, rank_id));
+    clock.Push(kKey, rank_id, true);
+  }
+  EXPECT_FALSE(clock.ReadyForPush(kKey, 0));
+  ASSERT_TRUE(clock.WaitForUpdate());
+  EXPECT_EQ(clock.GradNumToApply(kKey), kWorkers);
+  clock.Applied(kKey, true);
+  EXPECT_TRUE(clock.ReadyForPush(kKey, 0));
+}
+
+/// Feature: Bounded staleness of parameter server.
+/// Description: A worker pushes nothing to accumulate.
+/// Expectation: The empty push moves the clock of the worker and is regarded as applied when nothing is pending.
+TEST_F(TestWeightClock, test_staleness_empty_push) {
+  constexpr Key kKey = 0;
+  WeightClock clock(2, 1);
+  clock.AddWeight(kKey);
+  clock.Push(kKey, 0, false);
+  EXPECT_TRUE(clock.ReadyForPull(kKey, 0));
+  EXPECT_FALSE(clock.ReadyForPush(kKey, 0));
+
+  clock.Push(kKey, 1, true);
+  EXPECT_TRUE(clock.ReadyForPush(kKey, 0));
+  clock.Push(kKey, 0, false);
+  // The gradient of the other worker is pending, so the empty push waits for the update.
+  EXPECT_FALSE(clock.ReadyForPull(kKey, 0));
+  ASSERT_TRUE(clock.WaitForUpdate());
+  clock.Applied(kKey, true);
+  EXPECT_TRUE(clock.ReadyForPull(kKey, 0));
+  EXPECT_TRUE(clock.ReadyForPull(kKey, 1));
+}
+
+/// Feature: Bounded staleness of parameter server.
+/// Description: The fast worker waits for the push in a thread while the slow worker advances.
+/// Expectation: The fast worker is blocked until the slow worker pushes, and the stop wakes up the update waiting.
+TEST_F(TestWeightClock, test_staleness_release_fast_worker) {
+  constexpr Key kKey = 0;
+  WeightClock clock(2, 1);
+  clock.AddWeight(kKey);
+  clock.Push(kKey, 0, true);
+  ASSERT_TRUE(clock.WaitForUpdate());
+  clock.Applied(kKey, true);
+
+  std::atomic_bool released{false};
+  std::thread fast_worker([&clock, &released, kKey]() {
+    while (!clock.ReadyForPush(kKey, 0)) {
+      std::this_thread::yield();
+    }
+    released = true;
+  });
+  std::this_thread::sleep_for(std::chrono::milliseconds(10));
+  EXPECT_FALSE(released.load());
+  clock.Push(kKey, 1, false);
+  fast_worker.join();
+  EXPECT_TRUE(released.load());
+
+  std::thread update_thread([&clock]() { EXPECT_FALSE(clock.WaitForUpdate()); });
+  clock.Stop();
+  update_thread.join();
+}
+}  // namespace ps
+}  // namespace mindspore
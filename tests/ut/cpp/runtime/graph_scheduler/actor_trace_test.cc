@@ -0,0 +1,108 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <unistd.h>
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <thread>
+#include "common/common_test.h"
+#include "actor/trace.h"
+
+namespace mindspore {
+namespace {
+constexpr size_t kLongNameLen = 200;
+constexpr size_t kSmallCapacity = 4;
+constexpr size_t kOverwriteEventNum = 10;
+
+size_t CountOf(const std::string &text, const std::string &pattern) {
+  size_t count = 0;
+  for (auto pos = text.find(pattern); pos != std::string::npos; pos = text.find(pattern, pos + pattern.size())) {
+    ++count;
+  }
+  return count;
+}
+}  // namespace
+
+class ActorTraceTest : public UT::Common {
+ public:
+  ActorTraceTest() {}
+
+  void SetUp() override { trace_file_ = "./actor_trace_test_" + std::to_string(getpid()) + ".json"; }
+
+  void TearDown() override {
+    ActorTrace::Disable();
+    ActorTrace::Clear();
+    (void)remove(trace_file_.c_str());
+  }
+
+  std::string ExportTrace() {
+    EXPECT_TRUE(ActorTrace::ExportChromeTrace(trace_file_));
+    std::ifstream ifs(trace_file_);
+    std::stringstream buffer;
+    buffer << ifs.rdbuf();
+    return buffer.str();
+  }
+
+ protected:
+  std::string trace_file_;
+};
+
+/// Feature: actor runtime trace.
+/// Description: record the events with the long name and the json special characters, and export the trace.
+/// Expectation: the names are exported in full and escaped, the events recorded after disabled are dropped.
+TEST_F(ActorTraceTest, ExportFullNames) {
+  ActorTrace::Enable();
+  ActorTrace::Clear();
+  std::string long_name = "kernel_actor_" + std::string(kLongNameLen, 'x');
+  ActorTrace::Record(TraceEventType::kKernelLaunch, long_name, 1000, 3000);
+  ActorTrace::Record(TraceEventType::kActorRun, "actor \"quoted\"", 2000, 2500);
+  {
+    TraceScope trace_scope(TraceEventType::kMemoryAlloc, long_name);
+  }
+  ActorTrace::Disable();
+  ActorTrace::Record(TraceEventType::kActorRun, "disabled_actor", 4000, 5000);
+
+  auto trace = ExportTrace();
+  EXPECT_EQ(CountOf(trace, "\"ph\":\"X\""), 3);
+  EXPECT_EQ(CountOf(trace, "\"name\":\"" + long_name + "\""), 2);
+  EXPECT_EQ(CountOf(trace, "\"name\":\"actor \\\"quoted\\\"\""), 1);
+  EXPECT_EQ(CountOf(trace, "\"cat\":\"kernel_launch\""), 1);
+  EXPECT_EQ(CountOf(trace, "\"cat\":\"memory_alloc\""), 1);
+  EXPECT_EQ(CountOf(trace, "disabled_actor"), 0);
+}
+
+/// Feature: actor runtime trace.
+/// Description: record more events than the ring buffer capacity in a new thread.
+/// Expectation: only the latest events of the thread are exported.
+TEST_F(ActorTraceTest, RingBufferOverwrite) {
+  ActorTrace::Enable(kSmallCapacity);
+  ActorTrace::Clear();
+  std::thread trace_thread([]() {
+    for (size_t i = 0; i < kOverwriteEventNum; ++i) {
+      ActorTrace::Record(TraceEventType::kActorRun, "ring_event_" + std::to_string(i), i, i + 1);
+    }
+  });
+  trace_thread.join();
+
+  auto trace = ExportTrace();
+  EXPECT_EQ(CountOf(trace, "ring_event_"), kSmallCapacity);
+  for (size_t i = kOverwriteEventNum - kSmallCapacity; i < kOverwriteEventNum; ++i) {
+    EXPECT_EQ(CountOf(trace, "\"ring_event_" + std::to_string(i) + "\""), 1);
+  }
+}
+}  // namespace mindspore
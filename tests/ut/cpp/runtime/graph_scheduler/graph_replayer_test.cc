@@ -0,0 +1,100 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "runtime/graph_scheduler/graph_replayer.h"
+#include "runtime/graph_scheduler/device_tensor_store.h"
+#include "runtime/graph_scheduler/host_graph_test_utils.h"
+
+namespace mindspore {
+namespace runtime {
+namespace {
+constexpr size_t kReplaySteps = 4;
+}  // namespace
+
+class GraphReplayerTest : public HostGraphTest {
+ public:
+  GraphReplayerTest() {}
+
+  void SetUp() override {
+    // The replay is decided in the actor set transforming.
+    (void)setenv(kGraphReplayEnableEnv, "1", 1);
+    HostGraphTest::SetUp();
+  }
+
+  void TearDown() override {
+    HostGraphTest::TearDown();
+    (void)unsetenv(kGraphReplayEnableEnv);
+  }
+};
+
+/// Feature: graph replay of the static cpu actor set.
+/// Description: run the steps by the replay after the recording, and run the same inputs by the actors again.
+/// Expectation: the replayed outputs are the same as the outputs of the actors.
+TEST_F(GraphReplayerTest, ReplaySameAsActors) {
+  const auto &graph_replayer = actor_set_->graph_replayer_;
+  ASSERT_NE(graph_replayer, nullptr);
+  std::vector<float> consts{1.0f, 2.0f, 3.0f, 4.0f};
+  std::vector<std::vector<float>> replay_outputs;
+  for (size_t step = 0; step < kReplaySteps; ++step) {
+    auto x = StepInput(step, 1.5f);
+    auto y = StepInput(step, 0.5f);
+    auto output = RunStep(x, y);
+    ASSERT_TRUE(graph_replayer->recorded());
+    for (size_t i = 0; i < kElementNum; ++i) {
+      EXPECT_FLOAT_EQ(output[i], x[i] + consts[i] - y[i]);
+    }
+    (void)replay_outputs.emplace_back(output);
+  }
+
+  for (size_t step = 1; step < kReplaySteps; ++step) {
+    // The invalidated replayer runs the step by the actors and records again.
+    graph_replayer->Invalidate();
+    auto output = RunStep(StepInput(step, 1.5f), StepInput(step, 0.5f));
+    EXPECT_EQ(output, replay_outputs[step]);
+  }
+}
+
+/// Feature: graph replay of the static cpu actor set.
+/// Description: replace the device tensor of const in the device tensor store after the recording.
+/// Expectation: the replay falls back to the actors and the outputs use the new const.
+TEST_F(GraphReplayerTest, FallBackWhenStoreChanges) {
+  const auto &graph_replayer = actor_set_->graph_replayer_;
+  ASSERT_NE(graph_replayer, nullptr);
+  auto x = StepInput(0, 1.0f);
+  auto y = StepInput(1, 1.0f);
+  (void)RunStep(x, y);
+  ASSERT_TRUE(graph_replayer->recorded());
+
+  std::vector<float> new_consts{10.0f, 20.0f, 30.0f, 40.0f};
+  auto new_device_tensor = device_context_->device_res_manager_->CreateDeviceAddress(
+    nullptr, kDataSize, kOpFormat_DEFAULT, kNumberTypeFloat32, kShape);
+  ASSERT_TRUE(device_context_->device_res_manager_->AllocateMemory(new_device_tensor.get()));
+  (void)memcpy(new_device_tensor->GetMutablePtr(), new_consts.data(), kDataSize);
+  DeviceTensorStore::GetInstance().Insert(const_node_.get(), new_device_tensor);
+
+  auto output = RunStep(x, y);
+  for (size_t i = 0; i < kElementNum; ++i) {
+    EXPECT_FLOAT_EQ(output[i], x[i] + new_consts[i] - y[i]);
+  }
+  // The replay is recorded again with the new const.
+  ASSERT_TRUE(graph_replayer->recorded());
+  output = RunStep(y, x);
+  for (size_t i = 0; i < kElementNum; ++i) {
+    EXPECT_FLOAT_EQ(output[i], y[i] + new_consts[i] - x[i]);
+  }
+}
+}  // namespace runtime
+}  // namespace mindspore
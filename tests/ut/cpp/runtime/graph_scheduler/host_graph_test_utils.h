@@ -0,0 +1,314 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef TESTS_UT_CPP_RUNTIME_GRAPH_SCHEDULER_HOST_GRAPH_TEST_UTILS_H_
+#define TESTS_UT_CPP_RUNTIME_GRAPH_SCHEDULER_HOST_GRAPH_TEST_UTILS_H_
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+#include "common/common_test.h"
+#include "abstract/abstract_function.h"
+#include "runtime/graph_scheduler/graph_scheduler.h"
+#include "runtime/hardware/device_context.h"
+#include "include/common/utils/anfalgo.h"
+#include "kernel/kernel.h"
+
+namespace mindspore {
+namespace runtime {
+using KernelGraph = session::KernelGraph;
+using DeviceContextKey = device::DeviceContextKey;
+using DeviceAddress = device::DeviceAddress;
+using DeviceAddressPtr = device::DeviceAddressPtr;
+using DeviceType = device::DeviceType;
+using AddressPtr = kernel::AddressPtr;
+
+// The graph of host device context runs the kernels in the host memory, which tests the actor runtime without devices.
+constexpr size_t kElementNum = 4;
+constexpr size_t kDataSize = kElementNum * sizeof(float);
+const std::vector<int64_t> kShape{2, 2};
+
+// The gate counts the copies from host and can hold the next copy, which keeps the actor of a step running.
+class HostCopyGate {
+ public:
+  static HostCopyGate &GetInstance() {
+    static HostCopyGate instance;
+    return instance;
+  }
+
+  void BlockNextCopy() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    block_next_ = true;
+    blocked_ = false;
+  }
+  bool WaitBlocked() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    return cond_var_.wait_for(lock, kWaitTime, [this]() { return blocked_; });
+  }
+  void Release() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    blocked_ = false;
+    cond_var_.notify_all();
+  }
+  size_t copy_count() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return copy_count_;
+  }
+  bool WaitCopyCount(size_t copy_count) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    return cond_var_.wait_for(lock, kWaitTime, [this, copy_count]() { return copy_count_ >= copy_count; });
+  }
+
+  void BeforeCopy() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    if (!block_next_) {
+      return;
+    }
+    block_next_ = false;
+    blocked_ = true;
+    cond_var_.notify_all();
+    cond_var_.wait(lock, [this]() { return !blocked_; });
+  }
+  void AfterCopy() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    ++copy_count_;
+    cond_var_.notify_all();
+  }
+
+ private:
+  HostCopyGate() = default;
+  static constexpr std::chrono::seconds kWaitTime{10};
+  std::mutex mutex_;
+  std::condition_variable cond_var_;
+  size_t copy_count_{0};
+  bool block_next_{false};
+  bool blocked_{false};
+};
+
+// The device address in the host memory, which is copied like the cpu device.
+class HostDeviceAddress : public DeviceAddress {
+ public:
+  HostDeviceAddress(void *ptr, size_t size, const std::string &format, TypeId type_id)
+      : DeviceAddress(ptr, size, format, type_id) {}
+  ~HostDeviceAddress() override = default;
+  bool SyncDeviceToHost(const ShapeVector &shape, size_t size, TypeId type, void *host_ptr) const override {
+    if ((ptr_ == nullptr) || (host_ptr == nullptr) || (size > size_)) {
+      return false;
+    }
+    (void)memcpy(host_ptr, ptr_, size);
+    return true;
+  }
+  bool SyncHostToDevice(const ShapeVector &shape, size_t size, TypeId type, const void *host_ptr,
+                        const std::string &format) const override {
+    if ((ptr_ == nullptr) || (host_ptr == nullptr) || (size > size_)) {
+      return false;
+    }
+    HostCopyGate::GetInstance().BeforeCopy();
+    (void)memcpy(ptr_, host_ptr, size);
+    HostCopyGate::GetInstance().AfterCopy();
+    return true;
+  }
+  void ClearDeviceMemory() override {}
+  DeviceType GetDeviceType() const override { return DeviceType::kCPU; }
+};
+
+class HostKernelMod : public kernel::KernelMod {
+ public:
+  HostKernelMod() = default;
+  ~HostKernelMod() override = default;
+  bool Launch(const std::vector<AddressPtr> &inputs, const std::vector<AddressPtr> &workspace,
+              const std::vector<AddressPtr> &outputs, void *stream_ptr) override {
+    return true;
+  }
+};
+
+class HostDeviceResManager : public device::DeviceResManager {
+ public:
+  HostDeviceResManager() = default;
+  ~HostDeviceResManager() override = default;
+
+  void *AllocateMemory(size_t size) const override {
+    if (throw_allocations_ > 0) {
+      --throw_allocations_;
+      MS_LOG(EXCEPTION) << "Injected allocation failure, size: " << size;
+    }
+    return malloc(size);
+  }
+  void FreeMemory(void *const ptr) const override { free(ptr); }
+  DeviceAddressPtr CreateDeviceAddress(void *const device_ptr, size_t device_size, const string &format,
+                                       TypeId type_id, const ShapeVector &shape) const override {
+    return std::make_shared<HostDeviceAddress>(device_ptr, device_size, format, type_id);
+  }
+  // The next allocations throw the exception, which tests the failure in the actor threads.
+  void set_throw_allocations(size_t throw_allocations) const { throw_allocations_ = throw_allocations; }
+
+ private:
+  mutable std::atomic<size_t> throw_allocations_{0};
+};
+
+// The kernel executor computes the element wise add and sub of float32 in the launch.
+class HostKernelExecutor : public device::KernelExecutor {
+ public:
+  HostKernelExecutor() = default;
+  ~HostKernelExecutor() override = default;
+  void CreateKernel(const std::vector<CNodePtr> &nodes) const override {
+    for (const auto &node : nodes) {
+      MS_EXCEPTION_IF_NULL(node);
+      auto kernel_info = std::make_shared<device::KernelInfo>();
+      std::shared_ptr<KernelBuildInfoBuilder> builder = std::make_shared<KernelBuildInfoBuilder>();
+      builder->SetInputsFormat({kOpFormat_DEFAULT, kOpFormat_DEFAULT});
+      builder->SetInputsDeviceType({kNumberTypeFloat32, kNumberTypeFloat32});
+      builder->SetOutputsFormat({kOpFormat_DEFAULT});
+      builder->SetOutputsDeviceType({kNumberTypeFloat32});
+      kernel_info->set_select_kernel_build_info(builder->Build());
+      node->set_kernel_info(kernel_info);
+      auto kernel_mod_ptr = std::make_shared<HostKernelMod>();
+      kernel_mod_ptr->SetInputSizeList({kDataSize, kDataSize});
+      kernel_mod_ptr->SetOutputSizeList({kDataSize});
+      AnfAlgo::SetKernelMod(kernel_mod_ptr, node.get());
+    }
+  }
+  bool LaunchKernel(const CNodePtr &kernel, const std::vector<AddressPtr> &inputs,
+                    const std::vector<AddressPtr> &workspace, const std::vector<AddressPtr> &outputs) const override {
+    if ((inputs.size() != 2) || (outputs.size() != 1)) {
+      return false;
+    }
+    auto input0 = static_cast<float *>(inputs[0]->addr);
+    auto input1 = static_cast<float *>(inputs[1]->addr);
+    auto output = static_cast<float *>(outputs[0]->addr);
+    if ((input0 == nullptr) || (input1 == nullptr) || (output == nullptr)) {
+      return false;
+    }
+    bool is_add = (common::AnfAlgo::GetCNodeName(kernel) == prim::kPrimAdd->name());
+    for (size_t i = 0; i < kElementNum; ++i) {
+      output[i] = is_add ? (input0[i] + input1[i]) : (input0[i] - input1[i]);
+    }
+    return true;
+  }
+};
+
+class HostDeviceContext : public device::DeviceInterface<HostKernelExecutor, HostDeviceResManager> {
+ public:
+  explicit HostDeviceContext(const DeviceContextKey &device_context_key) : DeviceInterface(device_context_key) {}
+  ~HostDeviceContext() override = default;
+
+  void Initialize() override {}
+  DeviceType GetDeviceType() const override { return DeviceType::kCPU; }
+  device::RunMode GetRunMode(const FuncGraphPtr &func_graph) const override { return device::RunMode::kKernelMode; }
+};
+
+class HostGraphTest : public UT::Common {
+ public:
+  HostGraphTest() {}
+
+  void SetUp() override {
+    DeviceContextKey device_context_key{"CPU", 0};
+    device_context_ = std::make_shared<HostDeviceContext>(device_context_key);
+    BuildActorSet();
+  }
+
+  void TearDown() override {
+    GraphScheduler::GetInstance().Clear(graph_compiler_info_->name_, graph_compiler_info_->graphs_,
+                                        graph_compiler_info_->origin_parameters_order_,
+                                        graph_compiler_info_->control_node_parser_);
+    actor_set_ = nullptr;
+    graph_compiler_info_ = nullptr;
+  }
+
+  // The graph computes (x + c) - y, the const c is in the device tensor store.
+  void BuildActorSet() {
+    auto func_graph = std::make_shared<FuncGraph>();
+    auto parameter_x = func_graph->add_parameter();
+    parameter_x->set_abstract(std::make_shared<abstract::AbstractTensor>(kFloat32, kShape));
+    auto parameter_y = func_graph->add_parameter();
+    parameter_y->set_abstract(std::make_shared<abstract::AbstractTensor>(kFloat32, kShape));
+    auto const_tensor = CreateTensor({1.0f, 2.0f, 3.0f, 4.0f});
+    const_node_ = NewValueNode(const_tensor);
+    const_node_->set_abstract(const_tensor->ToAbstract());
+
+    auto add_node = func_graph->NewCNode({NewValueNode(prim::kPrimAdd), parameter_x, const_node_});
+    add_node->set_abstract(std::make_shared<abstract::AbstractTensor>(kFloat32, kShape));
+    auto sub_node = func_graph->NewCNode({NewValueNode(prim::kPrimSub), add_node, parameter_y});
+    sub_node->set_abstract(std::make_shared<abstract::AbstractTensor>(kFloat32, kShape));
+    func_graph->set_return(func_graph->NewCNode({NewValueNode(prim::kPrimReturn), sub_node}));
+
+    std::vector<AnfNodePtr> nodes{add_node, sub_node};
+    auto segment = std::make_shared<GraphSegment>(nodes, false);
+    compiler_ = std::make_shared<GraphCompiler>();
+    auto graph_id = compiler_->CompileGraph(segment, {sub_node}, device_context_.get(), device::RunMode::kKernelMode);
+    const auto &kernel_graph = compiler_->Fetch(graph_id);
+    ASSERT_NE(kernel_graph, nullptr);
+
+    KernelMapPosition outputs_order;
+    outputs_order[{sub_node, 0}] = {0};
+    graph_compiler_info_ = std::make_unique<GraphCompilerInfo>(
+      std::vector<KernelGraphPtr>{kernel_graph}, std::vector<DeviceContext *>{device_context_.get()},
+      std::vector<std::vector<int64_t> *>{&tensors_mask_}, std::vector<std::vector<TensorPtr> *>{&input_tensors_},
+      std::vector<AnfNodePtr>{}, func_graph->parameters(), std::make_shared<ControlNodeParser>(), outputs_order, 1,
+      "host_graph_test", false, GraphExecutionStrategy::kPipeline);
+    GraphScheduler::GetInstance().Initialize();
+    actor_set_ = GraphScheduler::GetInstance().Transform(*graph_compiler_info_);
+    ASSERT_NE(actor_set_, nullptr);
+    GraphScheduler::GetInstance().Schedule(actor_set_);
+  }
+
+  static TensorPtr CreateTensor(const std::vector<float> &values) {
+    auto tensor = std::make_shared<tensor::Tensor>(kNumberTypeFloat32, kShape);
+    (void)memcpy(tensor->data_c(), values.data(), kDataSize);
+    return tensor;
+  }
+
+  std::vector<float> RunStep(const std::vector<float> &x, const std::vector<float> &y) {
+    return RunStep({CreateTensor(x), CreateTensor(y)});
+  }
+
+  std::vector<float> RunStep(const std::vector<TensorPtr> &inputs) {
+    std::vector<std::vector<TensorPtr>> input_tensors{inputs};
+    GraphScheduler::GetInstance().Run(actor_set_, {device_context_.get()}, input_tensors);
+    const auto &output = actor_set_->output_actor_->outputs()[0];
+    MS_EXCEPTION_IF_NULL(output);
+    output->data_sync();
+    std::vector<float> result(kElementNum);
+    (void)memcpy(result.data(), output->data_c(), kDataSize);
+    return result;
+  }
+
+  static std::vector<float> StepInput(size_t step, float scale) {
+    std::vector<float> input(kElementNum);
+    for (size_t i = 0; i < kElementNum; ++i) {
+      input[i] = scale * static_cast<float>(step + i);
+    }
+    return input;
+  }
+
+ protected:
+  std::shared_ptr<HostDeviceContext> device_context_;
+  std::shared_ptr<GraphCompiler> compiler_;
+  std::unique_ptr<GraphCompilerInfo> graph_compiler_info_;
+  std::vector<int64_t> tensors_mask_;
+  std::vector<TensorPtr> input_tensors_;
+  ValueNodePtr const_node_;
+  ActorSet *actor_set_{nullptr};
+};
+}  // namespace runtime
+}  // namespace mindspore
+#endif  // TESTS_UT_CPP_RUNTIME_GRAPH_SCHEDULER_HOST_GRAPH_TEST_UTILS_H_
@@ -0,0 +1,148 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <thread>
+#include "runtime/graph_scheduler/host_graph_test_utils.h"
+
+namespace mindspore {
+namespace runtime {
+namespace {
+constexpr size_t kPrefetchSteps = 4;
+constexpr size_t kInputNum = 2;
+}  // namespace
+
+class InputPrefetchTest : public HostGraphTest {
+ public:
+  InputPrefetchTest() {}
+
+  void ExpectOutput(const std::vector<float> &output, const std::vector<float> &x, const std::vector<float> &y) {
+    const std::vector<float> consts{1.0f, 2.0f, 3.0f, 4.0f};
+    ASSERT_EQ(output.size(), kElementNum);
+    for (size_t i = 0; i < kElementNum; ++i) {
+      EXPECT_FLOAT_EQ(output[i], x[i] + consts[i] - y[i]);
+    }
+  }
+};
+
+/// Feature: input prefetch of the host data source actor.
+/// Description: prefetch the inputs of next step and run the next step with the same tensors.
+/// Expectation: the outputs are the same as the steps without the prefetch and the staged inputs are not copied again.
+TEST_F(InputPrefetchTest, RunPrefetchedInputs) {
+  auto &copy_gate = HostCopyGate::GetInstance();
+  ExpectOutput(RunStep(StepInput(0, 1.0f), StepInput(0, 2.0f)), StepInput(0, 1.0f), StepInput(0, 2.0f));
+  for (size_t step = 1; step < kPrefetchSteps; ++step) {
+    auto x = StepInput(step, 1.0f);
+    auto y = StepInput(step, 2.0f);
+    std::vector<TensorPtr> inputs{CreateTensor(x), CreateTensor(y)};
+    auto copy_count = copy_gate.copy_count();
+    GraphScheduler::GetInstance().PrefetchInputs(actor_set_, {inputs});
+    ASSERT_TRUE(copy_gate.WaitCopyCount(copy_count + kInputNum));
+    copy_count = copy_gate.copy_count();
+    ExpectOutput(RunStep(inputs), x, y);
+    EXPECT_EQ(copy_gate.copy_count(), copy_count);
+  }
+}
+
+/// Feature: input prefetch of the host data source actor.
+/// Description: hold the data source actor of step N in its copy and prefetch the inputs of step N + 1.
+/// Expectation: the inputs of step N + 1 are staged while step N is running, and both steps output correctly.
+TEST_F(InputPrefetchTest, StageNextStepWhileStepRuns) {
+  auto &copy_gate = HostCopyGate::GetInstance();
+  // The first step copies the const value, so the blocked copy of later step is the copy of data source actor.
+  ExpectOutput(RunStep(StepInput(0, 1.0f), StepInput(0, 2.0f)), StepInput(0, 1.0f), StepInput(0, 2.0f));
+
+  auto current_x = StepInput(1, 1.0f);
+  auto current_y = StepInput(1, 2.0f);
+  std::vector<float> current_output;
+  copy_gate.BlockNextCopy();
+  std::thread step_thread([this, &current_output, &current_x, &current_y]() {
+    current_output = RunStep(current_x, current_y);
+  });
+  bool blocked = copy_gate.WaitBlocked();
+  auto copy_count = copy_gate.copy_count();
+  auto next_x = StepInput(2, 1.0f);
+  auto next_y = StepInput(2, 2.0f);
+  std::vector<TensorPtr> next_inputs{CreateTensor(next_x), CreateTensor(next_y)};
+  GraphScheduler::GetInstance().PrefetchInputs(actor_set_, {next_inputs});
+  bool staged = copy_gate.WaitCopyCount(copy_count + kInputNum);
+  copy_gate.Release();
+  step_thread.join();
+  ASSERT_TRUE(blocked);
+  ASSERT_TRUE(staged);
+  ExpectOutput(current_output, current_x, current_y);
+
+  copy_count = copy_gate.copy_count();
+  ExpectOutput(RunStep(next_inputs), next_x, next_y);
+  EXPECT_EQ(copy_gate.copy_count(), copy_count);
+}
+
+/// Feature: input prefetch of the host data source actor.
+/// Description: prefetch the inputs of two steps before the first of them runs.
+/// Expectation: the staged inputs of both steps are kept in the two staging buffers and used by the steps.
+TEST_F(InputPrefetchTest, PrefetchTwoSteps) {
+  auto &copy_gate = HostCopyGate::GetInstance();
+  ExpectOutput(RunStep(StepInput(0, 1.0f), StepInput(0, 2.0f)), StepInput(0, 1.0f), StepInput(0, 2.0f));
+  std::vector<std::vector<float>> xs{StepInput(1, 1.0f), StepInput(2, 1.0f)};
+  std::vector<std::vector<float>> ys{StepInput(1, 2.0f), StepInput(2, 2.0f)};
+  std::vector<std::vector<TensorPtr>> inputs;
+  auto copy_count = copy_gate.copy_count();
+  for (size_t i = 0; i < xs.size(); ++i) {
+    inputs.push_back({CreateTensor(xs[i]), CreateTensor(ys[i])});
+    GraphScheduler::GetInstance().PrefetchInputs(actor_set_, {inputs.back()});
+  }
+  ASSERT_TRUE(copy_gate.WaitCopyCount(copy_count + xs.size() * kInputNum));
+  copy_count = copy_gate.copy_count();
+  for (size_t i = 0; i < xs.size(); ++i) {
+    ExpectOutput(RunStep(inputs[i]), xs[i], ys[i]);
+  }
+  EXPECT_EQ(copy_gate.copy_count(), copy_count);
+}
+
+/// Feature: input prefetch of the host data source actor.
+/// Description: replace the data of prefetched tensor before the step runs.
+/// Expectation: the staged data is dropped and the step uses the new data.
+TEST_F(InputPrefetchTest, DropStaleStagedData) {
+  auto &copy_gate = HostCopyGate::GetInstance();
+  auto x = StepInput(1, 1.0f);
+  auto y = StepInput(1, 2.0f);
+  std::vector<TensorPtr> inputs{CreateTensor(x), CreateTensor(y)};
+  auto copy_count = copy_gate.copy_count();
+  GraphScheduler::GetInstance().PrefetchInputs(actor_set_, {inputs});
+  ASSERT_TRUE(copy_gate.WaitCopyCount(copy_count + kInputNum));
+  auto new_x = StepInput(2, 3.0f);
+  (void)inputs[0]->AssignValue(*CreateTensor(new_x));
+  ExpectOutput(RunStep(inputs), new_x, y);
+}
+
+/// Feature: input prefetch of the host data source actor.
+/// Description: the memory allocation of staging throws the exception in the stager actor.
+/// Expectation: the exception is caught and the step copies the inputs as before.
+TEST_F(InputPrefetchTest, StagingExceptionIsCaught) {
+  auto &copy_gate = HostCopyGate::GetInstance();
+  auto x = StepInput(1, 1.0f);
+  auto y = StepInput(1, 2.0f);
+  std::vector<TensorPtr> inputs{CreateTensor(x), CreateTensor(y)};
+  auto res_manager = dynamic_cast<HostDeviceResManager *>(device_context_->device_res_manager_.get());
+  ASSERT_NE(res_manager, nullptr);
+  res_manager->set_throw_allocations(1);
+  auto copy_count = copy_gate.copy_count();
+  GraphScheduler::GetInstance().PrefetchInputs(actor_set_, {inputs});
+  // Only the input whose staging memory is allocated successfully is staged.
+  ASSERT_TRUE(copy_gate.WaitCopyCount(copy_count + 1));
+  ExpectOutput(RunStep(inputs), x, y);
+}
+}  // namespace runtime
+}  // namespace mindspore
@@ -490,6 +490,71 @@ def test_config_bool_type_error():
     config_error_func(ds.config.set_multiprocessing_timeout_interval, True, TypeError, "interval isn't of type int")
 
 
+def test_file_readahead_depth():
+    """
+    Feature: Test the function of get_file_readahead_depth and set_file_readahead_depth.
+    Description: Read the images of ImageFolderDataset ahead with a shuffled sampler.
+    Expectation: The default depth is 0, and the rows read ahead are the same as the rows read without readahead.
+    """
+    saved_config = ds.config.get_file_readahead_depth()
+    assert saved_config == 0
+    config_error_func(ds.config.set_file_readahead_depth, True, TypeError, "depth isn't of type int")
+    config_error_func(ds.config.set_file_readahead_depth, -1, ValueError, "depth is not within the required range")
+
+    image_folder_dir = "../data/dataset/testPK/data"
+    original_seed = ds.config.get_seed()
+    ds.config.set_seed(1)
+    data1 = ds.ImageFolderDataset(image_folder_dir, shuffle=True, num_parallel_workers=2)
+    expected = [(item["image"].tobytes(), int(item["label"]))
+                for item in data1.create_dict_iterator(num_epochs=1, output_numpy=True)]
+
+    ds.config.set_file_readahead_depth(4)
+    assert ds.config.get_file_readahead_depth() == 4
+    try:
+        ds.config.set_seed(1)
+        data2 = ds.ImageFolderDataset(image_folder_dir, shuffle=True, num_parallel_workers=2)
+        actual = [(item["image"].tobytes(), int(item["label"]))
+                  for item in data2.create_dict_iterator(num_epochs=1, output_numpy=True)]
+        assert actual == expected
+    finally:
+        ds.config.set_file_readahead_depth(saved_config)
+        ds.config.set_seed(original_seed)
+
+
+def test_tensor_memory_pool():
+    """
+    Feature: Test the function of get/set_enable_tensor_memory_pool and get/set_tensor_memory_pool_limit.
+    Description: Run the pipeline with the data of the tensors allocated from the tensor memory pool.
+    Expectation: The default setting is disabled without limit, and the rows are the same as the rows without the pool.
+    """
+    saved_enable = ds.config.get_enable_tensor_memory_pool()
+    saved_limit = ds.config.get_tensor_memory_pool_limit()
+    assert saved_enable is False
+    assert saved_limit == 0
+    config_error_func(ds.config.set_enable_tensor_memory_pool, 1, TypeError, "enable must be a boolean dtype")
+    config_error_func(ds.config.set_tensor_memory_pool_limit, True, TypeError, "memory_limit must be of type int")
+    config_error_func(ds.config.set_tensor_memory_pool_limit, -1, ValueError, "Memory limit given is not within")
+
+    def run_pipeline():
+        data = ds.ImageFolderDataset("../data/dataset/testPK/data", shuffle=False, num_samples=20)
+        data = data.map(operations=[vision.Decode(), vision.Resize((64, 64))], input_columns=["image"],
+                        num_parallel_workers=2)
+        data = data.batch(4)
+        return [(item["image"].tobytes(), item["label"].tobytes())
+                for item in data.create_dict_iterator(num_epochs=1, output_numpy=True)]
+
+    expected = run_pipeline()
+    ds.config.set_enable_tensor_memory_pool(True)
+    ds.config.set_tensor_memory_pool_limit(1024 * 1024 * 1024)
+    try:
+        assert ds.config.get_enable_tensor_memory_pool() is True
+        assert ds.config.get_tensor_memory_pool_limit() == 1024 * 1024 * 1024
+        assert run_pipeline() == expected
+    finally:
+        ds.config.set_enable_tensor_memory_pool(saved_enable)
+        ds.config.set_tensor_memory_pool_limit(saved_limit)
+
+
 if __name__ == '__main__':
     test_basic()
     test_get_seed()
@@ -505,3 +570,5 @@ if __name__ == '__main__':
     test_enable_watchdog()
     test_multiprocessing_timeout_interval()
     test_config_bool_type_error()
+    test_file_readahead_depth()
+    test_tensor_memory_pool()
@@ -53,6 +53,31 @@ class DatasetGeneratorLarge:
         return 10
 
 
+class DatasetGeneratorReadOnly:
+    def __init__(self):
+        data = np.array(range(4000))
+        self.dtype = data.dtype
+        self.bytes = [((data + item).tobytes(), (data * 10).tobytes()) for item in range(10)]
+
+    def __getitem__(self, item):
+        # the arrays on the bytes objects are read-only
+        return (np.frombuffer(self.bytes[item][0], dtype=self.dtype),
+                np.frombuffer(self.bytes[item][1], dtype=self.dtype))
+
+    def __len__(self):
+        return 10
+
+
+class DatasetGeneratorError:
+    def __getitem__(self, item):
+        if item == 3:
+            raise ValueError("Invalid item {}".format(item))
+        return (np.array([item]),)
+
+    def __len__(self):
+        return 6
+
+
 class DatasetGeneratorMixed:
     def __init__(self):
         pass
@@ -614,6 +639,42 @@ def test_generator_19():
         i = i + 1
 
 
+def test_generator_20():
+    """
+    Feature: GeneratorDataset
+    Description: Test multiprocessing workers which transfer the rows through shared memory rings for 2 epochs
+    Expectation: The dataset is processed as expected and the error of the source is raised
+    """
+    logger.info("Test multiprocessing workers with shared memory rings.")
+
+    shm_ring_original = ds.config.get_enable_generator_shm_ring()
+    ds.config.set_enable_generator_shm_ring(True)
+
+    data1 = ds.GeneratorDataset(DatasetGeneratorLarge(), ["col0", "col1"], python_multiprocessing=True, shuffle=False,
+                                num_parallel_workers=3)
+    num_epochs = 2
+    iter1 = data1.create_tuple_iterator(num_epochs=num_epochs, output_numpy=True)
+    for _ in range(num_epochs):
+        i = 0
+        for item in iter1:
+            assert len(item) == 2
+            golden = np.array(range(4000)) + i
+            np.testing.assert_array_equal(item[0], golden)
+            golden = np.array(range(4000)) * 10
+            np.testing.assert_array_equal(item[1], golden)
+            i = i + 1
+        assert i == 10
+
+    data2 = ds.GeneratorDataset(DatasetGeneratorError(), ["col0"], python_multiprocessing=True, shuffle=False,
+                                num_parallel_workers=2)
+    with pytest.raises(RuntimeError) as info:
+        for _ in data2.create_tuple_iterator(num_epochs=1, output_numpy=True):
+            pass
+    assert "Invalid item 3" in str(info.value)
+
+    ds.config.set_enable_generator_shm_ring(shm_ring_original)
+
+
 class RandomAccessDataset:
     def __init__(self):
         self.__data = np.random.sample((5, 1))
@@ -674,6 +735,39 @@ def test_generator_20():
     assert dataset_size3 == 10
 
 
+def test_generator_zero_copy():
+    """
+    Feature: GeneratorDataset
+    Description: Test sharing the arrays returned by the source with zero copy on and off, in the main process and in
+        the multiprocessing workers whose rows come through the reused shared memory, for 2 epochs
+    Expectation: The rows kept from the earlier steps are not overwritten by the later rows
+    """
+    logger.info("Test GeneratorDataset with zero copy.")
+
+    zero_copy_original = ds.config.get_generator_zero_copy()
+    mem_original = ds.config.get_enable_shared_mem()
+    ds.config.set_enable_shared_mem(True)
+
+    for zero_copy in [False, True]:
+        ds.config.set_generator_zero_copy(zero_copy)
+        for source in [DatasetGeneratorLarge(), DatasetGeneratorReadOnly()]:
+            for python_multiprocessing in [False, True]:
+                data1 = ds.GeneratorDataset(source, ["col0", "col1"], shuffle=False, num_parallel_workers=2,
+                                            python_multiprocessing=python_multiprocessing)
+                num_epochs = 2
+                iter1 = data1.create_tuple_iterator(num_epochs=num_epochs, output_numpy=True)
+                for _ in range(num_epochs):
+                    # keep all the rows of the epoch before checking them
+                    rows = [item for item in iter1]
+                    assert len(rows) == 10
+                    for i, item in enumerate(rows):
+                        np.testing.assert_array_equal(item[0], np.array(range(4000)) + i)
+                        np.testing.assert_array_equal(item[1], np.array(range(4000)) * 10)
+
+    ds.config.set_generator_zero_copy(zero_copy_original)
+    ds.config.set_enable_shared_mem(mem_original)
+
+
 def test_generator_error_1():
     """
     Feature: GeneratorDataset
@@ -2146,6 +2240,8 @@ if __name__ == "__main__":
     test_generator_17()
     test_generator_18()
     test_generator_19()
+    test_generator_20()
+    test_generator_zero_copy()
     test_generator_error_1()
     test_generator_error_2()
     test_generator_error_3()
@@ -460,6 +460,29 @@ def test_tfrecord_exception():
     assert "map operation: [PyFunc] failed. The corresponding data files" in str(info.value)
 
 
+def test_tfrecord_crc_check():
+    """
+    Feature: TFRecordDataset
+    Description: Test TFRecordDataset with the crc of each record verified
+    Expectation: The output is the same as the output without the crc check
+    """
+    logger.info("test_tfrecord_crc_check")
+    original_crc_check = ds.config.get_enable_tfrecord_crc_check()
+    try:
+        ds.config.set_enable_tfrecord_crc_check(False)
+        data = ds.TFRecordDataset(FILES, SCHEMA_FILE, shuffle=ds.Shuffle.FILES)
+        expected = [item for item in data.create_dict_iterator(num_epochs=1, output_numpy=True)]
+        ds.config.set_enable_tfrecord_crc_check(True)
+        data = ds.TFRecordDataset(FILES, SCHEMA_FILE, shuffle=ds.Shuffle.FILES)
+        result = [item for item in data.create_dict_iterator(num_epochs=1, output_numpy=True)]
+    finally:
+        ds.config.set_enable_tfrecord_crc_check(original_crc_check)
+    assert len(result) == len(expected)
+    for row, expected_row in zip(result, expected):
+        for column in expected_row:
+            np.testing.assert_array_equal(row[column], expected_row[column])
+
+
 if __name__ == '__main__':
     test_tfrecord_shape()
     test_tfrecord_read_all_dataset()
@@ -481,3 +504,4 @@ if __name__ == '__main__':
     test_tf_wrong_schema()
     test_tfrecord_invalid_columns()
     test_tfrecord_exception()
+    test_tfrecord_crc_check()
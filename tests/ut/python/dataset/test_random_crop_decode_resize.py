@@ -86,6 +86,36 @@ def test_random_crop_decode_resize_md5():
     ds.config.set_num_parallel_workers((original_num_parallel_workers))
 
 
+def test_random_crop_decode_resize_scaled_decode():
+    """
+    Feature: RandomCropDecodeResize op
+    Description: Test RandomCropDecodeResize op with scaled_decode, which decodes JPEG at a reduced DCT scale
+    Expectation: Output has the given size and is close to the output of Decode op and RandomResizedCrop op
+    """
+    logger.info("test_random_crop_decode_resize_scaled_decode")
+
+    data1 = ds.TFRecordDataset(DATA_DIR, SCHEMA_DIR, columns_list=["image"], shuffle=False)
+    random_crop_decode_resize_op = vision.RandomCropDecodeResize((64, 128), (1, 1), (0.5, 0.5), scaled_decode=True)
+    data1 = data1.map(operations=random_crop_decode_resize_op, input_columns=["image"])
+
+    data2 = ds.TFRecordDataset(DATA_DIR, SCHEMA_DIR, columns_list=["image"], shuffle=False)
+    data2 = data2.map(operations=vision.Decode(), input_columns=["image"])
+    data2 = data2.map(operations=vision.RandomResizedCrop((64, 128), (1, 1), (0.5, 0.5)), input_columns=["image"])
+
+    num_iter = 0
+    for item1, item2 in zip(data1.create_dict_iterator(num_epochs=1, output_numpy=True),
+                            data2.create_dict_iterator(num_epochs=1, output_numpy=True)):
+        image1 = item1["image"]
+        image2 = item2["image"]
+        assert image1.shape == (64, 128, 3)
+        assert image1.shape == image2.shape
+        mse = diff_mse(image1, image2)
+        logger.info("random_crop_decode_resize_scaled_decode_{}, mse: {}".format(num_iter + 1, mse))
+        assert mse < 1
+        num_iter += 1
+    assert num_iter == 3
+
+
 def test_random_crop_decode_resize_invalid():
     """
     Feature: RandomCropDecodeResize
@@ -100,8 +130,13 @@ def test_random_crop_decode_resize_invalid():
         vision.RandomCropDecodeResize((256, 512), (1, 1), (0.5, 0.5), max_attempts=True)
     assert "not of type (<class 'int'>,)" in str(error_info.value)
 
+    with pytest.raises(TypeError) as error_info:
+        vision.RandomCropDecodeResize((256, 512), (1, 1), (0.5, 0.5), scaled_decode=1)
+    assert "not of type (<class 'bool'>,)" in str(error_info.value)
+
 
 if __name__ == "__main__":
     test_random_crop_decode_resize_op(plot=True)
     test_random_crop_decode_resize_md5()
+    test_random_crop_decode_resize_scaled_decode()
     test_random_crop_decode_resize_invalid()